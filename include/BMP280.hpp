@@ -4,7 +4,7 @@
 #include <stdexcept>
 #include <string>
 #include <cstdint>
-#include <linux/spi/spidev.h>
+#include "SPI_Bus.hpp"
 
 class BMP280 {
 public:
@@ -24,11 +24,7 @@ public:
     float getPressure();
 
 private:
-    int spi_fd;
-    std::string spi_device;
-    uint8_t spi_mode;
-    uint8_t spi_bits;
-    uint32_t spi_speed;
+    SPI_Bus bus;
 
     uint16_t dig_T1;
     int16_t dig_T2, dig_T3;
@@ -41,6 +37,6 @@ private:
     uint8_t read8(uint8_t reg);
     uint16_t read16(uint8_t reg);
     uint32_t read24(uint8_t reg);
+    void readBlock(uint8_t reg, uint8_t *data, size_t length);
     void write8(uint8_t reg, uint8_t value);
-    void spiTransfer(uint8_t *tx, uint8_t *rx, size_t length);
 };
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+// Collects the screen areas changed since the last flush.
+// Overlapping and adjacent rectangles are merged as they arrive, as are
+// rectangles whose union wastes less than the cost of an extra window
+// change, so a flush needs few CASET/RASET/RAMWR sequences. The list has a
+// fixed capacity and never allocates.
+class Damage_Tracker {
+public:
+    struct Rect {
+        int16_t x, y, w, h;
+
+        int32_t area() const { return static_cast<int32_t>(w) * h; }
+        int16_t right() const { return x + w; }    // first column past the rectangle
+        int16_t bottom() const { return y + h; }   // first row past the rectangle
+    };
+
+    static constexpr size_t maxRects = 16;
+    // Pixels worth sending rather than opening another window; a window change
+    // costs five short ioctls and about ten bytes, roughly 64 pixels of data
+    static constexpr int32_t mergeSlack = 64;
+
+    void add(const Rect& rect);
+    void clear() { count_ = 0; }
+
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+    const Rect *begin() const { return rects_.data(); }
+    const Rect *end() const { return rects_.data() + count_; }
+
+private:
+    static Rect unite(const Rect& a, const Rect& b);
+    static bool touches(const Rect& a, const Rect& b);
+    static bool worthMerging(const Rect& a, const Rect& b);
+    void remove(size_t index);
+
+    std::array<Rect, maxRects> rects_;
+    size_t count_ = 0;
+};
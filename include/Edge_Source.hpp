@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <gpiod.hpp>
+
+// Source of signal edges a thread can synchronise to, e.g. the tearing
+// effect output of a display or the alert output of a sensor
+class Edge_Source {
+public:
+    virtual ~Edge_Source() = default;
+
+    // Blocks until the next edge; false on timeout
+    virtual bool wait(std::chrono::nanoseconds timeout) = 0;
+};
+
+// Edges of a GPIO line, through the libgpiod event API; rising ones unless
+// another EVENT_* request type is given. The kernel queues the events that
+// arrive while nobody waits; wait() reads them all first and, by default,
+// drops them, so it always returns on a fresh edge (a TE pulse from a frame
+// ago is useless). With dropStale false they count as one edge that already
+// happened, for signals whose changes must not be missed, e.g. ALERT.
+class GPIO_Edge_Source : public Edge_Source {
+public:
+    GPIO_Edge_Source(const std::string& chipName, unsigned int lineNum, const std::string& consumer,
+                     int requestType = gpiod::line_request::EVENT_RISING_EDGE, std::bitset<32> flags = 0,
+                     bool dropStale = true);
+    ~GPIO_Edge_Source() override;
+
+    // Prevent copying
+    GPIO_Edge_Source(const GPIO_Edge_Source&) = delete;
+    GPIO_Edge_Source& operator=(const GPIO_Edge_Source&) = delete;
+
+    bool wait(std::chrono::nanoseconds timeout) override;
+
+private:
+    // Reads the queued events; true if there were any
+    bool drain();
+
+    gpiod::chip chip;
+    gpiod::line line;
+    bool dropStale;
+};
+
+// Edges generated in software, for running without the hardware: a periodic
+// signal (period > 0) and/or edges fired by trigger()
+class Simulated_Edge_Source : public Edge_Source {
+public:
+    explicit Simulated_Edge_Source(std::chrono::nanoseconds period = std::chrono::nanoseconds::zero());
+
+    bool wait(std::chrono::nanoseconds timeout) override;
+    // Fires one edge, waking up a waiting thread
+    void trigger();
+
+    uint64_t edges() const;
+
+private:
+    std::chrono::nanoseconds period;
+    std::chrono::steady_clock::time_point start;
+    mutable std::mutex mutex;
+    std::condition_variable triggered;
+    uint64_t pending;
+    uint64_t count;
+};
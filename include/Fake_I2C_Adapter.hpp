@@ -0,0 +1,226 @@
+#pragma once
+
+#include "I2C_Adapter.hpp"
+#include <array>
+#include <cerrno>
+#include <deque>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <cstring>
+#include <thread>
+
+// Host-side I2C backend with simulated devices.
+// Each device is a bank of 256 registers, 8 or 16 bits wide (16-bit ones are
+// sent MSB first, like the MCP9808). A write message sets the register
+// pointer with its first byte and writes the rest; a read continues from the
+// pointer. Both auto-increment by one register per register width.
+// Every call sleeps for the time the bus would need at clockHz (9 clocks per
+// byte, plus start/stop) and a fixed per-call overhead standing in for the
+// syscall and driver setup, so throughput can be benchmarked on a host.
+// A message to an address without a device fails like a missing ACK, with
+// ENXIO, or the errno given to setNackError() (EREMOTEIO for i2c-bcm2835).
+// failNext() queues faults for the next calls and failReopen() failures of
+// the next recoveries, to exercise the adapter's retry and recovery.
+// I2C_M_NOSTART is supported: such a message continues the previous one.
+// SMBus byte, word and I2C block transactions run as the equivalent
+// messages, and cost the same on the bus; as in the kernel, byte and word
+// transactions carry the PEC byte (9 more clocks), which always matches
+// (failNext(EBADMSG) stands in for a mismatch), and I2C block data never does.
+class Fake_I2C_Adapter : public I2C_Adapter {
+public:
+    explicit Fake_I2C_Adapter(unsigned int clockHz = 100000,
+                              std::chrono::microseconds callOverhead = std::chrono::microseconds(0))
+        : I2C_Adapter("fake", -1), clockHz_(clockHz), callOverhead_(callOverhead) {
+        functionality_ = I2C_FUNC_I2C | I2C_FUNC_NOSTART | I2C_FUNC_SMBUS_BYTE_DATA | I2C_FUNC_SMBUS_WORD_DATA |
+                         I2C_FUNC_SMBUS_I2C_BLOCK | I2C_FUNC_SMBUS_PEC;
+    }
+
+    // Pretend to be an adapter with other capabilities (I2C_FUNC_* bits)
+    void setFunctionality(unsigned long functionality) { functionality_ = functionality; }
+
+    void addDevice(uint8_t address, unsigned int registerWidth = 1) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        devices_[address] = Device{registerWidth == 2 ? 2u : 1u, {}, 0, 0};
+    }
+
+    void setRegister(uint8_t address, uint8_t reg, uint16_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        device(address).registers[reg] = value;
+    }
+
+    uint16_t getRegister(uint8_t address, uint8_t reg) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return device(address).registers[reg];
+    }
+
+    // The next count calls fail with error (errno) before touching the bus,
+    // after the faults already queued
+    void failNext(int error, unsigned int count = 1) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        faults_.insert(faults_.end(), count, error);
+    }
+
+    // The next count reopens fail, as if the device file had gone away
+    void failReopen(unsigned int count = 1) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reopenFaults_ += count;
+    }
+
+    // errno of a missing ACK
+    void setNackError(int error) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        nackError_ = error;
+    }
+
+    // Attempts to reopen the device file, failed ones included
+    unsigned int reopens() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return reopens_;
+    }
+
+    // Simulated time the traffic kept the bus busy, without the call overhead
+    std::chrono::nanoseconds busTime() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return busTime_;
+    }
+
+    // SCL clock cycles of all traffic so far
+    uint64_t busCycles() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return busCycles_;
+    }
+
+protected:
+    void rdwr(struct i2c_msg *messages, size_t count) override {
+        std::chrono::nanoseconds time(0);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!faults_.empty()) {
+                const int error = faults_.front();
+                faults_.pop_front();
+                throw I2C_Error("I2C transfer failed on fake: injected " + std::string(strerror(error)), error);
+            }
+            uint64_t clocks = 1; // stop
+            for (size_t i = 0; i < count; ++i) {
+                if (messages[i].flags & I2C_M_NOSTART) {
+                    clocks += 9 * static_cast<uint64_t>(messages[i].len); // continues the previous message
+                } else {
+                    // start (or repeated start), address byte and payload, 9 clocks per byte
+                    clocks += 1 + 9 * (1 + static_cast<uint64_t>(messages[i].len));
+                }
+                auto found = devices_.find(static_cast<uint8_t>(messages[i].addr));
+                if (found == devices_.end()) {
+                    account(clocks);
+                    throw I2C_Error("I2C transfer failed on fake: no ACK from address " + std::to_string(messages[i].addr), nackError_);
+                }
+                access(found->second, messages[i]);
+            }
+            time = account(clocks);
+        }
+        std::this_thread::sleep_for(callOverhead_ + time);
+    }
+
+    void smbusXfer(uint8_t address, bool pec, uint8_t readWrite, uint8_t command, uint32_t size,
+                   union i2c_smbus_data *data) override {
+        uint16_t length = 0;
+        uint8_t *payload = data->block + 1;
+        switch (size) {
+        case I2C_SMBUS_BYTE_DATA: length = 1; payload = &data->byte; break;
+        case I2C_SMBUS_WORD_DATA: length = 2; break;
+        case I2C_SMBUS_I2C_BLOCK_DATA: length = data->block[0]; break;
+        default:
+            throw I2C_Error("SMBus transfer failed on fake: unsupported transaction", EOPNOTSUPP);
+        }
+        // words are little-endian on the wire
+        uint8_t word[2] = {static_cast<uint8_t>(data->word & 0xFF), static_cast<uint8_t>(data->word >> 8)};
+        if (size == I2C_SMBUS_WORD_DATA) {
+            payload = word;
+        }
+        struct i2c_msg messages[2] = {
+            {address, 0, 1, &command},
+            {address, static_cast<uint16_t>(readWrite == I2C_SMBUS_READ ? I2C_M_RD : I2C_M_NOSTART), length, payload},
+        };
+        rdwr(messages, 2);
+        if (pec && size != I2C_SMBUS_I2C_BLOCK_DATA) {
+            std::chrono::nanoseconds time;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                time = account(9);
+            }
+            std::this_thread::sleep_for(time);
+        }
+        if (size == I2C_SMBUS_WORD_DATA && readWrite == I2C_SMBUS_READ) {
+            data->word = static_cast<uint16_t>(word[0] | (word[1] << 8));
+        }
+    }
+
+    bool reopen() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reopens_++;
+        if (reopenFaults_ > 0) {
+            reopenFaults_--;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    struct Device {
+        unsigned int width;                  // register width in bytes
+        std::array<uint16_t, 256> registers;
+        uint8_t pointer;
+        unsigned int byteIndex;              // byte within the current register
+    };
+
+    std::chrono::nanoseconds account(uint64_t clocks) {
+        auto time = std::chrono::nanoseconds(clocks * 1000000000ull / clockHz_);
+        busCycles_ += clocks;
+        busTime_ += time;
+        return time;
+    }
+
+    Device& device(uint8_t address) {
+        auto found = devices_.find(address);
+        if (found == devices_.end()) {
+            throw std::runtime_error("Fake I2C: no device at address " + std::to_string(address));
+        }
+        return found->second;
+    }
+
+    static void access(Device& dev, struct i2c_msg& message) {
+        size_t i = 0;
+        if (!(message.flags & (I2C_M_RD | I2C_M_NOSTART))) {
+            if (message.len == 0) {
+                return; // quick write, address probe
+            }
+            dev.pointer = message.buf[i++];
+            dev.byteIndex = 0;
+        }
+        for (; i < message.len; ++i) {
+            uint16_t &reg = dev.registers[dev.pointer];
+            unsigned int shift = 8 * (dev.width - 1 - dev.byteIndex);
+            if (message.flags & I2C_M_RD) {
+                message.buf[i] = static_cast<uint8_t>(reg >> shift);
+            } else {
+                reg = static_cast<uint16_t>((reg & ~(0xFF << shift)) | (message.buf[i] << shift));
+            }
+            if (++dev.byteIndex == dev.width) {
+                dev.byteIndex = 0;
+                dev.pointer++;
+            }
+        }
+    }
+
+    unsigned int clockHz_;
+    std::chrono::microseconds callOverhead_;
+    std::mutex mutex_;
+    std::map<uint8_t, Device> devices_;
+    std::chrono::nanoseconds busTime_{0};
+    uint64_t busCycles_ = 0;
+    std::deque<int> faults_;
+    unsigned int reopens_ = 0;
+    unsigned int reopenFaults_ = 0;
+    int nackError_ = ENXIO;
+};
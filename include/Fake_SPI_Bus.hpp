@@ -0,0 +1,32 @@
+#pragma once
+
+#include "SPI_Bus.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// Host-side SPI backend: accepts every message without touching hardware.
+// Traffic is counted by SPI_Bus::submit(), so stats() reports the number of
+// ioctls and bytes the real spidev backend would have issued.
+class Fake_SPI_Bus : public SPI_Bus {
+public:
+    explicit Fake_SPI_Bus(unsigned int speedHz = 30000000, size_t bufferSize = defaultBufferSize)
+        : SPI_Bus({"fake", speedHz, SPI_MODE_3, 8}, bufferSize) {}
+
+    // Longest single message seen, checked against the spidev buffer size
+    size_t longestMessage() const { return longestMessage_; }
+
+protected:
+    void message(struct spi_ioc_transfer *transfers, size_t count) override {
+        size_t length = 0;
+        for (size_t i = 0; i < count; ++i) {
+            length += transfers[i].len;
+        }
+        if (length > maxTransferSize()) {
+            throw std::runtime_error("Fake SPI: message exceeds spidev buffer size");
+        }
+        longestMessage_ = std::max(longestMessage_, length);
+    }
+
+private:
+    size_t longestMessage_ = 0;
+};
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Streaming filters for sensor samples, chained into a Filter_Pipeline.
+// Every stage filters a batch of samples in place, so a thread sampling
+// faster than it publishes runs each stage once per batch instead of once
+// per sample. Stages keep their history in fixed-size rings of contiguous
+// storage, allocated with the stage; the loops over them have a constant
+// trip count and no branches, so the compiler unrolls them, and vectorizes
+// them for integer samples (float sums need -ffast-math to be reordered).
+// T is the sample type, e.g. float, or an integer type for fixed-point
+// samples, which the stages round to the nearest step instead of truncating.
+
+// Quotient rounded to the nearest integer, halves away from zero (divisor > 0)
+template <typename Int>
+constexpr Int roundedDivide(Int dividend, Int divisor) {
+    return dividend >= 0 ? (dividend + divisor / 2) / divisor : -((-dividend + divisor / 2) / divisor);
+}
+
+// Fixed-size ring of the last N samples, oldest overwritten first
+template <typename T, size_t N>
+class Sample_Ring {
+public:
+    static_assert(N > 0, "empty ring");
+
+    Sample_Ring() : data_{}, next_(0), size_(0) {}
+
+    void push(T sample) {
+        data_[next_] = sample;
+        next_ = (next_ + 1 == N) ? 0 : next_ + 1;
+        if (size_ < N) {
+            size_++;
+        }
+    }
+
+    // Until the ring is full, the unused slots hold T{}
+    const std::array<T, N>& data() const { return data_; }
+    size_t size() const { return size_; }
+    static constexpr size_t capacity() { return N; }
+
+    // Samples from the oldest to the newest, at most out.size(); returns the count
+    size_t copy(std::span<T> out) const {
+        const size_t count = out.size() < size_ ? out.size() : size_;
+        size_t index = (next_ + N - count) % N;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = data_[index];
+            index = (index + 1 == N) ? 0 : index + 1;
+        }
+        return count;
+    }
+
+private:
+    std::array<T, N> data_;
+    size_t next_;
+    size_t size_;
+};
+
+template <typename T>
+class Filter_Stage {
+public:
+    virtual ~Filter_Stage() = default;
+
+    // Filters the samples in place, oldest first
+    virtual void process(std::span<T> samples) = 0;
+};
+
+// Mean of the last N samples; until N have arrived, of those there are
+template <typename T, size_t N>
+class Moving_Average : public Filter_Stage<T> {
+public:
+    void process(std::span<T> samples) override {
+        for (T& sample : samples) {
+            ring_.push(sample);
+            // whole-ring sum, constant trip count: no running sum to drift
+            decltype(T() + T()) sum = 0;
+            for (const T& value : ring_.data()) {
+                sum += value;
+            }
+            const auto count = static_cast<decltype(T() + T())>(ring_.size());
+            if constexpr (std::is_integral_v<T>) {
+                sample = static_cast<T>(roundedDivide(sum, count));
+            } else {
+                sample = static_cast<T>(sum / count);
+            }
+        }
+    }
+
+private:
+    Sample_Ring<T, N> ring_;
+};
+
+// Median of the last N samples (N odd), removing single-sample spikes;
+// until N have arrived, the sample passes through
+template <typename T, size_t N>
+class Median : public Filter_Stage<T> {
+public:
+    static_assert(N % 2 == 1, "median of an even count");
+
+    void process(std::span<T> samples) override {
+        for (T& sample : samples) {
+            ring_.push(sample);
+            if (ring_.size() < N) {
+                continue;
+            }
+            // insertion sort of a copy, N is small
+            std::array<T, N> sorted = ring_.data();
+            for (size_t i = 1; i < N; ++i) {
+                const T value = sorted[i];
+                size_t j = i;
+                for (; j > 0 && value < sorted[j - 1]; --j) {
+                    sorted[j] = sorted[j - 1];
+                }
+                sorted[j] = value;
+            }
+            sample = sorted[N / 2];
+        }
+    }
+
+private:
+    Sample_Ring<T, N> ring_;
+};
+
+// Exponential moving average, y += alpha * (x - y); starts at the first sample.
+// Integer samples are averaged in fixed point, with alpha and the state
+// carrying 16 fraction bits, so that steps smaller than one sample unit are
+// not lost and the output does not stall short of a constant input.
+template <typename T>
+class Exponential_Average : public Filter_Stage<T> {
+public:
+    static constexpr int fractionBits = 16;
+
+    explicit Exponential_Average(float alpha)
+        : alpha_(alpha)
+        , alphaFixed_(static_cast<int64_t>(alpha * (1 << fractionBits) + 0.5f))
+        , value_()
+        , state_(0)
+        , started_(false) {}
+
+    void process(std::span<T> samples) override {
+        for (T& sample : samples) {
+            if constexpr (std::is_integral_v<T>) {
+                static_assert(sizeof(T) <= 4, "fixed-point state would overflow");
+                const int64_t input = static_cast<int64_t>(sample) * (int64_t(1) << fractionBits);
+                if (!started_) {
+                    state_ = input;
+                    started_ = true;
+                }
+                state_ += roundedDivide<int64_t>(alphaFixed_ * (input - state_), int64_t(1) << fractionBits);
+                sample = static_cast<T>(roundedDivide<int64_t>(state_, int64_t(1) << fractionBits));
+            } else {
+                if (!started_) {
+                    value_ = sample;
+                    started_ = true;
+                }
+                value_ += static_cast<T>(alpha_ * (sample - value_));
+                sample = value_;
+            }
+        }
+    }
+
+private:
+    float alpha_;
+    int64_t alphaFixed_;     // alpha, integer samples
+    T value_;                // floating-point samples
+    int64_t state_;          // integer samples: the average with fractionBits
+    bool started_;
+};
+
+// Two-state comparator: turns on above the threshold and off only once the
+// value is back at or below threshold - hysteresis, so noise around the
+// threshold does not toggle it
+template <typename T>
+class Hysteresis_Comparator {
+public:
+    explicit Hysteresis_Comparator(T hysteresis) : hysteresis_(hysteresis), state_(false) {}
+
+    bool update(T value, T threshold) {
+        if (state_) {
+            state_ = value > threshold - hysteresis_;
+        } else {
+            state_ = value > threshold;
+        }
+        return state_;
+    }
+
+    bool state() const { return state_; }
+
+private:
+    T hysteresis_;
+    bool state_;
+};
+
+// Chain of stages, with the raw and the filtered series of the last
+// History samples
+template <typename T, size_t History = 64>
+class Filter_Pipeline {
+public:
+    Filter_Pipeline& add(std::unique_ptr<Filter_Stage<T>> stage) {
+        stages_.push_back(std::move(stage));
+        return *this;
+    }
+
+    // Filters the batch in place; returns the last filtered sample
+    T process(std::span<T> samples) {
+        for (const T& sample : samples) {
+            raw_.push(sample);
+        }
+        for (auto& stage : stages_) {
+            stage->process(samples);
+        }
+        for (const T& sample : samples) {
+            filtered_.push(sample);
+        }
+        return samples.empty() ? T() : samples.back();
+    }
+
+    T process(T sample) {
+        return process(std::span<T>(&sample, 1));
+    }
+
+    const Sample_Ring<T, History>& raw() const { return raw_; }
+    const Sample_Ring<T, History>& filtered() const { return filtered_; }
+
+private:
+    std::vector<std::unique_ptr<Filter_Stage<T>>> stages_;
+    Sample_Ring<T, History> raw_;
+    Sample_Ring<T, History> filtered_;
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <bit>
+
+// In-memory RGB565 image of the panel.
+// Pixels are kept in the panel wire order (big-endian), so any contiguous run
+// of the buffer can be streamed to the display without conversion.
+class Framebuffer {
+public:
+    Framebuffer(int16_t width, int16_t height);
+
+    int16_t width() const { return width_; }
+    int16_t height() const { return height_; }
+
+    // Fill a rectangle, the rectangle must lie inside the buffer.
+    // Returns true when any pixel got a new value.
+    bool fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    bool setPixel(int16_t x, int16_t y, uint16_t color) {
+        uint16_t &p = pixels_[index(x, y)];
+        uint16_t wire = toWire(color);
+        bool changed = p != wire;
+        p = wire;
+        return changed;
+    }
+    // Copy a w*h block of wire-order pixels, clipped to the buffer.
+    // Returns true when any pixel got a new value.
+    bool blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels);
+    // Copy a rectangle from another buffer of the same size, clipped to the buffer
+    void copyArea(const Framebuffer& source, int16_t x, int16_t y, int16_t w, int16_t h);
+    uint16_t pixel(int16_t x, int16_t y) const { return toWire(pixels_[index(x, y)]); }
+
+    // Raw access to the wire-order pixels
+    uint16_t *row(int16_t y) { return &pixels_[index(0, y)]; }
+    const uint16_t *row(int16_t y) const { return &pixels_[index(0, y)]; }
+    const uint8_t *data() const { return reinterpret_cast<const uint8_t *>(pixels_.data()); }
+    size_t sizeBytes() const { return pixels_.size() * sizeof(uint16_t); }
+
+    // RGB565 in host order <-> panel order; the conversion is its own inverse
+    static constexpr uint16_t toWire(uint16_t color) {
+        if constexpr (std::endian::native == std::endian::little) {
+            return static_cast<uint16_t>((color << 8) | (color >> 8));
+        } else {
+            return color;
+        }
+    }
+
+private:
+    size_t index(int16_t x, int16_t y) const { return static_cast<size_t>(y) * width_ + x; }
+
+    int16_t width_;
+    int16_t height_;
+    std::vector<uint16_t> pixels_;
+};
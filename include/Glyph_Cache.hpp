@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Cache of glyphs expanded to RGB565 pixels.
+// The font is a 1-bit bitmap, 8 pixels (one byte) per scan line. Each
+// (glyph, foreground, background) combination is expanded once into a span of
+// wire-order pixels, row after row, ready to be copied into a Framebuffer.
+// The cache is direct-mapped with a fixed number of slots; all memory is
+// allocated by the constructor.
+class Glyph_Cache {
+public:
+    static constexpr int16_t width = 8;
+
+    Glyph_Cache(const uint8_t *bitmap, unsigned char firstChar, unsigned char lastChar, int16_t height, size_t slots = 256);
+
+    // Pixels of the glyph, width * height entries; valid until the next get()
+    const uint16_t *get(unsigned char c, uint16_t color, uint16_t bg);
+
+    int16_t height() const { return height_; }
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+
+private:
+    struct Slot {
+        bool valid;
+        unsigned char glyph;
+        uint16_t color;
+        uint16_t bg;
+    };
+
+    void render(unsigned char c, uint16_t color, uint16_t bg, uint16_t *pixels) const;
+
+    const uint8_t *bitmap_;
+    unsigned char firstChar_;
+    unsigned char lastChar_;
+    int16_t height_;
+    std::vector<Slot> slots_;
+    std::vector<uint16_t> pixels_;
+    uint64_t hits_;
+    uint64_t misses_;
+};
@@ -4,15 +4,41 @@
 #include <cstring>
 #include <string>
 #include <array>
-#include <linux/i2c-dev.h>
 #include <linux/i2c.h>
-#include <sys/ioctl.h>
-#include <stdexcept>
-
+#include <memory>
+#include <span>
+#include "I2C_Adapter.hpp"
+#include "I2C_Register_Cache.hpp"
+
+// Handle of one device on an I2C bus. Handles are cheap: the adapter, with
+// its file descriptor, is shared through I2C_Bus_Manager.
+// Register transfers go out as raw I2C_RDWR calls, or as SMBus transactions
+// (byte, word or I2C block data, up to 32 bytes each) when the adapter has
+// no plain I2C, when PEC is on, or when SMBus is preferred; the choice is
+// made per transfer from the adapter functionality.
 class I2CBus {
 public:
+    enum class Transport {
+        I2C,        // I2C_RDWR, SMBus only where the adapter cannot do plain I2C
+        SMBus       // SMBus transactions wherever the adapter has them, e.g. an SMBus controller doing them in hardware
+    };
+
+    // One part of a scatter/gather read: data.size() bytes starting at reg
+    struct Segment {
+        uint8_t reg;
+        std::span<uint8_t> data;
+    };
+
+    // Segments per I2C_RDWR call, two messages each (I2C_RDWR_IOCTL_MAX_MSGS is 42)
+    static constexpr size_t maxSegments = 21;
+
+    // Longest writeBlock() payload copied without a heap allocation on
+    // adapters without I2C_FUNC_NOSTART
+    static constexpr size_t stackWriteBlock = 32;
+
     // Constructor
     I2CBus(const std::string &deviceFile, uint8_t deviceAddress);
+    I2CBus(std::shared_ptr<I2C_Adapter> adapter, uint8_t deviceAddress);
 
     // Destructor
     ~I2CBus();
@@ -29,61 +55,69 @@ public:
     // Read 16-bit value from a register
     uint16_t read16(uint8_t reg);
 
-    // Write a block of data to a register
-    template <size_t N>
-    void writeBlock(uint8_t reg, const std::array<uint8_t, N> &data);
-
-    // Read a block of data from a register
-    template <size_t N>
-    void readBlock(uint8_t reg, std::array<uint8_t, N> &data);
-
-private:
-    int fd_;
-    uint8_t address_;
-};
+    // Read-modify-write: bits in mask are set to bits, the rest is kept.
+    // With the register in the shadow cache this is a single write, or
+    // nothing at all when the value would not change.
+    void update8(uint8_t reg, uint8_t mask, uint8_t bits);
+    void update16(uint8_t reg, uint16_t mask, uint16_t bits);
+
+    // Opt-in register shadow, see I2C_Register_Cache. Reads and writes of
+    // cached registers through read8/16, write8/16 and update8/16 keep it
+    // current; block transfers invalidate the registers they cover.
+    void cacheRegister(uint8_t reg, uint16_t volatileBits = 0, uint16_t volatileWrite = 0) {
+        cache_.cacheRegister(reg, volatileBits, volatileWrite);
+    }
+    I2C_Register_Cache::Stats cacheStats() const { return cache_.stats(); }
 
-template <size_t N>
-void I2CBus::writeBlock(uint8_t reg, const std::array<uint8_t, N> &data) {
-    struct i2c_msg messages[1];
-    std::array<uint8_t, N + 1> buffer;
-    buffer[0] = reg;
-    std::copy(data.begin(), data.end(), buffer.begin() + 1);
+    // Write a block of data to a register, of any length. The register byte
+    // and the payload must go out as one message. The Raspberry Pi controller
+    // (i2c-bcm2835) does not advertise I2C_M_NOSTART, so on the target every
+    // write copies the payload behind the register byte: into a stack buffer
+    // up to stackWriteBlock bytes, into a heap buffer above. Only adapters
+    // with NOSTART send the caller's buffer as a second segment, uncopied.
+    void writeBlock(uint8_t reg, std::span<const uint8_t> data);
 
-    messages[0].addr = address_;
-    messages[0].flags = 0;
-    messages[0].len = buffer.size();
-    messages[0].buf = buffer.data();
+    // Read a block of data from a register
+    void readBlock(uint8_t reg, std::span<uint8_t> data);
 
-    struct i2c_rdwr_ioctl_data ioctlData;
-    ioctlData.msgs = messages;
-    ioctlData.nmsgs = 1;
+    template <size_t N>
+    void writeBlock(uint8_t reg, const std::array<uint8_t, N> &data) {
+        writeBlock(reg, std::span<const uint8_t>(data));
+    }
 
-    if (ioctl(fd_, I2C_RDWR, &ioctlData) < 0) {
-        throw std::runtime_error("Failed to write block of data: " + std::string(strerror(errno)));
+    template <size_t N>
+    void readBlock(uint8_t reg, std::array<uint8_t, N> &data) {
+        readBlock(reg, std::span<uint8_t>(data));
     }
-}
 
-template <size_t N>
-void I2CBus::readBlock(uint8_t reg, std::array<uint8_t, N> &data) {
-    struct i2c_msg messages[2];
-    uint8_t regBuffer = reg;
+    // Scatter/gather read: every segment is a register pointer write and a
+    // read with a repeated start, all in one I2C_RDWR call. More than
+    // maxSegments segments take several calls, with the bus held throughout.
+    void readRegions(std::span<const Segment> segments);
 
-    messages[0].addr = address_;
-    messages[0].flags = 0;
-    messages[0].len = 1;
-    messages[0].buf = &regBuffer;
+    void setTransport(Transport transport) { transport_ = transport; }
+    // Packet error checking on SMBus transactions; all transfers of the
+    // handle then go through SMBus. Throws if the adapter cannot do PEC.
+    // The kernel only checks byte and word transactions, so with PEC on,
+    // transfers of other lengths (e.g. a 7-byte block) throw instead of
+    // going out unchecked as I2C block data.
+    void setPec(bool enable);
+    bool pec() const { return pec_; }
 
-    messages[1].addr = address_;
-    messages[1].flags = I2C_M_RD;
-    messages[1].len = data.size();
-    messages[1].buf = data.data();
+    // Holds the bus for a sequence of calls which must not be interleaved
+    // with other devices, e.g. a read-modify-write
+    std::unique_lock<I2C_Adapter> lock() { return std::unique_lock<I2C_Adapter>(*adapter_); }
 
-    struct i2c_rdwr_ioctl_data ioctlData;
-    ioctlData.msgs = messages;
-    ioctlData.nmsgs = 2;
+    I2C_Adapter& adapter() { return *adapter_; }
+    uint8_t address() const { return address_; }
 
-    if (ioctl(fd_, I2C_RDWR, &ioctlData) < 0) {
-        throw std::runtime_error("Failed to read block of data: " + std::string(strerror(errno)));
-    }
-}
+private:
+    std::shared_ptr<I2C_Adapter> adapter_;
+    uint8_t address_;
+    I2C_Register_Cache &cache_;
+    Transport transport_;
+    bool pec_;
 
+    bool viaSMBus(size_t length, bool read) const;
+    void smbusBlock(uint8_t reg, std::span<uint8_t> data, uint8_t readWrite);
+};
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <string>
+#include <chrono>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <map>
+#include <memory>
+#include <linux/i2c.h>
+#include "I2C_Register_Cache.hpp"
+
+// One /dev/i2c-N adapter, shared by every device handle (I2CBus) on it.
+// The adapter owns the only file descriptor of the process for its bus and
+// arbitrates access with a fair (FIFO) lock: threads are served in the order
+// they asked. A single transfer() takes the lock by itself; a sequence which
+// must not be interleaved with other devices, e.g. a read-modify-write, holds
+// the lock across calls:
+//     std::lock_guard<I2C_Adapter> lock(adapter);
+// The lock is recursive for its owner, so transfer() works while holding it.
+// Besides raw I2C_RDWR transfers the adapter runs single SMBus transactions
+// (I2C_SMBUS), which SMBus-only controllers require and which carry the
+// optional packet error checking (PEC) byte, added and verified by the kernel.
+// Transient failures (EIO, ETIMEDOUT, EAGAIN, EBUSY, and EBADMSG for a PEC
+// mismatch) are retried
+// with a jittered exponential backoff, bounded by a per-call deadline; after
+// a few failures in a row the bus is recovered: the device file is reopened,
+// the register caches are dropped (the device may have been reset) and the
+// recovery hook, if any, runs (e.g. clocking SCL to free a stuck slave).
+// Other errors fail at once, among them a missing ACK: ENXIO, or EREMOTEIO
+// from i2c-bcm2835, which means no device (or one refusing the transfer)
+// and is not cured by repeating it. If the device file could not be
+// reopened, every later call tries again before touching the bus.
+// Host backends override rdwr() and reopen() (see Fake_I2C_Adapter).
+
+// Failed I2C transfer, with the errno of the kernel
+class I2C_Error : public std::runtime_error {
+public:
+    I2C_Error(const std::string& what, int error) : std::runtime_error(what), error_(error) {}
+    int error() const { return error_; }
+
+private:
+    int error_;
+};
+
+class I2C_Adapter {
+public:
+    struct Retry_Policy {
+        unsigned int attempts;                // including the first one
+        std::chrono::microseconds baseDelay;  // backoff before the first retry, doubled after each
+        std::chrono::microseconds maxDelay;
+        std::chrono::microseconds deadline;   // no retry starts later than this after the call
+        unsigned int recoverAfter;            // failures in a row before the bus is recovered
+    };
+
+    static constexpr Retry_Policy defaultRetryPolicy = {
+        4, std::chrono::microseconds(500), std::chrono::microseconds(5000), std::chrono::microseconds(20000), 2
+    };
+
+    // Traffic counters, updated by transfer()
+    struct Stats {
+        uint64_t ioctls;         // I2C_RDWR and I2C_SMBUS calls
+        uint64_t messages;       // i2c_msg segments
+        uint64_t bytes;          // payload bytes, without address bytes
+        uint64_t retries;        // attempts repeated after a transient failure
+        uint64_t recoveries;     // bus recoveries
+    };
+
+    explicit I2C_Adapter(const std::string& path);
+    virtual ~I2C_Adapter();
+
+    // Prevent copying
+    I2C_Adapter(const I2C_Adapter&) = delete;
+    I2C_Adapter& operator=(const I2C_Adapter&) = delete;
+
+    // Send the messages as one I2C_RDWR call (repeated starts between them)
+    void transfer(struct i2c_msg *messages, size_t count);
+    // One SMBus transaction: readWrite is I2C_SMBUS_READ or I2C_SMBUS_WRITE,
+    // size one of I2C_SMBUS_BYTE_DATA, I2C_SMBUS_WORD_DATA,
+    // I2C_SMBUS_I2C_BLOCK_DATA (length in data->block[0]), ...
+    void smbus(uint8_t address, bool pec, uint8_t readWrite, uint8_t command, uint32_t size, union i2c_smbus_data *data);
+
+    void setRetryPolicy(const Retry_Policy& policy);
+    // Runs during bus recovery, after the device file has been reopened
+    void setRecoveryHook(std::function<void()> hook);
+    static bool isTransient(int error);
+
+    // Fair lock, BasicLockable
+    void lock();
+    void unlock();
+
+    // I2C_FUNC_* bits of the adapter, queried once when it is opened
+    unsigned long functionality() const { return functionality_; }
+
+    // Register shadow of the device at address, shared by all its handles
+    I2C_Register_Cache& registerCache(uint8_t address);
+
+    const std::string& path() const { return path_; }
+    Stats stats() const;
+    void resetStats();
+
+protected:
+    // Constructor for backends which do not open a device
+    I2C_Adapter(const std::string& path, int fd);
+
+    virtual void rdwr(struct i2c_msg *messages, size_t count);
+    virtual void smbusXfer(uint8_t address, bool pec, uint8_t readWrite, uint8_t command, uint32_t size, union i2c_smbus_data *data);
+    // Closes and opens the device file again; false if it could not be opened
+    virtual bool reopen();
+
+    int fd_;
+    unsigned long functionality_;
+
+private:
+    template <typename Attempt>
+    void retrying(const struct i2c_msg *messages, size_t count, Attempt attempt);
+    void recover();
+    std::chrono::microseconds backoff(unsigned int retry);
+
+    std::string path_;
+    mutable std::mutex mutex_;
+    std::condition_variable turn_;
+    uint64_t nextTicket_;
+    uint64_t serving_;
+    std::thread::id owner_;
+    unsigned depth_;
+    Stats stats_;
+    std::map<uint8_t, std::unique_ptr<I2C_Register_Cache>> caches_;
+    // used by the lock owner only
+    Retry_Policy policy_;
+    std::function<void()> recoveryHook_;
+    std::minstd_rand jitter_;
+    int slave_;              // I2C_SLAVE address of the descriptor, -1 when not set
+    bool pec_;               // I2C_PEC state of the descriptor
+    bool reopenPending_;     // the last reopen() failed
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include "I2C_Adapter.hpp"
+
+// Asynchronous register access on one I2C adapter.
+// Callers queue reads and writes and get a future (or a callback, run on the
+// worker thread). A single worker thread drains the queue in order: the reads
+// waiting at that moment go out as one I2C_RDWR call, up to the kernel limit
+// of messages per call, and each write as a call of its own. If a merged call
+// fails, its reads are retried one by one, so that each caller gets its own
+// result; a write is never merged, so it is never repeated after it has
+// reached the device. Reads must have no side effects (no clear-on-read
+// registers), as a failed batch reads them again.
+class I2C_Async_Engine {
+public:
+    // I2C_RDWR_IOCTL_MAX_MSGS of the kernel
+    static constexpr size_t maxMessages = 42;
+
+    using Callback = std::function<void(std::vector<uint8_t> data, std::exception_ptr error)>;
+
+    struct Stats {
+        uint64_t requests;       // completed requests
+        uint64_t batches;        // I2C_RDWR calls made by the worker
+        uint64_t retries;        // reads repeated alone after a failed batch
+    };
+
+    explicit I2C_Async_Engine(std::shared_ptr<I2C_Adapter> adapter);
+    // Finishes the queued requests, then stops the worker
+    ~I2C_Async_Engine();
+
+    // Prevent copying
+    I2C_Async_Engine(const I2C_Async_Engine&) = delete;
+    I2C_Async_Engine& operator=(const I2C_Async_Engine&) = delete;
+
+    // Register pointer write followed by a read of length bytes
+    std::future<std::vector<uint8_t>> read(uint8_t address, uint8_t reg, size_t length);
+    void read(uint8_t address, uint8_t reg, size_t length, Callback callback);
+    // Register pointer followed by data, one message
+    std::future<void> write(uint8_t address, uint8_t reg, std::vector<uint8_t> data);
+    void write(uint8_t address, uint8_t reg, std::vector<uint8_t> data, Callback callback);
+
+    Stats stats() const;
+
+private:
+    struct Request {
+        uint8_t address;
+        std::vector<uint8_t> buffer;     // write: reg + data; read: received data
+        uint8_t reg;
+        bool isRead;
+        Callback done;
+        size_t messages() const { return isRead ? 2 : 1; }
+    };
+
+    void enqueue(Request request);
+    void worker();
+    void execute(std::vector<Request>& batch);
+    static void addMessages(Request& request, std::vector<struct i2c_msg>& messages);
+
+    std::shared_ptr<I2C_Adapter> adapter_;
+    mutable std::mutex mutex_;
+    std::condition_variable queued_;
+    std::deque<Request> queue_;
+    bool stopping_;
+    Stats stats_;
+    std::thread worker_;
+};
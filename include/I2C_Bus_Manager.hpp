@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "I2C_Adapter.hpp"
+
+// Process-wide registry of I2C adapters.
+// The first request for a path opens the adapter; later requests, from any
+// thread, share it, so the process holds one file descriptor per bus.
+class I2C_Bus_Manager {
+public:
+    static I2C_Bus_Manager& instance();
+
+    // Adapter for the device file, opened on first use
+    std::shared_ptr<I2C_Adapter> adapter(const std::string& path);
+    // Use the given adapter for path, e.g. a Fake_I2C_Adapter on a host
+    void registerAdapter(const std::string& path, std::shared_ptr<I2C_Adapter> adapter);
+
+    // Prevent copying
+    I2C_Bus_Manager(const I2C_Bus_Manager&) = delete;
+    I2C_Bus_Manager& operator=(const I2C_Bus_Manager&) = delete;
+
+private:
+    I2C_Bus_Manager() = default;
+
+    std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<I2C_Adapter>> adapters_;
+};
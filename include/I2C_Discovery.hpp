@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+#include "I2CBus.hpp"
+
+// Startup scan of the I2C buses for the devices the application has drivers for.
+// Each driver lists the addresses its chip can be strapped to and a probe
+// which checks, on an I2CBus at one of them, that the chip is really there.
+// The result is saved in a small text file; as long as the file matches the
+// buses and drivers asked for, later starts read it instead of the bus, and
+// the drivers can skip their own identity checks. Delete the file, or call
+// invalidate(), after changing the hardware. A scan which could not reach a
+// bus, or got an error other than a missing ACK from a probe, is used but
+// not saved, so the next start scans again.
+class I2C_Discovery {
+public:
+    struct Driver {
+        std::string name;
+        std::vector<uint8_t> addresses;          // candidates, in probing order
+        std::function<bool(I2CBus&)> probe;      // true if the chip answers as expected
+    };
+
+    struct Device {
+        std::string driver;
+        std::string bus;
+        uint8_t address;
+    };
+
+    explicit I2C_Discovery(const std::string& cacheFile);
+
+    void addDriver(const Driver& driver);
+
+    // Devices on the buses, from the cache file when it is valid, otherwise
+    // probed and, if the scan was complete, saved. Each driver is matched at most once per bus.
+    const std::vector<Device>& discover(const std::vector<std::string>& buses);
+    // First device found for the driver
+    std::optional<Device> find(const std::string& driver) const;
+    // Whether the last discover() was answered by the cache file
+    bool fromCache() const { return fromCache_; }
+    // Forget the saved result; the next discover() scans the buses
+    void invalidate();
+
+private:
+    std::string fingerprint(const std::vector<std::string>& buses) const;
+    bool load(const std::string& key);
+    void save(const std::string& key) const;
+    // false if some address could not be probed
+    bool scan(const std::vector<std::string>& buses);
+
+    std::string cacheFile_;
+    std::vector<Driver> drivers_;
+    std::vector<Device> devices_;
+    bool fromCache_;
+};
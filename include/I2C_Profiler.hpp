@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#include <linux/i2c.h>
+
+// Process-wide I2C instrumentation, fed by I2C_Adapter::transfer().
+// Per device address it counts transactions, payload bytes, failures and a
+// histogram of call latencies in power-of-two microsecond buckets.
+// Every thread writes its own block of counters (relaxed atomics, a single
+// writer each), so recording takes no lock and causes no cache line
+// sharing; readers sum the blocks. Blocks outlive their threads.
+class I2C_Profiler {
+public:
+    // bucket i counts latencies below 2^i us, the last one everything above
+    static constexpr size_t buckets = 20;
+    static constexpr size_t addresses = 128;
+
+    struct Device_Stats {
+        uint64_t transactions;   // I2C_RDWR calls with a message for the device
+        uint64_t bytes;          // payload bytes to and from the device
+        uint64_t errors;         // failed calls
+        std::array<uint64_t, buckets> histogram;
+    };
+
+    static I2C_Profiler& instance();
+
+    // One I2C_RDWR call; every device addressed in it is charged the full
+    // latency, which is how long it waited
+    void record(const struct i2c_msg *messages, size_t count, std::chrono::nanoseconds latency, bool failed);
+
+    Device_Stats device(uint8_t address) const;
+    // Table of all devices seen so far
+    void dump(std::ostream &out) const;
+
+    void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Prevent copying
+    I2C_Profiler(const I2C_Profiler&) = delete;
+    I2C_Profiler& operator=(const I2C_Profiler&) = delete;
+
+private:
+    struct Counters {
+        std::atomic<uint64_t> transactions;
+        std::atomic<uint64_t> bytes;
+        std::atomic<uint64_t> errors;
+        std::array<std::atomic<uint64_t>, buckets> histogram;
+    };
+    struct alignas(64) Thread_Block {
+        std::array<Counters, addresses> devices;
+    };
+
+    I2C_Profiler();
+    Thread_Block& threadBlock();
+    static size_t bucket(std::chrono::nanoseconds latency);
+
+    std::atomic<bool> enabled_;
+    mutable std::mutex mutex_;      // guards the list of blocks, not the counters
+    std::vector<std::unique_ptr<Thread_Block>> blocks_;
+};
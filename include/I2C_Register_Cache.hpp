@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <mutex>
+
+// Shadow copy of the registers of one I2C device.
+// Only registers marked with cacheRegister() are kept; reads of them are
+// served from memory once the value is known. Bits the hardware changes on
+// its own (status flags) are declared volatile: a register with volatile
+// bits is never served from the cache, but its other bits still let a
+// read-modify-write skip the read. When such a register is written, the
+// volatile bits are sent as volatileWrite, the value that leaves them
+// untouched (e.g. 1 for flags cleared by writing 0).
+// One cache exists per (adapter, address), see I2C_Adapter::registerCache(),
+// so all handles of a device see the same shadow.
+class I2C_Register_Cache {
+public:
+    struct Stats {
+        uint64_t hits;           // reads served from memory
+        uint64_t misses;         // reads of cached registers which went to the bus
+        uint64_t writesSkipped;  // read-modify-writes which changed nothing
+    };
+
+    I2C_Register_Cache();
+
+    // Prevent copying
+    I2C_Register_Cache(const I2C_Register_Cache&) = delete;
+    I2C_Register_Cache& operator=(const I2C_Register_Cache&) = delete;
+
+    enum class Update {
+        Unknown,     // no shadow value, the register has to be read first
+        Write,       // send the returned value
+        Unchanged    // the write would not change anything
+    };
+
+    void cacheRegister(uint8_t reg, uint16_t volatileBits = 0, uint16_t volatileWrite = 0);
+
+    // Value of a register for a plain read; false if it has to be read
+    bool read(uint8_t reg, uint16_t &value);
+    // Read-modify-write from the shadow: bits in mask are taken from bits,
+    // volatile bits get volatileWrite and the rest keeps its value
+    Update update(uint8_t reg, uint16_t mask, uint16_t bits, uint16_t &value);
+
+    // Records a value read from or written to the device
+    void store(uint8_t reg, uint16_t value);
+    void invalidate(uint8_t reg);
+    void invalidateAll();
+
+    Stats stats() const;
+
+private:
+    struct Entry {
+        uint16_t value;
+        uint16_t volatileBits;
+        uint16_t volatileWrite;
+    };
+
+    mutable std::mutex mutex_;
+    std::bitset<256> cached_;
+    std::bitset<256> valid_;
+    std::array<Entry, 256> entries_;
+    Stats stats_;
+};
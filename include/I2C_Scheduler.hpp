@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Sampling plan for the devices on one I2C bus.
+// Each device declares how often it wants to sample and what one sample
+// costs on the wire; the scheduler works out the bus time at the configured
+// clock, the utilisation of the bus, and whether the plan fits under the
+// utilisation limit. Sampling threads wait for their slot with
+// waitForSlot(); slots of different devices are spread over the shortest
+// period so that the transactions do not arrive in bursts.
+class I2C_Scheduler {
+public:
+    struct Config {
+        unsigned int clockHz;        // SCL frequency of the bus, e.g. 100000
+        double utilisationLimit;     // share of the bus time sampling may use, e.g. 0.5
+    };
+
+    // What one sample costs on the wire
+    struct Device {
+        std::string name;
+        std::chrono::milliseconds period;
+        size_t messages;             // i2c_msg segments per sample
+        size_t bytes;                // payload bytes per sample, register pointers included
+    };
+
+    using Slot = size_t;
+
+    struct Report {
+        double utilisation;          // all devices, share of the bus time
+        bool fits;                   // utilisation within the limit
+    };
+
+    explicit I2C_Scheduler(const Config& config);
+
+    // Adds a device to the plan; warns on std::cerr when the plan stops fitting
+    Slot add(const Device& device);
+
+    // Time one sample of the device keeps the bus busy
+    std::chrono::microseconds busTime(Slot slot) const;
+    Report report() const;
+    // Table of the devices, their bus time and utilisation
+    void print(std::ostream& out) const;
+
+    // Sleeps until the next sampling slot of the device and returns its
+    // time; when late, returns at once with the last slot missed
+    std::chrono::steady_clock::time_point waitForSlot(Slot slot);
+
+    // Bus time of a transfer: start (or repeated start) and address byte for
+    // each message, 9 clocks per byte, one stop
+    static constexpr uint64_t clocks(size_t messages, size_t bytes) {
+        return messages * 10 + bytes * 9 + 1;
+    }
+
+private:
+    struct Entry {
+        Device device;
+        std::chrono::microseconds busTime;
+        std::chrono::steady_clock::time_point next;
+    };
+
+    double utilisation(const Entry& entry) const;
+    void stagger();
+
+    Config config_;
+    std::chrono::steady_clock::time_point epoch_;
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// PackBits-style run-length encoding of RGB565 images.
+// The stream is a sequence of packets, each starting with a control byte:
+//   0x00..0x7F  run:     one pixel follows, repeated (control + 1) times
+//   0x80..0xFF  literal: (control - 0x7F) pixels follow
+// Pixels are stored big-endian, which is the panel wire order, so literal
+// packets are copied to a wire-order buffer as they are.
+struct RLE565 {
+    static constexpr size_t maxPacket = 128;
+
+    // Number of pixels the stream decodes to, 0 for a malformed stream.
+    // Usable in static_assert to validate an asset at compile time.
+    static constexpr size_t decodedLength(const uint8_t *data, size_t size) {
+        size_t pixels = 0;
+        size_t pos = 0;
+        while (pos < size) {
+            uint8_t control = data[pos++];
+            size_t count = (control < 0x80) ? control + 1 : control - 0x7F;
+            size_t payload = (control < 0x80) ? 2 : 2 * count;
+            if (pos + payload > size) {
+                return 0;
+            }
+            pos += payload;
+            pixels += count;
+        }
+        return pixels;
+    }
+
+    // Decode into wire-order pixels; returns the number of pixels written,
+    // which stops at capacity
+    static size_t decode(const uint8_t *data, size_t size, uint16_t *pixels, size_t capacity) {
+        size_t written = 0;
+        size_t pos = 0;
+        while (pos < size && written < capacity) {
+            uint8_t control = data[pos++];
+            size_t payload = (control < 0x80) ? 2 : 2 * (control - 0x7F);
+            if (pos + payload > size) {
+                break; // truncated stream
+            }
+            if (control < 0x80) {
+                size_t count = control + 1;
+                if (count > capacity - written) {
+                    count = capacity - written;
+                }
+                uint16_t pixel;
+                std::memcpy(&pixel, data + pos, sizeof(pixel));
+                pos += 2;
+                for (size_t i = 0; i < count; ++i) {
+                    pixels[written++] = pixel;
+                }
+            } else {
+                size_t count = control - 0x7F;
+                size_t copied = (count > capacity - written) ? capacity - written : count;
+                std::memcpy(pixels + written, data + pos, copied * sizeof(uint16_t));
+                pos += 2 * count;
+                written += copied;
+            }
+        }
+        return written;
+    }
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <linux/spi/spidev.h>
+
+// Wrapper over a spidev character device.
+// Every transfer ends in submit(), which counts the traffic and hands it to the
+// virtual message() call. Host backends (see Fake_SPI_Bus) override message()
+// so that drivers can be exercised without the kernel driver.
+class SPI_Bus {
+public:
+    struct Config {
+        std::string spiDevice;   // e.g., "/dev/spidev0.0"
+        unsigned int speedHz;    // SPI speed in Hz
+        uint8_t mode;            // SPI_MODE_0 .. SPI_MODE_3
+        uint8_t bitsPerWord;     // usually 8
+    };
+
+    // Traffic counters, updated by submit()
+    struct Stats {
+        uint64_t ioctls;         // number of SPI_IOC_MESSAGE calls
+        uint64_t bytes;          // number of bytes clocked out
+    };
+
+    // spidev rejects messages longer than its "bufsiz" module parameter
+    static constexpr size_t defaultBufferSize = 4096;
+    static constexpr auto bufsizPath = "/sys/module/spidev/parameters/bufsiz";
+
+    explicit SPI_Bus(const Config& config);
+    virtual ~SPI_Bus();
+
+    // Prevent copying
+    SPI_Bus(const SPI_Bus&) = delete;
+    SPI_Bus& operator=(const SPI_Bus&) = delete;
+
+    // Single full-duplex transfer, rx may be nullptr for write-only traffic
+    void transfer(const uint8_t *tx, uint8_t *rx, size_t length);
+
+    // Submit the transfers as one SPI_IOC_MESSAGE(count) call
+    void submit(struct spi_ioc_transfer *transfers, size_t count);
+
+    // Largest number of bytes accepted by a single submit()
+    size_t maxTransferSize() const { return maxTransferSize_; }
+    unsigned int speedHz() const { return config_.speedHz; }
+
+    const Stats& stats() const { return stats_; }
+    void resetStats() { stats_ = {}; }
+
+protected:
+    // Constructor for backends which do not open a device
+    SPI_Bus(const Config& config, size_t maxTransferSize);
+
+    virtual void message(struct spi_ioc_transfer *transfers, size_t count);
+
+    Config config_;
+
+private:
+    static size_t readBufferSize();
+
+    int fd_;
+    size_t maxTransferSize_;
+    Stats stats_;
+};
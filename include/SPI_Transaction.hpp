@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "SPI_Bus.hpp"
+
+// Builder for multi-transfer SPI messages.
+// Transfers are queued and sent in a single SPI_IOC_MESSAGE(N) call. Chip
+// select stays asserted between transfers unless csChange is set. Write-only
+// transfers carry a null rx buffer, so the kernel does not copy anything back.
+// When the queue runs out of slots or the message would exceed the spidev
+// buffer, the transfers queued so far are submitted first.
+class SPI_Transaction {
+public:
+    // Per-transfer settings, {} gives the bus defaults
+    struct Options {
+        bool csChange;              // deassert CS after this transfer
+        uint32_t speedHz;           // 0 - bus default
+        uint16_t delayUsecs;        // delay after this transfer
+    };
+
+    static constexpr size_t maxTransfers = 32;
+
+    explicit SPI_Transaction(SPI_Bus& bus);
+    ~SPI_Transaction() = default;
+
+    // Prevent copying
+    SPI_Transaction(const SPI_Transaction&) = delete;
+    SPI_Transaction& operator=(const SPI_Transaction&) = delete;
+
+    // Queue transfers; the buffers must stay valid until submit()
+    SPI_Transaction& write(const uint8_t *tx, size_t length, const Options& options = {});
+    SPI_Transaction& read(uint8_t *rx, size_t length, const Options& options = {});
+    SPI_Transaction& transfer(const uint8_t *tx, uint8_t *rx, size_t length, const Options& options = {});
+
+    // Send everything queued as one message
+    void submit();
+
+    size_t size() const { return count_; }
+    size_t bytes() const { return bytes_; }
+    bool empty() const { return count_ == 0; }
+
+private:
+    SPI_Bus& bus_;
+    std::array<struct spi_ioc_transfer, maxTransfers> transfers_;
+    size_t count_;
+    size_t bytes_;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <cstdint>
+#include <ostream>
+#include "Text_Format.hpp"
+
+// Temperature in Q12.4 fixed point: an int16_t counting 1/16 C, the native
+// step of the MCP9808, from -2048 C to +2047.9375 C. It converts from the
+// sensor register, compares, and formats without floating point, and fits in
+// a lock-free std::atomic.
+class Temperature {
+public:
+    static constexpr int fractionBits = 4;
+    static constexpr int16_t one = 1 << fractionBits;   // 1 C
+
+    constexpr Temperature() : raw_(0) {}
+
+    static constexpr Temperature fromRaw(int16_t raw) { return Temperature(raw); }
+    static constexpr Temperature fromCelsius(int celsius) { return Temperature(static_cast<int16_t>(celsius * one)); }
+    // MCP9808 temperature or limit register: 13-bit two's complement in
+    // bits 12..0, the flags in bits 15..13 are dropped
+    static constexpr Temperature fromMCP9808(uint16_t reg) {
+        const int16_t value = static_cast<int16_t>(reg & 0x0FFF);
+        return Temperature(static_cast<int16_t>((reg & 0x1000) ? value - 0x1000 : value));
+    }
+
+    constexpr int16_t raw() const { return raw_; }
+    // Value times 10^decimals, rounded half away from zero, for Text_Format::fixedPoint
+    constexpr int32_t scaled(unsigned decimals) const {
+        int32_t value = raw_;
+        for (unsigned i = 0; i < decimals; ++i) {
+            value *= 10;
+        }
+        return value >= 0 ? (value + one / 2) / one : -((-value + one / 2) / one);
+    }
+
+    constexpr auto operator<=>(const Temperature&) const = default;
+    constexpr Temperature operator+(Temperature other) const { return Temperature(static_cast<int16_t>(raw_ + other.raw_)); }
+    constexpr Temperature operator-(Temperature other) const { return Temperature(static_cast<int16_t>(raw_ - other.raw_)); }
+
+private:
+    constexpr explicit Temperature(int16_t raw) : raw_(raw) {}
+
+    int16_t raw_;
+};
+
+static_assert(std::atomic<Temperature>::is_always_lock_free, "Temperature atomics must not take a lock");
+
+// e.g. "25.06", two decimals
+inline std::ostream& operator<<(std::ostream& out, Temperature temperature) {
+    Fixed_String<16> text;
+    Text_Format::fixedPoint(text, temperature.scaled(2), 2, 0);
+    return out << text.view();
+}
+
+// MCP9808 register conversions from the datasheet, around the sign bit (bit 12)
+static_assert([] {
+    struct Entry {
+        uint16_t reg;
+        int16_t raw;
+        int32_t centi;   // Celsius * 100
+    };
+    constexpr Entry table[] = {
+        {0x0000, 0, 0},             // 0 C
+        {0x0001, 1, 6},             // +0.0625 C
+        {0x0190, 400, 2500},        // +25 C
+        {0x0FFF, 4095, 25594},      // +255.9375 C, largest positive
+        {0x1FFF, -1, -6},           // -0.0625 C
+        {0x1FF0, -16, -100},        // -1 C
+        {0x1E70, -400, -2500},      // -25 C
+        {0x1D80, -640, -4000},      // -40 C, bottom of the range
+        {0x1000, -4096, -25600},    // -256 C, sign bit alone
+        {0xE190, 400, 2500},        // +25 C with all three flags set
+        {0x8FF0, 4080, 25500},      // TCRIT flag, not a sign
+    };
+    for (const Entry& entry : table) {
+        const Temperature t = Temperature::fromMCP9808(entry.reg);
+        if (t.raw() != entry.raw || t.scaled(2) != entry.centi) {
+            return false;
+        }
+    }
+    return Temperature::fromCelsius(-40) == Temperature::fromMCP9808(0x1D80) &&
+           Temperature::fromCelsius(28) < Temperature::fromMCP9808(0x01C1) &&
+           Temperature::fromMCP9808(0x1FFF).scaled(1) == -1;
+}(), "Temperature::fromMCP9808 conversion table");
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <time.h>
+
+// Fixed-capacity character buffer living on the stack.
+// Appends past the capacity are cut off, so formatting never allocates and
+// never fails; view() hands the text to ST7789::drawString.
+template <size_t Capacity>
+class Fixed_String {
+public:
+    constexpr Fixed_String() : data_{}, size_(0) {}
+
+    constexpr void clear() { size_ = 0; }
+    constexpr void push_back(char c) {
+        if (size_ < Capacity) {
+            data_[size_++] = c;
+        }
+    }
+    constexpr Fixed_String& append(std::string_view text) {
+        for (char c : text) {
+            push_back(c);
+        }
+        return *this;
+    }
+    constexpr Fixed_String& append(size_t count, char c) {
+        for (size_t i = 0; i < count; ++i) {
+            push_back(c);
+        }
+        return *this;
+    }
+
+    constexpr std::string_view view() const { return {data_, size_}; }
+    constexpr size_t size() const { return size_; }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    char data_[Capacity];
+    size_t size_;
+};
+
+// Formatting of the values shown on the display, replacing the iostream
+// manipulators and std::put_time
+struct Text_Format {
+    // Fixed-point number: value holds the number scaled by 10^decimals, e.g.
+    // 234 with one decimal is "23.4". Right-aligned to width with spaces.
+    template <size_t Capacity>
+    static constexpr void fixedPoint(Fixed_String<Capacity>& out, int32_t value, unsigned decimals, size_t width, bool showPos = false) {
+        char digits[16];
+        size_t n = 0;
+        const bool negative = value < 0;
+        uint32_t magnitude = negative ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+        do { // least significant digit first, at least one before the point
+            if (n == decimals && decimals > 0) {
+                digits[n++] = '.';
+            }
+            digits[n++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0 || n <= decimals);
+        if (negative || showPos) {
+            digits[n++] = negative ? '-' : '+';
+        }
+        out.append(width > n ? width - n : 0, ' ');
+        while (n > 0) {
+            out.push_back(digits[--n]);
+        }
+    }
+
+    // HH:MM:SS
+    template <size_t Capacity>
+    static constexpr void time(Fixed_String<Capacity>& out, const struct tm& t) {
+        twoDigits(out, t.tm_hour);
+        out.push_back(':');
+        twoDigits(out, t.tm_min);
+        out.push_back(':');
+        twoDigits(out, t.tm_sec);
+    }
+
+    // DD-MM-YY
+    template <size_t Capacity>
+    static constexpr void date(Fixed_String<Capacity>& out, const struct tm& t) {
+        twoDigits(out, t.tm_mday);
+        out.push_back('-');
+        twoDigits(out, t.tm_mon + 1);
+        out.push_back('-');
+        twoDigits(out, t.tm_year % 100);
+    }
+
+    template <size_t Capacity>
+    static constexpr void twoDigits(Fixed_String<Capacity>& out, int value) {
+        value = (value < 0) ? 0 : value % 100;
+        out.push_back(static_cast<char>('0' + value / 10));
+        out.push_back(static_cast<char>('0' + value % 10));
+    }
+};
+
+static_assert([] {
+    Fixed_String<16> s;
+    Text_Format::fixedPoint(s, -5, 1, 6, true);
+    Text_Format::fixedPoint(s, 28, 0, 3, true);
+    return s.view() == "  -0.5+28";
+}(), "Text_Format::fixedPoint");
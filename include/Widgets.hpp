@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <time.h>
+#include "st7789v2.hpp"
+#include "Text_Format.hpp"
+
+// Retained-mode text widgets drawn on an ST7789.
+// A widget owns a row of font cells and remembers what each cell shows; a
+// new value only redraws the cells whose character (or the colours) changed,
+// so one digit ticking over damages a single 8x16 cell.
+
+// Fixed-width line of text, padded with spaces
+class Label {
+public:
+    static constexpr size_t maxCells = ST7789::WIDTH / ST7789::font_width;
+
+    Label(ST7789& display, int16_t x, int16_t y, size_t cells, uint16_t color = ST7789::WHITE, uint16_t bg = ST7789::BLACK);
+
+    // Text longer than the widget is cut off
+    void setText(std::string_view text);
+    // A colour change redraws every cell
+    void setColors(uint16_t color, uint16_t bg);
+    // Forget the cached content, e.g. after the screen was cleared
+    void invalidate() { drawn = false; }
+
+    size_t cells() const { return width; }
+    // Cells drawn since construction, for checking the redraw granularity
+    uint64_t cellsDrawn() const { return cellDraws; }
+
+private:
+    ST7789& display;
+    int16_t x;
+    int16_t y;
+    size_t width;
+    uint16_t color;
+    uint16_t bg;
+    bool drawn;                          // shown holds what is on screen
+    std::array<char, maxCells> shown;
+    uint64_t cellDraws;
+};
+
+// Fixed-point number with an optional suffix, e.g. " +23.4 C"
+class Numeric_Field {
+public:
+    struct Format {
+        size_t digits;       // field width of the number, including sign and point
+        unsigned decimals;
+        bool showPos;
+        std::string_view suffix; // not copied, usually a string literal
+    };
+
+    Numeric_Field(ST7789& display, int16_t x, int16_t y, const Format& format);
+
+    void setValue(float value);
+    // value scaled by 10^decimals
+    void setScaled(int32_t value);
+    void setColors(uint16_t color, uint16_t bg) { label.setColors(color, bg); }
+    Label& widget() { return label; }
+
+private:
+    Format format;
+    Label label;
+    bool valid;
+    int32_t value;
+};
+
+// Time (HH:MM:SS) or date (DD-MM-YY), right-aligned in its cells
+class Clock_Field {
+public:
+    enum class Show { Time, Date };
+
+    Clock_Field(ST7789& display, int16_t x, int16_t y, Show show, size_t cells = 8);
+
+    void setTime(const struct tm& time);
+    void setColors(uint16_t color, uint16_t bg) { label.setColors(color, bg); }
+    Label& widget() { return label; }
+
+private:
+    Show show;
+    Label label;
+};
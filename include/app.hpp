@@ -10,6 +10,7 @@
 #include "PWM_Servo.hpp"
 #include "mcp9808.hpp"
 #include "pcf8563.hpp"
+#include "I2C_Scheduler.hpp"
 #include <time.h>
 
 // Hardware configuration structure
@@ -25,6 +26,8 @@ typedef struct {
     GPIO_config rotary_SW;
     PWM_Backlight::Config PWM_BL;
     PWM_Servo::Config PWM_Srv;
+    I2C_Scheduler::Config i2cSchedule;
+    std::string i2cDiscoveryCache;
 } Hardware_config_t;
 
 // Application state structure 
@@ -33,7 +36,8 @@ typedef struct {
     std::atomic<bool> setAlarm;
     std::atomic<std::chrono::steady_clock::time_point> alarmTime;
     std::atomic<int> tempThreshold; // in Celsius, temperature threshold for alarm
-    std::atomic<float> mcpTemperature; // in Celsius, temperature measured by the sensor
+    std::atomic<Temperature> mcpTemperature; // temperature measured by the sensor, filtered
+    std::atomic<Temperature> mcpTemperatureRaw; // last reading as it came from the sensor
     std::atomic<struct tm> pcfTime;
     std::atomic<bool> gpioButtonShortPress;
     std::atomic<bool> rotaryButtonShortPress;
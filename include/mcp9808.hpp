@@ -1,24 +1,126 @@
 #pragma once
 
 #include "I2CBus.hpp"
+#include "Temperature.hpp"
+#include <chrono>
 
 class MCP9808 {
 public:
+    // Resolution register (0x08): finer steps take longer conversions
+    enum class Resolution : uint8_t {
+        C0_5 = 0,       // 0.5 C, 30 ms
+        C0_25 = 1,      // 0.25 C, 65 ms
+        C0_125 = 2,     // 0.125 C, 130 ms
+        C0_0625 = 3     // 0.0625 C, 250 ms, power-on default
+    };
+
     struct Config {
        std::string i2cBusDevice;   // "/dev/i2c-1"
         uint8_t i2cAddress;    // 0x18
+        std::chrono::milliseconds samplePeriod;
+        bool identified = false;   // found by I2C_Discovery, no need to check the IDs again
+        // ALERT output wired to a GPIO (open drain, pulled up); no chip: not wired
+        std::string alertChip;     // e.g. "gpiochip0"
+        unsigned int alertPin = 0;
+        Resolution resolution = Resolution::C0_0625;
+        // Shut the sensor down between samples, each sample waking it for a
+        // single conversion; ALERT then only changes at samples. Otherwise
+        // the sensor converts continuously; the conversions are restarted
+        // now and then to keep them in step with the reads, see resyncInterval.
+        // Periods of several seconds resync at every sample, one-shot then
+        // costs the same on the bus and saves the supply current
+        bool oneShot = false;
+    };
+
+    // Limits of the ALERT output, rounded to 0.25 C
+    struct Alert_Limits {
+        Temperature upper;
+        Temperature lower;
+        Temperature critical;
+    };
+
+    // Hysteresis applied when a limit is crossed back (CONFIG bits 10..9)
+    enum class Hysteresis : uint16_t { None = 0, C1_5 = 1, C3 = 2, C6 = 3 };
+
+    // Temperature register with the limit flags the sensor sets on its own
+    struct Reading {
+        Temperature temperature;
+        bool aboveCritical;
+        bool aboveUpper;
+        bool belowLower;
     };
-    MCP9808(const std::string &i2cBusDevice, int address = 0x18);
+    // Bus cost of one getTemperature(): register pointer, then two bytes
+    static constexpr size_t sampleMessages = 2;
+    static constexpr size_t sampleBytes = 3;
+    // One-shot sample: CONFIG writes waking the sensor and shutting it down around the read
+    static constexpr size_t oneShotMessages = sampleMessages + 2;
+    static constexpr size_t oneShotBytes = sampleBytes + 2 * 3;
+
+    // Typical conversion times of the datasheet
+    static constexpr std::chrono::milliseconds conversionTime(Resolution resolution) {
+        constexpr std::chrono::milliseconds times[] = {
+            std::chrono::milliseconds(30), std::chrono::milliseconds(65),
+            std::chrono::milliseconds(130), std::chrono::milliseconds(250)
+        };
+        return times[static_cast<uint8_t>(resolution) & 0x03];
+    }
+    // Slack for the tolerance of the sensor's clock and the time a start
+    // command takes on the bus
+    static constexpr std::chrono::milliseconds conversionMargin(Resolution resolution) {
+        return conversionTime(resolution) / 8;
+    }
+    // Time from the start of a conversion until its result is read safely
+    static constexpr std::chrono::milliseconds conversionWait(Resolution resolution) {
+        return conversionTime(resolution) + conversionMargin(resolution);
+    }
+    // Sampling period for the configuration. In continuous mode the
+    // configured period in whole conversions (k >= 1), so that with the
+    // conversions ending conversionMargin() before the reads, every read gets
+    // a new conversion and none is read twice
+    static std::chrono::milliseconds samplePeriod(const Config& config);
+    // Continuous mode: samples until the sensor's clock, off by up to
+    // clockTolerancePercent against the host, may have used up the margin;
+    // the conversions are then restarted. The datasheet only gives typical
+    // conversion times, the tolerance is an assumption
+    static constexpr unsigned int clockTolerancePercent = 1;
+    static size_t resyncInterval(const Config& config);
+    // Addresses selectable with the A2..A0 pins
+    static constexpr uint8_t firstAddress = 0x18;
+    static constexpr uint8_t lastAddress = 0x1F;
+
+    // Throws unless identified is set and the chip does not answer with the
+    // MCP9808 manufacturer and device IDs
+    MCP9808(const std::string &i2cBusDevice, int address = 0x18, bool identified = false);
     ~MCP9808();
 
-    float getTemperature();
-    void setUpperAlarmTemperature(float temperature);
+    Temperature getTemperature();
+    Reading getReading();
+    void setUpperAlarmTemperature(Temperature temperature);
+    void setAlertLimits(const Alert_Limits& limits);
+    // ALERT in comparator mode, active low, for all three limits: the output
+    // follows the flags of getReading()
+    void enableAlert(Hysteresis hysteresis = Hysteresis::None);
+
+    void setResolution(Resolution resolution);
+    Resolution resolution() const { return resolution_; }
+    // Shutdown (CONFIG bit 8): conversions stop and the supply current drops
+    // from about 200 uA to 0.1 uA; registers stay accessible
+    void shutdown(bool enable);
+    // Wakes the sensor, waits for one conversion and shuts it down again
+    Temperature getTemperatureOneShot();
+    // Starts a new conversion now, by a shutdown and a wake-up; in
+    // continuous mode a read conversionWait() later returns its result, and
+    // the following conversions end every conversionTime() after that one
+    void restartConversion();
     void enableComparatorMode();
     uint16_t getManufacturerID();
     uint16_t getDeviceID();
+    // Whether the device on the bus is an MCP9808, for I2C_Discovery
+    static bool probe(I2CBus &i2cBus);
 
 private:
     I2CBus i2cBus_;
+    Resolution resolution_;
 
     static constexpr uint8_t MANUFACTURER_ID_REG = 0x06;
     static constexpr uint8_t DEVICE_ID_REG = 0x07;
@@ -27,11 +129,12 @@ private:
     static constexpr uint8_t TUPPER_REG = 0x02;
     static constexpr uint8_t TLOWER_REG = 0x03;
     static constexpr uint8_t TCRIT_REG = 0x04;
+    static constexpr uint8_t RESOLUTION_REG = 0x08;
 
     // Expected Manufacturer and Device ID
     static constexpr uint16_t EXPECTED_MANUFACTURER_ID = 0x0054;
     static constexpr uint16_t EXPECTED_DEVICE_ID = 0x0400; // Example device ID
 
-    float convertRawTemperature(uint16_t rawTemp);
+    static uint16_t encodeLimit(Temperature temperature);
 };
 
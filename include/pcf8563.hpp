@@ -2,13 +2,27 @@
 
 #include "I2CBus.hpp"
 #include <time.h>
+#include <chrono>
 
 class PCF8563 {
 public:
     struct Config {
         std::string i2cBusDevice;   // "/dev/i2c-1"
         uint8_t i2cAddress;    // 0x51
+        std::chrono::milliseconds samplePeriod;
     };
+    // Time and date read in one burst, seconds to years (0x02..0x08)
+    struct Snapshot {
+        struct tm wall;
+        bool voltageLow;    // VL: the supply dropped, the time may be wrong until set again
+    };
+
+    // Bus cost of one getSnapshot(): register pointer, then 7 registers
+    static constexpr size_t sampleMessages = 2;
+    static constexpr size_t sampleBytes = 1 + 7;
+    // The only address of the chip
+    static constexpr uint8_t defaultAddress = 0x51;
+
     PCF8563(const std::string &i2cBusDevice, uint8_t address = 0x51);
     ~PCF8563();
 
@@ -22,10 +36,15 @@ public:
     bool Stop();
     void setTimeAndDate(const struct tm & wall);
     struct tm getTimeAndDate();
+    Snapshot getSnapshot();
+    // Whether the device on the bus looks like a PCF8563, for I2C_Discovery
+    static bool probe(I2CBus &i2cBus);
 
 private:
     I2CBus i2cBus_;
 
+    static std::array<uint8_t, 3> decodeTime(const std::array<uint8_t, 3> &raw);
+    static std::array<uint8_t, 4> decodeDate(const std::array<uint8_t, 4> &raw);
     static uint8_t toBCD(uint8_t value);
     static uint8_t fromBCD(uint8_t value);
 };
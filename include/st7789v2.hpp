@@ -2,8 +2,20 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <memory>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <initializer_list>
+#include <vector>
 #include <gpiod.hpp>
+#include "SPI_Bus.hpp"
+#include "Framebuffer.hpp"
+#include "Damage_Tracker.hpp"
+#include "Glyph_Cache.hpp"
+#include "Edge_Source.hpp"
 
 class ST7789 {
 public:
@@ -19,6 +31,10 @@ public:
         GREEN = 0x07E0,
         BLUE  = 0x001F
     };
+    // Splash screen, run-length encoded (see RLE565.hpp), generated by "make logo";
+    // public so that the generated file can check it with static_assert
+    static const uint8_t logo_rle[];
+    static const size_t logo_rle_size;
     // Font dimensions
     static constexpr int16_t font_width=8;
     static constexpr int16_t font_height=16;
@@ -29,38 +45,113 @@ public:
         std::string gpioChip;    // e.g., "gpiochip0"
         unsigned int dcPin;      // Data/Command pin
         unsigned int resetPin;   // Reset pin
+        // Tearing effect: TEON is sent and every flush starts on the rising
+        // edge of the TE output, when the panel enters vertical blanking
+        bool tearingEffect = false;
+        unsigned int tePin = 0;  // TE pin, used with a gpioChip
+    };
+
+    // Panel refresh rate, set by Frame Rate Control in the init table
+    static constexpr auto refreshPeriod = std::chrono::microseconds(16667);
+
+    // Traffic counters, for measuring the cost of screen updates
+    struct Stats {
+        uint64_t ioctls;         // SPI_IOC_MESSAGE calls
+        uint64_t bytes;          // bytes sent over SPI
+        uint64_t dcWrites;       // D/C line changes
+        uint64_t frames;         // flushes which sent anything
+        uint64_t teTimeouts;     // flushes started without seeing a TE edge
+    };
+
+    // Cost of the most recent flush
+    struct FrameStats {
+        uint64_t ioctls;
+        uint64_t bytes;
+        size_t windows;          // CASET/RASET/RAMWR sequences
+        std::chrono::microseconds teWait;  // time spent waiting for the TE edge
+    };
+
+    // Counters of the double-buffered pipeline, see present()
+    struct PipelineStats {
+        uint64_t presented;                      // frames handed to the transmit thread
+        uint64_t transmitted;                    // frames sent to the panel
+        uint64_t dropped;                        // frames replaced before being sent
+        std::chrono::microseconds frameTime;     // between the starts of the last two transmissions
+        std::chrono::microseconds transmitTime;  // SPI time of the last transmitted frame
     };
 
     explicit ST7789(const Config& config);
+    // Runs the panel over the given bus; an empty config.gpioChip skips the
+    // D/C and reset lines, which allows host measurements with Fake_SPI_Bus.
+    // With tearingEffect set, edges come from teSource if given, otherwise
+    // from the TE pin, or from a simulated 60 Hz signal without a gpioChip.
+    ST7789(const Config& config, std::unique_ptr<SPI_Bus> bus, std::unique_ptr<Edge_Source> teSource = nullptr);
     ~ST7789();
 
     // Prevent copying
     ST7789(const ST7789&) = delete;
     ST7789& operator=(const ST7789&) = delete;
 
+    // Drawing goes to the framebuffer, flush() sends the changed areas to the panel
     void clearScreen(uint16_t color = BLACK);
     void showLogo();
     void drawPixel(int16_t x, int16_t y, uint16_t color);
     void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
     void drawChar(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg);
-    void drawString(int16_t x, int16_t y, const std::string& str, uint16_t color, uint16_t bg);
+    void drawString(int16_t x, int16_t y, std::string_view str, uint16_t color, uint16_t bg);
+    // Synchronous: sends the changed areas of the drawing buffer and returns
+    // when done. Not to be mixed with a running transmit thread.
+    void flush();
+
+    // Double-buffered operation: the UI thread draws and calls present(),
+    // which copies the changed areas into the front buffer and never waits
+    // for SPI. A transmit thread sends the front buffer with transmitFrame().
+    // While a transmission is running, present() drops the frame and returns
+    // false; its changes stay pending and go out with the next frame.
+    bool present();
+    // Waits up to timeout for a presented frame and sends it; false on timeout
+    bool transmitFrame(std::chrono::milliseconds timeout);
+    PipelineStats pipelineStats() const;
+
+    // Bus counters; read them from the thread which talks to the panel
+    Stats stats() const;
+    FrameStats lastFrame() const { return lastFrameStats; }
+    // Time spent in the constructor bringing the panel up
+    std::chrono::microseconds startupTime() const { return initDuration; }
 
 private:
     void reset();
     void display_init();
-    void writeReg(uint8_t cmd);
-    void writeDataByte(uint8_t data);
-    void writeDataWord(uint16_t data);
-    void spiWrite8(uint8_t data);
-    void spiWrite16(uint16_t data);
+    void command(uint8_t cmd, std::initializer_list<uint8_t> params = {});
+    void command(uint8_t cmd, const uint8_t *params, size_t length);
+    void writeData(const uint8_t *data, size_t length);
+    void setDC(int value);
     void selectArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
-    void spiTransfer(uint8_t *tx, uint8_t *rx, size_t length) ;
+    void waitForBlanking();
+    void sendAreas(const Framebuffer& source, const Damage_Tracker& areas);
+    void sendArea(const Framebuffer& source, const Damage_Tracker::Rect& area);
 
     Config config;
     gpiod::chip chip;
     gpiod::line dcLine;
     gpiod::line resetLine;
-    int spifd;
+    std::unique_ptr<SPI_Bus> bus;
+    std::unique_ptr<Edge_Source> teSource;  // null without tearing effect sync
+    Framebuffer framebuffer;        // drawing (back) buffer
+    Damage_Tracker damage;
+    Framebuffer frontbuffer;        // presented frame, owned by the transmit thread while sending
+    Damage_Tracker frontDamage;     // presented areas not yet sent
+    mutable std::mutex frameMutex;  // guards the front buffer hand-off and pipeline counters
+    std::condition_variable frameReady;
+    bool transmitting;
+    PipelineStats pipeline;
+    std::chrono::steady_clock::time_point lastTransmitStart;
+    Glyph_Cache glyphs;
+    int dcState;
+    uint64_t dcWrites;
+    uint64_t frames;
+    uint64_t teTimeouts;
+    FrameStats lastFrameStats;
+    std::chrono::microseconds initDuration;
     static const uint8_t font_bitmap[] ;
-    static std::vector<uint16_t> image_data ;
 };
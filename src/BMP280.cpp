@@ -1,30 +1,10 @@
 #include "BMP280.hpp"
-#include <fcntl.h>
-#include <unistd.h>
-#include <sys/ioctl.h>
+#include "SPI_Transaction.hpp"
 #include <cstring>
 #include <cmath>
 
 BMP280::BMP280(const Config& config)
-    : spi_fd(-1)
-    , spi_device(config.spiDevice)
-    , spi_mode(SPI_MODE_0)
-    , spi_bits(8)
-    , spi_speed(config.speedHz) {
-
-    // Open the SPI device
-    spi_fd = open(spi_device.c_str(), O_RDWR);
-    if (spi_fd < 0) {
-        throw std::runtime_error("Failed to open SPI device");
-    }
-
-    // Configure SPI mode, bits per word, and speed
-    if (ioctl(spi_fd, SPI_IOC_WR_MODE, &spi_mode) == -1 ||
-        ioctl(spi_fd, SPI_IOC_WR_BITS_PER_WORD, &spi_bits) == -1 ||
-        ioctl(spi_fd, SPI_IOC_WR_MAX_SPEED_HZ, &spi_speed) == -1) {
-        close(spi_fd);
-        throw std::runtime_error("Failed to configure SPI device");
-    }
+    : bus({config.spiDevice, config.speedHz, SPI_MODE_0, 8}) {
 
     // get sensor ID
     uint8_t id = read8(0xD0);
@@ -37,9 +17,6 @@ BMP280::BMP280(const Config& config)
 }
 
 BMP280::~BMP280() {
-    if (spi_fd >= 0) {
-        close(spi_fd);
-    }
 }
 
 float BMP280::getTemperature() {
@@ -74,61 +51,62 @@ float BMP280::getPressure() {
 }
 
 void BMP280::initializeSensor() {
-    // Read calibration data from BMP280
-    dig_T1 = read16(0x88);
-    dig_T2 = read16(0x8A);
-    dig_T3 = read16(0x8C);
-    dig_P1 = read16(0x8E);
-    dig_P2 = read16(0x90);
-    dig_P3 = read16(0x92);
-    dig_P4 = read16(0x94);
-    dig_P5 = read16(0x96);
-    dig_P6 = read16(0x98);
-    dig_P7 = read16(0x9A);
-    dig_P8 = read16(0x9C);
-    dig_P9 = read16(0x9E);
-
-    // Configure BMP280 for temperature and pressure measurement
-    write8(0xF4, 0x27); // Normal mode, temperature and pressure oversampling x1
-    write8(0xF5, 0xA0); // Config register with standby and filter settings
+    // Read calibration data from BMP280, 0x88..0x9F in one burst,
+    // each value is a little-endian 16-bit word
+    uint8_t calib[24];
+    readBlock(0x88, calib, sizeof(calib));
+    auto word = [&calib](size_t i) { return static_cast<uint16_t>((calib[2 * i + 1] << 8) | calib[2 * i]); };
+    dig_T1 = word(0);
+    dig_T2 = word(1);
+    dig_T3 = word(2);
+    dig_P1 = word(3);
+    dig_P2 = word(4);
+    dig_P3 = word(5);
+    dig_P4 = word(6);
+    dig_P5 = word(7);
+    dig_P6 = word(8);
+    dig_P7 = word(9);
+    dig_P8 = word(10);
+    dig_P9 = word(11);
+
+    // Configure BMP280 for temperature and pressure measurement, both
+    // register writes in one message with CS released between them
+    const uint8_t ctrl_meas[] = { 0xF4 & 0x7F, 0x27 }; // Normal mode, temperature and pressure oversampling x1
+    const uint8_t config[] = { 0xF5 & 0x7F, 0xA0 };    // Config register with standby and filter settings
+    SPI_Transaction transaction(bus);
+    transaction.write(ctrl_meas, sizeof(ctrl_meas), {.csChange = true, .speedHz = 0, .delayUsecs = 0});
+    transaction.write(config, sizeof(config));
+    transaction.submit();
 }
 
 uint8_t BMP280::read8(uint8_t reg) {
-    uint8_t tx[] = { static_cast<uint8_t>(reg | 0x80), 0 };
-    uint8_t rx[2] = { 0 };
-    spiTransfer(tx, rx, sizeof(tx));
-    return rx[1];
+    uint8_t rx[1];
+    readBlock(reg, rx, sizeof(rx));
+    return rx[0];
 }
 
 uint16_t BMP280::read16(uint8_t reg) {
-    uint8_t tx[] = { static_cast<uint8_t>(reg | 0x80), 0, 0 };
-    uint8_t rx[3] = { 0 };
-    spiTransfer(tx, rx, sizeof(tx));
-    return (rx[2] << 8) | rx[1];
+    uint8_t rx[2];
+    readBlock(reg, rx, sizeof(rx));
+    return (rx[1] << 8) | rx[0];
 }
 
 uint32_t BMP280::read24(uint8_t reg) {
-    uint8_t tx[] = { static_cast<uint8_t>(reg | 0x80), 0, 0, 0 };
-    uint8_t rx[4] = { 0 };
-    spiTransfer(tx, rx, sizeof(tx));
-    return (rx[1] << 16) | (rx[2] << 8) | rx[3];
+    uint8_t rx[3];
+    readBlock(reg, rx, sizeof(rx));
+    return (rx[0] << 16) | (rx[1] << 8) | rx[2];
 }
 
-void BMP280::write8(uint8_t reg, uint8_t value) {
-    uint8_t tx[] = { static_cast<uint8_t>(reg & 0x7F), value };
-    uint8_t rx[2] = { 0 };
-    spiTransfer(tx, rx, sizeof(tx));
+void BMP280::readBlock(uint8_t reg, uint8_t *data, size_t length) {
+    // register address as a write-only transfer, then the data in the same CS frame
+    const uint8_t address = reg | 0x80;
+    SPI_Transaction transaction(bus);
+    transaction.write(&address, 1);
+    transaction.read(data, length);
+    transaction.submit();
 }
 
-void BMP280::spiTransfer(uint8_t *tx, uint8_t *rx, size_t length) {
-    struct spi_ioc_transfer spi = {};
-    spi.tx_buf = reinterpret_cast<unsigned long>(tx);
-    spi.rx_buf = reinterpret_cast<unsigned long>(rx);
-    spi.len = length;
-    spi.speed_hz = spi_speed;
-    spi.bits_per_word = spi_bits;
-    spi.cs_change = 0;
-    if (ioctl(spi_fd, SPI_IOC_MESSAGE(1), &spi) < 0) {
-        throw std::runtime_error("SPI transfer failed");
-    }
+void BMP280::write8(uint8_t reg, uint8_t value) {
+    const uint8_t tx[] = { static_cast<uint8_t>(reg & 0x7F), value };
+    bus.transfer(tx, nullptr, sizeof(tx));
 }
@@ -0,0 +1,62 @@
+#include "Damage_Tracker.hpp"
+#include <algorithm>
+#include <limits>
+
+void Damage_Tracker::add(const Rect& rect) {
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+    Rect merged = rect;
+    // Merging may make the result touch rectangles it missed before, so
+    // rescan until nothing more can be absorbed
+    bool absorbed = true;
+    while (absorbed) {
+        absorbed = false;
+        for (size_t i = 0; i < count_; ++i) {
+            if (worthMerging(rects_[i], merged)) {
+                merged = unite(rects_[i], merged);
+                remove(i);
+                absorbed = true;
+                break;
+            }
+        }
+    }
+    if (count_ < maxRects) {
+        rects_[count_++] = merged;
+        return;
+    }
+    // List is full, grow the rectangle which gets the smallest extra area
+    size_t best = 0;
+    int32_t bestGrowth = std::numeric_limits<int32_t>::max();
+    for (size_t i = 0; i < count_; ++i) {
+        int32_t growth = unite(rects_[i], merged).area() - rects_[i].area();
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    merged = unite(rects_[best], merged);
+    remove(best);
+    add(merged);
+}
+
+Damage_Tracker::Rect Damage_Tracker::unite(const Rect& a, const Rect& b) {
+    int16_t x = std::min(a.x, b.x);
+    int16_t y = std::min(a.y, b.y);
+    int16_t right = std::max(a.right(), b.right());
+    int16_t bottom = std::max(a.bottom(), b.bottom());
+    return {x, y, static_cast<int16_t>(right - x), static_cast<int16_t>(bottom - y)};
+}
+
+bool Damage_Tracker::touches(const Rect& a, const Rect& b) {
+    // Overlapping or sharing an edge
+    return a.x <= b.right() && b.x <= a.right() && a.y <= b.bottom() && b.y <= a.bottom();
+}
+
+bool Damage_Tracker::worthMerging(const Rect& a, const Rect& b) {
+    return touches(a, b) || unite(a, b).area() - a.area() - b.area() <= mergeSlack;
+}
+
+void Damage_Tracker::remove(size_t index) {
+    rects_[index] = rects_[--count_];
+}
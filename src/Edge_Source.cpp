@@ -0,0 +1,82 @@
+#include "Edge_Source.hpp"
+
+GPIO_Edge_Source::GPIO_Edge_Source(const std::string& chipName, unsigned int lineNum, const std::string& consumer,
+                                   int requestType, std::bitset<32> flags, bool dropStale)
+    : chip(chipName)
+    , line(chip.get_line(lineNum))
+    , dropStale(dropStale)
+{
+    line.request({consumer, requestType, flags});
+}
+
+GPIO_Edge_Source::~GPIO_Edge_Source() {
+    if (line) {
+        line.release();
+    }
+}
+
+bool GPIO_Edge_Source::wait(std::chrono::nanoseconds timeout) {
+    if (drain() && !dropStale) {
+        return true;
+    }
+    if (!line.event_wait(timeout)) {
+        return false;
+    }
+    line.event_read(); // consume the event, only its arrival matters
+    return true;
+}
+
+bool GPIO_Edge_Source::drain() {
+    bool drained = false;
+    // one event at a time: event_read_multiple() would return a vector,
+    // and the flush path does not allocate
+    while (line.event_wait(std::chrono::nanoseconds::zero())) {
+        line.event_read();
+        drained = true;
+    }
+    return drained;
+}
+
+Simulated_Edge_Source::Simulated_Edge_Source(std::chrono::nanoseconds period)
+    : period(period)
+    , start(std::chrono::steady_clock::now())
+    , pending(0)
+    , count(0)
+{
+}
+
+bool Simulated_Edge_Source::wait(std::chrono::nanoseconds timeout) {
+    const auto now = std::chrono::steady_clock::now();
+    auto deadline = now + timeout;
+    bool periodic = false;
+    if (period > std::chrono::nanoseconds::zero()) {
+        // next tick of the free running signal
+        auto next = start + ((now - start) / period + 1) * period;
+        if (next <= deadline) {
+            deadline = next;
+            periodic = true;
+        }
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!triggered.wait_until(lock, deadline, [this] { return pending > 0; }) && !periodic) {
+        return false;
+    }
+    if (pending > 0) {
+        pending--;
+    }
+    count++;
+    return true;
+}
+
+void Simulated_Edge_Source::trigger() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending++;
+    }
+    triggered.notify_one();
+}
+
+uint64_t Simulated_Edge_Source::edges() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return count;
+}
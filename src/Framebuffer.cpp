@@ -0,0 +1,58 @@
+#include "Framebuffer.hpp"
+#include <algorithm>
+#include <cstring>
+
+Framebuffer::Framebuffer(int16_t width, int16_t height)
+    : width_(width)
+    , height_(height)
+    , pixels_(static_cast<size_t>(width) * height, 0) {
+}
+
+bool Framebuffer::fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    const uint16_t wire = toWire(color);
+    bool changed = false;
+    for (int16_t j = y; j < y + h; ++j) {
+        uint16_t *line = row(j) + x;
+        if (!changed && std::any_of(line, line + w, [wire](uint16_t p) { return p != wire; })) {
+            changed = true;
+        }
+        std::fill(line, line + w, wire);
+    }
+    return changed;
+}
+
+bool Framebuffer::blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels) {
+    // visible part of the block
+    int16_t x0 = std::max<int16_t>(x, 0);
+    int16_t y0 = std::max<int16_t>(y, 0);
+    int16_t x1 = std::min<int16_t>(x + w, width_);
+    int16_t y1 = std::min<int16_t>(y + h, height_);
+    if (x0 >= x1 || y0 >= y1) {
+        return false;
+    }
+    const size_t rowBytes = static_cast<size_t>(x1 - x0) * sizeof(uint16_t);
+    bool changed = false;
+    for (int16_t j = y0; j < y1; ++j) {
+        const uint16_t *src = pixels + static_cast<size_t>(j - y) * w + (x0 - x);
+        uint16_t *dst = row(j) + x0;
+        if (std::memcmp(dst, src, rowBytes) != 0) {
+            std::memcpy(dst, src, rowBytes);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+void Framebuffer::copyArea(const Framebuffer& source, int16_t x, int16_t y, int16_t w, int16_t h) {
+    int16_t x0 = std::max<int16_t>(x, 0);
+    int16_t y0 = std::max<int16_t>(y, 0);
+    int16_t x1 = std::min<int16_t>(x + w, std::min(width_, source.width_));
+    int16_t y1 = std::min<int16_t>(y + h, std::min(height_, source.height_));
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    const size_t rowBytes = static_cast<size_t>(x1 - x0) * sizeof(uint16_t);
+    for (int16_t j = y0; j < y1; ++j) {
+        std::memcpy(row(j) + x0, source.row(j) + x0, rowBytes);
+    }
+}
@@ -0,0 +1,43 @@
+#include "Glyph_Cache.hpp"
+#include "Framebuffer.hpp"
+
+Glyph_Cache::Glyph_Cache(const uint8_t *bitmap, unsigned char firstChar, unsigned char lastChar, int16_t height, size_t slots)
+    : bitmap_(bitmap)
+    , firstChar_(firstChar)
+    , lastChar_(lastChar)
+    , height_(height)
+    , slots_(slots, Slot{false, 0, 0, 0})
+    , pixels_(slots * width * height)
+    , hits_(0)
+    , misses_(0) {
+}
+
+const uint16_t *Glyph_Cache::get(unsigned char c, uint16_t color, uint16_t bg) {
+    if (c < firstChar_ || c > lastChar_) {
+        c = '?'; // no glyph in the font
+    }
+    // the glyph code alone spreads well over the slots, the colours only
+    // separate the few combinations a screen actually uses
+    size_t index = (c ^ (color * 7u) ^ (bg * 13u)) % slots_.size();
+    Slot &slot = slots_[index];
+    uint16_t *pixels = &pixels_[index * width * height_];
+    if (slot.valid && slot.glyph == c && slot.color == color && slot.bg == bg) {
+        hits_++;
+        return pixels;
+    }
+    misses_++;
+    render(c, color, bg, pixels);
+    slot = {true, c, color, bg};
+    return pixels;
+}
+
+void Glyph_Cache::render(unsigned char c, uint16_t color, uint16_t bg, uint16_t *pixels) const {
+    const uint16_t fgWire = Framebuffer::toWire(color);
+    const uint16_t bgWire = Framebuffer::toWire(bg);
+    const uint8_t *glyph = bitmap_ + static_cast<size_t>(c - firstChar_) * height_;
+    for (int16_t i = 0; i < height_; i++) {
+        for (int16_t j = 0; j < width; j++) {
+            *pixels++ = (glyph[i] & (0x80 >> j)) ? fgWire : bgWire;
+        }
+    }
+}
@@ -1,41 +1,250 @@
 #include "I2CBus.hpp"
-
-#include <iostream>
-#include <fcntl.h>
-#include <unistd.h>
+#include "I2C_Bus_Manager.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 // Class definition
-I2CBus::I2CBus(const std::string &deviceFile, uint8_t address_) : address_(address_) {
-    fd_ = open(deviceFile.c_str(), O_RDWR);
-    if (fd_ < 0) {
-        throw std::runtime_error("Failed to open I2C device file: " + std::string(strerror(errno)));
+I2CBus::I2CBus(const std::string &deviceFile, uint8_t address_)
+    : I2CBus(I2C_Bus_Manager::instance().adapter(deviceFile), address_) {
+}
+
+I2CBus::I2CBus(std::shared_ptr<I2C_Adapter> adapter, uint8_t address_)
+    : adapter_(std::move(adapter)), address_(address_), cache_(adapter_->registerCache(address_))
+    , transport_(Transport::I2C), pec_(false) {
+}
+
+void I2CBus::setPec(bool enable) {
+    if (enable && !(adapter_->functionality() & I2C_FUNC_SMBUS_PEC)) {
+        throw std::runtime_error("I2C adapter " + adapter_->path() + " does not support PEC");
     }
+    pec_ = enable;
 }
 
-I2CBus::~I2CBus() {
-    if (fd_ >= 0) {
-        close(fd_);
+// SMBus transaction moving length bytes at a register, 0 if the adapter has none
+static uint32_t smbusTransaction(unsigned long functionality, size_t length, bool read) {
+    if (length == 1 && (functionality & (read ? I2C_FUNC_SMBUS_READ_BYTE_DATA : I2C_FUNC_SMBUS_WRITE_BYTE_DATA))) {
+        return I2C_SMBUS_BYTE_DATA;
+    }
+    if (length == 2 && (functionality & (read ? I2C_FUNC_SMBUS_READ_WORD_DATA : I2C_FUNC_SMBUS_WRITE_WORD_DATA))) {
+        return I2C_SMBUS_WORD_DATA;
+    }
+    if (length >= 1 && length <= I2C_SMBUS_BLOCK_MAX &&
+        (functionality & (read ? I2C_FUNC_SMBUS_READ_I2C_BLOCK : I2C_FUNC_SMBUS_WRITE_I2C_BLOCK))) {
+        return I2C_SMBUS_I2C_BLOCK_DATA;
+    }
+    return 0;
+}
+
+bool I2CBus::viaSMBus(size_t length, bool read) const {
+    const unsigned long functionality = adapter_->functionality();
+    const bool plainI2C = functionality & I2C_FUNC_I2C;
+    if (plainI2C && !pec_ && transport_ == Transport::I2C) {
+        return false;
+    }
+    if (pec_) {
+        // the kernel adds and checks PEC on byte and word transactions only;
+        // I2C block data goes out without it, which would pass for checked
+        const uint32_t size = length <= 2 ? smbusTransaction(functionality, length, read) : 0;
+        if (size != I2C_SMBUS_BYTE_DATA && size != I2C_SMBUS_WORD_DATA) {
+            throw std::runtime_error("I2C adapter " + adapter_->path() + ": PEC covers 1- and 2-byte transfers only, not a " +
+                                     std::to_string(length) + "-byte " + (read ? "read" : "write"));
+        }
+        return true;
+    }
+    // longer transfers are split into blocks of I2C_SMBUS_BLOCK_MAX
+    const size_t last = (length - 1) % I2C_SMBUS_BLOCK_MAX + 1;
+    const bool possible = length > 0 && smbusTransaction(functionality, last, read) != 0 &&
+                          (length <= I2C_SMBUS_BLOCK_MAX || smbusTransaction(functionality, I2C_SMBUS_BLOCK_MAX, read) != 0);
+    if (possible) {
+        return true;
+    }
+    if (plainI2C && !pec_) {
+        return false;
+    }
+    throw std::runtime_error("I2C adapter " + adapter_->path() + " has no SMBus transaction for a " + std::to_string(length) +
+                             "-byte " + (read ? "read" : "write") + (pec_ ? " with PEC" : ""));
+}
+
+void I2CBus::smbusBlock(uint8_t reg, std::span<uint8_t> data, uint8_t readWrite) {
+    auto held = lock();
+    const bool read = readWrite == I2C_SMBUS_READ;
+    while (!data.empty()) {
+        const size_t length = std::min<size_t>(data.size(), I2C_SMBUS_BLOCK_MAX);
+        const uint32_t size = smbusTransaction(adapter_->functionality(), length, read);
+        union i2c_smbus_data buffer;
+        // SMBus words are little-endian: the first byte on the wire is the low one
+        if (!read) {
+            buffer.block[0] = static_cast<uint8_t>(length);
+            std::copy_n(data.begin(), length, buffer.block + 1);
+            if (size == I2C_SMBUS_BYTE_DATA) {
+                buffer.byte = data[0];
+            } else if (size == I2C_SMBUS_WORD_DATA) {
+                buffer.word = static_cast<uint16_t>(data[0] | (data[1] << 8));
+            }
+        } else {
+            buffer.block[0] = static_cast<uint8_t>(length);
+        }
+        adapter_->smbus(address_, pec_, readWrite, reg, size, &buffer);
+        if (read) {
+            if (size == I2C_SMBUS_BYTE_DATA) {
+                data[0] = buffer.byte;
+            } else if (size == I2C_SMBUS_WORD_DATA) {
+                data[0] = static_cast<uint8_t>(buffer.word & 0xFF);
+                data[1] = static_cast<uint8_t>(buffer.word >> 8);
+            } else {
+                std::copy_n(buffer.block + 1, length, data.begin());
+            }
+        }
+        data = data.subspan(length);
+        reg = static_cast<uint8_t>(reg + length);
     }
 }
 
+I2CBus::~I2CBus() {
+}
+
 void I2CBus::write8(uint8_t reg, uint8_t value) {
+    // the bus is held until the shadow is updated, so that a read of the
+    // register by another thread cannot store an older value after ours
+    auto held = lock();
     std::array<uint8_t, 1> data = {value};
     writeBlock(reg, data);
+    cache_.store(reg, value);
 }
 
 uint8_t I2CBus::read8(uint8_t reg) {
+    uint16_t cached;
+    if (cache_.read(reg, cached)) {
+        return static_cast<uint8_t>(cached);
+    }
+    auto held = lock();
     std::array<uint8_t, 1> valueBuffer;
     readBlock(reg, valueBuffer);
+    cache_.store(reg, valueBuffer[0]);
     return valueBuffer[0];
 }
 
 void I2CBus::write16(uint8_t reg, uint16_t value) {
+    auto held = lock();
     std::array<uint8_t, 2> data = {static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value & 0xFF)};
     writeBlock(reg, data);
+    cache_.store(reg, value);
 }
 
 uint16_t I2CBus::read16(uint8_t reg) {
+    uint16_t cached;
+    if (cache_.read(reg, cached)) {
+        return cached;
+    }
+    auto held = lock();
     std::array<uint8_t, 2> valueBuffer;
     readBlock(reg, valueBuffer);
-    return (static_cast<uint16_t>(valueBuffer[0]) << 8) | valueBuffer[1];
+    uint16_t value = (static_cast<uint16_t>(valueBuffer[0]) << 8) | valueBuffer[1];
+    cache_.store(reg, value);
+    return value;
+}
+
+void I2CBus::update8(uint8_t reg, uint8_t mask, uint8_t bits) {
+    auto held = lock();
+    uint16_t value;
+    auto result = cache_.update(reg, mask, bits, value);
+    if (result == I2C_Register_Cache::Update::Unknown) {
+        uint8_t current = read8(reg);
+        result = cache_.update(reg, mask, bits, value);
+        if (result == I2C_Register_Cache::Update::Unknown) { // not cached
+            value = (current & ~mask) | (bits & mask);
+            result = I2C_Register_Cache::Update::Write;
+        }
+    }
+    if (result == I2C_Register_Cache::Update::Write) {
+        write8(reg, static_cast<uint8_t>(value));
+    }
+}
+
+void I2CBus::update16(uint8_t reg, uint16_t mask, uint16_t bits) {
+    auto held = lock();
+    uint16_t value;
+    auto result = cache_.update(reg, mask, bits, value);
+    if (result == I2C_Register_Cache::Update::Unknown) {
+        uint16_t current = read16(reg);
+        result = cache_.update(reg, mask, bits, value);
+        if (result == I2C_Register_Cache::Update::Unknown) { // not cached
+            value = (current & ~mask) | (bits & mask);
+            result = I2C_Register_Cache::Update::Write;
+        }
+    }
+    if (result == I2C_Register_Cache::Update::Write) {
+        write16(reg, value);
+    }
+}
+
+void I2CBus::writeBlock(uint8_t reg, std::span<const uint8_t> data) {
+    for (size_t i = 0; i < data.size() && reg + i < 256; ++i) {
+        cache_.invalidate(static_cast<uint8_t>(reg + i));
+    }
+    // i2c_msg takes a non-const buffer, the kernel only reads it for writes
+    uint8_t *payload = const_cast<uint8_t *>(data.data());
+    const uint16_t length = static_cast<uint16_t>(data.size());
+    if (viaSMBus(data.size(), false)) {
+        smbusBlock(reg, std::span<uint8_t>(payload, data.size()), I2C_SMBUS_WRITE);
+        return;
+    }
+    if (adapter_->functionality() & I2C_FUNC_NOSTART) {
+        struct i2c_msg messages[2] = {
+            {address_, 0, 1, &reg},
+            {address_, I2C_M_NOSTART, length, payload},
+        };
+        adapter_->transfer(messages, length > 0 ? 2 : 1);
+        return;
+    }
+    // no gather support (i2c-bcm2835, so every write on the target): the
+    // register byte has to precede the payload in memory. Short writes, all
+    // the drivers make, are joined on the stack; longer ones on the heap.
+    uint8_t stackBuffer[stackWriteBlock + 1];
+    std::vector<uint8_t> heapBuffer;
+    uint8_t *buffer = stackBuffer;
+    if (data.size() > stackWriteBlock) {
+        heapBuffer.resize(data.size() + 1);
+        buffer = heapBuffer.data();
+    }
+    buffer[0] = reg;
+    std::copy(data.begin(), data.end(), buffer + 1);
+    struct i2c_msg message = {address_, 0, static_cast<uint16_t>(length + 1), buffer};
+    adapter_->transfer(&message, 1);
+}
+
+void I2CBus::readBlock(uint8_t reg, std::span<uint8_t> data) {
+    if (viaSMBus(data.size(), true)) {
+        smbusBlock(reg, data, I2C_SMBUS_READ);
+        return;
+    }
+    struct i2c_msg messages[2] = {
+        {address_, 0, 1, &reg},
+        {address_, I2C_M_RD, static_cast<uint16_t>(data.size()), data.data()},
+    };
+    adapter_->transfer(messages, 2);
+}
+
+void I2CBus::readRegions(std::span<const Segment> segments) {
+    auto held = lock();
+    if (!segments.empty() && viaSMBus(segments[0].data.size(), true)) {
+        // one SMBus transaction per segment, there is no gather in SMBus
+        for (const auto& segment : segments) {
+            readBlock(segment.reg, segment.data);
+        }
+        return;
+    }
+    while (!segments.empty()) {
+        const size_t count = std::min(segments.size(), maxSegments);
+        struct i2c_msg messages[2 * maxSegments];
+        uint8_t regs[maxSegments];
+        for (size_t i = 0; i < count; ++i) {
+            regs[i] = segments[i].reg;
+            messages[2 * i] = {address_, 0, 1, &regs[i]};
+            messages[2 * i + 1] = {address_, I2C_M_RD, static_cast<uint16_t>(segments[i].data.size()), segments[i].data.data()};
+        }
+        adapter_->transfer(messages, 2 * count);
+        segments = segments.subspan(count);
+    }
 }
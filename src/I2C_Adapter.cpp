@@ -0,0 +1,263 @@
+#include "I2C_Adapter.hpp"
+#include "I2C_Profiler.hpp"
+#include <stdexcept>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c-dev.h>
+
+I2C_Adapter::I2C_Adapter(const std::string& path)
+    : I2C_Adapter(path, open(path.c_str(), O_RDWR)) {
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to open I2C device file " + path + ": " + std::string(strerror(errno)));
+    }
+    if (ioctl(fd_, I2C_FUNCS, &functionality_) < 0) {
+        functionality_ = I2C_FUNC_I2C; // plain I2C_RDWR is all we rely on
+    }
+}
+
+I2C_Adapter::I2C_Adapter(const std::string& path, int fd)
+    : fd_(fd)
+    , functionality_(I2C_FUNC_I2C)
+    , path_(path)
+    , nextTicket_(0)
+    , serving_(0)
+    , owner_()
+    , depth_(0)
+    , stats_{}
+    , policy_(defaultRetryPolicy)
+    , jitter_(fd)
+    , slave_(-1)
+    , pec_(false)
+    , reopenPending_(false) {
+}
+
+I2C_Adapter::~I2C_Adapter() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void I2C_Adapter::lock() {
+    std::unique_lock<std::mutex> guard(mutex_);
+    if (depth_ > 0 && owner_ == std::this_thread::get_id()) {
+        depth_++;
+        return;
+    }
+    // ticket lock: waiters are served strictly in arrival order
+    const uint64_t ticket = nextTicket_++;
+    turn_.wait(guard, [this, ticket] { return serving_ == ticket; });
+    owner_ = std::this_thread::get_id();
+    depth_ = 1;
+}
+
+void I2C_Adapter::unlock() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (--depth_ > 0) {
+        return;
+    }
+    owner_ = std::thread::id();
+    serving_++;
+    turn_.notify_all();
+}
+
+// Runs attempt() under the bus lock, with retries and recovery as set by the
+// policy; messages describe the traffic for the stats and the profiler
+template <typename Attempt>
+void I2C_Adapter::retrying(const struct i2c_msg *messages, size_t count, Attempt attempt) {
+    std::lock_guard<I2C_Adapter> lock(*this);
+    const auto deadline = std::chrono::steady_clock::now() + policy_.deadline;
+    I2C_Profiler &profiler = I2C_Profiler::instance();
+    for (unsigned int tries = 1; ; ++tries) {
+        if (reopenPending_) {
+            // an earlier recovery left the device file closed
+            reopenPending_ = !reopen();
+            if (reopenPending_) {
+                throw I2C_Error("I2C device file " + path_ + " could not be reopened", EBADF);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            stats_.ioctls++;
+            stats_.messages += count;
+            for (size_t i = 0; i < count; ++i) {
+                stats_.bytes += messages[i].len;
+            }
+        }
+        const bool profiling = profiler.enabled(); // no clock reads otherwise
+        const auto start = profiling ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        try {
+            attempt();
+            if (profiling) {
+                profiler.record(messages, count, std::chrono::steady_clock::now() - start, false);
+            }
+            return;
+        } catch (const I2C_Error& e) {
+            if (profiling) {
+                profiler.record(messages, count, std::chrono::steady_clock::now() - start, true);
+            }
+            if (!isTransient(e.error()) || tries >= policy_.attempts) {
+                throw;
+            }
+            const auto delay = backoff(tries);
+            if (std::chrono::steady_clock::now() + delay > deadline) {
+                throw; // the retry would break the latency bound
+            }
+            if (tries >= policy_.recoverAfter) {
+                recover();
+            }
+            std::this_thread::sleep_for(delay);
+            std::lock_guard<std::mutex> guard(mutex_);
+            stats_.retries++;
+        }
+    }
+}
+
+void I2C_Adapter::transfer(struct i2c_msg *messages, size_t count) {
+    retrying(messages, count, [this, messages, count] { rdwr(messages, count); });
+}
+
+void I2C_Adapter::smbus(uint8_t address, bool pec, uint8_t readWrite, uint8_t command, uint32_t size, union i2c_smbus_data *data) {
+    // the same transaction as i2c_msg segments, for the stats and the profiler
+    uint16_t length = 0;
+    switch (size) {
+    case I2C_SMBUS_BYTE_DATA: length = 1; break;
+    case I2C_SMBUS_WORD_DATA: length = 2; break;
+    case I2C_SMBUS_I2C_BLOCK_DATA: length = data->block[0]; break;
+    default: break;
+    }
+    length += pec ? 1 : 0;
+    struct i2c_msg messages[2] = {
+        {address, 0, 1, &command},
+        {address, I2C_M_RD, length, nullptr},
+    };
+    size_t count = 2;
+    if (readWrite == I2C_SMBUS_WRITE) {
+        messages[0].len = static_cast<uint16_t>(1 + length);
+        count = 1;
+    }
+    retrying(messages, count, [=, this] { smbusXfer(address, pec, readWrite, command, size, data); });
+}
+
+void I2C_Adapter::rdwr(struct i2c_msg *messages, size_t count) {
+    struct i2c_rdwr_ioctl_data ioctlData;
+    ioctlData.msgs = messages;
+    ioctlData.nmsgs = count;
+    if (ioctl(fd_, I2C_RDWR, &ioctlData) < 0) {
+        const int error = errno;
+        throw I2C_Error("I2C transfer failed on " + path_ + ": " + std::string(strerror(error)), error);
+    }
+}
+
+void I2C_Adapter::smbusXfer(uint8_t address, bool pec, uint8_t readWrite, uint8_t command, uint32_t size, union i2c_smbus_data *data) {
+    // I2C_SMBUS addresses the device set on the descriptor, which all handles
+    // share; it is switched only when another device is addressed. FORCE,
+    // like I2C_RDWR, also reaches addresses a kernel driver has claimed
+    // (e.g. rtc-pcf8563), where plain I2C_SLAVE fails with EBUSY
+    if (slave_ != address) {
+        if (ioctl(fd_, I2C_SLAVE_FORCE, address) < 0) {
+            const int error = errno;
+            throw I2C_Error("I2C_SLAVE_FORCE failed on " + path_ + ": " + std::string(strerror(error)), error);
+        }
+        slave_ = address;
+    }
+    if (pec_ != pec) {
+        if (ioctl(fd_, I2C_PEC, pec ? 1 : 0) < 0) {
+            const int error = errno;
+            throw I2C_Error("I2C_PEC failed on " + path_ + ": " + std::string(strerror(error)), error);
+        }
+        pec_ = pec;
+    }
+    struct i2c_smbus_ioctl_data ioctlData;
+    ioctlData.read_write = readWrite;
+    ioctlData.command = command;
+    ioctlData.size = size;
+    ioctlData.data = data;
+    if (ioctl(fd_, I2C_SMBUS, &ioctlData) < 0) {
+        const int error = errno;
+        throw I2C_Error("SMBus transfer failed on " + path_ + ": " + std::string(strerror(error)), error);
+    }
+}
+
+bool I2C_Adapter::reopen() {
+    slave_ = -1;
+    pec_ = false;
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+    fd_ = open(path_.c_str(), O_RDWR);
+    if (fd_ < 0) {
+        std::cerr << "I2C: failed to reopen " << path_ << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void I2C_Adapter::recover() {
+    reopenPending_ = !reopen();
+    if (recoveryHook_) {
+        recoveryHook_();
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    // a stuck bus is often a device which lost its state, or was reset
+    for (auto& [address, cache] : caches_) {
+        cache->invalidateAll();
+    }
+    stats_.recoveries++;
+}
+
+std::chrono::microseconds I2C_Adapter::backoff(unsigned int retry) {
+    // exponential, capped, with "equal jitter": half fixed, half random, so
+    // devices failing together do not retry in lockstep
+    auto delay = policy_.baseDelay * (1u << std::min(retry - 1, 16u));
+    delay = std::min(delay, policy_.maxDelay);
+    std::uniform_int_distribution<int64_t> half(0, delay.count() / 2);
+    return std::chrono::microseconds(delay.count() - delay.count() / 2 + half(jitter_));
+}
+
+bool I2C_Adapter::isTransient(int error) {
+    switch (error) {
+    case EIO:
+    case ETIMEDOUT:
+    case EAGAIN:
+    case EBUSY:
+    case EBADMSG: // PEC mismatch, the data was corrupted on the wire
+        return true;
+    default:
+        return false;
+    }
+}
+
+void I2C_Adapter::setRetryPolicy(const Retry_Policy& policy) {
+    std::lock_guard<I2C_Adapter> lock(*this);
+    policy_ = policy;
+}
+
+void I2C_Adapter::setRecoveryHook(std::function<void()> hook) {
+    std::lock_guard<I2C_Adapter> lock(*this);
+    recoveryHook_ = std::move(hook);
+}
+
+I2C_Register_Cache& I2C_Adapter::registerCache(uint8_t address) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &cache = caches_[address];
+    if (!cache) {
+        cache = std::make_unique<I2C_Register_Cache>();
+    }
+    return *cache;
+}
+
+I2C_Adapter::Stats I2C_Adapter::stats() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return stats_;
+}
+
+void I2C_Adapter::resetStats() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stats_ = {};
+}
@@ -0,0 +1,146 @@
+#include "I2C_Async_Engine.hpp"
+
+I2C_Async_Engine::I2C_Async_Engine(std::shared_ptr<I2C_Adapter> adapter)
+    : adapter_(std::move(adapter))
+    , stopping_(false)
+    , stats_{}
+    , worker_(&I2C_Async_Engine::worker, this) {
+}
+
+I2C_Async_Engine::~I2C_Async_Engine() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    queued_.notify_one();
+    worker_.join();
+}
+
+std::future<std::vector<uint8_t>> I2C_Async_Engine::read(uint8_t address, uint8_t reg, size_t length) {
+    auto promise = std::make_shared<std::promise<std::vector<uint8_t>>>();
+    auto future = promise->get_future();
+    read(address, reg, length, [promise](std::vector<uint8_t> data, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value(std::move(data));
+        }
+    });
+    return future;
+}
+
+void I2C_Async_Engine::read(uint8_t address, uint8_t reg, size_t length, Callback callback) {
+    enqueue({address, std::vector<uint8_t>(length), reg, true, std::move(callback)});
+}
+
+std::future<void> I2C_Async_Engine::write(uint8_t address, uint8_t reg, std::vector<uint8_t> data) {
+    auto promise = std::make_shared<std::promise<void>>();
+    auto future = promise->get_future();
+    write(address, reg, std::move(data), [promise](std::vector<uint8_t>, std::exception_ptr error) {
+        if (error) {
+            promise->set_exception(error);
+        } else {
+            promise->set_value();
+        }
+    });
+    return future;
+}
+
+void I2C_Async_Engine::write(uint8_t address, uint8_t reg, std::vector<uint8_t> data, Callback callback) {
+    data.insert(data.begin(), reg);
+    enqueue({address, std::move(data), reg, false, std::move(callback)});
+}
+
+void I2C_Async_Engine::enqueue(Request request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(request));
+    }
+    queued_.notify_one();
+}
+
+I2C_Async_Engine::Stats I2C_Async_Engine::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void I2C_Async_Engine::worker() {
+    std::vector<Request> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queued_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return; // stopping, everything queued has been served
+            }
+            // a write goes out alone; otherwise take as many waiting reads
+            // as fit into one I2C_RDWR, up to the next write
+            size_t messages = 0;
+            do {
+                messages += queue_.front().messages();
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            } while (batch.front().isRead && !queue_.empty() && queue_.front().isRead &&
+                     messages + queue_.front().messages() <= maxMessages);
+        }
+        execute(batch);
+        batch.clear();
+    }
+}
+
+void I2C_Async_Engine::addMessages(Request& request, std::vector<struct i2c_msg>& messages) {
+    if (request.isRead) {
+        messages.push_back({request.address, 0, 1, &request.reg});
+        messages.push_back({request.address, I2C_M_RD, static_cast<uint16_t>(request.buffer.size()), request.buffer.data()});
+    } else {
+        messages.push_back({request.address, 0, static_cast<uint16_t>(request.buffer.size()), request.buffer.data()});
+    }
+}
+
+void I2C_Async_Engine::execute(std::vector<Request>& batch) {
+    std::vector<struct i2c_msg> messages;
+    messages.reserve(maxMessages);
+    for (auto& request : batch) {
+        addMessages(request, messages);
+    }
+    uint64_t batches = 1;
+    uint64_t retries = 0;
+    std::exception_ptr error;
+    try {
+        adapter_->transfer(messages.data(), messages.size());
+    } catch (const std::exception&) {
+        error = std::current_exception();
+    }
+    std::vector<std::exception_ptr> results(batch.size(), error);
+    if (error && batch.size() > 1) {
+        // the kernel stops at the first failing message without saying which
+        // one it was; repeat the requests alone to find out. Batches hold
+        // only reads, so nothing that already took effect is sent twice
+        for (size_t i = 0; i < batch.size(); ++i) {
+            messages.clear();
+            addMessages(batch[i], messages);
+            batches++;
+            retries++;
+            try {
+                adapter_->transfer(messages.data(), messages.size());
+                results[i] = nullptr;
+            } catch (const std::exception&) {
+                results[i] = std::current_exception();
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.requests += batch.size();
+        stats_.batches += batches;
+        stats_.retries += retries;
+    }
+    for (size_t i = 0; i < batch.size(); ++i) {
+        Request& request = batch[i];
+        if (results[i]) {
+            request.done({}, results[i]);
+        } else {
+            request.done(request.isRead ? std::move(request.buffer) : std::vector<uint8_t>{}, nullptr);
+        }
+    }
+}
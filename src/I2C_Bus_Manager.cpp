@@ -0,0 +1,20 @@
+#include "I2C_Bus_Manager.hpp"
+
+I2C_Bus_Manager& I2C_Bus_Manager::instance() {
+    static I2C_Bus_Manager manager;
+    return manager;
+}
+
+std::shared_ptr<I2C_Adapter> I2C_Bus_Manager::adapter(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = adapters_[path];
+    if (!entry) {
+        entry = std::make_shared<I2C_Adapter>(path);
+    }
+    return entry;
+}
+
+void I2C_Bus_Manager::registerAdapter(const std::string& path, std::shared_ptr<I2C_Adapter> adapter) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    adapters_[path] = std::move(adapter);
+}
@@ -0,0 +1,144 @@
+#include "I2C_Discovery.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+I2C_Discovery::I2C_Discovery(const std::string& cacheFile)
+    : cacheFile_(cacheFile)
+    , fromCache_(false) {
+}
+
+void I2C_Discovery::addDriver(const Driver& driver) {
+    drivers_.push_back(driver);
+}
+
+const std::vector<I2C_Discovery::Device>& I2C_Discovery::discover(const std::vector<std::string>& buses) {
+    const std::string key = fingerprint(buses);
+    fromCache_ = load(key);
+    if (!fromCache_ && scan(buses)) {
+        save(key);
+    }
+    return devices_;
+}
+
+std::optional<I2C_Discovery::Device> I2C_Discovery::find(const std::string& driver) const {
+    for (const auto& device : devices_) {
+        if (device.driver == driver) {
+            return device;
+        }
+    }
+    return std::nullopt;
+}
+
+void I2C_Discovery::invalidate() {
+    std::remove(cacheFile_.c_str());
+    devices_.clear();
+    fromCache_ = false;
+}
+
+// FNV-1a over the buses and the driver table, so that a cache written for
+// another configuration is not trusted
+std::string I2C_Discovery::fingerprint(const std::vector<std::string>& buses) const {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto mix = [&hash](const std::string& text) {
+        for (unsigned char c : text) {
+            hash = (hash ^ c) * 0x100000001b3ull;
+        }
+        hash = (hash ^ '\n') * 0x100000001b3ull;
+    };
+    for (const auto& bus : buses) {
+        mix(bus);
+    }
+    for (const auto& driver : drivers_) {
+        mix(driver.name);
+        mix(std::string(driver.addresses.begin(), driver.addresses.end()));
+    }
+    std::ostringstream key;
+    key << std::hex << hash;
+    return key.str();
+}
+
+// File format: a header line "i2c-discovery <key>", then one line per
+// device: "<bus> <address, hex> <driver>"
+bool I2C_Discovery::load(const std::string& key) {
+    std::ifstream in(cacheFile_);
+    std::string magic;
+    std::string fileKey;
+    if (!(in >> magic >> fileKey) || magic != "i2c-discovery" || fileKey != key) {
+        return false;
+    }
+    std::vector<Device> devices;
+    Device device;
+    unsigned int address;
+    while (in >> device.bus >> std::hex >> address >> std::dec >> device.driver) {
+        if (address > 0x7F) {
+            return false;
+        }
+        device.address = static_cast<uint8_t>(address);
+        devices.push_back(device);
+    }
+    if (!in.eof()) {
+        return false; // malformed line
+    }
+    devices_ = std::move(devices);
+    return true;
+}
+
+void I2C_Discovery::save(const std::string& key) const {
+    // written aside and renamed, so that a crash never leaves half a file
+    const std::string temporary = cacheFile_ + ".tmp";
+    {
+        std::ofstream out(temporary);
+        out << "i2c-discovery " << key << "\n";
+        for (const auto& device : devices_) {
+            out << device.bus << " " << std::hex << static_cast<unsigned int>(device.address) << std::dec
+                << " " << device.driver << "\n";
+        }
+        if (!out.flush()) {
+            std::cerr << "I2C_Discovery: cannot write " << temporary << std::endl;
+            return;
+        }
+    }
+    if (std::rename(temporary.c_str(), cacheFile_.c_str()) != 0) {
+        std::cerr << "I2C_Discovery: cannot write " << cacheFile_ << std::endl;
+    }
+}
+
+bool I2C_Discovery::scan(const std::vector<std::string>& buses) {
+    devices_.clear();
+    bool complete = true;
+    for (const auto& bus : buses) {
+        bool available = true;
+        for (const auto& driver : drivers_) {
+            for (uint8_t address : driver.addresses) {
+                if (!available) {
+                    break;
+                }
+                bool found = false;
+                try {
+                    I2CBus i2cBus(bus, address);
+                    found = driver.probe(i2cBus);
+                } catch (const I2C_Error& e) {
+                    // nothing acknowledges the address: ENXIO, or EREMOTEIO
+                    // from i2c-bcm2835; anything else leaves the answer open
+                    if (e.error() != ENXIO && e.error() != EREMOTEIO) {
+                        std::cerr << "I2C_Discovery: " << bus << " at 0x" << std::hex << static_cast<int>(address)
+                                  << std::dec << ": " << e.what() << std::endl;
+                        complete = false;
+                    }
+                } catch (const std::exception& e) {
+                    std::cerr << "I2C_Discovery: " << bus << ": " << e.what() << std::endl;
+                    available = false;
+                    complete = false;
+                }
+                if (found) {
+                    devices_.push_back({driver.name, bus, address});
+                    break;
+                }
+            }
+        }
+    }
+    return complete;
+}
@@ -0,0 +1,97 @@
+#include "I2C_Profiler.hpp"
+#include <bit>
+#include <iomanip>
+
+namespace {
+// single writer: a relaxed load and store is enough and avoids a locked RMW
+void increment(std::atomic<uint64_t> &counter, uint64_t value = 1) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+}
+
+I2C_Profiler& I2C_Profiler::instance() {
+    static I2C_Profiler profiler;
+    return profiler;
+}
+
+I2C_Profiler::I2C_Profiler()
+    : enabled_(true) {
+}
+
+I2C_Profiler::Thread_Block& I2C_Profiler::threadBlock() {
+    thread_local Thread_Block *block = nullptr;
+    if (!block) {
+        auto owned = std::make_unique<Thread_Block>(); // value-initialised: all counters 0
+        block = owned.get();
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocks_.push_back(std::move(owned));
+    }
+    return *block;
+}
+
+size_t I2C_Profiler::bucket(std::chrono::nanoseconds latency) {
+    const uint64_t us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    const size_t index = static_cast<size_t>(std::bit_width(us)); // us < 2^index
+    return index < buckets ? index : buckets - 1;
+}
+
+void I2C_Profiler::record(const struct i2c_msg *messages, size_t count, std::chrono::nanoseconds latency, bool failed) {
+    if (!enabled()) {
+        return;
+    }
+    Thread_Block &block = threadBlock();
+    const size_t slot = bucket(latency);
+    for (size_t i = 0; i < count; ++i) {
+        Counters &device = block.devices[messages[i].addr % addresses];
+        increment(device.bytes, messages[i].len);
+        bool seen = false; // one transaction per device and call
+        for (size_t k = 0; k < i && !seen; ++k) {
+            seen = messages[k].addr == messages[i].addr;
+        }
+        if (!seen) {
+            increment(device.transactions);
+            increment(device.histogram[slot]);
+            if (failed) {
+                increment(device.errors);
+            }
+        }
+    }
+}
+
+I2C_Profiler::Device_Stats I2C_Profiler::device(uint8_t address) const {
+    Device_Stats total{};
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &block : blocks_) {
+        const Counters &device = block->devices[address % addresses];
+        total.transactions += device.transactions.load(std::memory_order_relaxed);
+        total.bytes += device.bytes.load(std::memory_order_relaxed);
+        total.errors += device.errors.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < buckets; ++i) {
+            total.histogram[i] += device.histogram[i].load(std::memory_order_relaxed);
+        }
+    }
+    return total;
+}
+
+void I2C_Profiler::dump(std::ostream &out) const {
+    out << "I2C profile: address, transactions, bytes, errors, latency histogram (count per bucket, upper bound)" << std::endl;
+    for (size_t address = 0; address < addresses; ++address) {
+        Device_Stats stats = device(static_cast<uint8_t>(address));
+        if (stats.transactions == 0) {
+            continue;
+        }
+        out << "  0x" << std::hex << std::setw(2) << std::setfill('0') << address << std::dec << std::setfill(' ')
+            << std::setw(10) << stats.transactions << std::setw(10) << stats.bytes << std::setw(6) << stats.errors << " ";
+        for (size_t i = 0; i < buckets; ++i) {
+            if (stats.histogram[i] == 0) {
+                continue;
+            }
+            if (i + 1 < buckets) {
+                out << " <" << (1ull << i) << "us:" << stats.histogram[i];
+            } else {
+                out << " more:" << stats.histogram[i];
+            }
+        }
+        out << std::endl;
+    }
+}
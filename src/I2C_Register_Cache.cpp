@@ -0,0 +1,67 @@
+#include "I2C_Register_Cache.hpp"
+
+I2C_Register_Cache::I2C_Register_Cache()
+    : entries_{}
+    , stats_{} {
+}
+
+void I2C_Register_Cache::cacheRegister(uint8_t reg, uint16_t volatileBits, uint16_t volatileWrite) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cached_.test(reg)) {
+        return; // every handle of the device declares its registers, keep the shadow
+    }
+    cached_.set(reg);
+    entries_[reg] = {0, volatileBits, static_cast<uint16_t>(volatileWrite & volatileBits)};
+}
+
+bool I2C_Register_Cache::read(uint8_t reg, uint16_t &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!cached_.test(reg)) {
+        return false;
+    }
+    if (valid_.test(reg) && entries_[reg].volatileBits == 0) {
+        value = entries_[reg].value;
+        stats_.hits++;
+        return true;
+    }
+    stats_.misses++;
+    return false;
+}
+
+I2C_Register_Cache::Update I2C_Register_Cache::update(uint8_t reg, uint16_t mask, uint16_t bits, uint16_t &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!cached_.test(reg) || !valid_.test(reg)) {
+        return Update::Unknown;
+    }
+    const Entry &entry = entries_[reg];
+    const uint16_t stable = entry.value & ~entry.volatileBits;
+    value = (stable & ~mask) | (entry.volatileWrite & ~mask) | (bits & mask);
+    if ((mask & entry.volatileBits) == 0 && (value & ~entry.volatileBits) == stable) {
+        stats_.writesSkipped++;
+        return Update::Unchanged;
+    }
+    return Update::Write;
+}
+
+void I2C_Register_Cache::store(uint8_t reg, uint16_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cached_.test(reg)) {
+        entries_[reg].value = value;
+        valid_.set(reg);
+    }
+}
+
+void I2C_Register_Cache::invalidate(uint8_t reg) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    valid_.reset(reg);
+}
+
+void I2C_Register_Cache::invalidateAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    valid_.reset();
+}
+
+I2C_Register_Cache::Stats I2C_Register_Cache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -0,0 +1,102 @@
+#include "I2C_Scheduler.hpp"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+I2C_Scheduler::I2C_Scheduler(const Config& config)
+    : config_(config)
+    , epoch_(std::chrono::steady_clock::now()) {
+}
+
+I2C_Scheduler::Slot I2C_Scheduler::add(const Device& device) {
+    Slot slot;
+    Report plan;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const uint64_t us = clocks(device.messages, device.bytes) * 1000000 / config_.clockHz;
+        entries_.push_back({device, std::chrono::microseconds(us), epoch_});
+        slot = entries_.size() - 1;
+        stagger();
+    }
+    plan = report();
+    if (!plan.fits) {
+        const auto flags = std::cerr.flags();
+        const auto precision = std::cerr.precision();
+        std::cerr << "I2C_Scheduler: adding " << device.name << " brings the bus to " << std::fixed << std::setprecision(1)
+                  << plan.utilisation * 100 << "% of its time at " << config_.clockHz / 1000 << " kHz, over the limit of "
+                  << config_.utilisationLimit * 100 << "%" << std::endl;
+        std::cerr.flags(flags);
+        std::cerr.precision(precision);
+    }
+    return slot;
+}
+
+void I2C_Scheduler::stagger() {
+    // spread the first slots evenly over the shortest period; later slots
+    // follow each device's own period
+    auto shortest = std::min_element(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+        return a.device.period < b.device.period;
+    })->device.period;
+    const auto step = std::chrono::duration_cast<std::chrono::steady_clock::duration>(shortest) / entries_.size();
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        entries_[i].next = epoch_ + step * i;
+    }
+}
+
+double I2C_Scheduler::utilisation(const Entry& entry) const {
+    return static_cast<double>(entry.busTime.count()) / std::chrono::duration_cast<std::chrono::microseconds>(entry.device.period).count();
+}
+
+std::chrono::microseconds I2C_Scheduler::busTime(Slot slot) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.at(slot).busTime;
+}
+
+I2C_Scheduler::Report I2C_Scheduler::report() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    double total = 0;
+    for (const auto& entry : entries_) {
+        total += utilisation(entry);
+    }
+    return {total, total <= config_.utilisationLimit};
+}
+
+void I2C_Scheduler::print(std::ostream& out) const {
+    Report plan = report();
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << "I2C plan at " << config_.clockHz / 1000 << " kHz:" << std::endl;
+    for (const auto& entry : entries_) {
+        out << "  " << std::left << std::setw(10) << entry.device.name << std::right
+            << " every " << std::setw(5) << entry.device.period.count() << " ms, "
+            << std::setw(5) << entry.busTime.count() << " us per sample, "
+            << std::fixed << std::setprecision(3) << utilisation(entry) * 100 << "% of the bus" << std::endl;
+    }
+    out << "  total " << std::fixed << std::setprecision(3) << plan.utilisation * 100 << "%, limit "
+        << config_.utilisationLimit * 100 << "%" << (plan.fits ? "" : " - OVER CAPACITY") << std::endl;
+    out.flags(flags);
+    out.precision(precision);
+}
+
+std::chrono::steady_clock::time_point I2C_Scheduler::waitForSlot(Slot slot) {
+    std::chrono::steady_clock::time_point when;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Entry& entry = entries_.at(slot);
+        const auto now = std::chrono::steady_clock::now();
+        if (entry.next > now) {
+            when = entry.next;
+            entry.next += entry.device.period;
+        } else {
+            // late: sample now and skip the missed slots instead of catching up in a burst
+            while (entry.next <= now) {
+                when = entry.next;
+                entry.next += entry.device.period;
+            }
+        }
+    }
+    std::this_thread::sleep_until(when);
+    return when;
+}
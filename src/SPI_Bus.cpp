@@ -0,0 +1,83 @@
+#include "SPI_Bus.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <cerrno>
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+SPI_Bus::SPI_Bus(const Config& config)
+    : config_(config)
+    , fd_(-1)
+    , maxTransferSize_(readBufferSize())
+    , stats_{} {
+
+    fd_ = open(config_.spiDevice.c_str(), O_RDWR);
+    if (fd_ < 0) {
+        throw std::runtime_error("Failed to open SPI device " + config_.spiDevice + ": " + std::string(strerror(errno)));
+    }
+
+    // Configure SPI mode, bit order, bits per word, and speed
+    uint8_t bitOrder = 0; // 0 for MSB first
+    if (ioctl(fd_, SPI_IOC_WR_MODE, &config_.mode) < 0 ||
+        ioctl(fd_, SPI_IOC_WR_LSB_FIRST, &bitOrder) < 0 ||
+        ioctl(fd_, SPI_IOC_WR_BITS_PER_WORD, &config_.bitsPerWord) < 0 ||
+        ioctl(fd_, SPI_IOC_WR_MAX_SPEED_HZ, &config_.speedHz) < 0) {
+        close(fd_);
+        throw std::runtime_error("Failed to configure SPI device " + config_.spiDevice);
+    }
+}
+
+SPI_Bus::SPI_Bus(const Config& config, size_t maxTransferSize)
+    : config_(config)
+    , fd_(-1)
+    , maxTransferSize_(maxTransferSize)
+    , stats_{} {
+}
+
+SPI_Bus::~SPI_Bus() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+void SPI_Bus::transfer(const uint8_t *tx, uint8_t *rx, size_t length) {
+    struct spi_ioc_transfer spi = {};
+    spi.tx_buf = reinterpret_cast<unsigned long>(tx);
+    spi.rx_buf = reinterpret_cast<unsigned long>(rx);
+    spi.len = length;
+    submit(&spi, 1);
+}
+
+void SPI_Bus::submit(struct spi_ioc_transfer *transfers, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        // zero means "use the device default" for the kernel, make it explicit
+        if (transfers[i].speed_hz == 0) {
+            transfers[i].speed_hz = config_.speedHz;
+        }
+        if (transfers[i].bits_per_word == 0) {
+            transfers[i].bits_per_word = config_.bitsPerWord;
+        }
+        stats_.bytes += transfers[i].len;
+    }
+    stats_.ioctls++;
+    message(transfers, count);
+}
+
+void SPI_Bus::message(struct spi_ioc_transfer *transfers, size_t count) {
+    // SPI_IOC_MESSAGE(N) expects a compile-time N, build the request code by hand
+    unsigned long request = _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0, SPI_MSGSIZE(count));
+    if (ioctl(fd_, request, transfers) < 0) {
+        throw std::runtime_error("SPI transfer failed on " + config_.spiDevice + ": " + std::string(strerror(errno)));
+    }
+}
+
+size_t SPI_Bus::readBufferSize() {
+    std::ifstream bufsiz(bufsizPath);
+    size_t size = 0;
+    if (bufsiz >> size && size > 0) {
+        return size;
+    }
+    return defaultBufferSize;
+}
@@ -0,0 +1,48 @@
+#include "SPI_Transaction.hpp"
+#include <stdexcept>
+
+SPI_Transaction::SPI_Transaction(SPI_Bus& bus)
+    : bus_(bus)
+    , transfers_{}
+    , count_(0)
+    , bytes_(0) {
+}
+
+SPI_Transaction& SPI_Transaction::write(const uint8_t *tx, size_t length, const Options& options) {
+    return transfer(tx, nullptr, length, options);
+}
+
+SPI_Transaction& SPI_Transaction::read(uint8_t *rx, size_t length, const Options& options) {
+    // a null tx buffer makes the controller shift out zeros
+    return transfer(nullptr, rx, length, options);
+}
+
+SPI_Transaction& SPI_Transaction::transfer(const uint8_t *tx, uint8_t *rx, size_t length, const Options& options) {
+    if (length > bus_.maxTransferSize()) {
+        throw std::length_error("SPI transfer longer than the spidev buffer");
+    }
+    if (count_ == maxTransfers || bytes_ + length > bus_.maxTransferSize()) {
+        submit();
+    }
+    struct spi_ioc_transfer &spi = transfers_[count_++];
+    spi = {};
+    spi.tx_buf = reinterpret_cast<unsigned long>(tx);
+    spi.rx_buf = reinterpret_cast<unsigned long>(rx);
+    spi.len = length;
+    spi.speed_hz = options.speedHz;
+    spi.delay_usecs = options.delayUsecs;
+    spi.cs_change = options.csChange ? 1 : 0;
+    bytes_ += length;
+    return *this;
+}
+
+void SPI_Transaction::submit() {
+    if (count_ == 0) {
+        return;
+    }
+    // reset first, a failed ioctl must not leave stale pointers queued
+    size_t count = count_;
+    count_ = 0;
+    bytes_ = 0;
+    bus_.submit(transfers_.data(), count);
+}
@@ -0,0 +1,87 @@
+#include "Widgets.hpp"
+#include <algorithm>
+
+Label::Label(ST7789& display, int16_t x, int16_t y, size_t cells, uint16_t color, uint16_t bg)
+    : display(display)
+    , x(x)
+    , y(y)
+    , width(std::min(cells, maxCells))
+    , color(color)
+    , bg(bg)
+    , drawn(false)
+    , shown{}
+    , cellDraws(0)
+{
+}
+
+void Label::setText(std::string_view text) {
+    for (size_t i = 0; i < width; ++i) {
+        char c = (i < text.size()) ? text[i] : ' ';
+        if (drawn && shown[i] == c) {
+            continue;
+        }
+        display.drawChar(static_cast<int16_t>(x + i * ST7789::font_width), y, c, color, bg);
+        shown[i] = c;
+        cellDraws++;
+    }
+    drawn = true;
+}
+
+void Label::setColors(uint16_t newColor, uint16_t newBg) {
+    if (newColor == color && newBg == bg) {
+        return;
+    }
+    color = newColor;
+    bg = newBg;
+    if (drawn) {
+        drawn = false;
+        setText(std::string_view(shown.data(), width));
+    }
+}
+
+Numeric_Field::Numeric_Field(ST7789& display, int16_t x, int16_t y, const Format& format)
+    : format(format)
+    , label(display, x, y, format.digits + format.suffix.size())
+    , valid(false)
+    , value(0)
+{
+}
+
+void Numeric_Field::setValue(float newValue) {
+    float scale = 1.0f;
+    for (unsigned i = 0; i < format.decimals; ++i) {
+        scale *= 10.0f;
+    }
+    // round half away from zero
+    float scaled = newValue * scale;
+    setScaled(static_cast<int32_t>(scaled + (scaled < 0 ? -0.5f : 0.5f)));
+}
+
+void Numeric_Field::setScaled(int32_t newValue) {
+    if (valid && newValue == value) {
+        return;
+    }
+    value = newValue;
+    valid = true;
+    Fixed_String<Label::maxCells> text;
+    Text_Format::fixedPoint(text, value, format.decimals, format.digits, format.showPos);
+    text.append(format.suffix);
+    label.setText(text.view());
+}
+
+Clock_Field::Clock_Field(ST7789& display, int16_t x, int16_t y, Show show, size_t cells)
+    : show(show)
+    , label(display, x, y, cells)
+{
+}
+
+void Clock_Field::setTime(const struct tm& time) {
+    Fixed_String<Label::maxCells> text;
+    text.append(label.cells() > 8 ? label.cells() - 8 : 0, ' ');
+    if (show == Show::Time) {
+        Text_Format::time(text, time);
+    } else {
+        Text_Format::date(text, time);
+    }
+    label.setText(text.view());
+}
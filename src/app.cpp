@@ -37,12 +37,17 @@ Exercise:
  **************************************************************** */
 
 #include "app.hpp"
-#include <csignal>     // for signal, SIGINT
+#include "I2C_Profiler.hpp"
+#include "I2C_Discovery.hpp"
+#include "Filter_Pipeline.hpp"
+#include <csignal>     // for signal, SIGINT, SIGUSR1
 #include <thread>      // for std::thread
 #include <fcntl.h>     // for open
 #include <sys/ioctl.h> // for ioctl
 #include <sys/time.h>  // for settimeofday
 #include <iomanip>     // for std::setw, std::setfill
+#include <memory>      // for std::unique_ptr
+#include <vector>      // for std::vector
 
 // Hardware configuration
 Hardware_config_t hardwareConfig = {
@@ -61,12 +66,19 @@ Hardware_config_t hardwareConfig = {
     ,
     .mcp9808Config = {
         .i2cBusDevice = "/dev/i2c-1",
-        .i2cAddress = 0x18
+        .i2cAddress = 0x18,
+        .samplePeriod = std::chrono::milliseconds(1000),
+        .identified = false,
+        .alertChip = "",            // "gpiochip0" with .alertPin once ALERT is wired; polling otherwise
+        .alertPin = 0,
+        .resolution = MCP9808::Resolution::C0_0625,   // 250 ms conversions; C0_5 for 30 ms
+        .oneShot = false
     }
     ,
     .pcf8563Config = {
         .i2cBusDevice = "/dev/i2c-1",
-        .i2cAddress = 0x51
+        .i2cAddress = 0x51,
+        .samplePeriod = std::chrono::milliseconds(1000)
     }
     ,
     .LED = {"lwsw-led"}
@@ -114,6 +126,13 @@ Hardware_config_t hardwareConfig = {
         .minAngle=-45, 
         .maxAngle=45
     }
+    ,
+    .i2cSchedule = {
+        .clockHz = 100000,          // Raspberry Pi default for i2c-1
+        .utilisationLimit = 0.5     // headroom for user actions and retries
+    }
+    ,
+    .i2cDiscoveryCache = "/var/tmp/lwsw-i2c-devices"
 };
 
 // Global variable for synchronization and state sharing
@@ -122,7 +141,8 @@ Application_state_t appState {
     .setAlarm = false,
     .alarmTime = std::chrono::steady_clock::time_point::min(),
     .tempThreshold = 28,
-    .mcpTemperature = 0.0,
+    .mcpTemperature = Temperature(),
+    .mcpTemperatureRaw = Temperature(),
     .pcfTime = {},
     .gpioButtonShortPress = false,
     .rotaryButtonShortPress = false,
@@ -135,6 +155,45 @@ void sigint_handler(int signum) {
     appState.keepRunning.store(false);
 }
 
+// Find the sensors on the I2C bus, or read where they were found on an earlier
+// start, and point their configuration at them. Devices which are not found
+// keep the configured address and check their identity themselves.
+void discover_i2c_devices(Hardware_config_t & config) {
+    I2C_Discovery discovery(config.i2cDiscoveryCache);
+    std::vector<uint8_t> mcp9808Addresses;
+    for (unsigned int address = MCP9808::firstAddress; address <= MCP9808::lastAddress; ++address) {
+        mcp9808Addresses.push_back(static_cast<uint8_t>(address));
+    }
+    discovery.addDriver({"mcp9808", mcp9808Addresses, MCP9808::probe});
+    discovery.addDriver({"pcf8563", {PCF8563::defaultAddress}, PCF8563::probe});
+
+    std::vector<std::string> buses = {config.mcp9808Config.i2cBusDevice};
+    if (config.pcf8563Config.i2cBusDevice != config.mcp9808Config.i2cBusDevice) {
+        buses.push_back(config.pcf8563Config.i2cBusDevice);
+    }
+    const auto& devices = discovery.discover(buses);
+    if (auto found = discovery.find("mcp9808")) {
+        config.mcp9808Config.i2cBusDevice = found->bus;
+        config.mcp9808Config.i2cAddress = found->address;
+        config.mcp9808Config.identified = true;
+    }
+    if (auto found = discovery.find("pcf8563")) {
+        config.pcf8563Config.i2cBusDevice = found->bus;
+        config.pcf8563Config.i2cAddress = found->address;
+    }
+    std::cout << "I2C devices " << (discovery.fromCache() ? "from " + config.i2cDiscoveryCache : std::string("probed")) << ":";
+    for (const auto& device : devices) {
+        std::cout << " " << device.driver << "@" << device.bus << ":0x" << std::hex << static_cast<int>(device.address) << std::dec;
+    }
+    std::cout << std::endl;
+}
+
+// I2C profile dump on "kill -USR1", printed by the main loop
+std::atomic<bool> dumpI2CProfile = false;
+void sigusr1_handler(int) {
+    dumpI2CProfile.store(true);
+}
+
 // Prototypes of threads
 void button_thread( Application_state_t  & appState, const std::string & inputDevice) ;
 void rotary_encoder_thread(Application_state_t  & appState, const GPIO_config & SIA_config, const GPIO_config & SIB_config) ;
@@ -144,15 +203,16 @@ void pwmBacklight_thread(Application_state_t  & appState, const PWM_Backlight::C
 void servo_thread(Application_state_t  & appState, const PWM_Servo::Config & pwmServo_config) ;
 void display_thread( Application_state_t  & appState, const ST7789::Config & displayConfig) ;
 void bmp280_thread( Application_state_t  & appState, const BMP280::Config & bmp280Config) ;
-void mcp9808_thread( Application_state_t  & appState, const MCP9808::Config & mcp9808Config) ;
-void pcf8563_thread( Application_state_t  & appState, const PCF8563::Config & pcf8563Config) ;
+void mcp9808_thread( Application_state_t  & appState, const MCP9808::Config & mcp9808Config, I2C_Scheduler & scheduler, I2C_Scheduler::Slot slot) ;
+void pcf8563_thread( Application_state_t  & appState, const PCF8563::Config & pcf8563Config, I2C_Scheduler & scheduler, I2C_Scheduler::Slot slot) ;
+void mcp9808_alert_thread( Application_state_t  & appState, const MCP9808::Config & mcp9808Config, Edge_Source & alert) ;
 
 void test_i2c(const MCP9808::Config & mcp9808Config, const PCF8563::Config & pcf8563Config) {
     MCP9808 mcp9808(mcp9808Config.i2cBusDevice, mcp9808Config.i2cAddress);
     PCF8563 pcf8563(pcf8563Config.i2cBusDevice, pcf8563Config.i2cAddress);
 
     int id = mcp9808.getDeviceID();
-    float temperature = mcp9808.getTemperature();
+    Temperature temperature = mcp9808.getTemperature();
     std::cout << "MCP9808 Device ID: 0x" << std::setw(4) << std::setfill('0') << std::hex << id << " Temp: " << temperature << std::endl;
 
     pcf8563.setTime(12, 59, 56);
@@ -176,29 +236,64 @@ int main() {
     // return 0;
     try {
         signal(SIGINT, sigint_handler); // Register signal handler for Ctrl+C
+        signal(SIGUSR1, sigusr1_handler);
+        discover_i2c_devices(hardwareConfig);
+        // sampling plan of /dev/i2c-1, checked against the bus capacity before anything runs
+        I2C_Scheduler i2cScheduler(hardwareConfig.i2cSchedule);
+        const auto & mcp9808Config = hardwareConfig.mcp9808Config;
+        auto mcp9808_slot = i2cScheduler.add({"mcp9808", MCP9808::samplePeriod(mcp9808Config),
+                                              mcp9808Config.oneShot ? MCP9808::oneShotMessages : MCP9808::sampleMessages,
+                                              mcp9808Config.oneShot ? MCP9808::oneShotBytes : MCP9808::sampleBytes});
+        auto pcf8563_slot = i2cScheduler.add({"pcf8563", hardwareConfig.pcf8563Config.samplePeriod, PCF8563::sampleMessages, PCF8563::sampleBytes});
+        i2cScheduler.print(std::cout);
         std::thread display_task( display_thread, std::ref(appState), hardwareConfig.displayConfig) ;
         // std::thread bmp280_task( bmp280_thread, std::ref(appState), hardwareConfig.bmp280Config) ;
-        std::thread mcp9808_task( mcp9808_thread, std::ref(appState), hardwareConfig.mcp9808Config) ;
-        std::thread pcf8563_task( pcf8563_thread, std::ref(appState), hardwareConfig.pcf8563Config) ;
+        std::thread mcp9808_task( mcp9808_thread, std::ref(appState), hardwareConfig.mcp9808Config, std::ref(i2cScheduler), mcp9808_slot) ;
+        std::thread pcf8563_task( pcf8563_thread, std::ref(appState), hardwareConfig.pcf8563Config, std::ref(i2cScheduler), pcf8563_slot) ;
         std::thread lwsw_button_task( button_thread, std::ref(appState), hardwareConfig.buttonEvents) ;
         std::thread rotary_task( rotary_encoder_thread, std::ref(appState), hardwareConfig.rotary_SIA, hardwareConfig.rotary_SIB) ;
         std::thread rotary_button_task( rotary_button_thread, std::ref(appState), hardwareConfig.rotary_SW) ;
         std::thread alarm_led_task( gpio_led_thread, std::ref(appState), hardwareConfig.LED ) ;
         std::thread servo_task( servo_thread, std::ref(appState), hardwareConfig.PWM_Srv) ;
         std::thread displayBacklight_task( pwmBacklight_thread, std::ref(appState), hardwareConfig.PWM_BL) ;        
+        // with the ALERT output wired the sensor itself raises the alarm, otherwise the loop below compares
+        const bool alertWired = !hardwareConfig.mcp9808Config.alertChip.empty();
+        std::unique_ptr<Edge_Source> mcp9808Alert;
+        std::thread mcp9808_alert_task;
+        if (alertWired) {
+            mcp9808Alert = std::make_unique<GPIO_Edge_Source>(hardwareConfig.mcp9808Config.alertChip, hardwareConfig.mcp9808Config.alertPin,
+                                                               "mcp9808-alert", gpiod::line_request::EVENT_BOTH_EDGES,
+                                                               gpiod::line_request::FLAG_BIAS_PULL_UP, false);
+            mcp9808_alert_task = std::thread( mcp9808_alert_thread, std::ref(appState), hardwareConfig.mcp9808Config, std::ref(*mcp9808Alert)) ;
+        }
 
         unsigned int counter = 0;
         bool rtc_is_running = true;
         int mcpTemperatureMessage=-1 ;
+        // the alarm clears 0.5 C below the threshold, not on the next noisy sample
+        Hysteresis_Comparator<Temperature> alarmComparator(Temperature::fromRaw(Temperature::one / 2));
+        // one RTC handle for all user actions, set up on first use; the I2C
+        // adapter itself is shared with the sensor threads
+        std::unique_ptr<PCF8563> rtc;
+        auto pcf8563 = [&rtc]() -> PCF8563& {
+            if (!rtc) {
+                rtc = std::make_unique<PCF8563>(hardwareConfig.pcf8563Config.i2cBusDevice, hardwareConfig.pcf8563Config.i2cAddress);
+            }
+            return *rtc;
+        };
         while (appState.keepRunning.load()) {
             counter = (counter + 1) % 10 ; 
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            if (appState.mcpTemperature.load() > appState.tempThreshold.load() && mcpTemperatureMessage != 1) { // Alarm condition
+            if (dumpI2CProfile.exchange(false)) {
+                I2C_Profiler::instance().dump(std::cout);
+            }
+            const bool overTemperature = alarmComparator.update(appState.mcpTemperature.load(), Temperature::fromCelsius(appState.tempThreshold.load()));
+            if (!alertWired && overTemperature && mcpTemperatureMessage != 1) { // Alarm condition
                 std::cout << "ALARM! Temperature " << appState.mcpTemperature.load() << "C above threshold" << std::endl;
                 mcpTemperatureMessage = 1;
                 appState.setAlarm.store(true);
             } 
-            if (appState.mcpTemperature.load() <= appState.tempThreshold.load() && mcpTemperatureMessage != 0) {
+            if (!alertWired && !overTemperature && mcpTemperatureMessage != 0) {
                 mcpTemperatureMessage = 0;
                 std::cout << "Temperature " << appState.mcpTemperature.load() << "C below threshold. Normal operation" << std::endl;
                 appState.setAlarm.store(false);
@@ -207,23 +302,20 @@ int main() {
                 appState.gpioButtonShortPress.store(false);
                 time_t sys_time = std::time(nullptr);
                 struct tm sys_time_tm = *std::localtime(&sys_time);
-                PCF8563 pcf8563(hardwareConfig.pcf8563Config.i2cBusDevice, hardwareConfig.pcf8563Config.i2cAddress);
-                pcf8563.setTimeAndDate(sys_time_tm);
-                sys_time_tm = pcf8563.getTimeAndDate();
+                pcf8563().setTimeAndDate(sys_time_tm);
+                sys_time_tm = pcf8563().getTimeAndDate();
                 appState.pcfTime.store(sys_time_tm);
             }
             if (appState.rotaryButtonShortPress.load()) {
                 appState.rotaryButtonShortPress.store(false);
                 std::cout << "Rotary button short press" << std::endl;
-                PCF8563 pcf8563(hardwareConfig.pcf8563Config.i2cBusDevice, hardwareConfig.pcf8563Config.i2cAddress);
-                auto rtc_time = pcf8563.getTime();
-                pcf8563.setTime(rtc_time[2], rtc_time[1], appState.tempThreshold.load());
+                auto rtc_time = pcf8563().getTime();
+                pcf8563().setTime(rtc_time[2], rtc_time[1], appState.tempThreshold.load());
             }
             if (appState.rotaryButtonLongPress.load()) {
                 appState.rotaryButtonLongPress.store(false);
                 std::cout << "Rotary button long press" << std::endl;
-                PCF8563 pcf8563(hardwareConfig.pcf8563Config.i2cBusDevice, hardwareConfig.pcf8563Config.i2cAddress);
-                auto new_sys_time_tm = pcf8563.getTimeAndDate();
+                auto new_sys_time_tm = pcf8563().getTimeAndDate();
                 std::time_t new_sys_time = std::mktime(&new_sys_time_tm);
                 struct timeval tv = {new_sys_time, 0};
                 if (settimeofday(&tv, NULL) != 0) {
@@ -235,13 +327,11 @@ int main() {
             int tempThreshold = appState.tempThreshold.load();
             if (tempThreshold == 60 && rtc_is_running) {
                 rtc_is_running = false;
-                PCF8563 pcf8563(hardwareConfig.pcf8563Config.i2cBusDevice, hardwareConfig.pcf8563Config.i2cAddress);
-                pcf8563.Stop();
+                pcf8563().Stop();
                 std::cout << "PCF8563 stopped" << std::endl;
             } else if (tempThreshold == 59 && !rtc_is_running) {
                 rtc_is_running = true;
-                PCF8563 pcf8563(hardwareConfig.pcf8563Config.i2cBusDevice, hardwareConfig.pcf8563Config.i2cAddress);
-                pcf8563.Start();
+                pcf8563().Start();
                 std::cout << "PCF8563 started" << std::endl;
             }
         }
@@ -255,6 +345,9 @@ int main() {
         lwsw_button_task.join() ;
         // bmp280_task.join();
         pcf8563_task.join();
+        if (mcp9808_alert_task.joinable()) {
+            mcp9808_alert_task.join();
+        }
         mcp9808_task.join();
         display_task.join();
     } catch (const std::exception &e) {
@@ -1,67 +1,59 @@
 #include "app.hpp"
+#include "Widgets.hpp"
 
 #include <thread>
 #include <iostream>
-#include <iomanip>
-#include <sstream>
 #include <chrono>
 
+void display_transmit_thread( Application_state_t  & appState, ST7789 & display) ;
+
 void display_thread( Application_state_t  & appState, const ST7789::Config & displayConfig) {
     try {
         ST7789 display(displayConfig);
+        std::cout << __func__ << ": panel ready after " << display.startupTime().count() / 1000 << " ms" << std::endl;
         display.clearScreen(ST7789::Colors::BLACK);
         display.showLogo();
-        static float temperature = -273;
-        static float tempThreshold = -99;
-        time_t last_time = std::numeric_limits<time_t>::min();
-        time_t last_sys_time = std::numeric_limits<time_t>::min();
+        display.flush();
+        std::thread transmit_task( display_transmit_thread, std::ref(appState), std::ref(display)) ;
+        // widgets remember what they show and redraw only the cells which change
+        Numeric_Field temperature(display, 0, 16, {6, 1, true, " C"});
+        Numeric_Field tempThreshold(display, 240-(3)*16, 16, {3, 0, true, " "});
+        Clock_Field rtcTime(display, 0, 40, Clock_Field::Show::Time);
+        Clock_Field rtcDate(display, 160, 40, Clock_Field::Show::Date, 9);
+        Clock_Field sysTime(display, 0, 230, Clock_Field::Show::Time);
+        Clock_Field sysDate(display, 160, 230, Clock_Field::Show::Date, 9);
         std::cout << __func__ << " started." << std::endl;
-        while (appState.keepRunning.load()) {
-            float new_bmpTemperature = appState.mcpTemperature.load();
-            if (new_bmpTemperature != temperature) { // update temperature readings only when required
-                temperature = new_bmpTemperature;
-                std::ostringstream oss;
-                oss << std::fixed << std::showpos << std::setprecision(1) << std::setw(6) << std::setfill(' ') << temperature << " C";
+        try {
+            while (appState.keepRunning.load()) {
                 if (appState.setAlarm.load()) {
-                    display.drawString(0, 16, oss.str(), ST7789::Colors::RED, ST7789::Colors::BLACK);
+                    temperature.setColors(ST7789::Colors::RED, ST7789::Colors::BLACK);
                 } else {
-                    display.drawString(0, 16, oss.str(), ST7789::Colors::WHITE, ST7789::Colors::BLACK);
+                    temperature.setColors(ST7789::Colors::WHITE, ST7789::Colors::BLACK);
                 }
-            }
-            int new_tempThreshold = appState.tempThreshold.load();
-            if (new_tempThreshold != tempThreshold) { // update temperature threshold only when required
-                tempThreshold = new_tempThreshold;
-                std::ostringstream oss;
-                oss << std::fixed << std::showpos << std::setprecision(0) << std::setw(3) << std::setfill(' ') << tempThreshold << " ";
-                display.drawString(240-(3)*16, 16, oss.str(), ST7789::Colors::WHITE, ST7789::Colors::BLACK);
+                temperature.setScaled(appState.mcpTemperature.load().scaled(1));
+                tempThreshold.setScaled(appState.tempThreshold.load());
 
+                auto pcfTime = appState.pcfTime.load();
+                rtcTime.setTime(pcfTime);
+                rtcDate.setTime(pcfTime);
+                time_t sys_time = std::time(nullptr);
+                struct tm local;
+                localtime_r(&sys_time, &local);
+                sysTime.setTime(local);
+                sysDate.setTime(local);
+                display.present(); // if the previous frame is still being sent, this one goes out with the next
+                std::this_thread::sleep_for(std::chrono::milliseconds(250));
             }
-
-            // Update time only when required
-            auto pcfTime = appState.pcfTime.load();
-            auto new_time = std::mktime(&pcfTime);
-            if (new_time != last_time) {
-                last_time = new_time;
-                std::ostringstream oss;
-                oss << std::put_time(&pcfTime, "%H:%M:%S");
-                display.drawString(0, 40, oss.str(), ST7789::Colors::WHITE, ST7789::Colors::BLACK);
-                oss.str("");
-                oss << " " << std::put_time(&pcfTime, "%d-%m-%y");
-                display.drawString(160, 40, oss.str(), ST7789::Colors::WHITE, ST7789::Colors::BLACK);
-            }
-            time_t sys_time = std::time(nullptr);
-            if (sys_time != last_sys_time) {
-                last_sys_time = sys_time;
-                std::ostringstream oss;
-                oss << std::put_time(std::localtime(&sys_time), "%H:%M:%S");
-                display.drawString(0, 230, oss.str(), ST7789::Colors::WHITE, ST7789::Colors::BLACK);
-                oss.str("");
-                oss << " " << std::put_time(std::localtime(&sys_time), "%d-%m-%y");
-                display.drawString(160, 230, oss.str(), ST7789::Colors::WHITE, ST7789::Colors::BLACK);
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        } catch (const std::exception &e) {
+            // the transmit thread keeps running until the application stops
+            std::cerr << "An error occurred in display thread: " << e.what() << std::endl;
         }
+        transmit_task.join();
+        auto pipeline = display.pipelineStats();
+        std::cout << __func__ << ": frames presented " << pipeline.presented << ", transmitted " << pipeline.transmitted
+                  << ", dropped " << pipeline.dropped << ", last transmit " << pipeline.transmitTime.count() << " us" << std::endl;
         display.clearScreen( ST7789::Colors::BLACK );
+        display.flush();
     } catch (const std::exception &e) {
         std::cerr << "An error occurred in display thread: " << e.what() << std::endl;
     }
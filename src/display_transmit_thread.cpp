@@ -0,0 +1,23 @@
+#include "app.hpp"
+
+#include <thread>
+#include <iostream>
+#include <chrono>
+
+// Sends the frames presented by display_thread, so the UI loop never waits for SPI
+void display_transmit_thread( Application_state_t  & appState, ST7789 & display) {
+    try {
+        const auto frame_interval = std::chrono::milliseconds(20); // at most 50 frames per second
+        std::cout << __func__ << " started." << std::endl;
+        while (appState.keepRunning.load()) {
+            auto frame_start = std::chrono::steady_clock::now();
+            if (display.transmitFrame(std::chrono::milliseconds(100))) {
+                // frame pacing, frames presented meanwhile are merged into one
+                std::this_thread::sleep_until(frame_start + frame_interval);
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "An error occurred in display transmit thread: " << e.what() << std::endl;
+    }
+    std::cout << __func__ << " thread finished." << std::endl;
+}
@@ -1,5604 +1,2136 @@
-#include "st7789v2.hpp" 
+// Generated by tools/logo_converter from assets/logo.ppm, do not edit.
+// 240x280 RGB565, 33979 bytes run-length encoded (RLE565.hpp)
+#include "st7789v2.hpp"
+#include "RLE565.hpp"
 
-std::vector<uint16_t> ST7789::image_data = {
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x18E3,
-    0x18E3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18E3, 0x10A2, 0x1082, 0x0841,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x2945, 0x3186, 0x4A49, 0x52AA, 0x52AA, 0x52AA, 0x52AA,
-    0x52AA, 0x52AA, 0x39E7, 0x2945, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186,
-    0xC618, 0xC618, 0xDEDB, 0xE71C, 0xE73C, 0xEF7D, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xF7BE, 0xEF7D, 0xEF5D, 0xE71C, 0xDEFB, 0xC638, 0xBDD7, 0xA534, 0x8C71, 0x39C7,
-    0x1082, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,
-    0x0841, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49,
-    0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0x8430,
-    0x0841, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51,
-    0x0841, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51,
-    0x0841, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51,
-    0x0841, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0841, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51,
-    0x0861, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0841, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x2124, 0x31A6, 0x0000, 0x0861,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x0020, 0x0841, 0x0841, 0x0000, 0x39E7,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8430,
-    0x0000, 0x2104, 0x0841, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0861, 0x0861, 0x4208, 0x0000, 0x0000, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x2104, 0x8430, 0xEF7D, 0xE71C, 0x18C3, 0x10A2,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x4A49, 0x73AE, 0xAD55,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596,
-    0x39C7, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x0861, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861,
-    0x0000, 0x8410, 0xFFDF, 0xAD75, 0x4208, 0x0000, 0x0000, 0x10A2, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0861, 0x0000, 0x0000, 0x3186, 0x94B2, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x0000,
-    0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0841,
-    0x0020, 0x0000, 0x0000, 0x1082, 0x39C7, 0x6B4D, 0xA514, 0xD69A, 0xE73C, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0xEF5D, 0xD69A, 0xB596, 0x8430, 0x4A69, 0x2965, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841,
-    0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x2965, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFDF, 0xBDD7, 0x528A, 0x0000, 0x0000, 0x1082, 0x0841, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,
-    0x0000, 0x0000, 0x39C7, 0xAD55, 0xF79E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xF79E, 0x31A6,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x3186, 0x7BEF, 0xAD55, 0xD6BA, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF79E, 0xCE79, 0xA514, 0x738E, 0x2965, 0x0000,
-    0x0000, 0x0000, 0x0841, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000,
-    0xA534, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x528A, 0x0000, 0x0000, 0x10A2,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000,
-    0x39E7, 0xAD55, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7,
-    0x0000, 0x10A2, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x18E3, 0x4A69, 0x94B2, 0xDEFB,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xF79E, 0xE73C, 0xFFDF, 0xFFFF, 0xBDD7, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xA534, 0x9CD3, 0xA514, 0x9CF3, 0xBDF7, 0xCE59, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xD6BA,
-    0x94B2, 0x4A69, 0x18E3, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0020, 0x0000, 0x528A,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xC618, 0x4A49, 0x0000,
-    0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x2124, 0xA514,
-    0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0x52AA, 0x0000, 0x1082, 0x0000, 0x0000, 0x0861, 0x5ACB, 0xAD55, 0xDEFB, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x738E,
-    0x4228, 0x4208, 0x31A6, 0x39E7, 0xE71C, 0xF7BE, 0x18E3, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xEF5D, 0x18C3, 0x2945, 0x4208, 0x39E7, 0x2104, 0x2124, 0xDEDB, 0xFFFF, 0x39E7, 0xAD55, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xD69A, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xE71C, 0xAD55, 0x630C, 0x0861, 0x0000, 0x0000, 0x0861, 0x0861, 0x0861, 0xCE59,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xAD55,
-    0x2124, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x18C3, 0x8C51, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xDEDB, 0x0841, 0x0000, 0x39E7, 0x8C71, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x10A2, 0x3186,
-    0x8410, 0x9CF3, 0xBDD7, 0xD6BA, 0xFFFF, 0xFFDF, 0x39E7, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xE71C, 0x18E3, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFF, 0xF7BE, 0x0841, 0xA534, 0xFFFF,
-    0xFFDF, 0x738E, 0x0861, 0x9CD3, 0xC638, 0x5AEB, 0x94B2, 0xD69A, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x9CF3, 0x4A69, 0x0000, 0x0000, 0x738E, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xEF7D, 0x7BCF, 0x0861, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0020, 0x0000, 0x528A, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xAD75, 0xB596, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xCE79, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x9CD3,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x9471, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xE73C, 0x2104, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x2124, 0xE71C, 0xEF5D,
-    0x3185, 0x2104, 0xCE59, 0xFFFF, 0xD6BA, 0x73AE, 0x39C7, 0x18E3, 0x2945, 0x528A, 0x94B2, 0xEF7D,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xCE59, 0x8410, 0xE73C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xCE59, 0x39E7, 0x0000, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x10A2, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0xCE79, 0xF79E,
-    0x18A2, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x52AA,
-    0xCE59, 0xAD75, 0x8C51, 0x6B6D, 0xDEDB, 0xFFFF, 0x39E7, 0x8410, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xDEFB, 0x0861, 0x18E3, 0x4208, 0x4228, 0x4208, 0x8C71, 0xFFFF, 0xBDD7, 0x2965, 0x94B2, 0x18E3,
-    0x630B, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2945, 0x7BCF, 0x7BEF, 0x4A49, 0xE73C,
-    0xCE79, 0x6B6D, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0x8430, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0861, 0x0000, 0x0000, 0x52AA, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534, 0x0861, 0xE71C, 0xFFFF,
-    0x4A49, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0861,
-    0x39C6, 0x3186, 0x39E7, 0x632C, 0xDEFB, 0xFFFF, 0x39E7, 0x8410, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-    0xC638, 0x0000, 0xB5B6, 0xAD55, 0xAD55, 0xA514, 0xB596, 0xFFFF, 0x9CD3, 0x0000, 0x2104, 0x0841,
-    0xAD54, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x0841, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x630C, 0x0020, 0x31A6, 0x2965, 0x8410, 0xE73C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xBDF7, 0x3186, 0x0000, 0x0841, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0841, 0x0000, 0x10A2, 0x94B2, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0xB596, 0xFFFF, 0xFFFF, 0x3186, 0x8410, 0xFFFF, 0xFFFF,
-    0x8C71, 0x2945, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x10A2,
-    0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x8C30, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xCE59, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x2124, 0xE73C, 0x9CD2,
-    0x1082, 0xF79E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8C71, 0x31A6, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D,
-    0x1082, 0xB596, 0xFFDF, 0xAD75, 0x31A6, 0x2104, 0xE73C, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF7D, 0x6B6D, 0x0000, 0x0000, 0x0841, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x4228, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xC618, 0x7BCF, 0xFFFF, 0x4228, 0x4A69, 0xFFFF, 0xAD55, 0x2104, 0xEF5D, 0xFFFF, 0xFFFF,
-    0xDEDB, 0x1082, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB5B6, 0x0841,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFFF, 0x528A, 0x528A, 0xDEFB, 0xDEDB, 0xC638, 0xD69A,
-    0xBDF7, 0x0841, 0xD679, 0xD6BA, 0xDEFB, 0xEF5D, 0xEF5D, 0xFFFF, 0x528A, 0x73AE, 0xFFFF, 0xEF7D,
-    0x2103, 0x8C51, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x52AA, 0x6B4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD55,
-    0x1082, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2124, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xAD55, 0x18E3, 0x0000, 0x0861,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104,
-    0x0020, 0xDEDB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFFF, 0x5ACB, 0x630C, 0xFFFF, 0xBDD7, 0x0841, 0xEF5D, 0x31A6, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x2104, 0x8430, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x1082,
-    0x8410, 0x7BEF, 0x528A, 0x4228, 0x31A6, 0xEF5D, 0x632C, 0x0020, 0x2945, 0x2104, 0x0861, 0x8C30,
-    0xC638, 0x1082, 0x2104, 0x2104, 0x2124, 0x3186, 0x52AA, 0xF77D, 0x39C7, 0x9491, 0xFFFF, 0xFFFF,
-    0x9492, 0x0861, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFDF, 0x10A2, 0x9CF3, 0xFFFF, 0xFFDF, 0xFFFF, 0x52AA,
-    0x0841, 0x528A, 0xA534, 0xE71C, 0xC638, 0x0861, 0xAD75, 0xFFFF, 0xF79E, 0x7BEF, 0x4208, 0x4A49,
-    0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x2965, 0x0000,
-    0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228,
-    0x1082, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xDEDB, 0xE71C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x4228, 0x94B2, 0xFFFF, 0xEF7D, 0x3186, 0x4A49, 0x2104, 0x0861, 0x6B6D, 0xF7BE, 0xFFFF,
-    0xFFFF, 0x73AE, 0x4228, 0xFFFF, 0xFFFF, 0xBDF7, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x528A,
-    0x4228, 0x528A, 0x73AE, 0x94B2, 0xB5B6, 0xF79E, 0xE73C, 0xEF7D, 0xEF5D, 0xEF5D, 0xEF7D, 0xFFFF,
-    0xFFDF, 0xF79E, 0xEF5D, 0xEF7D, 0xDEDB, 0xC638, 0xD6BA, 0xFFDF, 0xAD55, 0xDEFB, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x2104, 0x6B6D, 0xFFFF, 0xFFFF, 0xCE39, 0x18E3, 0xDEDB, 0xFFFF, 0xFFFF, 0xE73C, 0x2104,
-    0x94B2, 0x8C51, 0x18C3, 0x1082, 0x2104, 0x6B4D, 0xFFDF, 0xEF7D, 0x39E7, 0x2945, 0x8C51, 0x8C51,
-    0x18E3, 0x4A49, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xD69A, 0x0020, 0x7BEF,
-    0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630C, 0x0000, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xDEDB, 0x632C, 0x10A2, 0x9492, 0xFFFF,
-    0xFFFF, 0x2945, 0xBDF7, 0xFFFF, 0xFFFF, 0x7BEF, 0x0000, 0x9492, 0xC638, 0x0861, 0x2945, 0xCE59,
-    0xFFFF, 0xBDF7, 0x0000, 0xEF5D, 0xF7BE, 0x0861, 0xB596, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xF7BE,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xE71C, 0xC638, 0xFFDF, 0xFFFF, 0x9492, 0x31A6, 0xFFDF, 0xFFDF, 0xFFFF, 0x9CF3, 0x18C3,
-    0xFFDF, 0xFFFF, 0xA534, 0x18E3, 0xD69A, 0xFFFF, 0xFFFF, 0x5ACB, 0x18E3, 0xF7BE, 0xFFFF, 0xFFFF,
-    0xE73C, 0x10A2, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x2104, 0x9492,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2965, 0x2945, 0x39C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x1082, 0x8430, 0xFFFF, 0x8C51, 0x18C3, 0x4208,
-    0xB5B6, 0x3185, 0xE71C, 0xFFFF, 0xFFFF, 0xCE59, 0x0820, 0xCE79, 0xFFFF, 0xEF5D, 0x5ACB, 0x0000,
-    0x840F, 0xDEFB, 0x528A, 0xCE59, 0xFFFF, 0x7BEF, 0xA534, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0xDEFB, 0xDEFB, 0xD6BA, 0xC618, 0xC618,
-    0xC618, 0xC5F7, 0xCE59, 0xDEFB, 0xDEFB, 0xE71C, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xEF5D, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0x39E7, 0x5AEB,
-    0xFFFF, 0xFFDF, 0xF7BE, 0x1082, 0xB596, 0xFFFF, 0xDEDB, 0x0841, 0xBDF7, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFFF, 0x8C51, 0x31A6, 0xFFDF, 0xFFFF, 0xD69A, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD55, 0x0000, 0x9CD3, 0x18C3,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x6B4D, 0x0000, 0xAD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x4208, 0x18C3, 0x9CF3, 0xF79E, 0xFFFF, 0xFFFF, 0xEF3C, 0x5ACB,
-    0x0861, 0x39E7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2124, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3,
-    0x8430, 0xF79E, 0xF7BE, 0xFFDF, 0xFFFF, 0xBDD7, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xDEDB,
-    0xB5B6, 0x9CD3, 0x7BCF, 0x4A69, 0x31A6, 0x2945, 0x2104, 0x18C3, 0x18C3, 0x10A2, 0x0021, 0x0021,
-    0x0041, 0x0020, 0x0861, 0x18C3, 0x10C3, 0x18E3, 0x2145, 0x2965, 0x31A6, 0x6B4D, 0x8C71, 0xAD55,
-    0xCE79, 0xE71C, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xB5B6, 0xD6BA,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x630C, 0xFFFF, 0xA514, 0x2965, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFDF, 0x8C51, 0x3186, 0xF7BE, 0xFFFF, 0x3186, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2124, 0x39C7, 0x7BCF, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x18C3, 0x39C7, 0x1903, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xDEFB, 0x62EB, 0x2104, 0x18C3, 0x5289, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xAD55, 0x0861, 0xDEDB, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0xAD75, 0x7BCF, 0x52AA, 0x2985, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x10A2, 0x4208, 0x632C, 0x9492, 0xCE58, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x8430, 0x18C3, 0xFFFF, 0xA534, 0x31A6, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF,
-    0xFFFF, 0x39C7, 0x4208, 0xFFFF, 0x9CD3, 0x0000, 0x39C7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8C71, 0x0000, 0xAD55, 0x0861, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5AEB, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xBDF7, 0x4A69, 0xE71C, 0xCE79, 0x0000, 0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFFF, 0x3186, 0x632C, 0xFFFF, 0xFFDF, 0xFFFF, 0xE71C, 0xBDF7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xE73C, 0xB5B6, 0x7BEF, 0x39C7, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x08C5, 0x00A4, 0x1126, 0x3A8C, 0x3A6C, 0x3A6C, 0x3A6C,
-    0x3A6C, 0x3A6C, 0x326C, 0x3A8C, 0x21C9, 0x00A4, 0x00C4, 0x10C4, 0x18E4, 0x20C3, 0x1061, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18E3, 0x5AEB, 0x9CF3, 0xD6BA, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xEF7D, 0xAD75, 0xFFDF, 0xEF5D, 0x0841, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xC618, 0x0000, 0xB5B6, 0xF79E, 0x20E3, 0x5AEB, 0x10A2, 0xEF7D, 0xFFFF, 0xFFFF, 0x9CD3, 0xDEDB,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1081, 0x738E, 0x528A, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x18E3, 0x0000, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xFFDF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B6D, 0x2124, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xAD55, 0x0020, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,
-    0xAD55, 0x5AEB, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0020, 0x31A7, 0x3A0A,
-    0x11EC, 0x1967, 0x0000, 0x0000, 0x18A3, 0x3B52, 0x0357, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
-    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0336, 0x0336, 0x1B55, 0x2B75, 0x3353, 0x22B0, 0x01CC,
-    0x21EB, 0x3A09, 0x18C3, 0x0020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4228, 0x7BCF,
-    0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x10A2, 0x8410, 0xC5F7, 0x9492,
-    0x1082, 0x6B6D, 0xFFFF, 0x5ACB, 0x4208, 0xD69A, 0x0000, 0xE73C, 0xFFFF, 0xB596, 0x0000, 0xCE79,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8430, 0x0000, 0x52AA, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0841, 0x0000, 0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x2965, 0x31A6,
-    0xD6BA, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x1082, 0x8C71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF7BE, 0xAD75, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xBDD7, 0x6B4D, 0x10A2,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x2104, 0x0906, 0x328D, 0x3311, 0x02B3, 0x0B35, 0x1356,
-    0x0357, 0x3AAD, 0x0000, 0x0000, 0x0000, 0x1081, 0x226D, 0x1336, 0x02D5, 0x02F4, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x0337,
-    0x0B56, 0x1356, 0x02F4, 0x12D2, 0x4310, 0x1168, 0x1905, 0x18A2, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0841, 0x4207, 0x94B2, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x4208, 0x39E7, 0x31A6,
-    0x9492, 0xFFFF, 0xBDF7, 0x0020, 0xD69A, 0xEF5D, 0x18A2, 0xE73C, 0xFFDF, 0x2124, 0x7BCF, 0xFFFF,
-    0xEF7D, 0x8430, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x632C, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861,
-    0x0000, 0x10A2, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x2945, 0x4A69,
-    0x18C3, 0x8410, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x0861, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x8C51, 0x39C7, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0841, 0x2125, 0x324B, 0x0A4F, 0x2B74, 0x0356, 0x0316, 0x0315, 0x0315, 0x02F5, 0x02D4,
-    0x02F5, 0x326C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x29C9, 0x1B55, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4,
-    0x02F5, 0x02F5, 0x02F5, 0x0315, 0x0316, 0x0336, 0x1B75, 0x1AF2, 0x1A2D, 0x31C8, 0x0841, 0x0820,
-    0x0000, 0x0000, 0x0000, 0x18C3, 0x5AEB, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xF79E, 0x2945, 0x6B4D, 0xFFFF, 0xE71C, 0x20E3, 0xF79E, 0x8430, 0x18E3, 0xF7BE, 0xFFFF,
-    0x7BCF, 0x0861, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x0020, 0x0000, 0x0841,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000,
-    0x2945, 0xCE79, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x94B2,
-    0xC618, 0x2945, 0x39C7, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0x2124, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x738E, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0840, 0x2145,
-    0x21EA, 0x2B32, 0x0315, 0x0B36, 0x0316, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x02F5, 0x02D5,
-    0x0316, 0x3A8D, 0x0000, 0x10A2, 0x62EB, 0x0020, 0x0000, 0x0000, 0x2966, 0x1B33, 0x0316, 0x02F4,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x0B35, 0x1314, 0x32AF,
-    0x1147, 0x18A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0xAD34, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xBDD7, 0x3186, 0xEF7D, 0xFFFF, 0xE71C, 0x2124, 0x9CF3, 0x0861, 0xAD55, 0xFFFF, 0xB5B6,
-    0x0000, 0xBDD7, 0xFFFF, 0xCE59, 0x8430, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x18C3, 0x0000,
-    0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x4208,
-    0xE71C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xA514, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0x83EF, 0x4A49,
-    0xFFFF, 0xB596, 0x0000, 0x0861, 0x7BCF, 0xF7BE, 0xFFFF, 0xBDF7, 0x7BAE, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xD6BA, 0x630C, 0x1082, 0x0000, 0x0000, 0x0000, 0x0862, 0x29C9, 0x22B0, 0x1B55,
-    0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x0B56, 0x1335,
-    0x02F4, 0x2A2A, 0x0000, 0x10A2, 0xEF5D, 0xB596, 0x10A2, 0x0000, 0x0000, 0x18C3, 0x2AD0, 0x0336,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316,
-    0x1356, 0x1AF2, 0x2A4C, 0x18E4, 0x1040, 0x0000, 0x0000, 0x0000, 0x31A6, 0xAD55, 0xF7BE, 0xFFFF,
-    0xFFFF, 0xF7BE, 0xEF5D, 0xFFFF, 0xFFFF, 0xE73C, 0x2965, 0x1082, 0x4A69, 0xFFFF, 0xEF5D, 0x1082,
-    0x6B6D, 0xFFFF, 0xEF7D, 0x2104, 0x528A, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xCE79, 0x2945,
-    0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x4A69, 0xE73C,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF7BE, 0x18E3, 0x0020, 0xBDD7, 0xFFFF, 0xFFFF, 0xBDF7, 0x18C3,
-    0x73AE, 0x20E3, 0x9CD3, 0xB5B6, 0x1082, 0x2945, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xD69A, 0x6B4D, 0x0020, 0x0000, 0x0000, 0x0000, 0x2104, 0x21EB, 0x2333, 0x0316, 0x0316, 0x02D5,
-    0x02F5, 0x02F5, 0x02F4, 0x02F5, 0x0316, 0x0316, 0x0316, 0x2355, 0x2B32, 0x0A0D, 0x29EA, 0x39C7,
-    0x10A2, 0x0000, 0x0000, 0x1082, 0xD6BA, 0xFFFF, 0xD679, 0x31A6, 0x0000, 0x0000, 0x0840, 0x328E,
-    0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02D5, 0x02F5, 0x0336, 0x1335, 0x2AD0, 0x2167, 0x0820, 0x0000, 0x0000, 0x0000, 0x39E7, 0xAD55,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x2965, 0x0020, 0xE71C, 0xFFFF, 0x52AA, 0x2945,
-    0xF7BE, 0xFFDF, 0x4228, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEFB,
-    0x4228, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x5AEB, 0xF7BE, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0841, 0x18E3, 0xD69A, 0xFFFF, 0xEF5D, 0x18E3,
-    0x2945, 0xD69A, 0xFFFF, 0xFFFF, 0xDEDB, 0xAD55, 0xF79E, 0xFFDF, 0xFFDF, 0xFFFF, 0xEF7D, 0x7BCF,
-    0x1082, 0x0000, 0x0000, 0x0820, 0x1904, 0x2A8E, 0x1314, 0x0336, 0x02F5, 0x02F5, 0x02F4, 0x02F5,
-    0x02F5, 0x02F5, 0x0336, 0x1356, 0x0AB2, 0x3AEF, 0x1967, 0x10C3, 0x18A2, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x10A2, 0xDEDB, 0xFFFF, 0xFFFF, 0xF79E, 0x632C, 0x0000, 0x0000, 0x0820,
-    0x21EA, 0x1B55, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F6, 0x1335, 0x12D1, 0x21A8, 0x1061, 0x0000, 0x0000, 0x0000,
-    0x41E7, 0xC618, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B6D, 0x8430, 0xFFFF, 0xA514, 0x0000, 0xCE59,
-    0xFFFF, 0x7BCE, 0x0020, 0xCE59, 0xD6BA, 0xBDD7, 0xAD55, 0x8C51, 0xAD75, 0xFFDF, 0xF7BE, 0xFFFF,
-    0xEF5D, 0x4208, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x5AEB, 0xF7BE, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x39C7, 0x5AEB, 0x18C3, 0xE73C, 0xFFFF, 0x4228,
-    0x8C30, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x2945, 0x0000,
-    0x0000, 0x0020, 0x1904, 0x226E, 0x1B55, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336,
-    0x0315, 0x2B33, 0x11EB, 0x31A7, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2944,
-    0x52AA, 0x6B4D, 0x9492, 0xBDF7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000,
-    0x0000, 0x2125, 0x2333, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x0316, 0x0316, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x0336, 0x22F2, 0x19A8, 0x0820, 0x0000,
-    0x0000, 0x0000, 0x632C, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x0020, 0x8C51, 0xFFFF,
-    0xA513, 0x0000, 0x0841, 0x2945, 0x0861, 0x2965, 0x4208, 0x4A49, 0x738E, 0xEF5D, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xEF5D, 0x4A69, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x5AEB, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xDEFB, 0x8410, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFDF, 0x4208, 0xB596, 0x4A69, 0x3185, 0xFFFF, 0x7BEF,
-    0x2945, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xD6BA, 0x528A, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x10C4, 0x1356, 0x02D5, 0x02F4, 0x02F4, 0x02F5, 0x02F5, 0x0356, 0x12F3, 0x2A8F,
-    0x1946, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x2965, 0x630C, 0xA514, 0xD69A, 0xEF7D,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB575, 0x18E3,
-    0x0000, 0x0000, 0x18C3, 0x22D0, 0x0316, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0315,
-    0x42EF, 0x0A90, 0x1356, 0x02F6, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B56, 0x2AD0, 0x2166,
-    0x0820, 0x0000, 0x0000, 0x10A2, 0x94B2, 0xFFFF, 0xFFFF, 0xFFDF, 0xD6BA, 0x8430, 0xFFFF, 0xC618,
-    0x0000, 0x8410, 0xDEDB, 0x4208, 0x738E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xF7BE, 0x52AA, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0x52AA, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0x6B4D, 0x0000, 0x18C3, 0x8430, 0xF7BE, 0xFFFF, 0x8C71, 0x5ACB, 0xFFDF, 0x2945, 0x528A, 0xBDF7,
-    0x52AA, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x8C71, 0x10A2, 0x0000, 0x0000, 0x0000, 0x6B6D,
-    0x4228, 0x0000, 0x0000, 0x29E9, 0x0B36, 0x02D4, 0x0316, 0x0315, 0x2B33, 0x19CA, 0x20E3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0861, 0x5289, 0x9492, 0xCE79, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEDB,
-    0x39C7, 0x0000, 0x0000, 0x1061, 0x2A6D, 0x1356, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0315, 0x22F2,
-    0x0820, 0x0800, 0x2167, 0x32CF, 0x1335, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x1356,
-    0x2A8F, 0x18E4, 0x0020, 0x0000, 0x0000, 0x4A69, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x18E3,
-    0x630C, 0xFFFF, 0xFFFF, 0x4A49, 0x7BCF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0x9492, 0x0861, 0xDEDB,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x41E7, 0x0000, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x4208, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF,
-    0xCE79, 0x18E3, 0x2925, 0x4208, 0x2924, 0xAD75, 0xF7BE, 0x2965, 0xE71C, 0xDEFB, 0x18E3, 0xA514,
-    0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA, 0x4A69, 0x0000, 0x0000, 0x0000, 0x31A6, 0xB5B6, 0xFFFF,
-    0xE71C, 0x18C3, 0x0000, 0x0800, 0x2A8E, 0x1B77, 0x1AB1, 0x31E9, 0x1061, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x4208, 0x94B2, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xF7BE, 0x630C, 0x0000, 0x0000, 0x0800, 0x29E9, 0x1335, 0x02F6, 0x02F4, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x2A0A,
-    0x0000, 0x0000, 0x0000, 0x1040, 0x2125, 0x226E, 0x1B34, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02D5,
-    0x0316, 0x2333, 0x0861, 0x0000, 0x0000, 0x0000, 0x10A2, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFDF, 0xC638,
-    0xF79E, 0xFFFF, 0xFFFF, 0x4208, 0x7BEF, 0xFFFF, 0xF7BE, 0xFFFF, 0xAD55, 0x0000, 0x9CD3, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0x4208, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0841, 0x0000, 0x2124, 0xE73C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xCE59, 0x10A2, 0x9492, 0xA534, 0x18E3, 0x52AA, 0x39E7, 0x8410, 0xFFFF, 0xEF3C, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xAD55, 0x10A2, 0x0000, 0x0000, 0x0861, 0x738E, 0xEF7D, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xAD75, 0x0841, 0x0000, 0x0041, 0x1946, 0x1040, 0x0000, 0x0000, 0x0000, 0x18E3, 0x73AE,
-    0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0x8C71, 0x0841, 0x0000, 0x0000, 0x1904, 0x12D2, 0x0336, 0x02F4, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B34, 0x0882,
-    0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x18E4, 0x226D, 0x1335, 0x0316, 0x02F5, 0x02F4,
-    0x0336, 0x19A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B6D, 0xF7BE, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0x39A6, 0x9CF3, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x9491, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x2944, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x2945, 0x0841, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x10A2, 0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0x9492, 0x5ACB, 0x6B6D,
-    0xBDF7, 0xFFFF, 0xB596, 0x0000, 0xBDF7, 0xFFFF, 0x6B6D, 0x0861, 0x39E7, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0x9492, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x18E3, 0x0000, 0x0000, 0x1061, 0x2AD0, 0x0336, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0336, 0x222D, 0x0800,
-    0x0000, 0x8410, 0xCE59, 0x528A, 0x0861, 0x0000, 0x0000, 0x0800, 0x2145, 0x2AAF, 0x1335, 0x0337,
-    0x2AAF, 0x0820, 0x0000, 0x18E3, 0xC638, 0x738E, 0x0000, 0x0000, 0x0000, 0x39A6, 0xD69A, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xF7BE, 0x2945, 0xA513, 0xFFFF, 0xC618, 0x0000, 0x7BCF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x18C3, 0x0000, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0841, 0x2124, 0xDEFB, 0xCE59, 0x39E7, 0x0000, 0x0000, 0x0841, 0x0000,
-    0x0000, 0x0000, 0x0020, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0x31A6, 0x2124, 0x6B6D, 0x39C7,
-    0x0020, 0x73AE, 0xFFFF, 0x9492, 0x0000, 0xCE59, 0xFFFF, 0xCE59, 0xC618, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xEF7D, 0x528A, 0x0000, 0x0000, 0x0000, 0x0840, 0x0000, 0x0020, 0xAD75, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xEF7D, 0x73AE, 0x18E3, 0x0020, 0x0000, 0x0000, 0x2965, 0xA514, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x39E7, 0x0000, 0x0000, 0x1040, 0x224C, 0x0336, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B15, 0x2945, 0x0000,
-    0x0841, 0xDEDB, 0xFFFF, 0xFFFF, 0xD69A, 0x632C, 0x0861, 0x0000, 0x0000, 0x0840, 0x2167, 0x3B10,
-    0x1082, 0x0000, 0x0000, 0xAD75, 0xFFFF, 0xFFFF, 0xAD55, 0x1082, 0x0000, 0x0000, 0x1082, 0xAD55,
-    0xFFFF, 0xFFDF, 0xFFDF, 0x8C51, 0xB5B6, 0xCE79, 0x0841, 0x73AE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF5D, 0xBDD7, 0xFFDF, 0xFFDF, 0xFFFF, 0xBDF7, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1082, 0x0000, 0x0000, 0x4A69, 0xC638, 0x39C7, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x2945, 0x0000, 0x0841,
-    0x10A2, 0x0000, 0x9CD3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x4A69, 0x4228, 0xF7BE, 0xFFFF, 0xFFFF,
-    0xA534, 0x0000, 0x7BEF, 0xFFFF, 0x738E, 0x0020, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEDB,
-    0x31A6, 0x0000, 0x0000, 0x10A2, 0x226E, 0x2AAF, 0x0000, 0x0000, 0x18C3, 0xDEFB, 0xFFFF, 0xA534,
-    0x2965, 0x0000, 0x0000, 0x0000, 0x2965, 0x9CF3, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0x6B6D, 0x0000, 0x0000, 0x0000, 0x1167, 0x1B35,
-    0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x2AF1, 0x0000, 0x0000,
-    0x52AA, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xCE79, 0x5AEB, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xD69A, 0x4208, 0x0000, 0x0000, 0x0000,
-    0x8C50, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x18C3, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xF79E, 0x3186, 0x3186, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534, 0x0020, 0x1082, 0x1082,
-    0x0000, 0x0000, 0x39C7, 0xB596, 0xFFFF, 0xFFFF, 0xD69A, 0x1082, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0861, 0x0000, 0x738E, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF5D, 0x8430, 0x0861,
-    0x0000, 0x632C, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xDEDB, 0x10A2, 0xE73C, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xA534, 0x0020, 0xDEFB, 0xFFFF, 0x8C51, 0xDEFB, 0xFFFF, 0xF7BE, 0xFFFF, 0xBDF7, 0x18E3,
-    0x0000, 0x0000, 0x2104, 0x22F2, 0x0316, 0x0316, 0x21A9, 0x0000, 0x0000, 0x39E7, 0x630C, 0x0000,
-    0x0000, 0x0000, 0x1082, 0x8C51, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9492, 0x0020, 0x0000, 0x0000, 0x2125,
-    0x2333, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0B36, 0x1147, 0x0000, 0x0000,
-    0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x39E7, 0x0000, 0x0000,
-    0x0000, 0x0000, 0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD75, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFDF, 0xBDD7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xDEFB, 0x2965, 0x31A6, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x0000, 0x0000,
-    0x18E3, 0x94B2, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8C51, 0x0000, 0x1082, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x31A6, 0xEF7D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xD69A,
-    0x73AE, 0xF79E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xBDF7, 0x1082, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x3186, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596, 0x1081, 0x0000,
-    0x0000, 0x2126, 0x2354, 0x02F6, 0x02F4, 0x02F5, 0x1355, 0x2967, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5ACB, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE59, 0x2124, 0x0000, 0x0000,
-    0x1082, 0x1A6E, 0x0B15, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B13, 0x18A2, 0x0000, 0x31A6,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x9CD3, 0x18C2,
-    0x0000, 0x0000, 0x0000, 0x6B6D, 0xF79D, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x5AEB, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA,
-    0x18E3, 0x39E7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x630C, 0x6B4D,
-    0xE73C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0x4228, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0841, 0x0841, 0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE79, 0xE73C, 0xEF5D, 0x1082, 0xA514, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0x2965, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0000, 0x0000,
-    0x19A9, 0x1335, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B56, 0x320A, 0x0000, 0x0020, 0x0000, 0x18E3,
-    0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x9CD3, 0x1082, 0x0000, 0x0000,
-    0x1041, 0x326D, 0x0B15, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x2A2C, 0x0000, 0x0000, 0x9492,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB,
-    0x5ACB, 0x0000, 0x0000, 0x0000, 0x31A6, 0xD69A, 0xFFFF, 0x4A49, 0x0000, 0x0000, 0x19C9, 0x1AD0,
-    0x18A1, 0x0000, 0x0000, 0x4A69, 0xF79E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x0000,
-    0x5AEB, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA, 0x1081, 0x0841, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,
-    0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFDF, 0xFFFF, 0xDEDB, 0x10A2, 0xB5B6, 0xFFFF, 0x7BEF, 0x0841, 0xC638, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x9CD3, 0x20E3, 0xEF7D, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CF3, 0x0000, 0x0000, 0x0820, 0x1A0B,
-    0x0B35, 0x02F5, 0x02F5, 0x02F4, 0x0316, 0x12F3, 0x1966, 0x0000, 0x0000, 0x0000, 0x5ACB, 0xE71C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x4A28, 0x0000, 0x0000, 0x0000, 0x2166,
-    0x2312, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B35, 0x18E3, 0x0000, 0x18C3, 0xE71C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0x9CD3, 0x18E3, 0x0000, 0x0000, 0x2104, 0x5289, 0x0000, 0x0000, 0x18C4, 0x0B14, 0x0316,
-    0x22F1, 0x20E4, 0x0000, 0x0000, 0x4A49, 0xF79E, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596, 0x0841, 0x630C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x0000, 0x0841,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000,
-    0x31A6, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0x39E7, 0x6B6D, 0xFFDF, 0xFFDF, 0xFFFF, 0x6B4D, 0x0000, 0x73AE, 0xA534,
-    0x738E, 0x10A2, 0xBDF7, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0000, 0x0820, 0x224C, 0x0336,
-    0x02F5, 0x02F5, 0x02F5, 0x0316, 0x2B11, 0x10A3, 0x0000, 0x0000, 0x0861, 0x9CB2, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFBE, 0x9492, 0x1082, 0x0000, 0x0000, 0x1082, 0x2A4C, 0x1355,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x22AF, 0x0000, 0x0000, 0x632C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xD69A, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2312, 0x0315, 0x02F4,
-    0x02F6, 0x2333, 0x20E3, 0x0000, 0x0000, 0x4A49, 0xF79E, 0xFFFF, 0xFFFF, 0x8C51, 0x73AE, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0861, 0xBDD7, 0xFFDF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4A69, 0x0000,
-    0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861,
-    0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x738E, 0x0000, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xA534, 0x4A69, 0x31A6,
-    0x5ACB, 0xCE79, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD55, 0x0000, 0x0000, 0x0820, 0x2A4C, 0x0336, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x2ACF, 0x1061, 0x0000, 0x0000, 0x2965, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x4208, 0x0000, 0x0000, 0x0800, 0x2146, 0x2312, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D5, 0x1356, 0x1947, 0x0000, 0x0020, 0xCE59, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0x738E, 0x0000, 0x0000, 0x0000, 0x2986, 0x0B35, 0x02F5, 0x02F5,
-    0x02F4, 0x02F6, 0x2B33, 0x20E3, 0x0000, 0x0000, 0x528A, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x7BEF, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x1082,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x73AE,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xAD55, 0x18A2, 0x52AA, 0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7, 0x0861, 0x0000, 0x0820, 0x2A4C, 0x0336, 0x02F5, 0x02F5,
-    0x02F5, 0x0B36, 0x2A8E, 0x1040, 0x0000, 0x0000, 0x52AA, 0xE73C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFDF, 0x8C51, 0x0861, 0x0000, 0x0000, 0x1081, 0x2A6D, 0x1335, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x1AD2, 0x18A2, 0x0000, 0x39E7, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0841, 0x0000, 0x0000, 0x1925, 0x1335, 0x02F5,
-    0x02F4, 0x02F5, 0x02F6, 0x2B33, 0x20E3, 0x0000, 0x0000, 0x630C, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0x4228, 0x18C3, 0xB5B6, 0xFFFF, 0xFFFF, 0xAD55, 0xE71C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF,
-    0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xEF7D,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xDEFB, 0x1082, 0xA514, 0xFFFF, 0x8C71, 0x0020, 0x630C, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA, 0x18C3, 0x0000, 0x0800, 0x224C, 0x0336, 0x02F5, 0x02F5, 0x02F5,
-    0x0B36, 0x21EB, 0x0840, 0x0000, 0x0000, 0x6B6D, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xCE79, 0x4208, 0x0000, 0x0000, 0x0800, 0x2166, 0x22F2, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x2A2B, 0x0000, 0x0000, 0xA514, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x10A2, 0x0000, 0x0000, 0x10C4, 0x2333,
-    0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x2B33, 0x20E3, 0x0000, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xC618, 0x18C3, 0x39E7, 0xE71C, 0xFFFF, 0xE71C, 0x5AEB, 0x0000, 0x8C71, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0xAD75, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x2945, 0x2124, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF5D, 0x2945, 0x0000, 0x0000, 0x19A8, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x0B36,
-    0x19EA, 0x0000, 0x0000, 0x0000, 0x8C51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x8C51,
-    0x0861, 0x0000, 0x0000, 0x1081, 0x2A2C, 0x1355, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B34, 0x10C3, 0x0000, 0x2104, 0xEF7D, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA, 0x2104, 0x0000, 0x0000, 0x18C3,
-    0x2333, 0x0316, 0x02F5, 0x02F5, 0x02F6, 0x22F1, 0x1882, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x9CD3, 0x0000, 0x6B4C, 0xFFFF, 0xFFFF, 0xA534, 0x0861, 0x18C3, 0x0000, 0xD69A, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x9CD3, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x4228, 0xFFDF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514,
-    0xAD75, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xF7BE, 0x630C, 0x0020, 0xAD75, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0x4A49, 0x0000, 0x0000, 0x1926, 0x1356, 0x02F5, 0x02F5, 0x02F5, 0x0B36, 0x21EA,
-    0x0000, 0x0000, 0x0020, 0x9CF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xE71C, 0xBDF7, 0x9CD3, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xCE79, 0x4208, 0x0000,
-    0x0000, 0x0800, 0x2145, 0x2312, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x226D, 0x0820, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE71C, 0x4208, 0x0000, 0x0000,
-    0x18C3, 0x2333, 0x02F5, 0x02F5, 0x02F4, 0x0316, 0x126F, 0x0820, 0x0000, 0x0861, 0xC618, 0xFFFF,
-    0xFFFF, 0x9CF3, 0x94B2, 0xFFFF, 0xEF7D, 0x4A49, 0x0861, 0x9CD3, 0x738D, 0x4208, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xEF7D, 0x2965, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xBDF7, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8410,
-    0x0000, 0x52AA, 0xE73C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x94B2, 0xBDD7, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x738E, 0x0000, 0x0000, 0x2125, 0x2355, 0x02F5, 0x02F5, 0x02F5, 0x0B36, 0x21EA, 0x0000,
-    0x0000, 0x0020, 0xAD54, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xBDD7, 0x738E,
-    0x4A49, 0x18C3, 0x0000, 0x0841, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFDF, 0x8C71, 0x1082, 0x0000, 0x0000,
-    0x1061, 0x2A6C, 0x1335, 0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02D5, 0x1355, 0x2146, 0x0000, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x4208, 0x0000,
-    0x0000, 0x10C3, 0x1314, 0x0315, 0x02F5, 0x02F5, 0x0336, 0x2A4D, 0x0000, 0x0000, 0x2103, 0xE71C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x18E3, 0x39E7, 0xD69A, 0xFFDF, 0x18C3, 0xAD75, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x94B2, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xCE59, 0x3186, 0x0020, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xAD55, 0x0000, 0x0000, 0x18C2, 0x2313, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x2A8E, 0x0820, 0x0000,
-    0x0020, 0xAD54, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xB5B6, 0x632C, 0x18C3, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x10A2, 0xDEDB, 0xFFFF, 0xCE79, 0x4228, 0x0000, 0x0000, 0x0000, 0x2166,
-    0x22F1, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x0316, 0x12B0, 0x0820, 0x0000, 0x5AEB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x4208,
-    0x0000, 0x0000, 0x1925, 0x1314, 0x02F5, 0x02F5, 0x02F5, 0x1356, 0x29EA, 0x0000, 0x0000, 0x4208,
-    0xFFDF, 0xFFDF, 0xFFFF, 0x52AA, 0x7BEF, 0xFFFF, 0xFFFF, 0x9492, 0x2104, 0xF7BE, 0xFFFF, 0xCE79,
-    0x2945, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF79E, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xBDF7, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x8C71, 0x1082, 0x4228, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEBA,
-    0x10A2, 0x0000, 0x0840, 0x22B0, 0x0316, 0x02F5, 0x02F5, 0x0316, 0x2ACF, 0x1040, 0x0000, 0x0000,
-    0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x8410, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840,
-    0x10A2, 0x18E3, 0x0000, 0x10A2, 0xD6BA, 0x94B2, 0x1082, 0x0000, 0x0000, 0x1081, 0x2A2C, 0x1355,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x0316, 0x320A, 0x0000, 0x0000, 0x83EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D,
-    0x2945, 0x0000, 0x0000, 0x29A8, 0x0B35, 0x02D5, 0x02F5, 0x02F5, 0x1355, 0x2966, 0x0000, 0x0000,
-    0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x3186, 0x8430, 0xFFFF, 0x7BEF, 0x0840,
-    0x5AEB, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x4228, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xE71C, 0x18C3, 0x6B6D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xF7BE, 0x39E7,
-    0x0000, 0x0000, 0x322B, 0x0B36, 0x02F4, 0x02F4, 0x0316, 0x2B12, 0x1881, 0x0000, 0x0000, 0x8C51,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xD69A, 0x6B6D, 0x1082, 0x0000, 0x0000, 0x0000, 0x1060, 0x2125, 0x21EA, 0x3311,
-    0x0315, 0x3A8C, 0x0000, 0x0861, 0x2965, 0x0000, 0x0000, 0x0800, 0x2125, 0x2312, 0x0336, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x2B53, 0x1040, 0x0000, 0x0000, 0x0020, 0x39C7, 0xAD55, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xD6BA, 0x2104, 0x0000, 0x0000, 0x2A0A, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x2313, 0x1082, 0x0000,
-    0x0000, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xC618, 0x10A2, 0xBDB6, 0x39C6, 0x18E3, 0xAD54,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF5D, 0x2965, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x2965, 0xCE79, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xF7BE, 0xFFFF, 0xB596, 0x39C7, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x0000,
-    0x0000, 0x2166, 0x0B35, 0x02D5, 0x02F5, 0x02F5, 0x12F3, 0x1082, 0x0000, 0x0000, 0x73AE, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xE71C, 0x6B6D, 0x1082, 0x0000, 0x0000, 0x0000, 0x0861, 0x3A4B, 0x12B0, 0x2355, 0x0316, 0x02F5,
-    0x0316, 0x326C, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x2A4C, 0x1335, 0x02F5, 0x02F4, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x0AF4, 0x2A8E, 0x1904, 0x0820, 0x0000, 0x0000, 0x0000, 0x31A6, 0xAD75,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xCE59, 0x0861, 0x0000, 0x0820, 0x2A6E, 0x0316, 0x02F4, 0x02F5, 0x0316, 0x2AAF, 0x0840,
-    0x0000, 0x2124, 0xEF5D, 0xFFDF, 0xFFDF, 0xFFFF, 0x630C, 0x0841, 0x0861, 0x52AA, 0xEF5D, 0xFFFF,
-    0xFFDF, 0x9492, 0x31A6, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x8C50, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x4228, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x4A69, 0x0000, 0x6B4C,
-    0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x4228, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE79, 0x0841, 0x0000,
-    0x1082, 0x22F2, 0x02F6, 0x02F5, 0x02D5, 0x0B56, 0x1946, 0x0000, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x8410,
-    0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x2AF1, 0x0317, 0x02D4, 0x02F5, 0x02F4,
-    0x0316, 0x326C, 0x0000, 0x0000, 0x0000, 0x2166, 0x22F2, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x0B35, 0x2AD0, 0x2187, 0x1081, 0x0000, 0x0000, 0x0000,
-    0x528A, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xB596, 0x0820, 0x0000, 0x0820, 0x1AF1, 0x02F6, 0x02F5, 0x02D5, 0x0336, 0x21C9,
-    0x0000, 0x0000, 0x6B2C, 0xFFFF, 0xFFFF, 0xFFDF, 0x18C3, 0x18C3, 0xAD55, 0xFFFF, 0xFFFF, 0xAD75,
-    0x31A6, 0x20E3, 0x10A2, 0x632C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x18C3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xAD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x2104,
-    0x18C3, 0x9492, 0xE73C, 0xA555, 0x0841, 0xB596, 0xFFFF, 0xFFDF, 0xFFDF, 0x39E7, 0x0000, 0x0000,
-    0x2A8E, 0x0316, 0x02F5, 0x02F5, 0x0B36, 0x322B, 0x0820, 0x0000, 0x2965, 0xEF7D, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x39C7, 0x0000,
-    0x0000, 0x0000, 0x2124, 0xA514, 0x8410, 0x0000, 0x0000, 0x18E4, 0x1354, 0x02F5, 0x02F5, 0x02F5,
-    0x0316, 0x326C, 0x0000, 0x1061, 0x2A2C, 0x1355, 0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x1356, 0x22F1, 0x1947, 0x0000, 0x0000,
-    0x0000, 0x0861, 0x8410, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x2124, 0x1B34, 0x02F5, 0x02F5, 0x02F5, 0x1B34,
-    0x1904, 0x0000, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xBDD7, 0xE73C, 0xFFFF, 0xBDD7, 0x39E7, 0x0000,
-    0x5AEB, 0xEF5D, 0xD69A, 0x10A2, 0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x39C7, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE,
-    0x7BEF, 0x1082, 0x0000, 0x10A2, 0x8C71, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x0000, 0x0000, 0x2146,
-    0x0B35, 0x02F5, 0x02F5, 0x0316, 0x1A8F, 0x0000, 0x0000, 0x1082, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0x840F, 0x0020, 0x0000, 0x0000,
-    0x1082, 0x7BCF, 0xEF7D, 0xFFFF, 0xFFFF, 0x52AA, 0x0000, 0x0000, 0x29C9, 0x1356, 0x02F5, 0x02F5,
-    0x0316, 0x3A8C, 0x2125, 0x22F2, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x0317, 0x22F1, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x39C7, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x0000, 0x0000, 0x2188, 0x0B36, 0x02F5, 0x02F4, 0x0316,
-    0x22B0, 0x0800, 0x0000, 0x2965, 0xF7BE, 0xFFFF, 0xFFFF, 0xD6BA, 0x4A69, 0x0020, 0x6B6D, 0x4A49,
-    0x630C, 0xFFFF, 0xFFFF, 0x5ACB, 0x528A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xDEFB, 0x10A2, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0861, 0x0841, 0x0841, 0x9CD3, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xDEFB, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x1082, 0x0000, 0x1081, 0x2313,
-    0x02F5, 0x02F4, 0x02F5, 0x1B34, 0x18E3, 0x0000, 0x0000, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA, 0x39C7, 0x0000, 0x0000, 0x0000, 0x4208,
-    0xDEDB, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0x2124, 0x0000, 0x0000, 0x2A6D, 0x0316, 0x02F4,
-    0x02F5, 0x2B12, 0x1334, 0x02F6, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B14, 0x2104, 0x0000, 0x0000,
-    0x52AA, 0x18E3, 0x0000, 0x0000, 0x0841, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x2965, 0x0000, 0x0000, 0x2AAF, 0x0336, 0x02F5, 0x02F5,
-    0x0B36, 0x21C9, 0x0000, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xB575, 0x4228, 0xCE79, 0xFFFF, 0xE73C,
-    0x10A2, 0xC618, 0xFFFF, 0xDEDB, 0x18E3, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x4208, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x8410, 0x5AEB, 0x0000, 0x2965, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x4228, 0x52AA, 0x528A, 0x528A, 0x6B4D, 0x6B6D,
-    0x8410, 0xA534, 0xAD75, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x2A2C, 0x0336,
-    0x02F4, 0x02F5, 0x0336, 0x21A8, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228,
-    0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x0861, 0x0000, 0x1881, 0x2312, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x1988, 0x0000, 0x0000, 0x528A,
-    0xFFFF, 0xD69A, 0x4A49, 0x0000, 0x0000, 0x0000, 0x632C, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x0041, 0x0000, 0x10A2, 0x2313, 0x02F5, 0x02F5,
-    0x02F5, 0x1B13, 0x1882, 0x0000, 0x10A2, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x6B6D, 0x3186, 0xFFFF, 0xFFFF, 0xC618, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xAD55, 0x18E3, 0x0000, 0x738E, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x6B4D, 0xB596, 0x2945, 0x0000, 0x630C, 0xDEFB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x0000, 0x528A, 0x9CB2, 0x738E, 0x39E7, 0x0000,
-    0x31A6, 0x2965, 0x5AEB, 0xFFDF, 0xFFDF, 0xFFFF, 0xCE79, 0x0861, 0x0000, 0x2104, 0x1335, 0x02F5,
-    0x02F5, 0x0316, 0x2AAF, 0x0820, 0x0000, 0x2965, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C30, 0x0000, 0x0000, 0x0000, 0x29A8, 0x2125, 0x0000, 0x0000,
-    0x632C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x2104, 0x1335,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0336, 0x328E, 0x0820, 0x0000, 0x2124, 0xEF5C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x0841, 0x0020, 0x0000, 0x4208, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x2187, 0x0B56, 0x02F5,
-    0x02F5, 0x0336, 0x2A4C, 0x0000, 0x0000, 0x630C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xE73C, 0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xD679, 0x4228, 0x0000, 0x4228, 0xCE59, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x94B2, 0x94B2, 0x1081, 0x0841, 0x8C71,
-    0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x18E3, 0xBDF7, 0xFFFF, 0x738E, 0x6B6D,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x0000, 0x0800, 0x228E, 0x0316, 0x02F5,
-    0x02F5, 0x1B55, 0x2104, 0x0000, 0x0000, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x0820, 0x21CA, 0x1356, 0x2334, 0x18C3, 0x0000,
-    0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4A49, 0x0000, 0x0000, 0x21C9,
-    0x0336, 0x02D4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x1AD1, 0x0841, 0x0000, 0x0020, 0xBDF7, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0000, 0x0020, 0x0000, 0x2965, 0xD6BA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x3186, 0x0000, 0x0820, 0x1A6E, 0x0316,
-    0x02F4, 0x02F5, 0x1335, 0x1904, 0x0000, 0x0841, 0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xDEFB, 0x9CD3, 0x8410, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x6B6D, 0x0000, 0x18C3, 0xB596, 0xB5B6, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0xBDF7, 0x5ACB, 0x0000,
-    0x94B2, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA514, 0x10A2, 0x9492, 0x2945, 0xDEDB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xC618, 0x0841, 0x0000, 0x2146, 0x1335, 0x02F5, 0x02F5,
-    0x0336, 0x220B, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0x62EB, 0x0000, 0x0000, 0x1061, 0x228E, 0x0336, 0x02D4, 0x0316, 0x1A8F, 0x0000,
-    0x0000, 0x10A2, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x18C3, 0x0000, 0x0820,
-    0x328E, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1335, 0x1904, 0x0000, 0x0000, 0x8C51, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0xCE59, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x0841, 0x0000, 0x18E3, 0x1B34,
-    0x02F5, 0x02F4, 0x0316, 0x1A6E, 0x0820, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xEF7D, 0x632C, 0x0841, 0x3186, 0x4208, 0x2104, 0x4A69, 0xF79E, 0xFFFF, 0xFFFF, 0xB5B6, 0x2104,
-    0x1082, 0x8410, 0xD69A, 0x52AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4A69, 0x0861,
-    0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x0000, 0x6B4D, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x0000, 0x0820, 0x2AD0, 0x0316, 0x02F4, 0x02F5,
-    0x1AF2, 0x0841, 0x0000, 0x18C3, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x630C, 0x0000, 0x0000, 0x18A2, 0x2AD0, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x0B36, 0x2A0A,
-    0x0000, 0x0000, 0x3186, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596, 0x0000, 0x0000,
-    0x1061, 0x1AF2, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B36, 0x29C9, 0x0000, 0x0000, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xA4F3, 0x0000, 0x0000, 0x1082, 0x2146, 0x0000, 0x0000, 0x18C3, 0xCE59,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B2C, 0x0000, 0x0000, 0x2A2C,
-    0x0336, 0x02F4, 0x02D5, 0x1355, 0x10E4, 0x0000, 0x0020, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0x4A49, 0x18C3, 0xBDD7, 0xF7BE, 0xFFFF, 0xE71B, 0x2945, 0x6B4D, 0xFFFF, 0xFFFF, 0xAD55, 0x0000,
-    0x94B2, 0x8430, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8C71, 0x1082, 0xBDF7,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x0020, 0x0000, 0x2966, 0x0B35, 0x02F5, 0x02F5, 0x0B56,
-    0x29C9, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x7BCE, 0x0000, 0x0000, 0x18A2, 0x2B11, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B35,
-    0x1945, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BEF, 0x0000,
-    0x0000, 0x2145, 0x1B55, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F4, 0x0316, 0x226E, 0x0000, 0x0000, 0x18C3, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xD69A, 0x1082, 0x0000, 0x0840, 0x2AB0, 0x1B76, 0x2167, 0x0000, 0x0000, 0x2945,
-    0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x18C3, 0x0000, 0x1082,
-    0x1AF2, 0x02F5, 0x02F4, 0x0316, 0x228F, 0x0000, 0x0000, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7,
-    0x10A2, 0xE73C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x2104, 0xEF5D, 0xFFFF, 0xF79E, 0x3186,
-    0x10C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0xA534,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x0861,
-    0xD6BA, 0xFFFF, 0xFFDF, 0xFFFF, 0x528A, 0x0000, 0x0840, 0x22B0, 0x0316, 0x02F4, 0x02F5, 0x2AF1,
-    0x1041, 0x0000, 0x31A6, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8430,
-    0x0000, 0x0000, 0x18A2, 0x2B11, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x2313, 0x1082, 0x0000, 0x0000, 0xAD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0x39E7,
-    0x0000, 0x0000, 0x29C9, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x2312, 0x18A2, 0x0000, 0x0840, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF79E, 0x39C7, 0x0000, 0x0000, 0x19CA, 0x0336, 0x02D5, 0x1B56, 0x2167, 0x0000, 0x0000,
-    0x3186, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000,
-    0x29EA, 0x0336, 0x02F5, 0x02F5, 0x0B35, 0x1905, 0x0000, 0x0820, 0xD69A, 0xFFFF, 0xFFFF, 0x738E,
-    0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xE71C, 0x2104, 0xDEFB, 0xFFFF, 0xFFFF, 0x8410,
-    0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0xEF5D,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x9492,
-    0xEF5D, 0xFFFF, 0xFFFF, 0xD69A, 0x0861, 0x0000, 0x2166, 0x1356, 0x02F5, 0x02F5, 0x1356, 0x2167,
-    0x0000, 0x0000, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD75, 0x0000,
-    0x0000, 0x1081, 0x2AF1, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4,
-    0x0316, 0x2ACF, 0x0840, 0x0000, 0x18C3, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB,
-    0x18A2, 0x0000, 0x0000, 0x22AF, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x1B35, 0x2105, 0x0000, 0x0000, 0x840F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x6B6D, 0x0000, 0x0000, 0x2125, 0x1335, 0x02F5, 0x02F5, 0x02F5, 0x1B54, 0x2945, 0x0000,
-    0x0000, 0x4A49, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2945, 0x0000,
-    0x1061, 0x1B13, 0x02F5, 0x02F4, 0x0316, 0x1A6E, 0x0820, 0x0000, 0x6B2C, 0xFFFF, 0xFFFF, 0x8C51,
-    0x52AA, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xAD75, 0x18C3, 0xEF5D, 0xFFFF, 0xFFFF, 0xD6BA,
-    0x0020, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x6B2C, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x2AAF, 0x0316, 0x02F4, 0x0316, 0x22D0, 0x1040,
-    0x0000, 0x4208, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x10A2, 0x0000,
-    0x0840, 0x22AF, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x0336, 0x21EA, 0x0000, 0x0000, 0x41E7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xAD55, 0x0000, 0x0000, 0x18A2, 0x2313, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02D5, 0x0B36, 0x2A0A, 0x0000, 0x0000, 0x4A49, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xAD75, 0x0000, 0x0000, 0x10A2, 0x2333, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B34, 0x2104,
-    0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CF3, 0x0000,
-    0x0000, 0x21C9, 0x0B36, 0x02F4, 0x02F5, 0x1B55, 0x18E4, 0x0000, 0x18C3, 0xDEFB, 0xFFFF, 0xD6BA,
-    0x0861, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0841, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0xAD75, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF5D, 0x18C3, 0x0000, 0x2104, 0x0B14, 0x02F5, 0x02F5, 0x0335, 0x29A8, 0x0000,
-    0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x3186, 0x0000, 0x0000,
-    0x19CA, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x1B55, 0x2125, 0x0000, 0x0000, 0x7BCE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x738E, 0x0000, 0x0000, 0x18E5, 0x0B35, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4,
-    0x0316, 0x328E, 0x0820, 0x0000, 0x2103, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB,
-    0x10A2, 0x0000, 0x0000, 0x1A6E, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x2312,
-    0x1061, 0x0000, 0x0020, 0xAD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2945,
-    0x0000, 0x1081, 0x1AF2, 0x02F5, 0x02F4, 0x0316, 0x326D, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFFF,
-    0x9CB2, 0x10A2, 0x630C, 0x7BEF, 0x4A49, 0x0000, 0x4A69, 0xF79E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x9CF3, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x18C3, 0xE71C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x8C30, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x5AEB, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xA514, 0x0000, 0x0000, 0x19EB, 0x0B36, 0x02F4, 0x02F5, 0x2B12, 0x0840, 0x0000,
-    0x31A6, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B4D, 0x0000, 0x0000, 0x2987,
-    0x1356, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x2312, 0x18A2, 0x0000, 0x0020, 0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0x39E7, 0x0000, 0x0000, 0x2A2B, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x2312, 0x1081, 0x0000, 0x0000, 0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x39C7,
-    0x0000, 0x0800, 0x320A, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0336,
-    0x2A8E, 0x0820, 0x0000, 0x10A2, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3,
-    0x0000, 0x0000, 0x2A2B, 0x0336, 0x02F4, 0x02F5, 0x12D2, 0x1881, 0x0000, 0x31A6, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xB5B6, 0x39E7, 0x39C7, 0x528A, 0xC618, 0xFFFF, 0xFFFF, 0xE73C, 0xD6BA, 0xFFDF, 0xFFFF,
-    0xDEDB, 0x0861, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528A, 0xFFDF, 0xFFDF,
-    0xFFFF, 0x9CF3, 0x9492, 0xEF7D, 0x4A69, 0xCE79, 0xFFFF, 0xFFDF, 0xFFFF, 0x3186, 0x8C71, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x4A49, 0x0000, 0x1061, 0x2B33, 0x02F5, 0x02F4, 0x0336, 0x19C9, 0x0000, 0x0000,
-    0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x0020, 0x0000, 0x18E3, 0x1B34,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x0316, 0x2A8E, 0x0000, 0x0000, 0x18E3, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xD6BA, 0x1082, 0x0000, 0x0820, 0x226E, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B55,
-    0x2166, 0x0000, 0x0000, 0x7BCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000,
-    0x0000, 0x1905, 0x0B35, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x0B36, 0x29E9, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
-    0x2945, 0x0000, 0x18C3, 0x2334, 0x02F5, 0x02F4, 0x0B56, 0x1168, 0x0000, 0x0000, 0xC638, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x9CD3, 0x39E7, 0x2124, 0x10A2, 0xE71C, 0xFFFF,
-    0xFFDF, 0x4228, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x9CD3, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x8C51, 0x2124, 0x10A2, 0x1082, 0x6B4D, 0xEF7D, 0xFFFF, 0xD69A, 0x18E3, 0xDEFB, 0xFFFF,
-    0xFFFF, 0xD69A, 0x0861, 0x0000, 0x1946, 0x0336, 0x02F5, 0x02F5, 0x1313, 0x18A2, 0x0000, 0x2104,
-    0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x2124, 0x0000, 0x0840, 0x2AAF, 0x0316,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B36, 0x2A0A, 0x0000, 0x0000, 0x4A69, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xA534, 0x0000, 0x0000, 0x1061, 0x1B13, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x29EA,
-    0x0000, 0x0000, 0x39C7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534, 0x0000, 0x0000,
-    0x1082, 0x1AF2, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x0B34, 0x1904, 0x0000, 0x0000, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8410, 0x0000, 0x0800, 0x224D, 0x0316, 0x02F4, 0x02F6, 0x2AD0, 0x0840, 0x0000, 0x738E, 0xFFFF,
-    0xFFFF, 0xF7BE, 0xB5B6, 0x73AE, 0x2965, 0x0000, 0x1082, 0x52AA, 0xB5B6, 0x39E7, 0x9CF3, 0xFFFF,
-    0xFFFF, 0x8C71, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0xDEDB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF7D, 0xAD75, 0x630C, 0x0861, 0x2124, 0x630C, 0x4A69, 0x4A69, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x8C71, 0x0000, 0x0000, 0x32AF, 0x0316, 0x02D4, 0x0336, 0x2A6E, 0x0000, 0x0000, 0x8430,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x29EA, 0x0B56, 0x02D5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1335, 0x2125, 0x0000, 0x0000, 0x8410, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B4D, 0x0000, 0x0000, 0x2967, 0x1335, 0x02F5, 0x02F4, 0x02F5,
-    0x0B35, 0x0314, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x22AF, 0x0820,
-    0x0000, 0x18C3, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x10A2, 0x0000, 0x0820,
-    0x2AAE, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F4, 0x0316, 0x2AF0, 0x0840, 0x0000, 0x2103, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xE71C, 0x0861, 0x0000, 0x1925, 0x1355, 0x02F5, 0x02F5, 0x0B14, 0x0882, 0x0000, 0x2125, 0xEF7D,
-    0xFFFF, 0xEF5D, 0x2124, 0x3186, 0x9492, 0x8C71, 0x31A6, 0xFFFF, 0xFFFF, 0x8430, 0x52AA, 0xFFFF,
-    0xFFFF, 0xCE79, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x5AEB, 0x738E, 0x18C3, 0xAD55, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x4208, 0x0000, 0x20C2, 0x12F3, 0x02F5, 0x02F5, 0x0315, 0x2166, 0x0000, 0x0861, 0xD6BA,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEBA, 0x1082, 0x0000, 0x18A2, 0x1B14, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x2B12, 0x1081, 0x0000, 0x0020, 0xBDD7, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x3186, 0x0000, 0x0000, 0x220B, 0x0336, 0x0316, 0x12D2,
-    0x4229, 0x2B33, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x2313, 0x18A2, 0x0000,
-    0x0000, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4208, 0x0000, 0x0000, 0x21C9,
-    0x0336, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02D5, 0x0336, 0x21A8, 0x0000, 0x0000, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x632C, 0x0000, 0x0840, 0x1AB1, 0x0316, 0x02F4, 0x0336, 0x3A2B, 0x0000, 0x0000, 0xB5B6,
-    0xFFFF, 0xF7BE, 0xEF7D, 0xFFFF, 0xFFFF, 0xF79E, 0x2945, 0xC638, 0xFFDF, 0xC638, 0x31A6, 0xF79E,
-    0xFFFF, 0xF7BE, 0x18E3, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B6D, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xE71C, 0xE71C, 0xAD54, 0xF79E, 0xFFFF, 0xFFFF,
-    0xD6BA, 0x0041, 0x0000, 0x2167, 0x1356, 0x02D4, 0x02F5, 0x2B33, 0x0820, 0x0000, 0x4A69, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x1A2C, 0x0336, 0x02F4, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x228D, 0x0000, 0x0000, 0x2945, 0xE73C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x1082, 0x0000, 0x1060, 0x2AD0, 0x22B0, 0x0862,
-    0x1860, 0x2B32, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B35, 0x1925, 0x0000, 0x0000,
-    0x738E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x0000, 0x0000, 0x2145, 0x1B55,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x1B34, 0x18C3, 0x0000, 0x0841, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xB596, 0x0000, 0x0000, 0x322B, 0x0316, 0x02F4, 0x0336, 0x0A6F, 0x0820, 0x0000, 0x73AE,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xE73C, 0x0841, 0x6B6D, 0xFFFF, 0xCE79, 0x18E3, 0xDEDB,
-    0xFFFF, 0xFFFF, 0x6B2C, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xDEDB, 0xB596, 0x7BEF, 0x632C, 0x528A, 0x4208, 0x18C3, 0x0000, 0x6B4C, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x94B2, 0x0000, 0x0820, 0x226E, 0x0316, 0x02F4, 0x0336, 0x19EB, 0x0820, 0x0000, 0xA534, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x0841, 0x0000, 0x1905, 0x1355, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B36, 0x2188, 0x0000, 0x0000, 0x528A,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA513, 0x0000, 0x0000, 0x1061, 0x0840, 0x0000,
-    0x0840, 0x0A4E, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x0B56, 0x2A2B, 0x0000, 0x0000, 0x4208,
-    0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB5B6, 0x0820, 0x0000, 0x1061, 0x1AF2, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F4, 0x0336, 0x2A2C, 0x0000, 0x0000, 0x6B2C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF7BE, 0x2965, 0x0000, 0x0882, 0x1B55, 0x02F5, 0x02D5, 0x1B55, 0x2124, 0x0000, 0x2945,
-    0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x2965, 0x18C3, 0x6B6D, 0x2965, 0x3186, 0xF7BE,
-    0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x0840, 0xD6BA, 0xFFFF, 0xFFFF, 0xD69A,
-    0x1082, 0x3186, 0x39E7, 0x630C, 0x62EB, 0x18E3, 0xB5B6, 0xDEDB, 0xF79E, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x528A, 0x0000, 0x0841, 0x2B53, 0x02F5, 0x02F5, 0x1B55, 0x2146, 0x0000, 0x1082, 0xEF7D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x2A8F, 0x0316, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B55, 0x2125, 0x0000, 0x0000,
-    0x8C71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x01AB, 0x0337, 0x02F4, 0x02F5, 0x02F5, 0x0316, 0x2AAF, 0x0820, 0x0000, 0x0861, 0xDEDB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x10A2, 0x0000, 0x0820, 0x2A8E, 0x0316, 0x02F4,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1334, 0x18C3, 0x0000, 0x1082, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x738E, 0x0000, 0x1061, 0x22D0, 0x02F6, 0x02F4, 0x0336, 0x0947, 0x0000, 0x0021,
-    0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0020, 0xDEFB, 0xB596, 0x4228, 0x4A69, 0xE6FB, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xCE79, 0x0841, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2945, 0xF79E, 0xFFFF, 0xFFFF, 0xE73C,
-    0x528A, 0x31A6, 0xCE59, 0xFFFF, 0xA514, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,
-    0x2945, 0x0000, 0x1925, 0x0315, 0x02F5, 0x0316, 0x0AB1, 0x1061, 0x0000, 0x630B, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x0841, 0x0000, 0x2125, 0x0B35, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x1AD1, 0x0820, 0x0000,
-    0x0841, 0xBDF7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x3185, 0x0000, 0x0841, 0x0000,
-    0x0000, 0x21EB, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x1B13, 0x10A2, 0x0000, 0x0000, 0xA514, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4A69, 0x0000, 0x0000, 0x29EA, 0x0B56, 0x02D5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x326D, 0x0000, 0x0000, 0x736D, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x1189, 0x0B56, 0x02D4, 0x02F6, 0x3AEF, 0x0820, 0x0000,
-    0x8C51, 0xFFFF, 0xFFFF, 0xA534, 0x0000, 0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xF79E, 0x2945, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x8430, 0x1082, 0x73AE, 0x4A49, 0x9492, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618,
-    0x0000, 0x0000, 0x3A6C, 0x0336, 0x02D4, 0x0336, 0x328E, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0820, 0x226E, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x2A4D, 0x0820,
-    0x0000, 0x2104, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x4A69, 0xB5B6, 0x0861,
-    0x0000, 0x320A, 0x0B56, 0x02D4, 0x02F5, 0x1355, 0x2166, 0x0000, 0x0000, 0x632C, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BEF, 0x0000, 0x0000, 0x1904, 0x0B35, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1314, 0x18E3, 0x0000, 0x18C2, 0xEF5D, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xF7BE, 0x2965, 0x0000, 0x31A6, 0x1335, 0x02F5, 0x02F5, 0x1AF3, 0x0000, 0x0000,
-    0x528A, 0xFFFF, 0xFFFF, 0xAD55, 0x8C71, 0xFFFF, 0xFFFF, 0xF79E, 0xD6BA, 0xAD75, 0x94B2, 0x738D,
-    0xCE79, 0xFFFF, 0xFFDF, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x8430, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xD67A, 0x3186, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,
-    0x0000, 0x0000, 0x0A2F, 0x0316, 0x02F4, 0x0316, 0x2187, 0x0000, 0x10A2, 0xDEDB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF3C, 0x18E3, 0x0000, 0x08A3, 0x1335, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D5, 0x0B36, 0x1967,
-    0x0000, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x3186,
-    0x0000, 0x39E8, 0x1335, 0x02D4, 0x0336, 0x19CA, 0x0000, 0x0000, 0x31A6, 0xF7BE, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x1082, 0x2B12, 0x02F6, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x0B36, 0x21CA, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0841, 0x12D2, 0x0316, 0x02F5, 0x0315, 0x2145, 0x0000,
-    0x2965, 0xEF7D, 0xFFFF, 0xFFDF, 0xAD55, 0x630C, 0x39E7, 0x3186, 0x2124, 0x18E3, 0x0000, 0x0000,
-    0x9492, 0xFFFF, 0xFFFF, 0x8410, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8410, 0x0000, 0x6B6D, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB,
-    0x0000, 0x2903, 0x1B33, 0x02F5, 0x02F5, 0x1B55, 0x0882, 0x0000, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xA534, 0x0000, 0x0000, 0x324B, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B13,
-    0x10A3, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4228,
-    0x0000, 0x2945, 0x0B14, 0x0316, 0x2AD0, 0x1040, 0x0000, 0x0861, 0xD6BA, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF3C, 0x2124, 0x0000, 0x0800, 0x2A8E, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x2312, 0x0841, 0x0000, 0x39E7, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x9CF3, 0x0000, 0x0000, 0x3ACF, 0x0316, 0x02D4, 0x0B56, 0x3A4B, 0x0000,
-    0x0000, 0xCE79, 0xFFFF, 0xF7BE, 0x632C, 0x4208, 0x8410, 0xBDF7, 0xB5B6, 0x630C, 0x2104, 0x7BCF,
-    0xEF3C, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF, 0xE71C, 0xAD55,
-    0xDEFB, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xC659, 0x2104, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFDF, 0x2104,
-    0x0000, 0x1926, 0x1B76, 0x02D4, 0x02F5, 0x3311, 0x1881, 0x0000, 0x738E, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x528A, 0x0000, 0x1061, 0x1AD1, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x0337,
-    0x32F0, 0x0840, 0x0000, 0x0020, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB,
-    0x0000, 0x0020, 0x02B3, 0x1B13, 0x1082, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x528A, 0x0000, 0x0000, 0x29C8, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0315, 0x2187, 0x0000, 0x0020, 0xCE59, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x10A3, 0x0000, 0x1988, 0x0316, 0x02F4, 0x0336, 0x09ED, 0x0000,
-    0x0000, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x2124, 0x52AA, 0xDEDB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0xEF5D, 0xFFFF, 0xFFFF, 0xBDD7, 0x2124,
-    0x0000, 0x10A2, 0x4228, 0x630C, 0x8430, 0xC638, 0xDEDB, 0xF79E, 0xFFFF, 0xFFFF, 0xDEDB, 0x0861,
-    0x0000, 0x0127, 0x0336, 0x02D4, 0x0336, 0x01CB, 0x0000, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xE73C, 0x0020, 0x0000, 0x2966, 0x1355, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x2312,
-    0x2125, 0x0000, 0x0000, 0x0020, 0x9492, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B4D,
-    0x0000, 0x0000, 0x2B33, 0x1947, 0x0000, 0x0000, 0x6B4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x8C71, 0x0000, 0x0000, 0x2145, 0x1B55, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0336, 0x1A4E, 0x0000, 0x0000, 0x8410, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2945, 0x0000, 0x10A4, 0x1B55, 0x02D5, 0x02F5, 0x1AF1, 0x18A1,
-    0x0000, 0x7BEF, 0xFFFF, 0xFFFF, 0xF79E, 0x9CD3, 0x2965, 0x528A, 0xCE79, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xEF5D, 0x10A2, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0861, 0x0020,
-    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xD6BA, 0xB5B6, 0x8410, 0x5ACB, 0x18C3, 0x18E3, 0x52AA, 0xFFDF, 0xFFFF, 0xFFFF, 0xB5B6, 0x0000,
-    0x0000, 0x328D, 0x0316, 0x02D4, 0x1356, 0x21A9, 0x0000, 0x0020, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xA534, 0x0000, 0x0000, 0x19EB, 0x0336, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0B15, 0x222C, 0x0840,
-    0x0000, 0x0000, 0x0000, 0x632C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8410,
-    0x0000, 0x0021, 0x2966, 0x0020, 0x0000, 0x2965, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xC5F7, 0x0020, 0x0000, 0x1061, 0x22F1, 0x02F6, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B13, 0x20E3, 0x0000, 0x4208, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x20C2, 0x3353, 0x02F5, 0x02F5, 0x2B74, 0x2104,
-    0x0000, 0x31A6, 0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x2945, 0x9CF3, 0xC638, 0xD69A, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4228, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0861, 0x0861,
-    0x0861, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x2965, 0x6B4D,
-    0x630C, 0x632C, 0x632C, 0x632C, 0x632C, 0x6B4D, 0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0xD6BA,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xDEFB, 0xFFFF, 0xFFDF, 0xFFFF, 0x8430, 0x0000,
-    0x0820, 0x3B31, 0x02F5, 0x02F5, 0x1355, 0x31A6, 0x0000, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x5ACB, 0x0000, 0x1061, 0x3352, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x12F4, 0x19CA, 0x18C3,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x41E7, 0x9CD2, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD55,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1081, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x2945, 0x0000, 0x0820, 0x326D, 0x0B36, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x1376, 0x1126, 0x0000, 0x0861, 0xDEFB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CB2, 0x0000, 0x0820, 0x0A4E, 0x0316, 0x02D4, 0x0B56, 0x08C4,
-    0x0000, 0x1904, 0xF7BE, 0xFFFF, 0xEF7D, 0xBDF7, 0x9492, 0x6B2C, 0x528A, 0x52AA, 0x4A49, 0x5AEB,
-    0x738E, 0xCE59, 0xFFFF, 0xFFFF, 0x7BEF, 0x2124, 0x2945, 0x2945, 0x2945, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x9CD3, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18E3, 0x0020,
-    0xCE79, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0x73AE, 0xAD55, 0xFFFF, 0xFFDF, 0xFFFF, 0x5B0C, 0x0000,
-    0x0820, 0x1AF2, 0x02F5, 0x02F5, 0x02B2, 0x1081, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x31A6, 0x0000, 0x08A3, 0x02F4, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x0AF4,
-    0x328E, 0x1905, 0x0820, 0x0000, 0x0000, 0x0000, 0x18C3, 0x7BEF, 0xD6BA, 0xFFFF, 0xFFFF, 0xBDF7,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x94B2, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x52AA,
-    0x0000, 0x0000, 0x2187, 0x0336, 0x02D4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x02F6, 0x222C, 0x0800, 0x0000, 0x9CF3,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0x0000, 0x11AB, 0x0336, 0x02D4, 0x0316, 0x0926,
-    0x0000, 0x10A2, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xCE59, 0x9492, 0x4A69, 0x0000,
-    0x0000, 0x8430, 0xFFFF, 0xFFDF, 0xF7BE, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xE71C, 0xDEDB, 0xDEDB,
-    0x9492, 0x0020, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xA514, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x39C7, 0x528A,
-    0x18C3, 0xCE59, 0xFFFF, 0xF7BE, 0xFFFF, 0x39E7, 0x8430, 0xFFFF, 0xFFDF, 0xFFFF, 0x4A69, 0x0000,
-    0x0041, 0x0315, 0x0B36, 0x0B57, 0x1AD1, 0x0000, 0x0000, 0x7BCF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xCE79, 0x0841, 0x0000, 0x426B, 0x0B77, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36,
-    0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36,
-    0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0336, 0x0336,
-    0x0357, 0x2397, 0x22D1, 0x320A, 0x1061, 0x0000, 0x0000, 0x0000, 0x0861, 0x528A, 0xBDF7, 0xD6BA,
-    0x0861, 0x0000, 0x0000, 0x632C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000,
-    0x0000, 0x18E4, 0x2355, 0x0336, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0B36,
-    0x0B36, 0x0B36, 0x0B36, 0x0B36, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336,
-    0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0337, 0x3B73, 0x0840, 0x0000, 0x5AEB,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x0861, 0x0000, 0x3A2A, 0x1397, 0x0316, 0x0337, 0x42EF,
-    0x0000, 0x0020, 0xC618, 0xFFFF, 0xFFFF, 0x8C51, 0x3185, 0x2104, 0x0000, 0x39C7, 0x630B, 0x8C71,
-    0xAD75, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xC638, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x0000, 0xB5B6, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x2965, 0xF79E,
-    0x7BEF, 0x1082, 0xCE79, 0xFFFF, 0xFFDF, 0x3A08, 0xAD75, 0xFFFF, 0xFFFF, 0xF79E, 0x2965, 0x0000,
-    0x18E3, 0x428C, 0x428C, 0x42AD, 0x31E8, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xA534, 0x0000, 0x0000, 0x31A7, 0x4AAD, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C,
-    0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C,
-    0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C,
-    0x428C, 0x3A6C, 0x3AAD, 0x52ED, 0x31C7, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x3186,
-    0x1082, 0x0000, 0x0841, 0x632C, 0x7BCF, 0x73AE, 0x7BCE, 0x73AE, 0x7BCF, 0x738E, 0x10A2, 0x0020,
-    0x0000, 0x2987, 0x4ACD, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C, 0x428C,
-    0x428C, 0x428C, 0x428C, 0x428C, 0x2A4D, 0x224E, 0x224E, 0x224E, 0x224E, 0x224E, 0x224E, 0x224E,
-    0x224E, 0x224E, 0x224E, 0x224E, 0x224E, 0x224E, 0x224E, 0x224E, 0x2A2D, 0x0020, 0x0000, 0x4208,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x31A6, 0x0000, 0x2125, 0x2A6E, 0x222D, 0x224E, 0x320A,
-    0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xAD55, 0xA534, 0xD69A, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xC638, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0xC638, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xC618, 0x2124, 0xFFDF,
-    0xFFFF, 0x73AE, 0x0861, 0xCE79, 0xFFFF, 0x3186, 0xC618, 0xFFFF, 0xFFFF, 0xEF3C, 0x2104, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8410, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3,
-    0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x7BEF, 0xFFFF, 0xFFFF, 0xAD75, 0x4A69, 0xB596, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xDEDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x2945, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x738E, 0x10A2, 0xAD75, 0x31A6, 0xDEDB, 0xFFFF, 0xFFFF, 0xD69A, 0x0000, 0x0000,
-    0x0861, 0x18E3, 0x18C3, 0x18E3, 0x0821, 0x0000, 0x18C3, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x528A, 0x0000, 0x0861, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-    0x4208, 0x3A08, 0x31A6, 0x31A6, 0x31A6, 0x39E7, 0x39E7, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-    0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x31A7,
-    0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x39E7,
-    0x39E7, 0x39E7, 0x39E7, 0x39E7, 0x4208, 0x39E7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x3186,
-    0x3186, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-    0x39E7, 0x39E7, 0x39E7, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6,
-    0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x31A6, 0x1082, 0x0000, 0x0000,
-    0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x6B6D, 0xFFFF, 0xFFFF, 0xCE59, 0x4A69, 0x2965, 0x0861, 0x528A, 0x8C51, 0xD69A,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xE71C, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0xE73C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x9CF3, 0xFFFF,
-    0xFFDF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0000, 0x0861, 0xF7BE, 0xFFFF, 0xFFFF, 0xC638, 0x0000, 0x0000,
-    0x738E, 0xE71C, 0xDEDB, 0xE71C, 0x3186, 0x0000, 0x2124, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x2124, 0x0000, 0x4208, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xF79E, 0xF79E, 0xE73C, 0xB5B6, 0xBDD7, 0xBDF7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,
-    0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xBDF7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7,
-    0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xCE59, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-    0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xEF7D,
-    0xC618, 0xBDD7, 0xBDD7, 0xEF7D, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E,
-    0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF79E, 0xF7BE, 0x8C51, 0x0000, 0x0000,
-    0xAD55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x94B2, 0xBDF7, 0xBDF7, 0xAD55,
-    0x0000, 0x0000, 0x630C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x2965, 0x5ACB, 0x31A6, 0x3186,
-    0x528A, 0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF79E, 0x2124, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x0000,
-    0x9CD3, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x2965, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x10A2, 0x0000, 0x528A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x0000, 0x0000, 0xAD75, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
-    0x2945, 0x0000, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x0020, 0x0000,
-    0x8C71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x0000, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x2104, 0x0000, 0x528A, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0x4208, 0xD6BA, 0xFFFF, 0xC618,
-    0x10A2, 0x0000, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x2965, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0xF7BE, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6,
-    0x5AEB, 0x5ACB, 0x73AE, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75, 0x0000, 0x0000,
-    0xA514, 0xFFFF, 0xFFDF, 0xF7BE, 0x2945, 0x0000, 0x31A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,
-    0x0861, 0x0000, 0x5AEB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3186, 0x0000, 0x0020, 0x0000, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x52AA, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF7D,
-    0x2945, 0x0000, 0x0000, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD679, 0x1082, 0x0000,
-    0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB5B6, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xF7BE,
-    0x39C7, 0x0000, 0x4A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x4228, 0x8410, 0x632C, 0x2104,
-    0x4A49, 0xC618, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0x39E7, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x630C, 0x0861,
-    0x5ACB, 0x630C, 0x4A49, 0x0000, 0x5269, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x0000, 0x0000,
-    0x9CF3, 0xFFFF, 0xFFFF, 0xE73C, 0x2104, 0x0000, 0x31A6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,
-    0x0841, 0x0000, 0x8C71, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x0020, 0x0000, 0x0000, 0x0000, 0x0861, 0xD69A, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x10A2, 0xA534, 0xBDD7,
-    0xBDD7, 0xBDD7, 0xBDD7, 0xBDD7, 0xB5B6, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x18E3, 0x0000,
-    0x6B4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB5B6, 0x0020, 0x0000, 0x8C71, 0xFFFF, 0xFFFF, 0xF7BE,
-    0x31A6, 0x0000, 0x3186, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x0861, 0x0000, 0x528A, 0xB5B6,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x5289, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA514, 0x0020, 0xD69A,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x10A2, 0x9492, 0xFFFF, 0xFFDF, 0xFFFF, 0x9491, 0x0000, 0x0841,
-    0xC618, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x6B2C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596,
-    0x0000, 0x0000, 0x94B2, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x0000, 0x0841, 0x31A6, 0x0000, 0x0000, 0x7BCF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x2104, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x2124, 0x0000,
-    0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x0861, 0x0000, 0x8430, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x528A, 0x0000, 0x31A6, 0xF79E, 0xFFFF, 0xEF5D, 0x4208, 0x1082, 0x5AEB, 0xD69A, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF7BE, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x4A69, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x736D, 0x738E, 0xFFFF,
-    0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0x8410, 0x5AEB, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x0000, 0x0861,
-    0xCE79, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x7BCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534,
-    0x0000, 0x0000, 0xAD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF7D, 0x2104, 0x0000, 0x2945, 0xC638, 0x1082, 0x0000, 0x18C3, 0xEF7D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x18E3, 0xE73C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x3186, 0x0000,
-    0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x1082, 0x0000, 0x8C30, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x52CB, 0x0000, 0x31A6, 0xF79E, 0xFFFF, 0xE71C, 0x738E, 0xC618, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFFF, 0x6B4D, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x4A69, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x9492, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x0000, 0x0861,
-    0xCE59, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD34,
-    0x0000, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xAD55, 0x0000, 0x0000, 0x6B4D, 0xFFFF, 0x4A49, 0x0000, 0x0000, 0xA514, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x0841, 0x4A28, 0x528A,
-    0x528A, 0x528A, 0x528A, 0x528A, 0x5AEB, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000,
-    0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x0861, 0x0000, 0x8C30, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x52AA, 0x0000, 0x3186, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x39E7, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x4A69, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ACB, 0x8430, 0xF79E,
-    0xEF7D, 0xF79E, 0xFFDF, 0xFFFF, 0x8430, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x0000, 0x0861,
-    0xCE59, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534,
-    0x0000, 0x0000, 0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x4208, 0x0000, 0x0020, 0xB596, 0xFFDF, 0x9CF3, 0x0000, 0x0000, 0x4228, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x31A6, 0x0000,
-    0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x1082, 0x0000, 0x8C30, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x52AA, 0x0000, 0x31A6, 0xF79E, 0xFFFF, 0xEF7D, 0xAD54, 0xA514, 0xA534, 0xB596, 0xC638, 0xC638,
-    0xCE79, 0x39C7, 0xAD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x4A69, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEB, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x2124, 0x39C7, 0x0861, 0x632C, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x0000, 0x0841,
-    0xCE59, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD34,
-    0x0000, 0x0000, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xD69A, 0x0841, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFDF, 0x18E3, 0x0000, 0x0000, 0xCE79,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x0841, 0x4A49, 0x528A,
-    0x4A69, 0x528A, 0x528A, 0x528A, 0x630C, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000,
-    0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x0861, 0x0000, 0x8C30, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x5ACB, 0x0000, 0x31A6, 0xF79E, 0xFFFF, 0xDEDB, 0x39E7, 0x3186, 0x31A6, 0x31A6, 0x39C7, 0x39C7,
-    0x18E3, 0x0020, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x528A, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0xC618, 0xBDF7,
-    0xC618, 0xC618, 0xBDD7, 0xBDD7, 0xAD55, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0x9491, 0x0000, 0x0000,
-    0xAD55, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x7BAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534,
-    0x0000, 0x0000, 0xAD75, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x7BEF, 0x0000, 0x0000, 0x1082, 0x39E7, 0x39E7, 0x4208, 0x18C3, 0x0000, 0x0000, 0x73AE,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x2104, 0xEF5D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x3186, 0x0000,
-    0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x1082, 0x0000, 0x8C30, 0xFFFF, 0xFFFF, 0xFFDF,
-    0x39E7, 0x0000, 0x3186, 0xF79E, 0xFFFF, 0xFFDF, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF7BE,
-    0xD6BA, 0x3186, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x31A6, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ACA, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55, 0x0000, 0x0000,
-    0x9CF3, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3, 0x0000, 0x6B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596,
-    0x0000, 0x0000, 0x94B2, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF79E, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3,
-    0xF79D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x18E3, 0xE6FB, 0xFFDF,
-    0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x2124, 0x0000,
-    0x39E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x0861, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xF7BE,
-    0x31A6, 0x0000, 0x4228, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x2945, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x2945, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x39C7, 0xCE79,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x0000, 0x0000,
-    0x9CF3, 0xFFFF, 0xFFFF, 0xE71C, 0x18E3, 0x0000, 0x39E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,
-    0x0841, 0x0000, 0x8C51, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xB596, 0x0000, 0x0000, 0x1082, 0x2965, 0x3186, 0x3186, 0x3186, 0x2965, 0x0861, 0x0000, 0x0000,
-    0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x2104, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x2104, 0x0000,
-    0x6B2C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB5B6, 0x0020, 0x0000, 0x8C51, 0xFFFF, 0xFFFF, 0xF7BE,
-    0x3186, 0x0000, 0x528A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xEF7D, 0x632C, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xEF7D, 0x18E3, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0xF7BE, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x5AEB, 0x0841,
-    0x6B6D, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0x0000,
-    0x8C51, 0xFFFF, 0xFFFF, 0xF7BE, 0x2945, 0x0000, 0x31A6, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,
-    0x0861, 0x0000, 0x52AA, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x528A, 0x0000, 0x0000, 0x94B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000,
-    0x4A49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0861, 0x0000, 0x0861, 0x6B4D, 0x73AE,
-    0x738E, 0x73AE, 0x73AE, 0x73AE, 0x73AE, 0x8410, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D,
-    0x2945, 0x0000, 0x0020, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE79, 0x0861, 0x0000,
-    0x7BCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xE73C,
-    0x0020, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xC618, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xE71C, 0x0000, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xEF7D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,
-    0x4A69, 0x39C7, 0x7BEF, 0x73AE, 0x630C, 0x528A, 0xFFDF, 0xFFFF, 0xFFFF, 0xCE79, 0x0000, 0x0000,
-    0x7BCF, 0xFFFF, 0xFFDF, 0xF7BE, 0x2965, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x10A2, 0x0000, 0x528A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA,
-    0x0861, 0x0000, 0x1082, 0xE73C, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xDEDB, 0x0841, 0x0000,
-    0x0000, 0xD699, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF7D,
-    0x2124, 0x0000, 0x0000, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596, 0x0000, 0x0000,
-    0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9491, 0x0000, 0x0000, 0xAD75, 0xFFFF, 0xFFFF, 0xDEDB,
-    0x0000, 0x0000, 0x6B4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638,
-    0x41E7, 0x10A2, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xD69A, 0x0000, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xE71C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xDEFB, 0x0840, 0x2945, 0x5ACB, 0x630C, 0x7BEF, 0xF79E, 0xFFFF, 0xFFFF, 0xDEFB, 0x10A2, 0x0000,
-    0x6B4C, 0xFFFF, 0xFFFF, 0xFFFF, 0x31A6, 0x0000, 0x2124, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0x18C3, 0x0000, 0x4A49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C71,
-    0x0841, 0x0841, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0841,
-    0x0841, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x10A2, 0x0841, 0x0861, 0x0861, 0x0862,
-    0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
-    0x3186, 0x0841, 0x0861, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x0000,
-    0xAD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0xCE79, 0xFFFF, 0xFFFF, 0xC638,
-    0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xDEDB, 0xC638, 0xE71C, 0xFFDF, 0xD69A, 0x4A69, 0x0000,
-    0x528A, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xC618, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xDEDB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA513,
-    0x0000, 0x6B4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79D, 0x3186, 0x0000,
-    0x41E7, 0xD69A, 0xD679, 0xD6BA, 0x31A6, 0x0000, 0x18C3, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x52AA, 0x0000, 0x39C7, 0xF79E, 0xF7BE, 0xF79E, 0xF7BE, 0xF7BE, 0xEF5D, 0xEF5D, 0xEF5D, 0xDEFB,
-    0xDEFB, 0xE71C, 0xF79E, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xEF5D, 0xEF5D, 0xE73C, 0xDEFB,
-    0xDEFB, 0xE71C, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE,
-    0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xEF5D, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB,
-    0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xDEFB, 0xEF5D, 0xF79E, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE,
-    0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE,
-    0xE71C, 0xDEDB, 0xDEFB, 0xEF5D, 0xEF5D, 0xEF7D, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE,
-    0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF7BE, 0xF79E, 0xF79E, 0xF7BE, 0x7BEF, 0x0000, 0x0020,
-    0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0xC638, 0xEF5D, 0xEF7D, 0xA4F3,
-    0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFFF, 0x9CF3, 0x2104, 0x18E3, 0x0000, 0x0000, 0x528A, 0xCE79,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xB596, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xC618, 0xFFDF,
-    0xF7BE, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B8D, 0x0000,
-    0x8C71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x4208, 0x0000,
-    0x0020, 0x1082, 0x1082, 0x10A2, 0x0861, 0x0000, 0x0841, 0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x7BEF, 0x0000, 0x0841, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x2945, 0x2945, 0x2945, 0x2965,
-    0x2965, 0x3186, 0x31A6, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2945, 0x2145, 0x2945, 0x2965,
-    0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-    0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x2965, 0x2945, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965,
-    0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2965, 0x2945, 0x3165, 0x3186, 0x3186, 0x3186, 0x3186,
-    0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-    0x3186, 0x2945, 0x2965, 0x2945, 0x2145, 0x2965, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186,
-    0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x3186, 0x31A6, 0x10A2, 0x0000, 0x2124,
-    0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A69, 0x0000, 0x0020, 0x2124, 0x2945, 0x2945, 0x18C3,
-    0x0000, 0x0000, 0xBDB6, 0xFFFF, 0xFFDF, 0xF79E, 0xDEFB, 0xCE79, 0xB596, 0x39E7, 0x528A, 0xF7BE,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0x9CD3, 0x10A2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x0000, 0xCE79, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x39C7, 0xBDD7,
-    0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9CF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xA534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0861, 0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x4228, 0x18C3,
-    0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x8C30, 0x18C3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x0000, 0x18C3, 0x2945,
-    0x2945, 0x2945, 0x2945, 0x2945, 0x2965, 0x31A6, 0x94B2, 0xFFFF, 0xFFFF, 0xEF7D, 0xEF5D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B6D, 0x0000,
-    0x0020, 0x424A, 0x42CE, 0x42CE, 0x322A, 0x0000, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xD69A, 0x1082, 0x0000, 0x2145, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE,
-    0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE,
-    0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE,
-    0x42CE, 0x42CE, 0x42EE, 0x0882, 0x0000, 0x10A2, 0x7BCF, 0x8C51, 0x8430, 0x8C51, 0x8C51, 0x8C51,
-    0x8C51, 0x8C51, 0x8C51, 0x8C50, 0x8430, 0x8C71, 0x39E7, 0x0000, 0x0000, 0x3A4B, 0x42EE, 0x42CE,
-    0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x42CE, 0x428C, 0x3A2A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A,
-    0x3A4A, 0x3A2A, 0x3A4A, 0x3A4A, 0x3A2A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A,
-    0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A4A, 0x3A2A, 0x3A4A, 0x39E8, 0x0020, 0x0000, 0x6B4D,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x0841, 0x0000, 0x1904, 0x3A4A, 0x3A2A, 0x3A4A, 0x1082,
-    0x0000, 0x18C3, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFFF, 0xFFFF, 0x738E,
-    0x1061, 0xBDD7, 0xFFFF, 0xFFDF, 0xD69A, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xBDF7, 0xC638,
-    0x52AA, 0x2124, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x2124, 0x4A49, 0x39E7,
-    0x4207, 0x4207, 0x4207, 0x39E7, 0x4228, 0x0861, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFDF, 0x630C, 0x39E7,
-    0x4A49, 0x5AEB, 0x5AEB, 0x6B6D, 0x8410, 0x8C71, 0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xA514, 0x0000,
-    0x0820, 0x3B30, 0x0337, 0x0336, 0x02D3, 0x0820, 0x0000, 0x630C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x31A6, 0x0000, 0x10C3, 0x0B36, 0x0316, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336,
-    0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336,
-    0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336,
-    0x0336, 0x0316, 0x0357, 0x0083, 0x0000, 0x2104, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x22F2, 0x0337, 0x0316,
-    0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0316, 0x0336, 0x0336, 0x0336, 0x0336,
-    0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336,
-    0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0336, 0x0315, 0x0337, 0x2A6D, 0x0000, 0x0000, 0xAD75,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7, 0x0000, 0x0000, 0x11CC, 0x0B77, 0x02F5, 0x2396, 0x1904,
-    0x0000, 0x2124, 0xFFFF, 0xFFFF, 0xF7BE, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x7BEF, 0x9CD3, 0xFFFF, 0xF7BE, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4208, 0xA514, 0x9492,
-    0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x94B2, 0x39E7, 0x39C7, 0xFFDF, 0xFFFF, 0xFFFF, 0xBDF7, 0xAD55,
-    0x8C71, 0x8410, 0x8C71, 0x9471, 0x2965, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x0041,
-    0x0000, 0x0127, 0x0316, 0x02D4, 0x1314, 0x2965, 0x0000, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x5ACB, 0x0000, 0x1041, 0x3332, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F4, 0x0316, 0x0083, 0x0000, 0x18E4, 0xE71C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x22B1, 0x02F5, 0x02F4,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x1356, 0x1926, 0x0000, 0x0841, 0xE6FB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0820, 0x0A2E, 0x0316, 0x02D5, 0x2B33, 0x20C2,
-    0x0000, 0x632C, 0xFFFF, 0xFFFF, 0xCE79, 0x2124, 0x10A2, 0x5ACB, 0x94B2, 0xBDD7, 0xE71C, 0xF7BE,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x0841, 0x7BEF, 0xCE59, 0xC618, 0xC638, 0xC638, 0xC638, 0xC618,
-    0xC638, 0x8C71, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xCE79, 0x5ACB, 0x2944, 0x8410, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x1082,
-    0x0000, 0x0906, 0x0B56, 0x02D4, 0x1356, 0x29A9, 0x0000, 0x0000, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xAD55, 0x0000, 0x0000, 0x11EB, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x22D1, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x1B13, 0x20E3, 0x0000, 0x4208, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x5AEB, 0x0000, 0x20C3, 0x3353, 0x02D5, 0x0316, 0x0A2E, 0x0820,
-    0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0xF79E, 0xCE59, 0x9492, 0x39E7, 0x0000, 0x0841, 0x1082, 0x31A6,
-    0x632C, 0xF79E, 0xFFFF, 0xD69A, 0x0000, 0x5269, 0x10A2, 0x0861, 0x0861, 0x0861, 0x0861, 0x0861,
-    0x0861, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xD69A, 0x52AA, 0x18E3, 0x630C, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7,
-    0x0000, 0x2924, 0x2354, 0x02D5, 0x0336, 0x09AB, 0x0000, 0x0000, 0xB596, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xEF7D, 0x10A2, 0x0000, 0x2166, 0x1355, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x22D1, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x226E, 0x0000, 0x0000, 0x8C51, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2945, 0x0000, 0x08A3, 0x1355, 0x02D4, 0x0B56, 0x2A0B, 0x0000,
-    0x0000, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x2965, 0x8C71, 0xD6BA, 0x8C71,
-    0x7BCF, 0xEF5D, 0xFFFF, 0xAD55, 0x0820, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xAD54, 0xFFFF, 0xFFFF, 0xF7BE, 0x630C,
-    0x1082, 0x738E, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BAF,
-    0x0000, 0x0840, 0x0A70, 0x0316, 0x02F5, 0x3311, 0x1881, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x1041, 0x0AB1, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x22D1, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0315, 0x2166, 0x0000, 0x1082, 0xCE79, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x1082, 0x0000, 0x19A8, 0x0316, 0x02F5, 0x0335, 0x31C7, 0x0000,
-    0x18C3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BCF, 0x1082, 0x10A2, 0xEF5D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x8410, 0x2124, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x6B6D, 0xFFDF, 0xFFFF, 0xF7BE, 0x31A6,
-    0x3186, 0x52AA, 0x39E7, 0x4A69, 0x5ACA, 0x7BEF, 0x8C71, 0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534,
-    0x0000, 0x0000, 0x2A4D, 0x0336, 0x02D5, 0x2354, 0x0882, 0x0000, 0x31C7, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xAD55, 0x0000, 0x0000, 0x2A0B, 0x0316, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x22D1, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x2B32, 0x0841, 0x0000, 0x39E7, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0000, 0x3AEF, 0x0316, 0x02F5, 0x0AF3, 0x0021, 0x0000,
-    0x4A49, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x630C, 0x0020, 0x2965, 0x9CF3, 0x5ACB, 0x4A49, 0xFFDF,
-    0xFFDF, 0xFFDF, 0xFFFF, 0x4228, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF, 0xE73C,
-    0xD6BA, 0xB5B6, 0xAD55, 0xAD55, 0x94B2, 0x4A69, 0x0000, 0x2965, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB,
-    0x18C3, 0x0000, 0x31E8, 0x0315, 0x02F5, 0x0316, 0x2167, 0x0000, 0x10A3, 0xDEDB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF7D, 0x2104, 0x0000, 0x10A2, 0x1B34, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x22D1, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x0336, 0x19CA, 0x0000, 0x0000, 0x9492, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x0A91, 0x0316, 0x02F5, 0x3B31, 0x0820, 0x0000,
-    0x738E, 0xFFFF, 0xFFFF, 0xC618, 0x0020, 0x4208, 0xAD75, 0xFFFF, 0xFFFF, 0xEF5D, 0x1082, 0x9CD3,
-    0xFFFF, 0xFFFF, 0xF79E, 0x18C3, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x18C3, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x630C, 0x2965, 0x8410, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0x4208, 0x0000, 0x0841, 0x1334, 0x02F5, 0x0336, 0x3AAE, 0x0000, 0x0000, 0x9CD3, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0000, 0x0820, 0x224D, 0x0336, 0x02F4, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x12B2, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x12F3, 0x18C3, 0x0000, 0x18C3, 0xEF5D, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xEF7D, 0x18E3, 0x0000, 0x3186, 0x1335, 0x02D5, 0x0316, 0x19CA, 0x0000, 0x0000,
-    0xBDF7, 0xFFFF, 0xFFFF, 0xDEDB, 0xC618, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xFFFF, 0x9CF3, 0x18C3,
-    0xEF7D, 0xFFFF, 0xD6BA, 0x18E3, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xB5B6, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xF79E, 0xA514, 0x3186, 0x10A2, 0x738E, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x7BEF, 0x0000, 0x1040, 0x32F0, 0x02F5, 0x0316, 0x0A70, 0x0820, 0x0000, 0x5ACB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x0020, 0x0000, 0x2125, 0x1335, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x224D, 0x0000, 0x0000, 0x7BAE, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xC618, 0x0000, 0x0000, 0x19AA, 0x0B56, 0x02D4, 0x1B76, 0x1925, 0x0000, 0x18C3,
-    0xF79E, 0xFFFF, 0xFFDF, 0x8C51, 0xBDD7, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x8410,
-    0xE71C, 0xFFFF, 0xA534, 0x0000, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x8410, 0xFFFF, 0xFFFF, 0xF7BE,
-    0x4208, 0x18E3, 0x8430, 0xE73C, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xC618, 0x0000, 0x0000, 0x1989, 0x0B56, 0x02D4, 0x1B55, 0x2946, 0x0000, 0x1082, 0xEF5D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x2A8E, 0x0316, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02D5, 0x1B54, 0x18E3, 0x0000, 0x1082, 0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x6B4D, 0x0000, 0x1061, 0x2AF0, 0x02F5, 0x0315, 0x12B1, 0x1082, 0x0000, 0x5ACB,
-    0xFFFF, 0xFFFF, 0xF7BE, 0x5AEB, 0x18C2, 0x0861, 0x4A49, 0x7BEF, 0xC618, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x73AE, 0x0861, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x4228, 0xFFFF, 0xFFFF, 0xF7BE,
-    0xA534, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0x2124, 0x0000, 0x2924, 0x1334, 0x02D5, 0x0336, 0x11AA, 0x0000, 0x0000, 0x9CF3, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x0861, 0x0000, 0x18E4, 0x1B35, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F4, 0x0336, 0x19EB, 0x0000, 0x0000, 0x738E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF79E, 0x2124, 0x0000, 0x10C3, 0x1335, 0x02D4, 0x0336, 0x2A6D, 0x0000, 0x0000, 0xA514,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF7D, 0xBDF7, 0x738E, 0x2965, 0x2104, 0x1082, 0x5ACB, 0xE71C,
-    0xFFFF, 0xFFDF, 0x31A6, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0xE73C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x738E, 0x0000, 0x0000, 0x1AB0, 0x0316, 0x02F5, 0x2B32, 0x0841, 0x0000, 0x4228, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0000, 0x0000, 0x2A4C, 0x0336, 0x02F4, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x1B13, 0x1082, 0x0000, 0x1082, 0xE6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xAD75, 0x0000, 0x0000, 0x322B, 0x0316, 0x02F5, 0x0315, 0x1925, 0x0000, 0x1082, 0xDEFB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x9CD3, 0x6B4D, 0xDEFB,
-    0xFFFF, 0xDEDB, 0x0000, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x0020, 0xAD55, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xBDF7, 0x0020, 0x0000, 0x29E9, 0x0316, 0x02F5, 0x0315, 0x2125, 0x0000, 0x1082, 0xD69A,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x1081, 0x0000, 0x1082, 0x1B13, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F4, 0x0B56, 0x29E9, 0x0000, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x5AEB, 0x0000, 0x0841, 0x12B1, 0x0316, 0x02F5, 0x2B12, 0x0820, 0x0000, 0x52AA, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xA514, 0x0861, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x630C, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF79E, 0x2945, 0x0000, 0x0862, 0x1B54, 0x02D5, 0x0336, 0x226D, 0x0000, 0x0000, 0x7BCF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8430, 0x0000, 0x0000, 0x2988, 0x0B36, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x0316, 0x226E, 0x0820, 0x0000, 0x18E3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xDEFB, 0x1082, 0x0000, 0x2146, 0x1355, 0x02D4, 0x0B36, 0x19CA, 0x0000, 0x0000, 0xA534, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x4A69, 0x2945, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x2965, 0xEF5D, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x840F, 0x0000, 0x0820, 0x224D, 0x0316, 0x02F5, 0x1B13, 0x18C3, 0x0000, 0x2104,
-    0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x3186, 0x0000, 0x0000, 0x226E, 0x0336,
-    0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x1B54, 0x18C3, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8410, 0x0000, 0x0800, 0x224D, 0x0316, 0x02F5, 0x1314, 0x2104, 0x0000, 0x18E3, 0xF79E, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xEF5D, 0x18E3, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x0000, 0xBDF7, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xD6BA, 0x0020, 0x0000, 0x2166, 0x0B35, 0x02D4, 0x0B36, 0x21A9, 0x0000, 0x0000,
-    0xA513, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0x0000, 0x18A2, 0x2312,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x0B36, 0x2167, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D,
-    0x2124, 0x0000, 0x0882, 0x1334, 0x02F5, 0x0316, 0x2A8F, 0x0000, 0x0000, 0x73AE, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xAD75, 0x0000, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x738E, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x528A, 0x0000, 0x0000, 0x1AD1, 0x0316, 0x02F5, 0x1AF2, 0x0000, 0x0000,
-    0x3186, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x1905,
-    0x0B35, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x18E4, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x0336,
-    0x224C, 0x0000, 0x0000, 0x2104, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2,
-    0x0000, 0x0000, 0x2A2B, 0x0336, 0x02D4, 0x0B36, 0x2166, 0x0000, 0x0841, 0xCE59, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x6B4D, 0x18A2, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x1082, 0xEF7D,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xB596, 0x0000, 0x0000, 0x2188, 0x0336, 0x02D4, 0x0335, 0x2167, 0x0000,
-    0x0000, 0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x41E7, 0x0000, 0x0000,
-    0x29E9, 0x0B36, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x2124, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x3311,
-    0x1061, 0x0000, 0x0000, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x3186,
-    0x0000, 0x10A2, 0x1B13, 0x02F5, 0x02F5, 0x22D0, 0x0840, 0x0000, 0x4228, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E,
-    0x0861, 0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0xAD55,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x3186, 0x0000, 0x1081, 0x2312, 0x02F5, 0x0316, 0x1AB1, 0x0841,
-    0x0000, 0x3186, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEDB, 0x10A2, 0x0000,
-    0x0800, 0x326D, 0x0B57, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x22F2, 0x1082,
-    0x0000, 0x0000, 0x7BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x0000,
-    0x0000, 0x29EA, 0x0B36, 0x02D4, 0x0B56, 0x1988, 0x0000, 0x0000, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB596,
-    0x0000, 0x52AA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x52AA,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x0000, 0x29EA, 0x0336, 0x02D4, 0x0B56, 0x1947,
-    0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB5B6, 0x0841,
-    0x0000, 0x0000, 0x2A6E, 0x0B36, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x02F5, 0x1314, 0x10E4, 0x0000,
-    0x0000, 0x528A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x2945, 0x0000,
-    0x1081, 0x2313, 0x02F5, 0x0315, 0x1AF2, 0x0840, 0x0000, 0x39C7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x528A,
-    0x2104, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x0861,
-    0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2965, 0x0000, 0x1061, 0x2313, 0x02F5, 0x02F5, 0x1AF1,
-    0x0000, 0x0000, 0x2924, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2,
-    0x0000, 0x0000, 0x0800, 0x2AB0, 0x0316, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0315, 0x1314, 0x18E4, 0x0000, 0x0000,
-    0x31A6, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C51, 0x0000, 0x0000,
-    0x29EA, 0x0336, 0x02D4, 0x0336, 0x1988, 0x0000, 0x0000, 0xAD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x0861,
-    0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0000, 0x0000,
-    0xAD54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0000, 0x29E9, 0x0B36, 0x02D4, 0x0336,
-    0x21A9, 0x0000, 0x0000, 0x8C50, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8C51, 0x0000, 0x0000, 0x0861, 0x22B0, 0x0B36, 0x02D4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0316, 0x1314, 0x18E4, 0x0000, 0x0000, 0x2945,
-    0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x10A2, 0x0000, 0x0882,
-    0x1B13, 0x02F5, 0x02F5, 0x22F1, 0x0861, 0x0000, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x8C51, 0x0000,
-    0x41E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x3186, 0xB596,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x2945, 0x0000, 0x1040, 0x1AF1, 0x0316, 0x02F5,
-    0x1AF2, 0x1082, 0x0000, 0x1082, 0xDEFB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x738D, 0x0000, 0x0000, 0x1061, 0x2A6E, 0x0B36, 0x02D5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F4, 0x0316, 0x1B13, 0x1904, 0x0000, 0x0000, 0x18E3, 0xD6BA,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x632C, 0x0000, 0x0000, 0x222C,
-    0x0336, 0x02D4, 0x0B56, 0x2987, 0x0000, 0x0000, 0xAD55, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x39E7,
-    0x0000, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x0000, 0x10A2, 0x8C71, 0xFFBE, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA514, 0x0000, 0x0000, 0x2167, 0x0B36, 0x02D4,
-    0x0336, 0x2A2C, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0800, 0x326D, 0x0B56, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02D4, 0x0316, 0x2B12, 0x1082, 0x0000, 0x0000, 0x2124, 0xCE79, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x0020, 0x0000, 0x18E4, 0x1335,
-    0x02F5, 0x0316, 0x2AB0, 0x0820, 0x0000, 0x39C7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0x9CD3, 0x2124, 0x0000, 0x0020, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0861, 0x0000, 0x0000, 0x6B4D, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x39E7, 0x0000, 0x0000, 0x2AAF, 0x0316,
-    0x02D5, 0x1B35, 0x1904, 0x0000, 0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x8C30, 0x0000, 0x0000, 0x0820, 0x29E9, 0x1335, 0x02F5, 0x02F4, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x0336, 0x2AAE, 0x1061, 0x0000, 0x0000, 0x31A6, 0xE73C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x3186, 0x0000, 0x0820, 0x2AD0, 0x0316,
-    0x02D5, 0x1335, 0x2125, 0x0000, 0x0020, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xE71C, 0x738E, 0x0020, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0861, 0x0000, 0x2965, 0xC5F7, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC5F7, 0x0000, 0x0000, 0x18C3, 0x1334,
-    0x02F5, 0x0316, 0x22B0, 0x0820, 0x0000, 0x18C3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CB2, 0x0020, 0x0000, 0x0000, 0x1925, 0x2B12, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F6, 0x1B35, 0x21CA, 0x0840, 0x0000, 0x0000, 0x4A49, 0xE73C, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x2188, 0x0B36, 0x02D4,
-    0x0336, 0x224C, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xC638, 0x4A49, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x1082, 0x3186, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEB, 0x0000, 0x0000, 0x2A0B,
-    0x0336, 0x02D4, 0x0B56, 0x29E9, 0x0000, 0x0000, 0x52AA, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7, 0x18C3, 0x0000, 0x0000, 0x18A2, 0x226E, 0x0B35,
-    0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x0B36, 0x1AF1, 0x2945, 0x0000, 0x0000, 0x0000, 0x6B6D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDD7, 0x0020, 0x0000, 0x18C3, 0x1B34, 0x02F5, 0x02F5,
-    0x22F2, 0x1061, 0x0000, 0x0861, 0xD6BB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2965, 0x18E3, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x18C3, 0x0000, 0x0820,
-    0x22D1, 0x0315, 0x02F5, 0x1314, 0x18C3, 0x0000, 0x0000, 0x8C51, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE71B, 0x4A49, 0x0000, 0x0000, 0x0000, 0x2187,
-    0x22F2, 0x0336, 0x02F5, 0x02F4, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x1B34,
-    0x2A2B, 0x1061, 0x0000, 0x0000, 0x18C3, 0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x2945, 0x0000, 0x0820, 0x228E, 0x0316, 0x02D4, 0x1356,
-    0x1946, 0x0000, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE59, 0x0000, 0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x39C7, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CF3, 0x0000, 0x0000,
-    0x2125, 0x1B55, 0x02F5, 0x0316, 0x2B11, 0x1061, 0x0000, 0x0841, 0xC638, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x8430, 0x0861, 0x0000, 0x0000,
-    0x1061, 0x220B, 0x1313, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F6, 0x1335, 0x2AAF, 0x18E3,
-    0x0000, 0x0000, 0x0000, 0x4208, 0xD6BA, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x52AA, 0x0000, 0x0000, 0x29EA, 0x0B56, 0x02D4, 0x0316, 0x2A4D,
-    0x0000, 0x0000, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x52AA, 0x18E3, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0000, 0xBDF7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A49, 0x0000,
-    0x0000, 0x21C9, 0x0336, 0x02D4, 0x0336, 0x2A4C, 0x0000, 0x0000, 0x2945, 0xE73C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x39E7, 0x0000,
-    0x0000, 0x0000, 0x18C3, 0x1A0B, 0x1334, 0x0336, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0336, 0x0B35, 0x2AB0, 0x2146, 0x0820, 0x0000,
-    0x0000, 0x0861, 0x8C71, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x8410, 0x0000, 0x0000, 0x18E4, 0x1334, 0x02D5, 0x02F5, 0x2312, 0x1061,
-    0x0000, 0x0841, 0xCE38, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x0000, 0x6B2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x4228, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x18C3,
-    0x0000, 0x0840, 0x2ACF, 0x0316, 0x02D4, 0x1356, 0x2987, 0x0000, 0x0000, 0x4228, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x94B2,
-    0x2104, 0x0000, 0x0000, 0x0800, 0x1082, 0x2A2C, 0x1AF2, 0x0B56, 0x02F6, 0x02F5, 0x02F5, 0x02F5,
-    0x02F5, 0x02F5, 0x0316, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x0315, 0x02F5,
-    0x02F5, 0x02F5, 0x02F5, 0x02F5, 0x0316, 0x1B34, 0x1A6E, 0x2166, 0x0840, 0x0000, 0x0000, 0x0020,
-    0x5AEB, 0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xAD55, 0x0000, 0x0000, 0x18A2, 0x2B12, 0x02F5, 0x02F5, 0x1B35, 0x2125, 0x0000,
-    0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x20E4, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x0000, 0xC618, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA514,
-    0x0000, 0x0000, 0x1062, 0x1AF2, 0x02F5, 0x02F5, 0x1B34, 0x2104, 0x0000, 0x0000, 0x632C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xE73C, 0x7BCF, 0x1082, 0x0000, 0x0000, 0x0000, 0x18C2, 0x1967, 0x32D0, 0x0B14, 0x0B36, 0x0336,
-    0x02F5, 0x02D4, 0x0315, 0x0083, 0x0000, 0x3186, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x0292, 0x02F5, 0x02D5,
-    0x02F6, 0x0B56, 0x0B15, 0x2312, 0x2A2B, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x4207, 0xBDF7,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xC638, 0x1082, 0x0000, 0x1040, 0x22AF, 0x0316, 0x02D4, 0x0336, 0x1988, 0x0000, 0x0000,
-    0x4208, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xD69A, 0x0000, 0x630C, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x5AEB, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x6B6D, 0x0000, 0x0000, 0x1905, 0x0B35, 0x02D5, 0x02F5, 0x1AF2, 0x1882, 0x0000, 0x0000, 0x8410,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xDEFB, 0x73AE, 0x2104, 0x0000, 0x0000, 0x0000, 0x0820, 0x18E3, 0x320A, 0x122E,
-    0x2B53, 0x1355, 0x0337, 0x0084, 0x0000, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x02B3, 0x0337, 0x2375,
-    0x1AD1, 0x222C, 0x2986, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A49, 0xAD75, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xD69A, 0x2104, 0x0000, 0x0000, 0x220B, 0x0336, 0x02D4, 0x0336, 0x32AE, 0x0820, 0x0000, 0x18A2,
-    0xDEFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x6B4D, 0x1082, 0x4208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x0020, 0xD69A, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x31A6, 0x0000, 0x0000, 0x29E9, 0x1356, 0x02D4, 0x0316, 0x228F, 0x0000, 0x0000, 0x0000,
-    0x9CF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x94B2, 0x3186, 0x0041, 0x0000, 0x0000, 0x0000, 0x0800,
-    0x20E3, 0x10E5, 0x220A, 0x0882, 0x0000, 0x2965, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x6B6D, 0x0000, 0x0000, 0x324B, 0x1147, 0x18E4,
-    0x1881, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x6B4D, 0xC659, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x2945, 0x0000, 0x0000, 0x29A9, 0x0B36, 0x02D4, 0x0316, 0x2AD1, 0x1041, 0x0000, 0x0000, 0xAD75,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xD6DA, 0x0020, 0x630C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x0841, 0x5ACB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xDEDB, 0x18C3, 0x0000, 0x0000, 0x322C, 0x0B36, 0x02D4, 0x0B36, 0x2A8E, 0x0820, 0x0000,
-    0x0020, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xC638, 0x738E, 0x39C7, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841, 0x3186, 0x4A69, 0x52AA, 0x6B6D, 0x738E, 0x738E,
-    0x738E, 0x6B6D, 0x738E, 0x630C, 0x52AA, 0x4208, 0x18C3, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x18C3, 0x52AA, 0xA4F3, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0x31A6,
-    0x0000, 0x0000, 0x29A8, 0x1B56, 0x02D4, 0x02F5, 0x1AF2, 0x0861, 0x0000, 0x0000, 0x8430, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0x5ACB, 0x1081, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x0020, 0xCE59, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xBDD7, 0x0020, 0x0000, 0x0000, 0x1A4D, 0x0336, 0x02D4, 0x0B36, 0x326C, 0x0000,
-    0x0000, 0x0020, 0xA514, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xC618, 0x9491,
-    0x4228, 0x1904, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x2945,
-    0x6B4D, 0xAD75, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF5D, 0x31A6, 0x0000,
-    0x0000, 0x29A7, 0x1B55, 0x02D5, 0x02F5, 0x1334, 0x2145, 0x0000, 0x0000, 0x5AEB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xCE79, 0x0000, 0x6B6D, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x1082, 0x4228, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x0000, 0x0840, 0x228F, 0x0336, 0x02D4, 0x0B36, 0x326C,
-    0x0800, 0x0000, 0x0020, 0x9492, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF79E, 0xCE59, 0x9CD3, 0x73AE, 0x62EB, 0x4208, 0x31A6, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x39C7, 0x528A, 0x6B4D, 0x8430, 0xB596, 0xDEFB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x3186, 0x0000, 0x0000,
-    0x29A7, 0x1B55, 0x02F5, 0x02F5, 0x1334, 0x2166, 0x0000, 0x0000, 0x39E7, 0xF79E, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x31A6, 0x2124, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x0000, 0xB596,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x1081, 0x1AF1, 0x0316, 0x02D4, 0x0B36,
-    0x324C, 0x0820, 0x0000, 0x0000, 0x8430, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0xE73C, 0xE71C, 0xDEFB, 0xCE59,
-    0xBDF7, 0xD6BA, 0xE71C, 0xE71C, 0xEF7D, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x2104, 0x0000, 0x0000, 0x29A7,
-    0x1B55, 0x02F5, 0x02D5, 0x1355, 0x29A8, 0x0000, 0x0000, 0x2124, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CF3,
-    0x0000, 0x7BCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18E3, 0x2124,
-    0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x0000, 0x18C2, 0x1AF1, 0x0316, 0x02D4,
-    0x0B36, 0x326C, 0x0800, 0x0000, 0x0000, 0x632C, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xB5B6, 0x18C3, 0x0000, 0x0000, 0x29A7, 0x1B55,
-    0x02F5, 0x02D5, 0x1356, 0x31E9, 0x0000, 0x0000, 0x2104, 0xDEDB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE71C, 0x1061,
-    0x528A, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x0020,
-    0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x0000, 0x0000, 0x18C3, 0x22F1, 0x0336,
-    0x02D4, 0x0B36, 0x2A6E, 0x0820, 0x0000, 0x0000, 0x4228, 0xE73C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x8C71, 0x0000, 0x0000, 0x0000, 0x29A8, 0x1B55, 0x02D5,
-    0x02F5, 0x1356, 0x31E9, 0x0000, 0x0000, 0x1082, 0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x52AA, 0x0861,
-    0x632C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6,
-    0x0000, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x52AA, 0x0000, 0x0000, 0x1882, 0x1A8F,
-    0x0336, 0x02D4, 0x0B36, 0x1A6F, 0x1081, 0x0000, 0x0000, 0x2124, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xF79E, 0x6B4D, 0x0000, 0x0000, 0x0820, 0x29EA, 0x1356, 0x02D4, 0x02F5,
-    0x1334, 0x29A7, 0x0000, 0x0000, 0x10A2, 0xC618, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534, 0x0000, 0x73AE,
-    0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2,
-    0x18C3, 0x3185, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x52AA, 0x0000, 0x0000, 0x0840,
-    0x1A4D, 0x0B56, 0x02D4, 0x0316, 0x2312, 0x2125, 0x0000, 0x0000, 0x0840, 0x8C51, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xCE79, 0x39E7, 0x0000, 0x0000, 0x1081, 0x228E, 0x0B36, 0x02D4, 0x0315, 0x1334,
-    0x2166, 0x0000, 0x0000, 0x10A2, 0xC618, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE71C, 0x10A2, 0x4A69, 0x2945,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x3186, 0x0000, 0x8410, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD75,
-    0xB596, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x738E, 0x0000, 0x0000,
-    0x0000, 0x2A2C, 0x1356, 0x02D5, 0x02F5, 0x2354, 0x2187, 0x0000, 0x0000, 0x0000, 0x5AAA, 0xDEFB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0x94B2, 0x1082, 0x0000, 0x0000, 0x18C3, 0x2AF1, 0x0316, 0x02D4, 0x0316, 0x22D2, 0x18E4,
-    0x0000, 0x0000, 0x2124, 0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x4A69, 0x1082, 0x6B4D, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x39C7, 0x0000, 0xC638, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xD6BA, 0x52AA, 0x0000,
-    0x0000, 0xC618, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x0000,
-    0x0000, 0x0000, 0x29E9, 0x0B35, 0x02F5, 0x02D5, 0x1335, 0x1A0B, 0x1061, 0x0000, 0x0000, 0x10A2,
-    0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xD6BA,
-    0x4A69, 0x0000, 0x0000, 0x0800, 0x1987, 0x2334, 0x0316, 0x02D4, 0x0336, 0x32D0, 0x1062, 0x0000,
-    0x0000, 0x3185, 0xDEDB, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CF3, 0x0000, 0x4208,
-    0xCE79, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x0000, 0x8410, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x10A2, 0x2104, 0x2965, 0xF7BE, 0xFFFF, 0xFFFF, 0xEF7D, 0x738E, 0x0000, 0x0861, 0x94B2,
-    0x39E7, 0x10A2, 0xE71C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0x7BEF, 0x73AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2,
-    0x0020, 0x0000, 0x0000, 0x1905, 0x22F2, 0x0316, 0x02D4, 0x0336, 0x2AF1, 0x10C3, 0x0000, 0x0000,
-    0x0000, 0x4A69, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x8C51, 0x1082,
-    0x0000, 0x0000, 0x1061, 0x2A4C, 0x0B36, 0x02F5, 0x02F5, 0x0B36, 0x222C, 0x1040, 0x0000, 0x0000,
-    0x4228, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x6B4C, 0x18C2, 0x73AE, 0xDEFB, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xD69A, 0x0000, 0x39C7, 0x2965,
-    0x0000, 0x6B6D, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x0000, 0x5ACB, 0x2945, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x3186, 0x0000, 0x6B4D, 0xFFFF, 0x9492, 0x18C3, 0x0020, 0x73AE, 0xD69A, 0x5ACB,
-    0x4A49, 0x18E3, 0x3186, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0x8C51, 0x0000, 0x0841, 0x630C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xBDF7, 0x18C3, 0x0000, 0x0000, 0x1082, 0x2AAF, 0x0336, 0x02D5, 0x02F5, 0x1B34, 0x2A0A, 0x0800,
-    0x0000, 0x0000, 0x0841, 0x8410, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x39C7, 0x0000, 0x0000,
-    0x0000, 0x2166, 0x2333, 0x0316, 0x02D4, 0x02F6, 0x2334, 0x1967, 0x0000, 0x0000, 0x0000, 0x6B6D,
-    0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x2124, 0x52AA, 0x1082, 0x5ACB, 0xCE59,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x2104, 0x2945, 0x8C51, 0x9CF3,
-    0x8430, 0x0840, 0x1081, 0x8C71, 0xFFFF, 0xFFDF, 0x39C7, 0x2104, 0x632C, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x39C7, 0x0020, 0x2104, 0x0000, 0x5ACB, 0xD6BA, 0x8410, 0x0861, 0x0000,
-    0x0000, 0x4A49, 0x0000, 0x5AAA, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xAD75, 0x0000, 0x9CF3, 0xE71C, 0x2104, 0x4A69, 0xFFDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xD6BA, 0x39C7, 0x0000, 0x0000, 0x0820, 0x21CA, 0x1B55, 0x02F5, 0x02D5, 0x0B36, 0x22B0,
-    0x2125, 0x0000, 0x0000, 0x0000, 0x20E3, 0x94B2, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x4A69, 0x0000, 0x0000, 0x0000, 0x18A2,
-    0x2A6D, 0x1335, 0x02F5, 0x02D5, 0x0B36, 0x1AB0, 0x20E3, 0x0000, 0x0000, 0x0841, 0x9492, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xF79E, 0xFFFF, 0xCE59, 0x2945, 0xEF3C, 0xC638, 0x39E7, 0x0000,
-    0x4208, 0xBDD7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xF7BE, 0x4A49, 0x0000, 0x94B2, 0x0000, 0x0000,
-    0x4A49, 0xBDD7, 0x630C, 0x0000, 0x31A6, 0x630B, 0x0000, 0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1082, 0x2104, 0x2965, 0xCE59, 0xA514, 0x2104, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x52AA, 0x0000, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xCE79, 0x0000, 0x73AE, 0xFFFF, 0xFFFF, 0xE73C, 0x18C3, 0x8410, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xF79E, 0x6B4D, 0x0000, 0x0000, 0x0000, 0x2125, 0x22D1, 0x0336, 0x02D5, 0x0316,
-    0x1B35, 0x224C, 0x1081, 0x0000, 0x0000, 0x0000, 0x3186, 0x9CD3, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x5ACB, 0x0020, 0x0000, 0x0000, 0x0820, 0x21C9, 0x1B13,
-    0x0336, 0x02D4, 0x0316, 0x1334, 0x2A0A, 0x1040, 0x0000, 0x0000, 0x2965, 0xC618, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xDEDB, 0x4A49, 0xEF7D, 0xFFFF, 0xFFFF, 0x39E7, 0x7BAE, 0xFFFF, 0x4A49, 0x5ACB,
-    0x630C, 0x0000, 0x4208, 0xEF5D, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x9CF3, 0x1082, 0x0000, 0x0000,
-    0x0000, 0x0841, 0x632C, 0xBDF7, 0x39E7, 0x0000, 0x7BCF, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x39C7, 0xBDF7, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0020, 0x632C, 0x0000, 0x7BEF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA,
-    0x10A2, 0x3186, 0x3186, 0xCE38, 0xFFFF, 0xFFFF, 0x632C, 0x31A6, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x18C3, 0x0000, 0x0000, 0x0820, 0x2A2B, 0x1B55, 0x0316,
-    0x02D5, 0x0336, 0x2313, 0x21C9, 0x1081, 0x0000, 0x0000, 0x0000, 0x2124, 0x8C51, 0xE6FB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xB596, 0x528A, 0x0020, 0x0000, 0x0000, 0x0820, 0x1946, 0x2AF1, 0x0B36, 0x02F5,
-    0x02F5, 0x0B36, 0x2AD0, 0x2104, 0x0000, 0x0000, 0x0000, 0x52AA, 0xEF7D, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFDF, 0xFFFF, 0x9CF3, 0x2945, 0xFFFF, 0xFFFF, 0xFFFF, 0xAD55, 0x18E3, 0x3186, 0x5ACB, 0xFFFF,
-    0xFFFF, 0xCE59, 0xAD75, 0xF7BE, 0xFFFF, 0x8430, 0x0000, 0x8C51, 0x2104, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x10A2, 0x8C51, 0xAD75, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1081, 0x5AEB, 0x0000, 0x8430, 0xFFFF, 0xFFDF, 0xFFFF, 0xD6BA, 0x10A2,
-    0x528A, 0xF7BE, 0x7BCF, 0x0861, 0x7BCF, 0x94B2, 0x0000, 0x8C51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x528A, 0x0000, 0x0000, 0x0000, 0x2104, 0x22AF,
-    0x0B35, 0x02F5, 0x02F5, 0x0B36, 0x22F2, 0x29C8, 0x1061, 0x0000, 0x0000, 0x0000, 0x18E3, 0x632C,
-    0xC618, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C,
-    0x9492, 0x31A7, 0x0000, 0x0000, 0x0000, 0x0840, 0x2146, 0x2AAF, 0x1335, 0x02F5, 0x02D5, 0x0316,
-    0x1B13, 0x21A8, 0x1061, 0x0000, 0x0000, 0x18C3, 0xA514, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x8C51, 0x528A, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE, 0x2104, 0x4208, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF3, 0x0000, 0x73AE, 0x39C7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x632C, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0x9CD3, 0x4208,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xA514, 0x2945, 0x10A2, 0x6B4D, 0xF79E, 0x8410, 0x39C6, 0x2965, 0x632C,
-    0xDEDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x9CD3, 0x10A2, 0x0000, 0x0000, 0x0000,
-    0x2187, 0x1AF1, 0x0B36, 0x02F5, 0x02F5, 0x0336, 0x2B12, 0x21A9, 0x1882, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x39C7, 0x8430, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xAD75, 0x630B, 0x0861,
-    0x0000, 0x0000, 0x0000, 0x0840, 0x2147, 0x2AAF, 0x1335, 0x0316, 0x02D5, 0x0316, 0x1B34, 0x2A2C,
-    0x1082, 0x0000, 0x0000, 0x0000, 0x5ACA, 0xDEFB, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xE73C, 0x73AE,
-    0xE73C, 0xFFFF, 0x6B6D, 0x738E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0x7BEF, 0x39E7, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xA514, 0x0000, 0x6B4D, 0x4A49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x632C, 0x0000, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xE73C, 0xFFFF, 0x4228, 0x10A2, 0x94B2, 0xB596, 0x5ACB,
-    0x18C3, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0x5ACB, 0x0000, 0x0000,
-    0x0000, 0x1061, 0x29EA, 0x2312, 0x0B36, 0x02F5, 0x02F5, 0x0B36, 0x12D2, 0x2A4C, 0x18C3, 0x1040,
-    0x0000, 0x0000, 0x0000, 0x1082, 0x31A6, 0x840F, 0xC638, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xDEDB, 0xAD55, 0x528A, 0x2124, 0x0000, 0x0000, 0x0000,
-    0x0800, 0x1082, 0x21A8, 0x22D1, 0x1335, 0x02F5, 0x02D5, 0x0316, 0x1334, 0x2A8E, 0x18E4, 0x0000,
-    0x0000, 0x0000, 0x2124, 0xA534, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0x18C3,
-    0x5AAA, 0xFFFF, 0x5ACB, 0x4A49, 0xD6BA, 0xF7BE, 0xFFFF, 0xFFFF, 0xE73C, 0x0861, 0xB596, 0xFFFF,
-    0xF7BE, 0xFFFF, 0xA514, 0x0000, 0x52AA, 0x738E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x632C, 0x0000, 0x8430, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6B4D, 0x0861, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x5AEB, 0x3186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xB596, 0x31A6,
-    0x0000, 0x0000, 0x0000, 0x1081, 0x29EA, 0x2B13, 0x0336, 0x02F5, 0x02F5, 0x0315, 0x1B55, 0x228E,
-    0x21A8, 0x18C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x5ACB, 0x8430, 0xBDF7, 0xE73C,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0xD6BA, 0xA534, 0x738E, 0x4A28, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x2966,
-    0x1A0C, 0x2B33, 0x0316, 0x02F5, 0x02D5, 0x0316, 0x1B55, 0x2A6E, 0x2125, 0x0000, 0x0000, 0x0000,
-    0x0841, 0x7BCF, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xAD55, 0xB596, 0xFFDF, 0xDEDB,
-    0x0020, 0x8C51, 0x4A28, 0x2945, 0x10A2, 0x2965, 0x5AEB, 0x9CF3, 0xDEDB, 0x73AE, 0xBDD7, 0xFFFF,
-    0xFFFF, 0xA514, 0x0000, 0x4A69, 0x7BCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x6B4D, 0x0000, 0x8410, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE71C, 0x10A2, 0xAD55, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-    0xDEDB, 0x1082, 0xD6BA, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE,
-    0x9CF3, 0x2944, 0x0000, 0x0000, 0x0000, 0x1082, 0x3209, 0x1AD1, 0x1355, 0x0316, 0x02D5, 0x02F6,
-    0x1356, 0x12F3, 0x32CF, 0x2187, 0x18C3, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18C3,
-    0x2945, 0x630C, 0x8C51, 0xA534, 0xBDF7, 0xD69A, 0xE73C, 0xEF7D, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xF7BE, 0xEF5D, 0xDEFB, 0xCE59, 0xB5B6, 0x9CF3, 0x73AE, 0x4228,
-    0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A2, 0x10C4, 0x326C, 0x1AD1, 0x1335,
-    0x0336, 0x02D5, 0x02F5, 0x0B36, 0x1B14, 0x326D, 0x18E4, 0x0820, 0x0000, 0x0000, 0x0841, 0x5AEB,
-    0xD6BA, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xAD55, 0x2104, 0x2965, 0x10A2, 0x5AEB, 0xFFFF,
-    0xAD34, 0x0000, 0x1082, 0xD69A, 0xE71C, 0x9CF3, 0x4208, 0x18C3, 0x528A, 0xF79E, 0xFFFF, 0xFFFF,
-    0x9492, 0x0000, 0x6B2C, 0x7BCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E3, 0x6B6D, 0x0000, 0x632C,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xB5B6, 0x0861, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xCE79, 0x0841, 0xDEDB, 0xFFDF, 0x39C7, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xEF7D, 0x8430, 0x18E3, 0x0000, 0x0000, 0x0000, 0x1040, 0x2167, 0x2A8E, 0x1B54, 0x0315,
-    0x02F6, 0x02F5, 0x0315, 0x0316, 0x2B54, 0x124E, 0x29EA, 0x3186, 0x0020, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x2965, 0x4228, 0x4208, 0x39E7, 0x5289,
-    0x5ACB, 0x4228, 0x39E7, 0x4208, 0x39E7, 0x2945, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x18C2, 0x31E9, 0x09EC, 0x2B32, 0x1335, 0x0316, 0x02F5, 0x02F5,
-    0x0316, 0x0B35, 0x3332, 0x1189, 0x2103, 0x0000, 0x0000, 0x0000, 0x0000, 0x5ACB, 0xC638, 0xFFFF,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE79, 0x0841, 0x94B2, 0xFFFF, 0xDEDB, 0xD6BA, 0xFFFF,
-    0xFFFF, 0x7BEF, 0x0000, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xEF7D, 0xFFFF, 0xFFFF, 0x8430,
-    0x0000, 0x6B6D, 0x738E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x7BCF, 0x0000,
-    0x52AA, 0xF79E, 0xFFFF, 0xF7BE, 0xFFFF, 0xC618, 0x10A2, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF,
-    0x738E, 0x10A2, 0xFFFF, 0x7BCF, 0x1082, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x8C71, 0x2965, 0x0000, 0x0000, 0x0000, 0x0840, 0x10A3, 0x322B,
-    0x1AB0, 0x1B55, 0x0336, 0x02F5, 0x02F5, 0x0316, 0x0B36, 0x1315, 0x0AD2, 0x3B10, 0x2A0A, 0x08E5,
-    0x1904, 0x2103, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18A2, 0x2104,
-    0x10E5, 0x1147, 0x42EF, 0x22F1, 0x0AF3, 0x1335, 0x0336, 0x02F5, 0x02F5, 0x0316, 0x1356, 0x1AF3,
-    0x226E, 0x2966, 0x1061, 0x0000, 0x0000, 0x0000, 0x0862, 0x5AEB, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B6D, 0x5ACB, 0xFFFF, 0xFFFF, 0xEF7D, 0xB596, 0xA514,
-    0xE73C, 0xFFFF, 0x39E7, 0x31A6, 0xF7BE, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x630C, 0x0000,
-    0x8430, 0x4A49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x630C,
-    0x0000, 0x2945, 0xD6BA, 0xFFFF, 0xFFDF, 0xF7BE, 0x2965, 0x738E, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDD7,
-    0x0000, 0xA513, 0xE71C, 0x0000, 0xA534, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0xA514, 0x4228, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x1040, 0x2145, 0x19EA, 0x3B31, 0x0AF4, 0x0B35, 0x0336, 0x02F6, 0x02F5, 0x02F5, 0x0316, 0x0B36,
-    0x2355, 0x2B53, 0x1290, 0x0042, 0x0000, 0x10A2, 0x630C, 0x4228, 0x4A49, 0x2965, 0x0861, 0x0861,
-    0x0861, 0x0861, 0x10A2, 0x4208, 0x4228, 0x52AA, 0x3186, 0x0000, 0x0000, 0x01CC, 0x2312, 0x2B74,
-    0x1B55, 0x0316, 0x02F5, 0x02F5, 0x02F6, 0x0316, 0x0B36, 0x0B15, 0x2313, 0x328D, 0x1147, 0x20C2,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x7BEF, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xF7BE, 0xF79E, 0xFFFF, 0xFFDF, 0xFFFF, 0x9CD3, 0x1082, 0x7BCF, 0x5289, 0x18E3, 0x1082, 0x2104,
-    0x2124, 0xDEFB, 0xEF5D, 0x18C3, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0xEF7D, 0x4228, 0x0000, 0x9471,
-    0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6B4D, 0x18E3, 0x1082, 0xB596, 0xFFFF, 0xFFFF, 0xC638, 0x18C3, 0x528A, 0x9CD3, 0x6B6D, 0x0000,
-    0x738E, 0xFFFF, 0x4A49, 0x4228, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xC618, 0x5AEB, 0xFFDF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x6B6D, 0x2945, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1041, 0x0841, 0x3A09, 0x1A2D, 0x1AD1, 0x2B75, 0x0B36, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x0337, 0x0084, 0x0000, 0x3186, 0xFFDF, 0xFFDF, 0xFFDF, 0xF7BE, 0xEF7D, 0xEF7D,
-    0xEF7D, 0xEF7D, 0xF79E, 0xFFDF, 0xF7BE, 0xFFFF, 0x738E, 0x0000, 0x0000, 0x02B3, 0x0316, 0x02F5,
-    0x02F5, 0x02F5, 0x0336, 0x1B55, 0x2B53, 0x0A4E, 0x324C, 0x2145, 0x0841, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x1082, 0x4A49, 0xA514, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x5ACB, 0x2124, 0xDEFB, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BEF, 0x39E7, 0x4A69, 0xAD75, 0xF7BE, 0xFFFF,
-    0x3186, 0x8430, 0xFFFF, 0xCE59, 0xCE59, 0xFFFF, 0xFFFF, 0xD6BA, 0x2945, 0x0841, 0xA514, 0x31A6,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x5AEB, 0x4A48, 0x0000, 0xA514, 0xFFFF, 0xFFFF, 0xE71C, 0x73AE, 0x39C7, 0x528A, 0xAD75,
-    0xFFFF, 0xB5B6, 0x0000, 0xD69A, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A49, 0x4A69, 0xCE59,
-    0x52AA, 0xC638, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xB596,
-    0x6B4D, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1881, 0x2124, 0x08E5, 0x326C, 0x4310,
-    0x1AD2, 0x02B3, 0x1356, 0x0083, 0x0000, 0x31A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BCF, 0x0000, 0x0000, 0x0AD2, 0x0B15, 0x0AD2,
-    0x3311, 0x42EF, 0x0927, 0x1905, 0x2903, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x39C6,
-    0x9491, 0xD6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x4228, 0x3186, 0x18E3, 0xB596, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x2965, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB596, 0x10A2, 0x2945, 0xAD75, 0x18C3, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x39E7, 0x0841, 0xC5F7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0x2124, 0x6B4D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59, 0x0840, 0xD69A, 0xE73C,
-    0x5ACB, 0x2104, 0x528A, 0xA534, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF79E, 0xB596, 0x630C, 0x39C7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-    0x0020, 0x0841, 0x31C7, 0x0841, 0x0000, 0x18A2, 0x8C71, 0x94B2, 0xB596, 0xC638, 0xC618, 0xC618,
-    0xC618, 0xC618, 0xC618, 0xC618, 0x9CF3, 0x94B2, 0x39E7, 0x0000, 0x0000, 0x31A7, 0x2104, 0x0020,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0x528A, 0x8C71, 0xDEFB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x5AEB, 0x8C51, 0x9CD3, 0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0xB5B6, 0x6B6D, 0xD6BA, 0xC618, 0x39E7,
-    0x4208, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0x52AA, 0x0000, 0x7BEF, 0x0861, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x73AE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8410, 0x0000, 0xEF7D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228, 0x5289, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xBDF7, 0x0000, 0x10A2, 0x2965, 0x9492, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xD69A, 0xA514, 0x738E, 0x2945, 0x10A2, 0x0021, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0841,
-    0x0841, 0x0841, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0862, 0x1904, 0x52AA, 0x8C71, 0xBDF7, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF,
-    0x8410, 0xFFDF, 0xFFDF, 0xFFFF, 0xD6BA, 0xC618, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x738E, 0x632C, 0xFFFF, 0xA514, 0x0000, 0x6B6D, 0xFFFF, 0xCE79, 0x2124, 0x2945, 0x2104, 0x6B6D,
-    0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE79, 0x1082, 0x0861, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x18E3, 0xE71C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xBDD7, 0x39C7, 0x39C7, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0x0000, 0xCE79, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x73AE, 0x3186, 0xF79E, 0x9492, 0x73AE, 0xAD55, 0x52AA, 0xA534, 0xEF7D, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0xC618, 0x8C71,
-    0x6B6D, 0x52AA, 0x39E7, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x4A49, 0x632C,
-    0x7BCF, 0xAD75, 0xCE79, 0xF7BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x31A6,
-    0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0x94B2, 0x18C3, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8C71, 0x4208, 0x9CF3, 0x39E7, 0x4A49, 0x18C3, 0x4228, 0xEF7D, 0xFFFF, 0xD69A, 0xE73C, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x73AE, 0x0000, 0x0861, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0861, 0x0000, 0x9492, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xF7BE, 0x7BEF, 0x18E3, 0x5289, 0xF79E, 0xFFFF, 0x39C7, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xEF7D, 0x10A2, 0xA514, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A28, 0x2124, 0x31A6, 0x2124, 0x528A, 0xAD55,
-    0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFBE, 0xE73C, 0xDEDB, 0xC618, 0xBDF7, 0xB595, 0x94B2, 0x9CF3, 0x9CD3, 0x9CD3,
-    0x9CD3, 0x9CD3, 0x9CD3, 0x9CD3, 0xA514, 0xBDD7, 0xBDD7, 0xD69A, 0xDEFB, 0xF79E, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x73AE,
-    0x3186, 0x2965, 0x4A69, 0xDEDB, 0xF7BE, 0x1082, 0x9CF3, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xB596, 0x0841, 0x31A6, 0xA513, 0xFFFF, 0xDEDB, 0x18E3, 0x39E7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE73C, 0x18E3, 0x0861, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x3186, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x6B4D, 0xEF7D, 0xB596, 0x0841, 0xDEDB, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x8C51, 0x2104, 0xFFDF, 0xFFFF, 0xFFFF, 0xDEFB, 0x0861, 0xCE59, 0xFFFF, 0xBDD7, 0x738E, 0x2124,
-    0xA514, 0xFFFF, 0xFFFF, 0xFFDF, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7BEF, 0x10A2,
-    0x9492, 0xBDD7, 0x3186, 0x4A49, 0xFFFF, 0x738E, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xCE79, 0x18C3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xC618, 0x52AA, 0xFFFF, 0xF7BE, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x94B2, 0x0000, 0x0841, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,
-    0x0841, 0xB575, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x738D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF,
-    0x2104, 0x738E, 0xFFFF, 0xFFBE, 0xFFFF, 0x8C51, 0x18E3, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xF7BE, 0xF79E, 0x738E, 0x10A2, 0x2104, 0x2944, 0x9CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xDEFB, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x2104, 0xB5B6,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xEF9D, 0xFFFF, 0xDEDB, 0x0861, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xE71C, 0x2124, 0xCE59, 0xFFFF, 0xFFDF, 0xFFFF, 0xE71C, 0x2124, 0x39E7, 0xE73C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0x2965, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000,
-    0x39E7, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xA534,
-    0x0841, 0xEF5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x0000, 0x31A6, 0x52AA, 0xAD75, 0xEF5D, 0xFFFF,
-    0xFFFF, 0x52AA, 0x10A2, 0xAD75, 0xCE79, 0x9492, 0x0000, 0x94B2, 0xFFFF, 0x8410, 0x738E, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xF7BE, 0xF79E, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFB, 0xA534, 0xEF7D,
-    0xFFFF, 0xEF7D, 0x2124, 0x39C7, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4208, 0x4208,
-    0xAD75, 0x8430, 0x8410, 0xA514, 0xEF5D, 0xFFFF, 0x4228, 0x528A, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A,
-    0xD6BA, 0x39E7, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7, 0xBDD7, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xBDF7, 0x0020, 0x0861,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x4228,
-    0x0000, 0x5ACB, 0xEF5D, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4228,
-    0x5ACB, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEDB, 0x0861, 0xB5B6, 0xC638, 0x632C, 0x3186, 0x31A6, 0xFFDF,
-    0xC618, 0x0020, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0x73AE, 0x18C3, 0xFFFF, 0x4228, 0x39E7, 0xFFFF,
-    0xF7BE, 0xFFFF, 0xC618, 0x2965, 0xEF7D, 0x9CF3, 0x5ACB, 0xFFDF, 0xFFFF, 0xFFFF, 0xE73C, 0x7BCF,
-    0xFFFF, 0xD6BA, 0x7BEF, 0xFFDF, 0x9CF3, 0x73AE, 0xFFFF, 0xFFFF, 0xE73C, 0x10A2, 0x738E, 0xFFFF,
-    0xFFFF, 0xC618, 0x2104, 0x2965, 0x8410, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x4208,
-    0x31A6, 0x39E7, 0x4208, 0x2924, 0x2965, 0xEF7D, 0xC618, 0x1082, 0xD6BA, 0xB5B6, 0x4228, 0x18C3,
-    0xB5B6, 0xEF5D, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x7BEF, 0x0000, 0x2945,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3186,
-    0x738E, 0x0000, 0x18C3, 0xBDD6, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xCE59,
-    0xE71C, 0xFFFF, 0xFFDF, 0xFFFF, 0x9492, 0x2124, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xD69A, 0xFFFF,
-    0x630C, 0x2965, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xEF5D, 0xC618, 0xFFFF, 0x4208, 0x94B2, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x9CF3, 0x18C3, 0xFFFF, 0x7BCF, 0x0000, 0x9CD3, 0xFFFF, 0xFFFF, 0xD69A, 0x18A2,
-    0xFFFF, 0xBDF7, 0x18C3, 0xFFDF, 0x8C71, 0x18C3, 0xFFFF, 0xFFDF, 0x3186, 0x528A, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x94B2, 0x4208, 0xBDD7, 0x0820, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0x2965, 0xAD75, 0xFFFF, 0x2945, 0x10A2, 0x2945, 0x7BEF, 0xDEDB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6BA, 0x39E7, 0x0000, 0x6B4D, 0x8410,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x73AE, 0x39E7, 0x0000, 0x738E, 0xF7BE, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x2124, 0xA534, 0xEF9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0x4A49, 0x738E, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x3186, 0x738E, 0xD69A,
-    0xE71C, 0xFFFF, 0x7BCF, 0x2124, 0xFFFF, 0x5ACB, 0x2124, 0x18C3, 0xDEDB, 0xFFFF, 0xBDF7, 0x2124,
-    0xFFFF, 0xC618, 0x2124, 0xFFDF, 0xAD75, 0x0841, 0xFFFF, 0x630C, 0x3186, 0xF7BE, 0xFFFF, 0xFFDF,
-    0xFFFF, 0x6B6D, 0x632C, 0xFFFF, 0x632C, 0x39C6, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xF79E, 0x8430,
-    0xE71C, 0xFFFF, 0xFFFF, 0xDEDB, 0x18E3, 0xC618, 0xFFFF, 0xAD75, 0x8C71, 0xFFDF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0x9CD3, 0x0000, 0x18E3, 0xA514, 0x4A69, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x39C7, 0x7BCF, 0x0000, 0x2945, 0xCE59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC638, 0x73AE, 0x18E3, 0x2965, 0x5ACB, 0xB596, 0xEF7D, 0xFFFF,
-    0x4A69, 0x5ACB, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xE73C, 0x2103, 0x2104, 0x3186,
-    0x3186, 0x39A6, 0x10A2, 0x6B4D, 0xFFFF, 0x4208, 0x840F, 0x52AA, 0x4A69, 0xFFFF, 0xAD75, 0x2104,
-    0xFFFF, 0xC618, 0x2944, 0xF7BE, 0xC638, 0x2124, 0x738E, 0x0000, 0xA4F3, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0x528A, 0x6B4D, 0xAD75, 0x630C, 0x0000, 0x9492, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0x4228,
-    0x10A2, 0x8410, 0x632C, 0x18C3, 0x630C, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xDEFB, 0x4208, 0x0000, 0x6B6D, 0x9492, 0x1082, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1082, 0x6B6D, 0x31A6, 0x0841, 0x8430, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xF7BE, 0xD69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xB5B6, 0x632C, 0x31A6, 0xC638, 0xFFFF,
-    0x9CD3, 0x0020, 0xD69A, 0xFFFF, 0xFFFF, 0xBDF7, 0x39E7, 0xEF3C, 0xD69A, 0x0020, 0xE73C, 0xEF5D,
-    0xCE79, 0xB596, 0x2944, 0x8410, 0xFFFF, 0x4208, 0x8C51, 0xE73C, 0x0000, 0xC618, 0xC618, 0x18E3,
-    0xFFDF, 0xDEFB, 0x2124, 0xE71C, 0xE71C, 0x0861, 0x10A2, 0x6B4D, 0x0020, 0xBDF7, 0xFFFF, 0xFFFF,
-    0xFFDF, 0x2965, 0x18E3, 0x4A69, 0x7BCF, 0x6B4D, 0x0841, 0xDEDB, 0xFFFF, 0xFFDF, 0xFFFF, 0xF7BE,
-    0x8430, 0x4A49, 0x5AEB, 0xB5B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7D, 0xE71C, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0x9492, 0x0861, 0x18C3, 0x9CF3, 0x4A69, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A69, 0x632C, 0x0000, 0x39E7, 0xC638, 0xFFFF, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0x94B2, 0x0000, 0x39E7, 0xA514, 0xE71C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0xFFDF, 0xFFFF,
-    0xFFFF, 0x5AEB, 0x0861, 0x6B4D, 0x6B4D, 0x0000, 0x4207, 0xF7BE, 0xB596, 0x18C3, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0x39A6, 0x9CF3, 0xFFFF, 0x4208, 0x9492, 0xFFFF, 0x7BEF, 0x2945, 0xA514, 0x4208,
-    0xFFFF, 0xDF1C, 0x18C3, 0xD69A, 0xF7BE, 0x18E3, 0x9CF3, 0xFFFF, 0x73AE, 0x0020, 0xCE59, 0xFFFF,
-    0xE71C, 0x10A2, 0xCE79, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C7, 0x31A6, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD69A, 0x7BEF, 0x0841, 0x39A6, 0xF7BE, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xCE59, 0x4A49, 0x0000, 0x5AEB, 0x94B2, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x7BEF, 0x2965, 0x0000, 0x6B6D, 0xEF7D,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x0861, 0x31A6, 0x4A69, 0x0000, 0x0861, 0x4A69, 0xAD75, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF,
-    0xFFDF, 0xFFFF, 0xAD75, 0x630C, 0x52AA, 0x9CD3, 0xFFDF, 0xFFFF, 0x8410, 0x39A6, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xEF5D, 0x0861, 0xC618, 0xFFFF, 0x31A6, 0x94B2, 0xFFFF, 0xF79E, 0x2965, 0x2104, 0x528A,
-    0xFFFF, 0xDEFB, 0x18E3, 0xCE79, 0xFFFF, 0x3185, 0xB596, 0xFFFF, 0xFFFF, 0x52AA, 0x1082, 0xDEFB,
-    0xB5B6, 0x18C3, 0xEF7D, 0xFFFF, 0xF7BE, 0xFFFF, 0xDEDB, 0x7BEF, 0xEF7D, 0xFFFF, 0xFFDF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x9CD3, 0x39E7, 0x0000, 0x0861, 0x5AEB, 0x0000, 0x8430, 0xFFFF,
-    0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF5D,
-    0x630C, 0x0000, 0x2124, 0xA514, 0x5AEB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4228, 0x73AE, 0x0841, 0x10A2,
-    0x9492, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x6B4D,
-    0x0841, 0xAD55, 0x52AA, 0x8C51, 0x7BCF, 0x2124, 0x0000, 0x0000, 0x5ACB, 0x9CF3, 0xDEDB, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xAD75, 0x8C71, 0xFFFF, 0xFFDF,
-    0xFFFF, 0xCE79, 0x0000, 0xDEFB, 0xFFFF, 0x0000, 0x94B2, 0xFFFF, 0xFFFF, 0xC638, 0x0000, 0x4208,
-    0xFFFF, 0xDEFB, 0x1061, 0xCE59, 0xFFFF, 0x2104, 0x8430, 0xFFFF, 0xFFDF, 0xF7BE, 0x4208, 0x5ACB,
-    0xA534, 0x738E, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xD6BA, 0x9CD3, 0x4A49, 0x0000, 0x0020, 0x31A6, 0x94B2, 0x9CD3, 0x632C, 0x5AAA, 0x0861, 0xDEFB,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xE71C, 0x7BCF, 0x0020,
-    0x0841, 0x7BEF, 0x94B2, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x738E, 0x5AEB,
-    0x0000, 0x2124, 0xA514, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFDF, 0xFFFF, 0xCE79, 0x0000,
-    0x8410, 0x39C7, 0x0000, 0x0000, 0x18E3, 0x5ACB, 0x9491, 0x7BCF, 0x3186, 0x0000, 0x1082, 0x3186,
-    0x6B6D, 0xBDD7, 0xE73C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xE73C, 0xB5B6, 0xFFDF, 0xFFFF, 0x6B6D, 0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0x7BCE, 0x738E,
-    0xFFFF, 0xF79E, 0x7BCF, 0xDEFB, 0xFFFF, 0x9492, 0xBDD7, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xE71C,
-    0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xBDF7, 0x6B4D, 0x2945,
-    0x0841, 0x0000, 0x4208, 0x8C51, 0xA534, 0x632C, 0x2104, 0x0000, 0x0000, 0x528A, 0x0841, 0x5AEB,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xEF5D, 0x73AE, 0x0841, 0x0000, 0x7BCF,
-    0x9CF3, 0x31A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965,
-    0x8430, 0x4A69, 0x0000, 0x2945, 0x9CF3, 0xF79E, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0x39E7, 0x18E3,
-    0x9492, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x5ACB, 0x8C71, 0x8430, 0x4A49,
-    0x20E3, 0x0000, 0x0000, 0x39C7, 0x6B6D, 0x94B2, 0xC638, 0xEF7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xF79E, 0xCE79, 0xA514, 0x738E, 0x39E7, 0x0000, 0x0000, 0x2104, 0x4A49,
-    0x9CD2, 0xA4F3, 0x632C, 0x2965, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B6D, 0x0000,
-    0xC638, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xD6BA, 0x738E, 0x0841, 0x0841, 0x6B4D, 0x9CD3, 0x39E7,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x39C7, 0x8C71, 0x4A69, 0x0000, 0x18A2, 0x8C71, 0xEF7D, 0xFFFF, 0xA514, 0x0000, 0xAD54,
-    0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x3186,
-    0x7BAE, 0x8C71, 0x8430, 0x630C, 0x18C3, 0x0000, 0x0861, 0x10A2, 0x2104, 0x4207, 0x7BCF, 0xCE79,
-    0xFFFF, 0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDF7,
-    0x94B2, 0x630C, 0x2965, 0x10A2, 0x0861, 0x0000, 0x1082, 0x5ACB, 0x9492, 0xA514, 0x8C51, 0x528A,
-    0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x2945,
-    0x39C7, 0xFFFF, 0xFFFF, 0xCE79, 0x5AEB, 0x0020, 0x0000, 0x7BCF, 0x9CF3, 0x39E7, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x3186, 0x8410, 0x52AA, 0x0000, 0x18C3, 0x8C51, 0x2104, 0x4208, 0x738E,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0861, 0x4208, 0x632C, 0x94B2, 0x9CD3, 0x7BEF, 0x5AEB, 0x4228, 0x0000, 0x8C71,
-    0xFFFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0841,
-    0x0861, 0x31A6, 0x4A69, 0x738E, 0x9CD3, 0xA514, 0x8C51, 0x528A, 0x2945, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x632C,
-    0x0000, 0x8410, 0x5ACB, 0x0000, 0x18C3, 0x8410, 0xA514, 0x39E7, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x8C51, 0x630C, 0x0000, 0x0000, 0xB596, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10A2, 0x2124, 0x5ACB, 0x0000, 0x8C71,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0000,
-    0x738E, 0x7BCF, 0x52AA, 0x2945, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18C3,
-    0x4A49, 0x0000, 0x2124, 0x9492, 0x8C71, 0x3186, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2965, 0x632C, 0xA534, 0x4208, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C71,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0000,
-    0x4A69, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x630C, 0x9CD3, 0x8410, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C71,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0020,
-    0x5269, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x18C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C71,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0020,
-    0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C71,
-    0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BE, 0x0000,
-    0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x94B2,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFDF, 0x0020,
-    0x5269, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B4D,
-    0xD69A, 0xDEFB, 0xF79E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0x0000,
-    0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861,
-    0x1082, 0x18C2, 0x1082, 0x18C3, 0x2124, 0x2965, 0x5ACB, 0x738E, 0x73AE, 0x9CD3, 0x9CD3, 0x9CD3,
-    0x9CD3, 0x9CD3, 0x9CD3, 0x8C71, 0x738E, 0x6B4D, 0x39C7, 0x2965, 0x18E3, 0x18C3, 0x1082, 0x0000,
-    0x528A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6B6D, 0xA514,
-    0x9492, 0x9CD2, 0x73AE, 0x6B6D, 0x528A, 0x4228, 0x3186, 0x31A6, 0x18E3, 0x18C3, 0x18C3, 0x18C3,
-    0x18C3, 0x18C3, 0x18C3, 0x18A2, 0x2945, 0x31A6, 0x39C7, 0x4A69, 0x5ACB, 0x738E, 0x738E, 0xA534,
-    0x7BEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0841, 0x0861, 0x18C3, 0x4A49, 0x528A, 0x8C51, 0x8430, 0xA514, 0xCE59, 0xC618,
-    0xC618, 0xC618, 0xCE59, 0x9CF3, 0x8430, 0x8430, 0x528A, 0x4A49, 0x10A2, 0x0861, 0x0841, 0x0020,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+constexpr uint8_t ST7789::logo_rle[] = {
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x69, 0x00, 0x00, 0x80, 0x08, 0x61, 0x01, 0x18, 0xe3, 0x80, 0x08, 0x41, 0x10, 0x00, 0x00,
+    0x85, 0x00, 0x20, 0x18, 0xe3, 0x10, 0xa2, 0x10, 0x82, 0x08, 0x41, 0x00, 0x20, 0x7f, 0x00, 0x00,
+    0x54, 0x00, 0x00, 0x80, 0x00, 0x20, 0x04, 0x00, 0x00, 0x83, 0x10, 0xa2, 0x29, 0x45, 0x31, 0x86,
+    0x4a, 0x49, 0x05, 0x52, 0xaa, 0x82, 0x39, 0xe7, 0x29, 0x45, 0x21, 0x04, 0x06, 0x00, 0x00, 0x80,
+    0x00, 0x20, 0x7f, 0x00, 0x00, 0x55, 0x00, 0x00, 0x80, 0x31, 0x86, 0x01, 0xc6, 0x18, 0x85, 0xde,
+    0xdb, 0xe7, 0x1c, 0xe7, 0x3c, 0xef, 0x7d, 0xf7, 0x9e, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x89, 0xf7,
+    0xbe, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x1c, 0xde, 0xfb, 0xc6, 0x38, 0xbd, 0xd7, 0xa5, 0x34, 0x8c,
+    0x71, 0x39, 0xc7, 0x01, 0x10, 0x82, 0x7f, 0x00, 0x00, 0x54, 0x00, 0x00, 0x80, 0x4a, 0x69, 0x16,
+    0xff, 0xff, 0x82, 0x8c, 0x71, 0x08, 0x41, 0x21, 0x04, 0x7f, 0x00, 0x00, 0x54, 0x00, 0x00, 0x80,
+    0x4a, 0x49, 0x02, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x03, 0xff, 0xdf, 0x82, 0x84, 0x30, 0x08, 0x41,
+    0x21, 0x04, 0x7f, 0x00, 0x00, 0x54, 0x00, 0x00, 0x80, 0x4a, 0x49, 0x16, 0xff, 0xff, 0x82, 0x8c,
+    0x51, 0x08, 0x41, 0x21, 0x04, 0x7f, 0x00, 0x00, 0x54, 0x00, 0x00, 0x80, 0x4a, 0x49, 0x16, 0xff,
+    0xff, 0x82, 0x8c, 0x51, 0x08, 0x41, 0x21, 0x04, 0x7f, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x81, 0x08,
+    0x61, 0x00, 0x20, 0x17, 0x00, 0x00, 0x80, 0x4a, 0x49, 0x16, 0xff, 0xff, 0x82, 0x8c, 0x51, 0x08,
+    0x41, 0x21, 0x04, 0x16, 0x00, 0x00, 0x81, 0x08, 0x41, 0x00, 0x20, 0x7f, 0x00, 0x00, 0x1f, 0x00,
+    0x00, 0x80, 0x08, 0x61, 0x01, 0x00, 0x00, 0x80, 0x08, 0x41, 0x17, 0x00, 0x00, 0x81, 0x4a, 0x69,
+    0xff, 0xdf, 0x15, 0xff, 0xff, 0x82, 0x8c, 0x51, 0x08, 0x61, 0x18, 0xc3, 0x15, 0x00, 0x00, 0x80,
+    0x08, 0x41, 0x01, 0x00, 0x00, 0x80, 0x10, 0x82, 0x7f, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x80, 0x08,
+    0x41, 0x01, 0x00, 0x00, 0x83, 0x21, 0x24, 0x31, 0xa6, 0x00, 0x00, 0x08, 0x61, 0x10, 0x00, 0x00,
+    0x82, 0x08, 0x41, 0x10, 0x82, 0x00, 0x20, 0x01, 0x08, 0x41, 0x81, 0x00, 0x00, 0x39, 0xe7, 0x14,
+    0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x21, 0x04, 0x08, 0x41, 0x10,
+    0x82, 0x08, 0x61, 0x12, 0x00, 0x00, 0x01, 0x08, 0x61, 0x80, 0x42, 0x08, 0x01, 0x00, 0x00, 0x81,
+    0x10, 0x82, 0x08, 0x41, 0x7f, 0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x10, 0x82, 0x01, 0x00, 0x00,
+    0x85, 0x21, 0x04, 0x84, 0x30, 0xef, 0x7d, 0xe7, 0x1c, 0x18, 0xc3, 0x10, 0xa2, 0x0d, 0x00, 0x00,
+    0x81, 0x10, 0x82, 0x08, 0x61, 0x03, 0x00, 0x00, 0x83, 0x10, 0x82, 0x4a, 0x49, 0x73, 0xae, 0xad,
+    0x55, 0x16, 0xff, 0xff, 0x82, 0xb5, 0x96, 0x39, 0xc7, 0x08, 0x41, 0x04, 0x00, 0x00, 0x81, 0x18,
+    0xc3, 0x08, 0x61, 0x0d, 0x00, 0x00, 0x85, 0x08, 0x61, 0x00, 0x00, 0x84, 0x10, 0xff, 0xdf, 0xad,
+    0x75, 0x42, 0x08, 0x01, 0x00, 0x00, 0x81, 0x10, 0xa2, 0x00, 0x20, 0x7f, 0x00, 0x00, 0x13, 0x00,
+    0x00, 0x80, 0x08, 0x61, 0x01, 0x00, 0x00, 0x82, 0x31, 0x86, 0x94, 0xb2, 0xef, 0x7d, 0x02, 0xff,
+    0xff, 0x82, 0x94, 0xb2, 0x00, 0x00, 0x08, 0x41, 0x08, 0x00, 0x00, 0x82, 0x10, 0xa2, 0x08, 0x41,
+    0x00, 0x20, 0x01, 0x00, 0x00, 0x86, 0x10, 0x82, 0x39, 0xc7, 0x6b, 0x4d, 0xa5, 0x14, 0xd6, 0x9a,
+    0xe7, 0x3c, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x06, 0xff, 0xff, 0x03, 0xff, 0xdf,
+    0x05, 0xff, 0xff, 0x87, 0xf7, 0xbe, 0xef, 0x5d, 0xd6, 0x9a, 0xb5, 0x96, 0x84, 0x30, 0x4a, 0x69,
+    0x29, 0x65, 0x00, 0x20, 0x01, 0x00, 0x00, 0x82, 0x00, 0x20, 0x08, 0x41, 0x10, 0x82, 0x09, 0x00,
+    0x00, 0x82, 0x00, 0x20, 0x29, 0x65, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xbd, 0xd7,
+    0x52, 0x8a, 0x01, 0x00, 0x00, 0x81, 0x10, 0x82, 0x08, 0x41, 0x7f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+    0x80, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x39, 0xc7, 0xad, 0x55, 0xf7, 0x9e, 0x01, 0xff, 0xff,
+    0x01, 0xff, 0xdf, 0x83, 0xff, 0xff, 0xf7, 0x9e, 0x31, 0xa6, 0x00, 0x20, 0x05, 0x00, 0x00, 0x81,
+    0x08, 0x61, 0x08, 0x41, 0x02, 0x00, 0x00, 0x84, 0x31, 0x86, 0x7b, 0xef, 0xad, 0x55, 0xd6, 0xba,
+    0xff, 0xdf, 0x04, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x1b, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xf7, 0x9e,
+    0xce, 0x79, 0xa5, 0x14, 0x73, 0x8e, 0x29, 0x65, 0x02, 0x00, 0x00, 0x81, 0x08, 0x41, 0x08, 0x61,
+    0x05, 0x00, 0x00, 0x83, 0x10, 0x82, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x02,
+    0xff, 0xff, 0x81, 0xc6, 0x18, 0x52, 0x8a, 0x01, 0x00, 0x00, 0x80, 0x10, 0xa2, 0x7f, 0x00, 0x00,
+    0x0c, 0x00, 0x00, 0x80, 0x08, 0x61, 0x01, 0x00, 0x00, 0x82, 0x39, 0xe7, 0xad, 0x55, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xd7,
+    0x00, 0x00, 0x10, 0xa2, 0x01, 0x00, 0x00, 0x80, 0x10, 0x82, 0x02, 0x00, 0x00, 0x84, 0x18, 0xe3,
+    0x4a, 0x69, 0x94, 0xb2, 0xde, 0xfb, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x06, 0xff,
+    0xff, 0x85, 0xf7, 0x9e, 0xe7, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xd7, 0xe7, 0x1c, 0x03, 0xff,
+    0xff, 0x87, 0xff, 0xdf, 0xa5, 0x34, 0x9c, 0xd3, 0xa5, 0x14, 0x9c, 0xf3, 0xbd, 0xf7, 0xce, 0x59,
+    0xf7, 0xbe, 0x04, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x02, 0xff,
+    0xff, 0x84, 0xf7, 0xbe, 0xd6, 0xba, 0x94, 0xb2, 0x4a, 0x69, 0x18, 0xe3, 0x02, 0x00, 0x00, 0x80,
+    0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x52, 0x8a, 0x05, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0xc6, 0x18, 0x4a, 0x49, 0x01, 0x00, 0x00, 0x80, 0x08, 0x61,
+    0x7f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x08, 0x61, 0x01, 0x00, 0x00, 0x82, 0x21, 0x24, 0xa5,
+    0x14, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x82,
+    0x52, 0xaa, 0x00, 0x00, 0x10, 0x82, 0x01, 0x00, 0x00, 0x84, 0x08, 0x61, 0x5a, 0xcb, 0xad, 0x55,
+    0xde, 0xfb, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x8b, 0xa5, 0x34,
+    0x73, 0x8e, 0x42, 0x28, 0x42, 0x08, 0x31, 0xa6, 0x39, 0xe7, 0xe7, 0x1c, 0xf7, 0xbe, 0x18, 0xe3,
+    0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x8f, 0xef, 0x5d, 0x18, 0xc3, 0x29, 0x45,
+    0x42, 0x08, 0x39, 0xe7, 0x21, 0x04, 0x21, 0x24, 0xde, 0xdb, 0xff, 0xff, 0x39, 0xe7, 0xad, 0x55,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0xde, 0xfb, 0x03, 0xff, 0xff, 0x01, 0xff, 0xdf,
+    0x02, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xe7, 0x1c, 0xad, 0x55, 0x63, 0x0c, 0x08, 0x61, 0x01, 0x00,
+    0x00, 0x02, 0x08, 0x61, 0x82, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xad, 0x55, 0x21, 0x24, 0x01, 0x00, 0x00, 0x80, 0x00,
+    0x20, 0x7f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x84, 0x08, 0x41, 0x00, 0x00, 0x18, 0xc3, 0x8c, 0x51,
+    0xf7, 0x9e, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff,
+    0xde, 0xdb, 0x08, 0x41, 0x00, 0x00, 0x39, 0xe7, 0x8c, 0x71, 0xe7, 0x1c, 0x02, 0xff, 0xff, 0x01,
+    0xff, 0xdf, 0x0a, 0xff, 0xff, 0x89, 0x10, 0xa2, 0x31, 0x86, 0x84, 0x10, 0x9c, 0xf3, 0xbd, 0xd7,
+    0xd6, 0xba, 0xff, 0xff, 0xff, 0xdf, 0x39, 0xe7, 0xad, 0x75, 0x03, 0xff, 0xff, 0x82, 0xe7, 0x1c,
+    0x18, 0xe3, 0xd6, 0x9a, 0x02, 0xff, 0xff, 0x8e, 0xf7, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x08, 0x41,
+    0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x73, 0x8e, 0x08, 0x61, 0x9c, 0xd3, 0xc6, 0x38, 0x5a, 0xeb,
+    0x94, 0xb2, 0xd6, 0x9a, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x82,
+    0xe7, 0x3c, 0x9c, 0xf3, 0x4a, 0x69, 0x01, 0x00, 0x00, 0x82, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xdf,
+    0x07, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xef, 0x7d, 0x7b, 0xcf, 0x08, 0x61,
+    0x00, 0x00, 0x08, 0x41, 0x7f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x84, 0x08, 0x41, 0x00, 0x20, 0x00,
+    0x00, 0x52, 0x8a, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x82, 0xad,
+    0x75, 0xb5, 0x96, 0xf7, 0xbe, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xce, 0x79, 0xf7, 0xbe, 0x07, 0xff, 0xff, 0x81, 0x42, 0x08, 0x9c, 0xd3, 0x05, 0xff, 0xff,
+    0x83, 0x42, 0x28, 0x94, 0x71, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0x21,
+    0x04, 0xbd, 0xf7, 0x04, 0xff, 0xff, 0x8f, 0xd6, 0xba, 0x21, 0x24, 0xe7, 0x1c, 0xef, 0x5d, 0x31,
+    0x85, 0x21, 0x04, 0xce, 0x59, 0xff, 0xff, 0xd6, 0xba, 0x73, 0xae, 0x39, 0xc7, 0x18, 0xe3, 0x29,
+    0x45, 0x52, 0x8a, 0x94, 0xb2, 0xef, 0x7d, 0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x83, 0xff, 0xdf, 0xce, 0x59, 0x84, 0x10, 0xe7, 0x3c, 0x0b, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01,
+    0xff, 0xff, 0x84, 0xce, 0x59, 0x39, 0xe7, 0x00, 0x00, 0x08, 0x41, 0x00, 0x20, 0x7f, 0x00, 0x00,
+    0x83, 0x10, 0xa2, 0x00, 0x00, 0x10, 0xa2, 0xa5, 0x34, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x11,
+    0xff, 0xff, 0x80, 0xf7, 0xbe, 0x03, 0xff, 0xff, 0x84, 0xa5, 0x14, 0xce, 0x79, 0xf7, 0x9e, 0x18,
+    0xa2, 0xad, 0x75, 0x07, 0xff, 0xff, 0x8b, 0x63, 0x0c, 0x52, 0xaa, 0xce, 0x59, 0xad, 0x75, 0x8c,
+    0x51, 0x6b, 0x6d, 0xde, 0xdb, 0xff, 0xff, 0x39, 0xe7, 0x84, 0x10, 0xff, 0xff, 0xff, 0xdf, 0x01,
+    0xff, 0xff, 0x8f, 0xde, 0xfb, 0x08, 0x61, 0x18, 0xe3, 0x42, 0x08, 0x42, 0x28, 0x42, 0x08, 0x8c,
+    0x71, 0xff, 0xff, 0xbd, 0xd7, 0x29, 0x65, 0x94, 0xb2, 0x18, 0xe3, 0x63, 0x0b, 0xf7, 0xbe, 0xff,
+    0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x88, 0xff, 0xdf, 0x29, 0x45, 0x7b, 0xcf, 0x7b, 0xef, 0x4a,
+    0x49, 0xe7, 0x3c, 0xce, 0x79, 0x6b, 0x6d, 0xc6, 0x18, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x11,
+    0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x84, 0x30, 0x01, 0x00, 0x00, 0x80, 0x10,
+    0x82, 0x7c, 0x00, 0x00, 0x80, 0x08, 0x61, 0x01, 0x00, 0x00, 0x81, 0x52, 0xaa, 0xde, 0xdb, 0x01,
+    0xff, 0xff, 0x80, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x89, 0xff,
+    0xdf, 0xff, 0xff, 0xa5, 0x34, 0x08, 0x61, 0xe7, 0x1c, 0xff, 0xff, 0x4a, 0x49, 0x63, 0x0c, 0xff,
+    0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x8a, 0x84, 0x30, 0x08, 0x61, 0x39, 0xc6, 0x31, 0x86, 0x39,
+    0xe7, 0x63, 0x2c, 0xde, 0xfb, 0xff, 0xff, 0x39, 0xe7, 0x84, 0x10, 0xff, 0xff, 0x01, 0xff, 0xdf,
+    0x83, 0xff, 0xff, 0xc6, 0x38, 0x00, 0x00, 0xb5, 0xb6, 0x01, 0xad, 0x55, 0x8f, 0xa5, 0x14, 0xb5,
+    0x96, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0x21, 0x04, 0x08, 0x41, 0xad, 0x54, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xf7, 0x08, 0x41, 0xf7, 0x9e, 0x02, 0xff, 0xff,
+    0x85, 0x63, 0x0c, 0x00, 0x20, 0x31, 0xa6, 0x29, 0x65, 0x84, 0x10, 0xe7, 0x3c, 0x01, 0xff, 0xff,
+    0x80, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xbd, 0xf7, 0x31,
+    0x86, 0x00, 0x00, 0x08, 0x41, 0x00, 0x20, 0x79, 0x00, 0x00, 0x83, 0x08, 0x41, 0x00, 0x00, 0x10,
+    0xa2, 0x94, 0xb2, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x14, 0xff, 0xff, 0x81, 0x63, 0x0c, 0xb5,
+    0x96, 0x01, 0xff, 0xff, 0x81, 0x31, 0x86, 0x84, 0x10, 0x01, 0xff, 0xff, 0x82, 0x8c, 0x71, 0x29,
+    0x45, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x10, 0xa2, 0xef,
+    0x7d, 0x04, 0xff, 0xff, 0x81, 0x42, 0x28, 0x8c, 0x30, 0x03, 0xff, 0xff, 0x81, 0xce, 0x59, 0x00,
+    0x00, 0x05, 0xff, 0xff, 0x85, 0x6b, 0x4d, 0x21, 0x24, 0xe7, 0x3c, 0x9c, 0xd2, 0x10, 0x82, 0xf7,
+    0x9e, 0x01, 0xff, 0xff, 0x8f, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x71, 0x31, 0xa6, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0xef, 0x5d, 0x10, 0x82, 0xb5, 0x96, 0xff, 0xdf, 0xad, 0x75, 0x31, 0xa6, 0x21,
+    0x04, 0xe7, 0x3c, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff,
+    0xef, 0x7d, 0x6b, 0x6d, 0x01, 0x00, 0x00, 0x80, 0x08, 0x41, 0x79, 0x00, 0x00, 0x81, 0x42, 0x28,
+    0xd6, 0xba, 0x15, 0xff, 0xff, 0x88, 0xc6, 0x18, 0x7b, 0xcf, 0xff, 0xff, 0x42, 0x28, 0x4a, 0x69,
+    0xff, 0xff, 0xad, 0x55, 0x21, 0x04, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x84, 0xde, 0xdb, 0x10, 0x82,
+    0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0xb6,
+    0x08, 0x41, 0x03, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0xff, 0xff, 0x01, 0x52, 0x8a, 0x88, 0xde, 0xfb,
+    0xde, 0xdb, 0xc6, 0x38, 0xd6, 0x9a, 0xbd, 0xf7, 0x08, 0x41, 0xd6, 0x79, 0xd6, 0xba, 0xde, 0xfb,
+    0x01, 0xef, 0x5d, 0x88, 0xff, 0xff, 0x52, 0x8a, 0x73, 0xae, 0xff, 0xff, 0xef, 0x7d, 0x21, 0x03,
+    0x8c, 0x51, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x87, 0x52, 0xaa, 0x6b, 0x4d, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0xad, 0x55, 0x10, 0x82, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0x21, 0x24,
+    0x94, 0xb2, 0x15, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xad, 0x55, 0x18, 0xe3,
+    0x00, 0x00, 0x08, 0x61, 0x00, 0x20, 0x75, 0x00, 0x00, 0x84, 0x21, 0x04, 0x00, 0x20, 0xde, 0xdb,
+    0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x88, 0xff, 0xff, 0x5a, 0xcb, 0x63,
+    0x0c, 0xff, 0xff, 0xbd, 0xd7, 0x08, 0x41, 0xef, 0x5d, 0x31, 0xa6, 0x5a, 0xcb, 0x01, 0xff, 0xff,
+    0x85, 0xff, 0xdf, 0xff, 0xff, 0x21, 0x04, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff,
+    0x8f, 0xd6, 0x9a, 0x10, 0x82, 0x84, 0x10, 0x7b, 0xef, 0x52, 0x8a, 0x42, 0x28, 0x31, 0xa6, 0xef,
+    0x5d, 0x63, 0x2c, 0x00, 0x20, 0x29, 0x45, 0x21, 0x04, 0x08, 0x61, 0x8c, 0x30, 0xc6, 0x38, 0x10,
+    0x82, 0x01, 0x21, 0x04, 0x85, 0x21, 0x24, 0x31, 0x86, 0x52, 0xaa, 0xf7, 0x7d, 0x39, 0xc7, 0x94,
+    0x91, 0x01, 0xff, 0xff, 0x82, 0x94, 0x92, 0x08, 0x61, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x93, 0xff,
+    0xdf, 0x10, 0xa2, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x52, 0xaa, 0x08, 0x41, 0x52,
+    0x8a, 0xa5, 0x34, 0xe7, 0x1c, 0xc6, 0x38, 0x08, 0x61, 0xad, 0x75, 0xff, 0xff, 0xf7, 0x9e, 0x7b,
+    0xef, 0x42, 0x08, 0x4a, 0x49, 0xa5, 0x34, 0x13, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x29, 0x65, 0x00,
+    0x00, 0x08, 0x61, 0x75, 0x00, 0x00, 0x82, 0x42, 0x28, 0x10, 0x82, 0x5a, 0xcb, 0x0e, 0xff, 0xff,
+    0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0xde, 0xdb, 0xe7, 0x1c, 0x02, 0xff, 0xff, 0x89, 0x42,
+    0x28, 0x94, 0xb2, 0xff, 0xff, 0xef, 0x7d, 0x31, 0x86, 0x4a, 0x49, 0x21, 0x04, 0x08, 0x61, 0x6b,
+    0x6d, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x81, 0x73, 0xae, 0x42, 0x28, 0x01, 0xff, 0xff, 0x81, 0xbd,
+    0xf7, 0xef, 0x7d, 0x02, 0xff, 0xff, 0x89, 0xef, 0x5d, 0x52, 0x8a, 0x42, 0x28, 0x52, 0x8a, 0x73,
+    0xae, 0x94, 0xb2, 0xb5, 0xb6, 0xf7, 0x9e, 0xe7, 0x3c, 0xef, 0x7d, 0x01, 0xef, 0x5d, 0x8b, 0xef,
+    0x7d, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x9e, 0xef, 0x5d, 0xef, 0x7d, 0xde, 0xdb, 0xc6, 0x38, 0xd6,
+    0xba, 0xff, 0xdf, 0xad, 0x55, 0xde, 0xfb, 0x01, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x21, 0x04, 0x6b,
+    0x6d, 0x01, 0xff, 0xff, 0x82, 0xce, 0x39, 0x18, 0xe3, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x8b, 0xe7,
+    0x3c, 0x21, 0x04, 0x94, 0xb2, 0x8c, 0x51, 0x18, 0xc3, 0x10, 0x82, 0x21, 0x04, 0x6b, 0x4d, 0xff,
+    0xdf, 0xef, 0x7d, 0x39, 0xe7, 0x29, 0x45, 0x01, 0x8c, 0x51, 0x82, 0x18, 0xe3, 0x4a, 0x49, 0xf7,
+    0xbe, 0x0f, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x83, 0xd6, 0x9a, 0x00, 0x20, 0x7b, 0xef, 0x21, 0x04,
+    0x76, 0x00, 0x00, 0x84, 0x63, 0x0c, 0x00, 0x00, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff,
+    0xff, 0x84, 0xef, 0x7d, 0xde, 0xdb, 0x63, 0x2c, 0x10, 0xa2, 0x94, 0x92, 0x01, 0xff, 0xff, 0x81,
+    0x29, 0x45, 0xbd, 0xf7, 0x01, 0xff, 0xff, 0x92, 0x7b, 0xef, 0x00, 0x00, 0x94, 0x92, 0xc6, 0x38,
+    0x08, 0x61, 0x29, 0x45, 0xce, 0x59, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x00, 0xef, 0x5d, 0xf7, 0xbe,
+    0x08, 0x61, 0xb5, 0x96, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x18, 0xff,
+    0xff, 0x85, 0xe7, 0x1c, 0xc6, 0x38, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x31, 0xa6, 0x01, 0xff,
+    0xdf, 0x87, 0xff, 0xff, 0x9c, 0xf3, 0x18, 0xc3, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x18, 0xe3,
+    0xd6, 0x9a, 0x01, 0xff, 0xff, 0x82, 0x5a, 0xcb, 0x18, 0xe3, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x84,
+    0xe7, 0x3c, 0x10, 0xa2, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x82, 0x39, 0xe7,
+    0x21, 0x04, 0x94, 0x92, 0x77, 0x00, 0x00, 0x82, 0x29, 0x65, 0x29, 0x45, 0x39, 0xc7, 0x0d, 0xff,
+    0xff, 0x89, 0x9c, 0xf3, 0x10, 0x82, 0x84, 0x30, 0xff, 0xff, 0x8c, 0x51, 0x18, 0xc3, 0x42, 0x08,
+    0xb5, 0xb6, 0x31, 0x85, 0xe7, 0x1c, 0x01, 0xff, 0xff, 0x8d, 0xce, 0x59, 0x08, 0x20, 0xce, 0x79,
+    0xff, 0xff, 0xef, 0x5d, 0x5a, 0xcb, 0x00, 0x00, 0x84, 0x0f, 0xde, 0xfb, 0x52, 0x8a, 0xce, 0x59,
+    0xff, 0xff, 0x7b, 0xef, 0xa5, 0x34, 0x01, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xef,
+    0x7d, 0x01, 0xde, 0xfb, 0x80, 0xd6, 0xba, 0x02, 0xc6, 0x18, 0x81, 0xc5, 0xf7, 0xce, 0x59, 0x01,
+    0xde, 0xfb, 0x81, 0xe7, 0x1c, 0xf7, 0xbe, 0x07, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x81, 0xef, 0x5d,
+    0xde, 0xdb, 0x02, 0xff, 0xff, 0x8b, 0x39, 0xe7, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe,
+    0x10, 0x82, 0xb5, 0x96, 0xff, 0xff, 0xde, 0xdb, 0x08, 0x41, 0xbd, 0xf7, 0xff, 0xff, 0x01, 0xff,
+    0xdf, 0x86, 0xff, 0xff, 0x8c, 0x51, 0x31, 0xa6, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0xc6, 0x18,
+    0x0a, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x55, 0x00, 0x00, 0x9c, 0xd3, 0x18, 0xc3,
+    0x78, 0x00, 0x00, 0x84, 0x6b, 0x4d, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x08, 0xff,
+    0xff, 0x84, 0xc6, 0x18, 0x42, 0x08, 0x18, 0xc3, 0x9c, 0xf3, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x84,
+    0xef, 0x3c, 0x5a, 0xcb, 0x08, 0x61, 0x39, 0xe7, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0x21, 0x24,
+    0x8c, 0x71, 0x02, 0xff, 0xff, 0x87, 0x9c, 0xf3, 0x84, 0x30, 0xf7, 0x9e, 0xf7, 0xbe, 0xff, 0xdf,
+    0xff, 0xff, 0xbd, 0xd7, 0xde, 0xdb, 0x02, 0xff, 0xff, 0x88, 0xf7, 0x9e, 0xde, 0xdb, 0xb5, 0xb6,
+    0x9c, 0xd3, 0x7b, 0xcf, 0x4a, 0x69, 0x31, 0xa6, 0x29, 0x45, 0x21, 0x04, 0x01, 0x18, 0xc3, 0x80,
+    0x10, 0xa2, 0x01, 0x00, 0x21, 0x8e, 0x00, 0x41, 0x00, 0x20, 0x08, 0x61, 0x18, 0xc3, 0x10, 0xc3,
+    0x18, 0xe3, 0x21, 0x45, 0x29, 0x65, 0x31, 0xa6, 0x6b, 0x4d, 0x8c, 0x71, 0xad, 0x55, 0xce, 0x79,
+    0xe7, 0x1c, 0xf7, 0xbe, 0x03, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xb5, 0xb6,
+    0xd6, 0xba, 0x02, 0xff, 0xff, 0x85, 0x42, 0x28, 0x63, 0x0c, 0xff, 0xff, 0xa5, 0x14, 0x29, 0x65,
+    0xf7, 0xbe, 0x01, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x83, 0x8c, 0x51, 0x31, 0x86, 0xf7, 0xbe, 0xff,
+    0xff, 0x01, 0x31, 0x86, 0x80, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x83, 0xf7, 0xbe, 0x21, 0x24, 0x39,
+    0xc7, 0x7b, 0xcf, 0x79, 0x00, 0x00, 0x83, 0x18, 0xc3, 0x39, 0xc7, 0x19, 0x03, 0xf7, 0xbe, 0x07,
+    0xff, 0xff, 0x84, 0xde, 0xfb, 0x62, 0xeb, 0x21, 0x04, 0x18, 0xc3, 0x52, 0x89, 0x02, 0xff, 0xff,
+    0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x87, 0xad, 0x55, 0x08, 0x61, 0xde, 0xdb, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0x84, 0x10, 0x29, 0x45, 0x09, 0xff, 0xff, 0x84, 0xe7, 0x3c, 0xad, 0x75, 0x7b,
+    0xcf, 0x52, 0xaa, 0x29, 0x85, 0x19, 0x00, 0x00, 0x85, 0x10, 0xa2, 0x42, 0x08, 0x63, 0x2c, 0x94,
+    0x92, 0xce, 0x58, 0xf7, 0x9e, 0x05, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30, 0x18,
+    0xc3, 0xff, 0xff, 0xa5, 0x34, 0x31, 0xa6, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x87, 0xff, 0xff, 0x39,
+    0xc7, 0x42, 0x08, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0x39, 0xc7, 0xff, 0xdf, 0x08, 0xff, 0xff,
+    0x85, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x71, 0x00, 0x00, 0xad, 0x55, 0x08, 0x61, 0x7a, 0x00, 0x00,
+    0x84, 0x5a, 0xeb, 0x00, 0x00, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x88, 0xbd,
+    0xf7, 0x4a, 0x69, 0xe7, 0x1c, 0xce, 0x79, 0x00, 0x00, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0x01, 0xff, 0xdf, 0x89, 0xff, 0xff, 0x31, 0x86, 0x63, 0x2c, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xe7, 0x1c, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x84, 0xe7, 0x3c, 0xb5,
+    0xb6, 0x7b, 0xef, 0x39, 0xc7, 0x10, 0xa2, 0x08, 0x00, 0x00, 0x84, 0x10, 0x82, 0x08, 0xc5, 0x00,
+    0xa4, 0x11, 0x26, 0x3a, 0x8c, 0x04, 0x3a, 0x6c, 0x88, 0x32, 0x6c, 0x3a, 0x8c, 0x21, 0xc9, 0x00,
+    0xa4, 0x00, 0xc4, 0x10, 0xc4, 0x18, 0xe4, 0x20, 0xc3, 0x10, 0x61, 0x05, 0x00, 0x00, 0x85, 0x08,
+    0x41, 0x18, 0xe3, 0x5a, 0xeb, 0x9c, 0xf3, 0xd6, 0xba, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x86, 0xff,
+    0xdf, 0xef, 0x7d, 0xad, 0x75, 0xff, 0xdf, 0xef, 0x5d, 0x08, 0x41, 0xb5, 0xb6, 0x02, 0xff, 0xff,
+    0x87, 0xc6, 0x18, 0x00, 0x00, 0xb5, 0xb6, 0xf7, 0x9e, 0x20, 0xe3, 0x5a, 0xeb, 0x10, 0xa2, 0xef,
+    0x7d, 0x01, 0xff, 0xff, 0x83, 0x9c, 0xd3, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff,
+    0x83, 0xde, 0xfb, 0x10, 0x81, 0x73, 0x8e, 0x52, 0x8a, 0x7a, 0x00, 0x00, 0x83, 0x00, 0x20, 0x18,
+    0xe3, 0x00, 0x00, 0x7b, 0xcf, 0x04, 0xff, 0xff, 0x83, 0xf7, 0x9e, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xdf, 0x02, 0xff, 0xff, 0x82, 0x6b, 0x6d, 0x21, 0x24, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x84, 0xff,
+    0xdf, 0xff, 0xff, 0xad, 0x55, 0x00, 0x20, 0xde, 0xfb, 0x06, 0xff, 0xff, 0x83, 0xef, 0x7d, 0xad,
+    0x55, 0x5a, 0xeb, 0x21, 0x04, 0x04, 0x00, 0x00, 0x85, 0x08, 0x20, 0x00, 0x20, 0x31, 0xa7, 0x3a,
+    0x0a, 0x11, 0xec, 0x19, 0x67, 0x01, 0x00, 0x00, 0x82, 0x18, 0xa3, 0x3b, 0x52, 0x03, 0x57, 0x09,
+    0x03, 0x16, 0x01, 0x03, 0x36, 0x89, 0x1b, 0x55, 0x2b, 0x75, 0x33, 0x53, 0x22, 0xb0, 0x01, 0xcc,
+    0x21, 0xeb, 0x3a, 0x09, 0x18, 0xc3, 0x00, 0x20, 0x08, 0x20, 0x03, 0x00, 0x00, 0x83, 0x08, 0x41,
+    0x42, 0x28, 0x7b, 0xcf, 0xd6, 0x9a, 0x03, 0xff, 0xff, 0x92, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3,
+    0x10, 0xa2, 0x84, 0x10, 0xc5, 0xf7, 0x94, 0x92, 0x10, 0x82, 0x6b, 0x6d, 0xff, 0xff, 0x5a, 0xcb,
+    0x42, 0x08, 0xd6, 0x9a, 0x00, 0x00, 0xe7, 0x3c, 0xff, 0xff, 0xb5, 0x96, 0x00, 0x00, 0xce, 0x79,
+    0x03, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x52, 0xaa, 0x7a, 0x00,
+    0x00, 0x80, 0x08, 0x41, 0x01, 0x00, 0x00, 0x80, 0x9c, 0xd3, 0x04, 0xff, 0xff, 0x83, 0xef, 0x5d,
+    0x29, 0x65, 0x31, 0xa6, 0xd6, 0xba, 0x01, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x5d,
+    0x10, 0x82, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0xad, 0x75,
+    0xef, 0x7d, 0x03, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xbd, 0xd7, 0x6b, 0x4d, 0x10, 0xa2, 0x03, 0x00,
+    0x00, 0x89, 0x08, 0x20, 0x21, 0x04, 0x09, 0x06, 0x32, 0x8d, 0x33, 0x11, 0x02, 0xb3, 0x0b, 0x35,
+    0x13, 0x56, 0x03, 0x57, 0x3a, 0xad, 0x02, 0x00, 0x00, 0x84, 0x10, 0x81, 0x22, 0x6d, 0x13, 0x36,
+    0x02, 0xd5, 0x02, 0xf4, 0x0b, 0x02, 0xf5, 0x89, 0x03, 0x16, 0x03, 0x37, 0x0b, 0x56, 0x13, 0x56,
+    0x02, 0xf4, 0x12, 0xd2, 0x43, 0x10, 0x11, 0x68, 0x19, 0x05, 0x18, 0xa2, 0x03, 0x00, 0x00, 0x83,
+    0x08, 0x41, 0x42, 0x07, 0x94, 0xb2, 0xde, 0xfb, 0x03, 0xff, 0xff, 0x99, 0xb5, 0xb6, 0x42, 0x08,
+    0x39, 0xe7, 0x31, 0xa6, 0x94, 0x92, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20, 0xd6, 0x9a, 0xef, 0x5d,
+    0x18, 0xa2, 0xe7, 0x3c, 0xff, 0xdf, 0x21, 0x24, 0x7b, 0xcf, 0xff, 0xff, 0xef, 0x7d, 0x84, 0x30,
+    0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x5d, 0x63, 0x2c, 0x00, 0x00, 0x00, 0x20,
+    0x78, 0x00, 0x00, 0x83, 0x08, 0x61, 0x00, 0x00, 0x10, 0xa2, 0xbd, 0xd7, 0x01, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x02, 0xff, 0xff, 0x8b, 0xef, 0x7d, 0x29, 0x45, 0x4a, 0x69, 0x18, 0xc3, 0x84, 0x10,
+    0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x08, 0x61, 0xe7, 0x3c, 0x08, 0xff,
+    0xff, 0x82, 0xe7, 0x1c, 0x8c, 0x51, 0x39, 0xc7, 0x03, 0x00, 0x00, 0x86, 0x08, 0x41, 0x21, 0x25,
+    0x32, 0x4b, 0x0a, 0x4f, 0x2b, 0x74, 0x03, 0x56, 0x03, 0x16, 0x01, 0x03, 0x15, 0x83, 0x02, 0xf5,
+    0x02, 0xd4, 0x02, 0xf5, 0x32, 0x6c, 0x03, 0x00, 0x00, 0x82, 0x08, 0x00, 0x29, 0xc9, 0x1b, 0x55,
+    0x0d, 0x02, 0xf5, 0x80, 0x02, 0xf4, 0x02, 0x02, 0xf5, 0x88, 0x03, 0x15, 0x03, 0x16, 0x03, 0x36,
+    0x1b, 0x75, 0x1a, 0xf2, 0x1a, 0x2d, 0x31, 0xc8, 0x08, 0x41, 0x08, 0x20, 0x02, 0x00, 0x00, 0x82,
+    0x18, 0xc3, 0x5a, 0xeb, 0xc6, 0x18, 0x03, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x8d,
+    0xf7, 0x9e, 0x29, 0x45, 0x6b, 0x4d, 0xff, 0xff, 0xe7, 0x1c, 0x20, 0xe3, 0xf7, 0x9e, 0x84, 0x30,
+    0x18, 0xe3, 0xf7, 0xbe, 0xff, 0xff, 0x7b, 0xcf, 0x08, 0x61, 0xe7, 0x3c, 0x04, 0xff, 0xff, 0x83,
+    0x94, 0xb2, 0x00, 0x20, 0x00, 0x00, 0x08, 0x41, 0x75, 0x00, 0x00, 0x85, 0x10, 0x82, 0x00, 0x00,
+    0x29, 0x45, 0xce, 0x79, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x85, 0x4a, 0x69, 0x94, 0xb2,
+    0xc6, 0x18, 0x29, 0x45, 0x39, 0xc7, 0xce, 0x59, 0x02, 0xff, 0xff, 0x81, 0x21, 0x24, 0x52, 0xaa,
+    0x06, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x73, 0x8e, 0x10, 0xa2, 0x02, 0x00, 0x00, 0x87, 0x08, 0x40,
+    0x21, 0x45, 0x21, 0xea, 0x2b, 0x32, 0x03, 0x15, 0x0b, 0x36, 0x03, 0x16, 0x02, 0xd5, 0x02, 0x02,
+    0xf5, 0x88, 0x02, 0xf4, 0x02, 0xf5, 0x02, 0xd5, 0x03, 0x16, 0x3a, 0x8d, 0x00, 0x00, 0x10, 0xa2,
+    0x62, 0xeb, 0x00, 0x20, 0x01, 0x00, 0x00, 0x83, 0x29, 0x66, 0x1b, 0x33, 0x03, 0x16, 0x02, 0xf4,
+    0x13, 0x02, 0xf5, 0x85, 0x03, 0x36, 0x0b, 0x35, 0x13, 0x14, 0x32, 0xaf, 0x11, 0x47, 0x18, 0xa2,
+    0x03, 0x00, 0x00, 0x82, 0x42, 0x28, 0xad, 0x34, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x92, 0xff, 0xdf,
+    0xff, 0xff, 0xbd, 0xd7, 0x31, 0x86, 0xef, 0x7d, 0xff, 0xff, 0xe7, 0x1c, 0x21, 0x24, 0x9c, 0xf3,
+    0x08, 0x61, 0xad, 0x55, 0xff, 0xff, 0xb5, 0xb6, 0x00, 0x00, 0xbd, 0xd7, 0xff, 0xff, 0xce, 0x59,
+    0x84, 0x30, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xb5, 0xb6, 0x18, 0xc3, 0x00, 0x00, 0x08, 0x61,
+    0x73, 0x00, 0x00, 0x85, 0x10, 0xa2, 0x00, 0x00, 0x42, 0x08, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x01, 0xa5, 0x14, 0x8d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x83, 0xef, 0x4a,
+    0x49, 0xff, 0xff, 0xb5, 0x96, 0x00, 0x00, 0x08, 0x61, 0x7b, 0xcf, 0xf7, 0xbe, 0xff, 0xff, 0xbd,
+    0xf7, 0x7b, 0xae, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xd6, 0xba, 0x63,
+    0x0c, 0x10, 0x82, 0x02, 0x00, 0x00, 0x84, 0x08, 0x62, 0x29, 0xc9, 0x22, 0xb0, 0x1b, 0x55, 0x03,
+    0x36, 0x02, 0x02, 0xf5, 0x80, 0x02, 0xf4, 0x03, 0x02, 0xf5, 0x89, 0x03, 0x36, 0x0b, 0x56, 0x13,
+    0x35, 0x02, 0xf4, 0x2a, 0x2a, 0x00, 0x00, 0x10, 0xa2, 0xef, 0x5d, 0xb5, 0x96, 0x10, 0xa2, 0x01,
+    0x00, 0x00, 0x82, 0x18, 0xc3, 0x2a, 0xd0, 0x03, 0x36, 0x16, 0x02, 0xf5, 0x85, 0x03, 0x16, 0x13,
+    0x56, 0x1a, 0xf2, 0x2a, 0x4c, 0x18, 0xe4, 0x10, 0x40, 0x02, 0x00, 0x00, 0x82, 0x31, 0xa6, 0xad,
+    0x55, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x8b, 0xe7,
+    0x3c, 0x29, 0x65, 0x10, 0x82, 0x4a, 0x69, 0xff, 0xff, 0xef, 0x5d, 0x10, 0x82, 0x6b, 0x6d, 0xff,
+    0xff, 0xef, 0x7d, 0x21, 0x04, 0x52, 0x8a, 0x03, 0xff, 0xdf, 0x84, 0xff, 0xff, 0xce, 0x79, 0x29,
+    0x45, 0x00, 0x00, 0x10, 0x82, 0x71, 0x00, 0x00, 0x85, 0x10, 0xa2, 0x00, 0x00, 0x4a, 0x69, 0xe7,
+    0x3c, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x83, 0xf7, 0xbe, 0x18, 0xe3, 0x00, 0x20, 0xbd,
+    0xd7, 0x01, 0xff, 0xff, 0x88, 0xbd, 0xf7, 0x18, 0xc3, 0x73, 0xae, 0x20, 0xe3, 0x9c, 0xd3, 0xb5,
+    0xb6, 0x10, 0x82, 0x29, 0x45, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x82, 0xd6, 0x9a, 0x6b, 0x4d, 0x00, 0x20, 0x02, 0x00, 0x00, 0x82, 0x21, 0x04, 0x21, 0xeb, 0x23,
+    0x33, 0x01, 0x03, 0x16, 0x80, 0x02, 0xd5, 0x01, 0x02, 0xf5, 0x81, 0x02, 0xf4, 0x02, 0xf5, 0x02,
+    0x03, 0x16, 0x85, 0x23, 0x55, 0x2b, 0x32, 0x0a, 0x0d, 0x29, 0xea, 0x39, 0xc7, 0x10, 0xa2, 0x01,
+    0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0xba, 0xff, 0xff, 0xd6, 0x79, 0x31, 0xa6, 0x01, 0x00, 0x00,
+    0x82, 0x08, 0x40, 0x32, 0x8e, 0x0b, 0x36, 0x16, 0x02, 0xf5, 0x86, 0x02, 0xd5, 0x02, 0xf5, 0x03,
+    0x36, 0x13, 0x35, 0x2a, 0xd0, 0x21, 0x67, 0x08, 0x20, 0x02, 0x00, 0x00, 0x81, 0x39, 0xe7, 0xad,
+    0x55, 0x02, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x29, 0x65, 0x00, 0x20, 0xe7,
+    0x1c, 0xff, 0xff, 0x52, 0xaa, 0x29, 0x45, 0xf7, 0xbe, 0xff, 0xdf, 0x42, 0x28, 0x29, 0x65, 0x04,
+    0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xfb, 0x42, 0x28, 0x00, 0x00, 0x10, 0xa2, 0x6f,
+    0x00, 0x00, 0x85, 0x10, 0xa2, 0x00, 0x00, 0x5a, 0xeb, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0x03,
+    0xff, 0xff, 0x88, 0x73, 0x8e, 0x08, 0x41, 0x18, 0xe3, 0xd6, 0x9a, 0xff, 0xff, 0xef, 0x5d, 0x18,
+    0xe3, 0x29, 0x45, 0xd6, 0x9a, 0x01, 0xff, 0xff, 0x82, 0xde, 0xdb, 0xad, 0x55, 0xf7, 0x9e, 0x01,
+    0xff, 0xdf, 0x83, 0xff, 0xff, 0xef, 0x7d, 0x7b, 0xcf, 0x10, 0x82, 0x01, 0x00, 0x00, 0x84, 0x08,
+    0x20, 0x19, 0x04, 0x2a, 0x8e, 0x13, 0x14, 0x03, 0x36, 0x01, 0x02, 0xf5, 0x80, 0x02, 0xf4, 0x02,
+    0x02, 0xf5, 0x86, 0x03, 0x36, 0x13, 0x56, 0x0a, 0xb2, 0x3a, 0xef, 0x19, 0x67, 0x10, 0xc3, 0x18,
+    0xa2, 0x05, 0x00, 0x00, 0x81, 0x10, 0xa2, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0x63,
+    0x2c, 0x01, 0x00, 0x00, 0x82, 0x08, 0x20, 0x21, 0xea, 0x1b, 0x55, 0x16, 0x02, 0xf5, 0x80, 0x02,
+    0xf4, 0x01, 0x02, 0xf5, 0x84, 0x02, 0xf6, 0x13, 0x35, 0x12, 0xd1, 0x21, 0xa8, 0x10, 0x61, 0x02,
+    0x00, 0x00, 0x81, 0x41, 0xe7, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x97, 0xff, 0xdf, 0xff, 0xff, 0x6b,
+    0x6d, 0x84, 0x30, 0xff, 0xff, 0xa5, 0x14, 0x00, 0x00, 0xce, 0x59, 0xff, 0xff, 0x7b, 0xce, 0x00,
+    0x20, 0xce, 0x59, 0xd6, 0xba, 0xbd, 0xd7, 0xad, 0x55, 0x8c, 0x51, 0xad, 0x75, 0xff, 0xdf, 0xf7,
+    0xbe, 0xff, 0xff, 0xef, 0x5d, 0x42, 0x08, 0x00, 0x00, 0x10, 0xa2, 0x6d, 0x00, 0x00, 0x83, 0x10,
+    0xa2, 0x00, 0x00, 0x5a, 0xeb, 0xf7, 0xbe, 0x04, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff, 0xff, 0xbd,
+    0xf7, 0x39, 0xc7, 0x5a, 0xeb, 0x18, 0xc3, 0xe7, 0x3c, 0xff, 0xff, 0x42, 0x28, 0x8c, 0x30, 0xff,
+    0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x29, 0x45, 0x01, 0x00, 0x00, 0x84, 0x00,
+    0x20, 0x19, 0x04, 0x22, 0x6e, 0x1b, 0x55, 0x03, 0x16, 0x04, 0x02, 0xf5, 0x85, 0x03, 0x36, 0x03,
+    0x15, 0x2b, 0x33, 0x11, 0xeb, 0x31, 0xa7, 0x08, 0x40, 0x05, 0x00, 0x00, 0x85, 0x29, 0x44, 0x52,
+    0xaa, 0x6b, 0x4d, 0x94, 0x92, 0xbd, 0xf7, 0xf7, 0xbe, 0x03, 0xff, 0xff, 0x80, 0x8c, 0x71, 0x02,
+    0x00, 0x00, 0x83, 0x21, 0x25, 0x23, 0x33, 0x03, 0x16, 0x02, 0xf4, 0x12, 0x02, 0xf5, 0x01, 0x03,
+    0x16, 0x80, 0x02, 0xd5, 0x02, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x03, 0x36, 0x22, 0xf2, 0x19, 0xa8,
+    0x08, 0x20, 0x02, 0x00, 0x00, 0x81, 0x63, 0x2c, 0xe7, 0x1c, 0x03, 0xff, 0xff, 0x94, 0xd6, 0xba,
+    0x00, 0x20, 0x8c, 0x51, 0xff, 0xff, 0xa5, 0x13, 0x00, 0x00, 0x08, 0x41, 0x29, 0x45, 0x08, 0x61,
+    0x29, 0x65, 0x42, 0x08, 0x4a, 0x49, 0x73, 0x8e, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
+    0xef, 0x5d, 0x4a, 0x69, 0x00, 0x00, 0x10, 0xa2, 0x6b, 0x00, 0x00, 0x89, 0x10, 0xa2, 0x00, 0x00,
+    0x5a, 0xeb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xfb, 0x84, 0x10, 0xde, 0xdb,
+    0x01, 0xff, 0xff, 0x88, 0xff, 0xdf, 0x42, 0x08, 0xb5, 0x96, 0x4a, 0x69, 0x31, 0x85, 0xff, 0xff,
+    0x7b, 0xef, 0x29, 0x45, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x82, 0xff, 0xff, 0xd6,
+    0xba, 0x52, 0x8a, 0x04, 0x00, 0x00, 0x82, 0x10, 0xc4, 0x13, 0x56, 0x02, 0xd5, 0x01, 0x02, 0xf4,
+    0x01, 0x02, 0xf5, 0x84, 0x03, 0x56, 0x12, 0xf3, 0x2a, 0x8f, 0x19, 0x46, 0x10, 0x82, 0x03, 0x00,
+    0x00, 0x85, 0x08, 0x62, 0x29, 0x65, 0x63, 0x0c, 0xa5, 0x14, 0xd6, 0x9a, 0xef, 0x7d, 0x07, 0xff,
+    0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x75, 0x18, 0xe3, 0x01, 0x00, 0x00, 0x83, 0x18, 0xc3,
+    0x22, 0xd0, 0x03, 0x16, 0x02, 0xd5, 0x10, 0x02, 0xf5, 0x84, 0x03, 0x15, 0x42, 0xef, 0x0a, 0x90,
+    0x13, 0x56, 0x02, 0xf6, 0x04, 0x02, 0xf5, 0x83, 0x0b, 0x56, 0x2a, 0xd0, 0x21, 0x66, 0x08, 0x20,
+    0x01, 0x00, 0x00, 0x81, 0x10, 0xa2, 0x94, 0xb2, 0x01, 0xff, 0xff, 0x8a, 0xff, 0xdf, 0xd6, 0xba,
+    0x84, 0x30, 0xff, 0xff, 0xc6, 0x18, 0x00, 0x00, 0x84, 0x10, 0xde, 0xdb, 0x42, 0x08, 0x73, 0x8e,
+    0xff, 0xdf, 0x03, 0xff, 0xff, 0x80, 0xd6, 0xba, 0x01, 0xff, 0xdf, 0x84, 0xff, 0xff, 0xf7, 0xbe,
+    0x52, 0xaa, 0x00, 0x00, 0x10, 0xa2, 0x69, 0x00, 0x00, 0x85, 0x10, 0xa2, 0x00, 0x00, 0x52, 0xaa,
+    0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x8f, 0x6b, 0x4d, 0x00, 0x00, 0x18, 0xc3,
+    0x84, 0x30, 0xf7, 0xbe, 0xff, 0xff, 0x8c, 0x71, 0x5a, 0xcb, 0xff, 0xdf, 0x29, 0x45, 0x52, 0x8a,
+    0xbd, 0xf7, 0x52, 0xaa, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0x8c, 0x71,
+    0x10, 0xa2, 0x02, 0x00, 0x00, 0x81, 0x6b, 0x6d, 0x42, 0x28, 0x01, 0x00, 0x00, 0x87, 0x29, 0xe9,
+    0x0b, 0x36, 0x02, 0xd4, 0x03, 0x16, 0x03, 0x15, 0x2b, 0x33, 0x19, 0xca, 0x20, 0xe3, 0x03, 0x00,
+    0x00, 0x84, 0x08, 0x61, 0x52, 0x89, 0x94, 0x92, 0xce, 0x79, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x05, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xdb, 0x39, 0xc7, 0x01, 0x00,
+    0x00, 0x82, 0x10, 0x61, 0x2a, 0x6d, 0x13, 0x56, 0x0f, 0x02, 0xf5, 0x87, 0x03, 0x15, 0x22, 0xf2,
+    0x08, 0x20, 0x08, 0x00, 0x21, 0x67, 0x32, 0xcf, 0x13, 0x35, 0x03, 0x36, 0x03, 0x02, 0xf5, 0x84,
+    0x03, 0x16, 0x13, 0x56, 0x2a, 0x8f, 0x18, 0xe4, 0x00, 0x20, 0x01, 0x00, 0x00, 0x81, 0x4a, 0x69,
+    0xde, 0xdb, 0x02, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x18, 0xe3, 0x63, 0x0c, 0x01, 0xff, 0xff, 0x82,
+    0x4a, 0x49, 0x7b, 0xcf, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x8a, 0xff, 0xff, 0x94, 0x92, 0x08, 0x61,
+    0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x5d, 0x41, 0xe7, 0x00, 0x00, 0x10, 0xa2,
+    0x5d, 0x00, 0x00, 0x80, 0x08, 0x61, 0x08, 0x00, 0x00, 0x84, 0x08, 0x61, 0x00, 0x00, 0x42, 0x08,
+    0xef, 0x5d, 0xff, 0xff, 0x03, 0xff, 0xdf, 0x91, 0xce, 0x79, 0x18, 0xe3, 0x29, 0x25, 0x42, 0x08,
+    0x29, 0x24, 0xad, 0x75, 0xf7, 0xbe, 0x29, 0x65, 0xe7, 0x1c, 0xde, 0xfb, 0x18, 0xe3, 0xa5, 0x14,
+    0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0xba, 0x4a, 0x69, 0x02, 0x00, 0x00, 0x8b,
+    0x31, 0xa6, 0xb5, 0xb6, 0xff, 0xff, 0xe7, 0x1c, 0x18, 0xc3, 0x00, 0x00, 0x08, 0x00, 0x2a, 0x8e,
+    0x1b, 0x77, 0x1a, 0xb1, 0x31, 0xe9, 0x10, 0x61, 0x02, 0x00, 0x00, 0x83, 0x00, 0x20, 0x42, 0x08,
+    0x94, 0xb2, 0xde, 0xfb, 0x03, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x83, 0xff, 0xdf,
+    0xff, 0xff, 0xf7, 0xbe, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x84, 0x08, 0x00, 0x29, 0xe9, 0x13, 0x35,
+    0x02, 0xf6, 0x02, 0xf4, 0x0c, 0x02, 0xf5, 0x81, 0x03, 0x16, 0x2a, 0x0a, 0x02, 0x00, 0x00, 0x84,
+    0x10, 0x40, 0x21, 0x25, 0x22, 0x6e, 0x1b, 0x34, 0x03, 0x36, 0x02, 0x02, 0xf5, 0x83, 0x02, 0xd5,
+    0x03, 0x16, 0x23, 0x33, 0x08, 0x61, 0x02, 0x00, 0x00, 0x81, 0x10, 0xa2, 0x9c, 0xd3, 0x01, 0xff,
+    0xff, 0x82, 0xff, 0xdf, 0xc6, 0x38, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x88, 0x42, 0x08, 0x7b, 0xef,
+    0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xad, 0x55, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x3c, 0x42, 0x08, 0x00, 0x00, 0x08, 0x61, 0x5b, 0x00,
+    0x00, 0x81, 0x08, 0x61, 0x00, 0x00, 0x01, 0x00, 0x20, 0x05, 0x00, 0x00, 0x85, 0x08, 0x41, 0x00,
+    0x00, 0x21, 0x24, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x8a, 0xce, 0x59, 0x10,
+    0xa2, 0x94, 0x92, 0xa5, 0x34, 0x18, 0xe3, 0x52, 0xaa, 0x39, 0xe7, 0x84, 0x10, 0xff, 0xff, 0xef,
+    0x3c, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0xad, 0x55, 0x10, 0xa2, 0x01, 0x00, 0x00, 0x8b, 0x08,
+    0x61, 0x73, 0x8e, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x75, 0x08, 0x41, 0x00,
+    0x00, 0x00, 0x41, 0x19, 0x46, 0x10, 0x40, 0x02, 0x00, 0x00, 0x82, 0x18, 0xe3, 0x73, 0xae, 0xc6,
+    0x38, 0x03, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x81, 0x8c, 0x71, 0x08, 0x41, 0x01, 0x00, 0x00, 0x83, 0x19, 0x04, 0x12, 0xd2, 0x03, 0x36, 0x02,
+    0xf4, 0x0b, 0x02, 0xf5, 0x81, 0x1b, 0x34, 0x08, 0x82, 0x01, 0x00, 0x00, 0x80, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x87, 0x18, 0xe4, 0x22, 0x6d, 0x13, 0x35, 0x03, 0x16, 0x02, 0xf5, 0x02, 0xf4, 0x03,
+    0x36, 0x19, 0xa9, 0x05, 0x00, 0x00, 0x81, 0x6b, 0x6d, 0xf7, 0xbe, 0x03, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0x39, 0xa6, 0x9c, 0xf3, 0x01, 0xff, 0xff, 0x82, 0xb5, 0x96, 0x00, 0x00, 0x94, 0x91, 0x04,
+    0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x5d, 0x29, 0x44, 0x00, 0x00, 0x08, 0x41, 0x06,
+    0x00, 0x00, 0x81, 0x00, 0x20, 0x08, 0x61, 0x50, 0x00, 0x00, 0x85, 0x08, 0x41, 0x00, 0x00, 0x29,
+    0x45, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0x03, 0x00, 0x00, 0x93, 0x00, 0x20, 0x00, 0x00, 0x10,
+    0xa2, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x94, 0x92, 0x5a, 0xcb, 0x6b,
+    0x6d, 0xbd, 0xf7, 0xff, 0xff, 0xb5, 0x96, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0x6b, 0x6d, 0x08,
+    0x61, 0x39, 0xe7, 0x03, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x7b, 0xef, 0x03, 0x00, 0x00, 0x80, 0x52,
+    0xaa, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0x63, 0x2c, 0x04, 0x00, 0x00,
+    0x82, 0x39, 0xc7, 0x94, 0x92, 0xf7, 0x9e, 0x1b, 0xff, 0xff, 0x81, 0xbd, 0xd7, 0x18, 0xe3, 0x01,
+    0x00, 0x00, 0x82, 0x10, 0x61, 0x2a, 0xd0, 0x03, 0x36, 0x09, 0x02, 0xf5, 0x88, 0x02, 0xf4, 0x03,
+    0x36, 0x22, 0x2d, 0x08, 0x00, 0x00, 0x00, 0x84, 0x10, 0xce, 0x59, 0x52, 0x8a, 0x08, 0x61, 0x01,
+    0x00, 0x00, 0x8a, 0x08, 0x00, 0x21, 0x45, 0x2a, 0xaf, 0x13, 0x35, 0x03, 0x37, 0x2a, 0xaf, 0x08,
+    0x20, 0x00, 0x00, 0x18, 0xe3, 0xc6, 0x38, 0x73, 0x8e, 0x02, 0x00, 0x00, 0x8d, 0x39, 0xa6, 0xd6,
+    0x9a, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x29, 0x45, 0xa5, 0x13, 0xff, 0xff, 0xc6,
+    0x18, 0x00, 0x00, 0x7b, 0xcf, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff,
+    0xff, 0xd6, 0x9a, 0x18, 0xc3, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x01, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x80, 0x08, 0x41, 0x4d, 0x00, 0x00, 0x85, 0x00, 0x20, 0x08, 0x41, 0x21, 0x24, 0xde,
+    0xfb, 0xce, 0x59, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x80, 0x08, 0x41, 0x02, 0x00, 0x00, 0x97, 0x00,
+    0x20, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x3c, 0x31, 0xa6, 0x21, 0x24, 0x6b,
+    0x6d, 0x39, 0xc7, 0x00, 0x20, 0x73, 0xae, 0xff, 0xff, 0x94, 0x92, 0x00, 0x00, 0xce, 0x59, 0xff,
+    0xff, 0xce, 0x59, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x7d, 0x52, 0x8a, 0x02,
+    0x00, 0x00, 0x8a, 0x08, 0x40, 0x00, 0x00, 0x00, 0x20, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0xef, 0x7d, 0x73, 0xae, 0x18, 0xe3, 0x00, 0x20, 0x01, 0x00, 0x00, 0x82, 0x29, 0x65, 0xa5,
+    0x14, 0xf7, 0xbe, 0x1e, 0xff, 0xff, 0x81, 0xde, 0xdb, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x82, 0x10,
+    0x40, 0x22, 0x4c, 0x03, 0x36, 0x09, 0x02, 0xf5, 0x84, 0x0b, 0x15, 0x29, 0x45, 0x00, 0x00, 0x08,
+    0x41, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x63, 0x2c, 0x08, 0x61, 0x01, 0x00, 0x00,
+    0x83, 0x08, 0x40, 0x21, 0x67, 0x3b, 0x10, 0x10, 0x82, 0x01, 0x00, 0x00, 0x80, 0xad, 0x75, 0x01,
+    0xff, 0xff, 0x81, 0xad, 0x55, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x10, 0x82, 0xad, 0x55, 0xff,
+    0xff, 0x01, 0xff, 0xdf, 0x86, 0x8c, 0x51, 0xb5, 0xb6, 0xce, 0x79, 0x08, 0x41, 0x73, 0xae, 0xff,
+    0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x81, 0xef, 0x5d, 0xbd, 0xd7, 0x01, 0xff, 0xdf, 0x82, 0xff,
+    0xff, 0xbd, 0xf7, 0x08, 0x41, 0x03, 0x00, 0x00, 0x80, 0x10, 0x82, 0x01, 0x00, 0x00, 0x84, 0x4a,
+    0x69, 0xc6, 0x38, 0x39, 0xc7, 0x00, 0x00, 0x08, 0x41, 0x4c, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00,
+    0x00, 0xb5, 0x96, 0x02, 0xff, 0xff, 0x8d, 0x9c, 0xf3, 0x29, 0x45, 0x00, 0x00, 0x08, 0x41, 0x10,
+    0xa2, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x4a, 0x69, 0x42,
+    0x28, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x86, 0xa5, 0x34, 0x00, 0x00, 0x7b, 0xef, 0xff, 0xff, 0x73,
+    0x8e, 0x00, 0x20, 0xd6, 0xba, 0x01, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xdb, 0x31,
+    0xa6, 0x01, 0x00, 0x00, 0x82, 0x10, 0xa2, 0x22, 0x6e, 0x2a, 0xaf, 0x01, 0x00, 0x00, 0x84, 0x18,
+    0xc3, 0xde, 0xfb, 0xff, 0xff, 0xa5, 0x34, 0x29, 0x65, 0x02, 0x00, 0x00, 0x82, 0x29, 0x65, 0x9c,
+    0xf3, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x1c, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff,
+    0xff, 0xf7, 0x9e, 0x6b, 0x6d, 0x02, 0x00, 0x00, 0x83, 0x11, 0x67, 0x1b, 0x35, 0x02, 0xf5, 0x02,
+    0xf4, 0x06, 0x02, 0xf5, 0x80, 0x2a, 0xf1, 0x01, 0x00, 0x00, 0x81, 0x52, 0xaa, 0xff, 0xff, 0x01,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0xce, 0x79, 0x5a, 0xeb, 0x05, 0x00, 0x00, 0x81, 0x7b, 0xef,
+    0xff, 0xff, 0x01, 0xff, 0xdf, 0x82, 0xff, 0xff, 0xd6, 0x9a, 0x42, 0x08, 0x02, 0x00, 0x00, 0x80,
+    0x8c, 0x50, 0x02, 0xff, 0xff, 0x82, 0xef, 0x5d, 0x18, 0xc3, 0x52, 0xaa, 0x03, 0xff, 0xff, 0x82,
+    0xff, 0xdf, 0xff, 0xff, 0xf7, 0x9e, 0x01, 0x31, 0x86, 0x85, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf,
+    0xff, 0xff, 0xa5, 0x34, 0x00, 0x20, 0x01, 0x10, 0x82, 0x01, 0x00, 0x00, 0x81, 0x39, 0xc7, 0xb5,
+    0x96, 0x01, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x20, 0x4b, 0x00, 0x00, 0x83, 0x08,
+    0x61, 0x00, 0x00, 0x73, 0x8e, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x85, 0xef, 0x5d,
+    0x84, 0x30, 0x08, 0x61, 0x00, 0x00, 0x63, 0x2c, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x85, 0xff, 0xff,
+    0xde, 0xdb, 0x10, 0xa2, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x8a, 0xa5, 0x34,
+    0x00, 0x20, 0xde, 0xfb, 0xff, 0xff, 0x8c, 0x51, 0xde, 0xfb, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff,
+    0xbd, 0xf7, 0x18, 0xe3, 0x01, 0x00, 0x00, 0x81, 0x21, 0x04, 0x22, 0xf2, 0x01, 0x03, 0x16, 0x80,
+    0x21, 0xa9, 0x01, 0x00, 0x00, 0x81, 0x39, 0xe7, 0x63, 0x0c, 0x02, 0x00, 0x00, 0x82, 0x10, 0x82,
+    0x8c, 0x51, 0xef, 0x7d, 0x25, 0xff, 0xff, 0x81, 0x94, 0x92, 0x00, 0x20, 0x01, 0x00, 0x00, 0x82,
+    0x21, 0x25, 0x23, 0x33, 0x03, 0x16, 0x04, 0x02, 0xf5, 0x82, 0x02, 0xf4, 0x0b, 0x36, 0x11, 0x47,
+    0x01, 0x00, 0x00, 0x82, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x81, 0xbd, 0xf7,
+    0x39, 0xe7, 0x03, 0x00, 0x00, 0x80, 0xad, 0x55, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff,
+    0xad, 0x75, 0x03, 0x00, 0x00, 0x80, 0x73, 0x8e, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xbd, 0xd7,
+    0xf7, 0xbe, 0x02, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xfb, 0x29, 0x65, 0x31, 0xa6,
+    0xe7, 0x1c, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x01, 0x00, 0x00, 0x82,
+    0x18, 0xe3, 0x94, 0xb2, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x51,
+    0x00, 0x00, 0x10, 0x82, 0x49, 0x00, 0x00, 0x84, 0x00, 0x20, 0x00, 0x00, 0x31, 0xa6, 0xef, 0x7d,
+    0xff, 0xdf, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xd6, 0x9a, 0x73, 0xae,
+    0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xbd, 0xf7, 0x10, 0x82, 0xff, 0xdf,
+    0x04, 0xff, 0xff, 0x81, 0x31, 0x86, 0xb5, 0x96, 0x02, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff,
+    0xb5, 0x96, 0x10, 0x81, 0x01, 0x00, 0x00, 0x86, 0x21, 0x26, 0x23, 0x54, 0x02, 0xf6, 0x02, 0xf4,
+    0x02, 0xf5, 0x13, 0x55, 0x29, 0x67, 0x04, 0x00, 0x00, 0x81, 0x5a, 0xcb, 0xd6, 0xba, 0x01, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x23, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x59, 0x21, 0x24,
+    0x01, 0x00, 0x00, 0x82, 0x10, 0x82, 0x1a, 0x6e, 0x0b, 0x15, 0x04, 0x02, 0xf5, 0x84, 0x1b, 0x13,
+    0x18, 0xa2, 0x00, 0x00, 0x31, 0xa6, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x82, 0xff, 0xdf, 0x9c, 0xd3,
+    0x18, 0xc2, 0x02, 0x00, 0x00, 0x81, 0x6b, 0x6d, 0xf7, 0x9d, 0x01, 0xff, 0xff, 0x81, 0xde, 0xfb,
+    0x18, 0xc3, 0x04, 0x00, 0x00, 0x81, 0x5a, 0xeb, 0xf7, 0xbe, 0x04, 0xff, 0xff, 0x85, 0xff, 0xdf,
+    0xff, 0xff, 0xd6, 0xba, 0x18, 0xe3, 0x39, 0xe7, 0xf7, 0xbe, 0x03, 0xff, 0xff, 0x80, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x82, 0x63, 0x0c, 0x6b, 0x4d, 0xe7, 0x3c, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xf7, 0xbe, 0x42, 0x28, 0x00, 0x00, 0x00, 0x20, 0x48, 0x00,
+    0x00, 0x01, 0x08, 0x41, 0x82, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x87, 0xff,
+    0xdf, 0xff, 0xff, 0xce, 0x79, 0xe7, 0x3c, 0xef, 0x5d, 0x10, 0x82, 0xa5, 0x14, 0xff, 0xff, 0x01,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0x29, 0x65, 0xbd, 0xd7, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x81,
+    0xff, 0xff, 0x9c, 0xd3, 0x02, 0x00, 0x00, 0x81, 0x19, 0xa9, 0x13, 0x35, 0x03, 0x02, 0xf5, 0x86,
+    0x0b, 0x56, 0x32, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x18, 0xe3, 0xa5, 0x34, 0x27, 0xff,
+    0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x9c, 0xd3, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82,
+    0x10, 0x41, 0x32, 0x6d, 0x0b, 0x15, 0x03, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x2a, 0x2c, 0x01, 0x00,
+    0x00, 0x82, 0x94, 0x92, 0xff, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x81, 0xde, 0xfb, 0x5a, 0xcb,
+    0x02, 0x00, 0x00, 0x83, 0x31, 0xa6, 0xd6, 0x9a, 0xff, 0xff, 0x4a, 0x49, 0x01, 0x00, 0x00, 0x82,
+    0x19, 0xc9, 0x1a, 0xd0, 0x18, 0xa1, 0x01, 0x00, 0x00, 0x83, 0x4a, 0x69, 0xf7, 0x9e, 0xff, 0xff,
+    0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xc6, 0x38, 0x00, 0x00, 0x5a, 0xeb, 0xff, 0xdf, 0x0a, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0xba, 0x10, 0x81,
+    0x08, 0x41, 0x47, 0x00, 0x00, 0x84, 0x08, 0x41, 0x00, 0x00, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf,
+    0x07, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x87, 0xff, 0xff, 0xde, 0xdb, 0x10, 0xa2, 0xb5, 0xb6, 0xff,
+    0xff, 0x7b, 0xef, 0x08, 0x41, 0xc6, 0x38, 0x02, 0xff, 0xff, 0x86, 0x9c, 0xd3, 0x20, 0xe3, 0xef,
+    0x7d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xf3, 0x01, 0x00, 0x00, 0x82, 0x08, 0x20, 0x1a,
+    0x0b, 0x0b, 0x35, 0x01, 0x02, 0xf5, 0x83, 0x02, 0xf4, 0x03, 0x16, 0x12, 0xf3, 0x19, 0x66, 0x02,
+    0x00, 0x00, 0x81, 0x5a, 0xcb, 0xe7, 0x1c, 0x29, 0xff, 0xff, 0x81, 0xd6, 0xba, 0x4a, 0x28, 0x02,
+    0x00, 0x00, 0x82, 0x21, 0x66, 0x23, 0x12, 0x03, 0x36, 0x04, 0x02, 0xf5, 0x84, 0x0b, 0x35, 0x18,
+    0xe3, 0x00, 0x00, 0x18, 0xc3, 0xe7, 0x1c, 0x09, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x81, 0x9c, 0xd3, 0x18, 0xe3, 0x01, 0x00, 0x00, 0x81, 0x21, 0x04, 0x52, 0x89, 0x01, 0x00, 0x00,
+    0x84, 0x18, 0xc4, 0x0b, 0x14, 0x03, 0x16, 0x22, 0xf1, 0x20, 0xe4, 0x01, 0x00, 0x00, 0x87, 0x4a,
+    0x49, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96, 0x08, 0x41, 0x63, 0x0c, 0x04,
+    0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x3c, 0xf7, 0xbe, 0x09, 0xff, 0xff, 0x84, 0xff,
+    0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x08, 0x41, 0x45, 0x00, 0x00, 0x83, 0x08, 0x41, 0x00,
+    0x00, 0x31, 0xa6, 0xf7, 0x9e, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf, 0x39, 0xe7, 0x6b, 0x6d, 0x01,
+    0xff, 0xdf, 0x8b, 0xff, 0xff, 0x6b, 0x4d, 0x00, 0x00, 0x73, 0xae, 0xa5, 0x34, 0x73, 0x8e, 0x10,
+    0xa2, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x01, 0x00, 0x00, 0x82, 0x08,
+    0x20, 0x22, 0x4c, 0x03, 0x36, 0x02, 0x02, 0xf5, 0x82, 0x03, 0x16, 0x2b, 0x11, 0x10, 0xa3, 0x01,
+    0x00, 0x00, 0x81, 0x08, 0x61, 0x9c, 0xb2, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x24, 0xff, 0xff,
+    0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbe, 0x94, 0x92, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x10,
+    0x82, 0x2a, 0x4c, 0x13, 0x55, 0x05, 0x02, 0xf5, 0x81, 0x02, 0xf6, 0x22, 0xaf, 0x01, 0x00, 0x00,
+    0x80, 0x63, 0x2c, 0x0c, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x39, 0xe7, 0x03,
+    0x00, 0x00, 0x86, 0x10, 0x82, 0x23, 0x12, 0x03, 0x15, 0x02, 0xf4, 0x02, 0xf6, 0x23, 0x33, 0x20,
+    0xe3, 0x01, 0x00, 0x00, 0x81, 0x4a, 0x49, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x81, 0x8c, 0x51, 0x73,
+    0xae, 0x06, 0xff, 0xff, 0x82, 0xa5, 0x34, 0x08, 0x61, 0xbd, 0xd7, 0x01, 0xff, 0xdf, 0x09, 0xff,
+    0xff, 0x83, 0xff, 0xdf, 0x4a, 0x69, 0x00, 0x00, 0x08, 0x41, 0x44, 0x00, 0x00, 0x84, 0x00, 0x20,
+    0x08, 0x61, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff,
+    0x73, 0x8e, 0x00, 0x00, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x88, 0xa5, 0x34,
+    0x4a, 0x69, 0x31, 0xa6, 0x5a, 0xcb, 0xce, 0x79, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x55,
+    0x01, 0x00, 0x00, 0x82, 0x08, 0x20, 0x2a, 0x4c, 0x03, 0x36, 0x02, 0x02, 0xf5, 0x82, 0x03, 0x16,
+    0x2a, 0xcf, 0x10, 0x61, 0x01, 0x00, 0x00, 0x81, 0x29, 0x65, 0xc6, 0x38, 0x29, 0xff, 0xff, 0x81,
+    0xce, 0x59, 0x42, 0x08, 0x01, 0x00, 0x00, 0x83, 0x08, 0x00, 0x21, 0x46, 0x23, 0x12, 0x03, 0x16,
+    0x05, 0x02, 0xf5, 0x85, 0x02, 0xd5, 0x13, 0x56, 0x19, 0x47, 0x00, 0x00, 0x00, 0x20, 0xce, 0x59,
+    0x0d, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x73, 0x8e, 0x02, 0x00, 0x00, 0x81,
+    0x29, 0x86, 0x0b, 0x35, 0x01, 0x02, 0xf5, 0x83, 0x02, 0xf4, 0x02, 0xf6, 0x2b, 0x33, 0x20, 0xe3,
+    0x01, 0x00, 0x00, 0x81, 0x52, 0x8a, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x83, 0x73, 0x8e, 0x00, 0x00, 0x7b, 0xef, 0xf7, 0x9e, 0x0a, 0xff, 0xff, 0x84, 0xff, 0xdf,
+    0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x20, 0x43, 0x00, 0x00, 0x84, 0x08, 0x61, 0x00, 0x00,
+    0x73, 0xae, 0xff, 0xff, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x84, 0xad, 0x55, 0x18, 0xa2, 0x52, 0xaa,
+    0x00, 0x00, 0x9c, 0xd3, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x87, 0xff, 0xdf,
+    0xff, 0xff, 0xbd, 0xd7, 0x08, 0x61, 0x00, 0x00, 0x08, 0x20, 0x2a, 0x4c, 0x03, 0x36, 0x02, 0x02,
+    0xf5, 0x82, 0x0b, 0x36, 0x2a, 0x8e, 0x10, 0x40, 0x01, 0x00, 0x00, 0x83, 0x52, 0xaa, 0xe7, 0x3c,
+    0xff, 0xff, 0xff, 0xdf, 0x24, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x8c, 0x51,
+    0x08, 0x61, 0x01, 0x00, 0x00, 0x82, 0x10, 0x81, 0x2a, 0x6d, 0x13, 0x35, 0x07, 0x02, 0xf5, 0x84,
+    0x03, 0x16, 0x1a, 0xd2, 0x18, 0xa2, 0x00, 0x00, 0x39, 0xe7, 0x12, 0xff, 0xff, 0x81, 0x9c, 0xf3,
+    0x08, 0x41, 0x01, 0x00, 0x00, 0x87, 0x19, 0x25, 0x13, 0x35, 0x02, 0xf5, 0x02, 0xf4, 0x02, 0xf5,
+    0x02, 0xf6, 0x2b, 0x33, 0x20, 0xe3, 0x01, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x01, 0xff, 0xdf, 0x02,
+    0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x3c, 0x42, 0x28, 0x18, 0xc3, 0xb5, 0xb6, 0x01,
+    0xff, 0xff, 0x81, 0xad, 0x55, 0xe7, 0x1c, 0x09, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x7b,
+    0xcf, 0x00, 0x00, 0x08, 0x61, 0x43, 0x00, 0x00, 0x81, 0x21, 0x04, 0xef, 0x7d, 0x0b, 0xff, 0xff,
+    0x89, 0xde, 0xfb, 0x10, 0x82, 0xa5, 0x14, 0xff, 0xff, 0x8c, 0x71, 0x00, 0x20, 0x63, 0x0c, 0xf7,
+    0xbe, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0xba, 0x18,
+    0xc3, 0x00, 0x00, 0x08, 0x00, 0x22, 0x4c, 0x03, 0x36, 0x02, 0x02, 0xf5, 0x82, 0x0b, 0x36, 0x21,
+    0xeb, 0x08, 0x40, 0x01, 0x00, 0x00, 0x83, 0x6b, 0x6d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x26,
+    0xff, 0xff, 0x81, 0xce, 0x79, 0x42, 0x08, 0x01, 0x00, 0x00, 0x83, 0x08, 0x00, 0x21, 0x66, 0x22,
+    0xf2, 0x03, 0x36, 0x08, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x2a, 0x2b, 0x01, 0x00, 0x00, 0x82, 0xa5,
+    0x14, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x81, 0xbd, 0xd7, 0x10, 0xa2, 0x01, 0x00, 0x00,
+    0x81, 0x10, 0xc4, 0x23, 0x33, 0x02, 0x02, 0xf5, 0x82, 0x02, 0xf6, 0x2b, 0x33, 0x20, 0xe3, 0x01,
+    0x00, 0x00, 0x82, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x8a, 0xc6, 0x18, 0x18,
+    0xc3, 0x39, 0xe7, 0xe7, 0x1c, 0xff, 0xff, 0xe7, 0x1c, 0x5a, 0xeb, 0x00, 0x00, 0x8c, 0x71, 0xff,
+    0xff, 0xff, 0xdf, 0x09, 0xff, 0xff, 0x81, 0xef, 0x5d, 0x21, 0x24, 0x42, 0x00, 0x00, 0x84, 0x10,
+    0x82, 0x00, 0x00, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0xb5,
+    0x96, 0x02, 0xff, 0xff, 0x83, 0xce, 0x79, 0x29, 0x45, 0x21, 0x24, 0xd6, 0x9a, 0x04, 0xff, 0xff,
+    0x81, 0xef, 0x5d, 0x29, 0x45, 0x01, 0x00, 0x00, 0x81, 0x19, 0xa8, 0x03, 0x36, 0x02, 0x02, 0xf5,
+    0x81, 0x0b, 0x36, 0x19, 0xea, 0x02, 0x00, 0x00, 0x80, 0x8c, 0x51, 0x1d, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x07, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x8c, 0x51, 0x08, 0x61, 0x01,
+    0x00, 0x00, 0x82, 0x10, 0x81, 0x2a, 0x2c, 0x13, 0x55, 0x0a, 0x02, 0xf5, 0x84, 0x1b, 0x34, 0x10,
+    0xc3, 0x00, 0x00, 0x21, 0x04, 0xef, 0x7d, 0x12, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xd6,
+    0xba, 0x21, 0x04, 0x01, 0x00, 0x00, 0x82, 0x18, 0xc3, 0x23, 0x33, 0x03, 0x16, 0x01, 0x02, 0xf5,
+    0x82, 0x02, 0xf6, 0x22, 0xf1, 0x18, 0x82, 0x01, 0x00, 0x00, 0x86, 0x9c, 0xf3, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0x6b, 0x4c, 0x01, 0xff, 0xff, 0x84, 0xa5, 0x34, 0x08,
+    0x61, 0x18, 0xc3, 0x00, 0x00, 0xd6, 0x9a, 0x0a, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x9c,
+    0xd3, 0x00, 0x00, 0x08, 0x61, 0x3f, 0x00, 0x00, 0x01, 0x00, 0x20, 0x80, 0x42, 0x28, 0x01, 0xff,
+    0xdf, 0x0a, 0xff, 0xff, 0x81, 0xa5, 0x14, 0xad, 0x75, 0x01, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x86,
+    0xff, 0xff, 0xf7, 0xbe, 0x63, 0x0c, 0x00, 0x20, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x80, 0x4a, 0x49, 0x01, 0x00, 0x00, 0x81, 0x19, 0x26, 0x13, 0x56, 0x02, 0x02, 0xf5, 0x81,
+    0x0b, 0x36, 0x21, 0xea, 0x01, 0x00, 0x00, 0x83, 0x00, 0x20, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf,
+    0x1e, 0xff, 0xff, 0x85, 0xe7, 0x1c, 0xbd, 0xf7, 0x9c, 0xd3, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x81, 0xce, 0x79, 0x42, 0x08, 0x01, 0x00, 0x00, 0x83, 0x08, 0x00, 0x21, 0x45,
+    0x23, 0x12, 0x03, 0x16, 0x0a, 0x02, 0xf5, 0x86, 0x03, 0x16, 0x22, 0x6d, 0x08, 0x20, 0x00, 0x00,
+    0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x12, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x1c,
+    0x42, 0x08, 0x01, 0x00, 0x00, 0x81, 0x18, 0xc3, 0x23, 0x33, 0x01, 0x02, 0xf5, 0x86, 0x02, 0xf4,
+    0x03, 0x16, 0x12, 0x6f, 0x08, 0x20, 0x00, 0x00, 0x08, 0x61, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x8a,
+    0x9c, 0xf3, 0x94, 0xb2, 0xff, 0xff, 0xef, 0x7d, 0x4a, 0x49, 0x08, 0x61, 0x9c, 0xd3, 0x73, 0x8d,
+    0x42, 0x08, 0xff, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xef, 0x7d, 0x29, 0x65, 0x00, 0x20,
+    0x41, 0x00, 0x00, 0x82, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x83, 0x84, 0x10,
+    0x00, 0x00, 0x52, 0xaa, 0xe7, 0x3c, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x85,
+    0x94, 0xb2, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81,
+    0x21, 0x25, 0x23, 0x55, 0x02, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x21, 0xea, 0x01, 0x00, 0x00, 0x83,
+    0x00, 0x20, 0xad, 0x54, 0xff, 0xff, 0xff, 0xdf, 0x17, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff,
+    0xff, 0x87, 0xef, 0x7d, 0xbd, 0xd7, 0x73, 0x8e, 0x4a, 0x49, 0x18, 0xc3, 0x00, 0x00, 0x08, 0x41,
+    0xde, 0xdb, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0x8c, 0x71, 0x10, 0x82, 0x01, 0x00, 0x00, 0x84,
+    0x10, 0x61, 0x2a, 0x6c, 0x13, 0x35, 0x02, 0xf5, 0x02, 0xf4, 0x09, 0x02, 0xf5, 0x82, 0x02, 0xd5,
+    0x13, 0x55, 0x21, 0x46, 0x01, 0x00, 0x00, 0x80, 0xd6, 0xba, 0x15, 0xff, 0xff, 0x83, 0xff, 0xdf,
+    0xff, 0xff, 0xef, 0x5d, 0x42, 0x08, 0x01, 0x00, 0x00, 0x82, 0x10, 0xc3, 0x13, 0x14, 0x03, 0x15,
+    0x01, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x2a, 0x4d, 0x01, 0x00, 0x00, 0x81, 0x21, 0x03, 0xe7, 0x1c,
+    0x02, 0xff, 0xff, 0x86, 0x9c, 0xd3, 0x18, 0xe3, 0x39, 0xe7, 0xd6, 0x9a, 0xff, 0xdf, 0x18, 0xc3,
+    0xad, 0x75, 0x0c, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x08, 0x61,
+    0x3d, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x4a, 0x69, 0x0e, 0xff, 0xff, 0x83, 0xce, 0x59,
+    0x31, 0x86, 0x00, 0x20, 0x94, 0x92, 0x05, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x55,
+    0x01, 0x00, 0x00, 0x81, 0x18, 0xc2, 0x23, 0x13, 0x02, 0x02, 0xf5, 0x87, 0x03, 0x16, 0x2a, 0x8e,
+    0x08, 0x20, 0x00, 0x00, 0x00, 0x20, 0xad, 0x54, 0xff, 0xff, 0xff, 0xdf, 0x19, 0xff, 0xff, 0x83,
+    0xf7, 0xbe, 0xb5, 0xb6, 0x63, 0x2c, 0x18, 0xc3, 0x04, 0x00, 0x00, 0x84, 0x10, 0xa2, 0xde, 0xdb,
+    0xff, 0xff, 0xce, 0x79, 0x42, 0x28, 0x02, 0x00, 0x00, 0x82, 0x21, 0x66, 0x22, 0xf1, 0x03, 0x36,
+    0x0c, 0x02, 0xf5, 0x86, 0x03, 0x16, 0x12, 0xb0, 0x08, 0x20, 0x00, 0x00, 0x5a, 0xeb, 0xff, 0xff,
+    0xff, 0xdf, 0x17, 0xff, 0xff, 0x81, 0xef, 0x7d, 0x42, 0x08, 0x01, 0x00, 0x00, 0x81, 0x19, 0x25,
+    0x13, 0x14, 0x02, 0x02, 0xf5, 0x81, 0x13, 0x56, 0x29, 0xea, 0x01, 0x00, 0x00, 0x80, 0x42, 0x08,
+    0x01, 0xff, 0xdf, 0x82, 0xff, 0xff, 0x52, 0xaa, 0x7b, 0xef, 0x01, 0xff, 0xff, 0x86, 0x94, 0x92,
+    0x21, 0x04, 0xf7, 0xbe, 0xff, 0xff, 0xce, 0x79, 0x29, 0x45, 0xb5, 0x96, 0x0a, 0xff, 0xff, 0x81,
+    0xf7, 0x9e, 0x21, 0x24, 0x3e, 0x00, 0x00, 0x84, 0x10, 0xa2, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff,
+    0xff, 0xdf, 0x0e, 0xff, 0xff, 0x83, 0x8c, 0x71, 0x10, 0x82, 0x42, 0x28, 0xef, 0x5d, 0x02, 0xff,
+    0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xba, 0x10, 0xa2, 0x00, 0x00, 0x08, 0x40, 0x22, 0xb0,
+    0x03, 0x16, 0x01, 0x02, 0xf5, 0x82, 0x03, 0x16, 0x2a, 0xcf, 0x10, 0x40, 0x01, 0x00, 0x00, 0x82,
+    0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x18, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0x84, 0x10, 0x31, 0xa6,
+    0x03, 0x00, 0x00, 0x87, 0x08, 0x40, 0x10, 0xa2, 0x18, 0xe3, 0x00, 0x00, 0x10, 0xa2, 0xd6, 0xba,
+    0x94, 0xb2, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x10, 0x81, 0x2a, 0x2c, 0x13, 0x55, 0x0e, 0x02,
+    0xf5, 0x81, 0x03, 0x16, 0x32, 0x0a, 0x01, 0x00, 0x00, 0x80, 0x83, 0xef, 0x18, 0xff, 0xff, 0x83,
+    0xff, 0xdf, 0xff, 0xff, 0xef, 0x5d, 0x29, 0x45, 0x01, 0x00, 0x00, 0x82, 0x29, 0xa8, 0x0b, 0x35,
+    0x02, 0xd5, 0x01, 0x02, 0xf5, 0x81, 0x13, 0x55, 0x29, 0x66, 0x01, 0x00, 0x00, 0x80, 0x7b, 0xef,
+    0x04, 0xff, 0xff, 0x87, 0xff, 0xdf, 0x31, 0x86, 0x84, 0x30, 0xff, 0xff, 0x7b, 0xef, 0x08, 0x40,
+    0x5a, 0xeb, 0xde, 0xfb, 0x09, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00,
+    0x08, 0x61, 0x3b, 0x00, 0x00, 0x83, 0x00, 0x20, 0x00, 0x00, 0x42, 0x28, 0xff, 0xdf, 0x0a, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x88, 0xe7, 0x1c,
+    0x18, 0xc3, 0x6b, 0x6d, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x39, 0xe7,
+    0x01, 0x00, 0x00, 0x81, 0x32, 0x2b, 0x0b, 0x36, 0x01, 0x02, 0xf4, 0x82, 0x03, 0x16, 0x2b, 0x12,
+    0x18, 0x81, 0x01, 0x00, 0x00, 0x82, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xdf, 0x14, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x6b, 0x6d, 0x10, 0x82, 0x02, 0x00, 0x00, 0x88,
+    0x10, 0x60, 0x21, 0x25, 0x21, 0xea, 0x33, 0x11, 0x03, 0x15, 0x3a, 0x8c, 0x00, 0x00, 0x08, 0x61,
+    0x29, 0x65, 0x01, 0x00, 0x00, 0x83, 0x08, 0x00, 0x21, 0x25, 0x23, 0x12, 0x03, 0x36, 0x0f, 0x02,
+    0xf5, 0x81, 0x2b, 0x53, 0x10, 0x40, 0x01, 0x00, 0x00, 0x83, 0x00, 0x20, 0x39, 0xc7, 0xad, 0x55,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff,
+    0xd6, 0xba, 0x21, 0x04, 0x01, 0x00, 0x00, 0x81, 0x2a, 0x0a, 0x0b, 0x36, 0x02, 0x02, 0xf5, 0x81,
+    0x23, 0x13, 0x10, 0x82, 0x01, 0x00, 0x00, 0x81, 0xbd, 0xd7, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x86,
+    0xff, 0xff, 0xc6, 0x18, 0x10, 0xa2, 0xbd, 0xb6, 0x39, 0xc6, 0x18, 0xe3, 0xad, 0x54, 0x0d, 0xff,
+    0xff, 0x82, 0xef, 0x5d, 0x29, 0x65, 0x00, 0x20, 0x3b, 0x00, 0x00, 0x82, 0x10, 0x82, 0x00, 0x00,
+    0xbd, 0xf7, 0x09, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x29, 0x65, 0xce, 0x79,
+    0x01, 0xff, 0xff, 0x89, 0xff, 0xdf, 0xf7, 0xbe, 0xff, 0xff, 0xb5, 0x96, 0x39, 0xc7, 0xff, 0xdf,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x01, 0x00, 0x00, 0x82, 0x21, 0x66, 0x0b, 0x35,
+    0x02, 0xd5, 0x01, 0x02, 0xf5, 0x81, 0x12, 0xf3, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x73, 0xae,
+    0xff, 0xff, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x82, 0xe7, 0x1c, 0x6b, 0x6d, 0x10, 0x82, 0x02, 0x00,
+    0x00, 0x87, 0x08, 0x61, 0x3a, 0x4b, 0x12, 0xb0, 0x23, 0x55, 0x03, 0x16, 0x02, 0xf5, 0x03, 0x16,
+    0x32, 0x6c, 0x03, 0x00, 0x00, 0x84, 0x10, 0x40, 0x2a, 0x4c, 0x13, 0x35, 0x02, 0xf5, 0x02, 0xf4,
+    0x0f, 0x02, 0xf5, 0x83, 0x0a, 0xf4, 0x2a, 0x8e, 0x19, 0x04, 0x08, 0x20, 0x02, 0x00, 0x00, 0x81,
+    0x31, 0xa6, 0xad, 0x75, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x8f, 0xff, 0xdf,
+    0xff, 0xff, 0xce, 0x59, 0x08, 0x61, 0x00, 0x00, 0x08, 0x20, 0x2a, 0x6e, 0x03, 0x16, 0x02, 0xf4,
+    0x02, 0xf5, 0x03, 0x16, 0x2a, 0xaf, 0x08, 0x40, 0x00, 0x00, 0x21, 0x24, 0xef, 0x5d, 0x01, 0xff,
+    0xdf, 0x8a, 0xff, 0xff, 0x63, 0x0c, 0x08, 0x41, 0x08, 0x61, 0x52, 0xaa, 0xef, 0x5d, 0xff, 0xff,
+    0xff, 0xdf, 0x94, 0x92, 0x31, 0xa6, 0xe7, 0x1c, 0x08, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff,
+    0x8c, 0x50, 0x00, 0x00, 0x08, 0x41, 0x39, 0x00, 0x00, 0x83, 0x00, 0x20, 0x00, 0x00, 0x42, 0x28,
+    0xff, 0xdf, 0x0b, 0xff, 0xff, 0x84, 0xde, 0xfb, 0x4a, 0x69, 0x00, 0x00, 0x6b, 0x4c, 0xf7, 0x9e,
+    0x02, 0xff, 0xff, 0x8e, 0x7b, 0xef, 0x42, 0x28, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79,
+    0x08, 0x41, 0x00, 0x00, 0x10, 0x82, 0x22, 0xf2, 0x02, 0xf6, 0x02, 0xf5, 0x02, 0xd5, 0x0b, 0x56,
+    0x19, 0x46, 0x01, 0x00, 0x00, 0x80, 0x5a, 0xcb, 0x17, 0xff, 0xff, 0x82, 0xf7, 0x9e, 0x84, 0x10,
+    0x10, 0xa2, 0x04, 0x00, 0x00, 0x87, 0x08, 0x61, 0x2a, 0xf1, 0x03, 0x17, 0x02, 0xd4, 0x02, 0xf5,
+    0x02, 0xf4, 0x03, 0x16, 0x32, 0x6c, 0x02, 0x00, 0x00, 0x82, 0x21, 0x66, 0x22, 0xf2, 0x03, 0x36,
+    0x13, 0x02, 0xf5, 0x84, 0x03, 0x36, 0x0b, 0x35, 0x2a, 0xd0, 0x21, 0x87, 0x10, 0x81, 0x02, 0x00,
+    0x00, 0x81, 0x52, 0x8a, 0xce, 0x79, 0x15, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96,
+    0x08, 0x20, 0x00, 0x00, 0x08, 0x20, 0x1a, 0xf1, 0x02, 0xf6, 0x02, 0xf5, 0x02, 0xd5, 0x03, 0x36,
+    0x21, 0xc9, 0x01, 0x00, 0x00, 0x80, 0x6b, 0x2c, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0x18,
+    0xc3, 0x80, 0xad, 0x55, 0x01, 0xff, 0xff, 0x84, 0xad, 0x75, 0x31, 0xa6, 0x20, 0xe3, 0x10, 0xa2,
+    0x63, 0x2c, 0x0a, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0x18, 0xc3, 0x00, 0x20, 0x39, 0x00, 0x00, 0x84,
+    0x10, 0xa2, 0x00, 0x00, 0xad, 0x55, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x88, 0xb5, 0xb6,
+    0x21, 0x04, 0x18, 0xc3, 0x94, 0x92, 0xe7, 0x3c, 0xa5, 0x55, 0x08, 0x41, 0xb5, 0x96, 0xff, 0xff,
+    0x01, 0xff, 0xdf, 0x80, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x81, 0x2a, 0x8e, 0x03, 0x16, 0x01, 0x02,
+    0xf5, 0x85, 0x0b, 0x36, 0x32, 0x2b, 0x08, 0x20, 0x00, 0x00, 0x29, 0x65, 0xef, 0x7d, 0x16, 0xff,
+    0xff, 0x81, 0xc6, 0x18, 0x39, 0xc7, 0x02, 0x00, 0x00, 0x82, 0x21, 0x24, 0xa5, 0x14, 0x84, 0x10,
+    0x01, 0x00, 0x00, 0x81, 0x18, 0xe4, 0x13, 0x54, 0x02, 0x02, 0xf5, 0x87, 0x03, 0x16, 0x32, 0x6c,
+    0x00, 0x00, 0x10, 0x61, 0x2a, 0x2c, 0x13, 0x55, 0x02, 0xf5, 0x02, 0xf4, 0x15, 0x02, 0xf5, 0x83,
+    0x02, 0xf6, 0x13, 0x56, 0x22, 0xf1, 0x19, 0x47, 0x02, 0x00, 0x00, 0x84, 0x08, 0x61, 0x84, 0x10,
+    0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0x12, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30,
+    0x01, 0x00, 0x00, 0x81, 0x21, 0x24, 0x1b, 0x34, 0x02, 0x02, 0xf5, 0x81, 0x1b, 0x34, 0x19, 0x04,
+    0x01, 0x00, 0x00, 0x80, 0xbd, 0xd7, 0x01, 0xff, 0xff, 0x8c, 0xbd, 0xd7, 0xe7, 0x3c, 0xff, 0xff,
+    0xbd, 0xd7, 0x39, 0xe7, 0x00, 0x00, 0x5a, 0xeb, 0xef, 0x5d, 0xd6, 0x9a, 0x10, 0xa2, 0xd6, 0x9a,
+    0xff, 0xff, 0xff, 0xdf, 0x06, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x00, 0x00,
+    0x08, 0x41, 0x37, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x39, 0xc7, 0x01, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x0b, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x7b, 0xef, 0x10, 0x82,
+    0x00, 0x00, 0x10, 0xa2, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x01, 0x00,
+    0x00, 0x81, 0x21, 0x46, 0x0b, 0x35, 0x01, 0x02, 0xf5, 0x81, 0x03, 0x16, 0x1a, 0x8f, 0x01, 0x00,
+    0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x13, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe,
+    0x84, 0x0f, 0x00, 0x20, 0x01, 0x00, 0x00, 0x82, 0x10, 0x82, 0x7b, 0xcf, 0xef, 0x7d, 0x01, 0xff,
+    0xff, 0x80, 0x52, 0xaa, 0x01, 0x00, 0x00, 0x81, 0x29, 0xc9, 0x13, 0x56, 0x01, 0x02, 0xf5, 0x84,
+    0x03, 0x16, 0x3a, 0x8c, 0x21, 0x25, 0x22, 0xf2, 0x03, 0x36, 0x19, 0x02, 0xf5, 0x82, 0x02, 0xd4,
+    0x03, 0x17, 0x22, 0xf1, 0x04, 0x00, 0x00, 0x81, 0x39, 0xc7, 0xce, 0x59, 0x16, 0xff, 0xff, 0x80,
+    0x52, 0xaa, 0x01, 0x00, 0x00, 0x89, 0x21, 0x88, 0x0b, 0x36, 0x02, 0xf5, 0x02, 0xf4, 0x03, 0x16,
+    0x22, 0xb0, 0x08, 0x00, 0x00, 0x00, 0x29, 0x65, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x85, 0xd6, 0xba,
+    0x4a, 0x69, 0x00, 0x20, 0x6b, 0x6d, 0x4a, 0x49, 0x63, 0x0c, 0x01, 0xff, 0xff, 0x81, 0x5a, 0xcb,
+    0x52, 0x8a, 0x09, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xde, 0xfb, 0x01, 0x10, 0xa2, 0x37, 0x00, 0x00,
+    0x80, 0x08, 0x61, 0x01, 0x08, 0x41, 0x83, 0x9c, 0xd3, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x0e,
+    0xff, 0xff, 0x82, 0xff, 0xdf, 0xde, 0xfb, 0xef, 0x5d, 0x02, 0xff, 0xff, 0x89, 0xde, 0xfb, 0x10,
+    0x82, 0x00, 0x00, 0x10, 0x81, 0x23, 0x13, 0x02, 0xf5, 0x02, 0xf4, 0x02, 0xf5, 0x1b, 0x34, 0x18,
+    0xe3, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x83, 0xff,
+    0xdf, 0xff, 0xff, 0xd6, 0xba, 0x39, 0xc7, 0x02, 0x00, 0x00, 0x81, 0x42, 0x08, 0xde, 0xdb, 0x01,
+    0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x3c, 0x21, 0x24, 0x01, 0x00, 0x00, 0x87, 0x2a,
+    0x6d, 0x03, 0x16, 0x02, 0xf4, 0x02, 0xf5, 0x2b, 0x12, 0x13, 0x34, 0x02, 0xf6, 0x02, 0xf4, 0x1a,
+    0x02, 0xf5, 0x81, 0x1b, 0x14, 0x21, 0x04, 0x01, 0x00, 0x00, 0x81, 0x52, 0xaa, 0x18, 0xe3, 0x01,
+    0x00, 0x00, 0x81, 0x08, 0x41, 0x94, 0x92, 0x15, 0xff, 0xff, 0x81, 0xef, 0x5d, 0x29, 0x65, 0x01,
+    0x00, 0x00, 0x81, 0x2a, 0xaf, 0x03, 0x36, 0x01, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x21, 0xc9, 0x01,
+    0x00, 0x00, 0x80, 0x84, 0x30, 0x01, 0xff, 0xff, 0x8a, 0xb5, 0x75, 0x42, 0x28, 0xce, 0x79, 0xff,
+    0xff, 0xe7, 0x3c, 0x10, 0xa2, 0xc6, 0x18, 0xff, 0xff, 0xde, 0xdb, 0x18, 0xe3, 0xd6, 0x9a, 0x09,
+    0xff, 0xff, 0x83, 0xef, 0x7d, 0x42, 0x08, 0x00, 0x00, 0x08, 0x41, 0x37, 0x00, 0x00, 0x84, 0x84,
+    0x10, 0x5a, 0xeb, 0x00, 0x00, 0x29, 0x65, 0xbd, 0xd7, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x04,
+    0xff, 0xff, 0x82, 0xde, 0xfb, 0x42, 0x28, 0x52, 0xaa, 0x01, 0x52, 0x8a, 0x85, 0x6b, 0x4d, 0x6b,
+    0x6d, 0x84, 0x10, 0xa5, 0x34, 0xad, 0x75, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x80, 0x63, 0x2c, 0x01,
+    0x00, 0x00, 0x85, 0x2a, 0x2c, 0x03, 0x36, 0x02, 0xf4, 0x02, 0xf5, 0x03, 0x36, 0x21, 0xa8, 0x01,
+    0x00, 0x00, 0x80, 0x5a, 0xeb, 0x15, 0xff, 0xff, 0x81, 0xb5, 0x96, 0x18, 0xe3, 0x03, 0x00, 0x00,
+    0x80, 0x42, 0x28, 0x01, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xf7,
+    0x08, 0x61, 0x00, 0x00, 0x18, 0x81, 0x23, 0x12, 0x1f, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x19, 0x88,
+    0x01, 0x00, 0x00, 0x83, 0x52, 0x8a, 0xff, 0xff, 0xd6, 0x9a, 0x4a, 0x49, 0x02, 0x00, 0x00, 0x81,
+    0x63, 0x2c, 0xf7, 0x9e, 0x12, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x41,
+    0x00, 0x00, 0x10, 0xa2, 0x23, 0x13, 0x02, 0x02, 0xf5, 0x84, 0x1b, 0x13, 0x18, 0x82, 0x00, 0x00,
+    0x10, 0xa2, 0xde, 0xfb, 0x03, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x6d, 0x31, 0x86,
+    0x01, 0xff, 0xff, 0x81, 0xc6, 0x18, 0xe7, 0x1c, 0x05, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x84, 0xad, 0x55, 0x18, 0xe3, 0x00, 0x00, 0x73, 0x8e, 0x10, 0x82, 0x37, 0x00, 0x00, 0x86,
+    0x08, 0x41, 0x6b, 0x4d, 0xb5, 0x96, 0x29, 0x45, 0x00, 0x00, 0x63, 0x0c, 0xde, 0xfb, 0x05, 0xff,
+    0xff, 0x89, 0xce, 0x59, 0x00, 0x00, 0x52, 0x8a, 0x9c, 0xb2, 0x73, 0x8e, 0x39, 0xe7, 0x00, 0x00,
+    0x31, 0xa6, 0x29, 0x65, 0x5a, 0xeb, 0x01, 0xff, 0xdf, 0x85, 0xff, 0xff, 0xce, 0x79, 0x08, 0x61,
+    0x00, 0x00, 0x21, 0x04, 0x13, 0x35, 0x01, 0x02, 0xf5, 0x85, 0x03, 0x16, 0x2a, 0xaf, 0x08, 0x20,
+    0x00, 0x00, 0x29, 0x65, 0xef, 0x5d, 0x14, 0xff, 0xff, 0x80, 0x8c, 0x30, 0x02, 0x00, 0x00, 0x81,
+    0x29, 0xa8, 0x21, 0x25, 0x01, 0x00, 0x00, 0x82, 0x63, 0x2c, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30, 0x01, 0x00, 0x00, 0x81, 0x21, 0x04, 0x13, 0x35,
+    0x1c, 0x02, 0xf5, 0x86, 0x02, 0xf4, 0x03, 0x36, 0x32, 0x8e, 0x08, 0x20, 0x00, 0x00, 0x21, 0x24,
+    0xef, 0x5c, 0x02, 0xff, 0xff, 0x85, 0x7b, 0xef, 0x08, 0x41, 0x00, 0x20, 0x00, 0x00, 0x42, 0x08,
+    0xef, 0x5d, 0x12, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x01, 0x00, 0x00, 0x81,
+    0x21, 0x87, 0x0b, 0x56, 0x01, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x2a, 0x4c, 0x01, 0x00, 0x00, 0x80,
+    0x63, 0x0c, 0x05, 0xff, 0xff, 0x81, 0xe7, 0x3c, 0xad, 0x55, 0x0a, 0xff, 0xff, 0x85, 0xd6, 0x79,
+    0x42, 0x28, 0x00, 0x00, 0x42, 0x28, 0xce, 0x59, 0x8c, 0x71, 0x3a, 0x00, 0x00, 0x80, 0x18, 0xc3,
+    0x01, 0x94, 0xb2, 0x83, 0x10, 0x81, 0x08, 0x41, 0x8c, 0x71, 0xf7, 0x9e, 0x04, 0xff, 0xff, 0x87,
+    0xad, 0x75, 0x18, 0xe3, 0xbd, 0xf7, 0xff, 0xff, 0x73, 0x8e, 0x6b, 0x6d, 0xff, 0xff, 0xff, 0xdf,
+    0x03, 0xff, 0xff, 0x84, 0x4a, 0x69, 0x00, 0x00, 0x08, 0x00, 0x22, 0x8e, 0x03, 0x16, 0x01, 0x02,
+    0xf5, 0x81, 0x1b, 0x55, 0x21, 0x04, 0x01, 0x00, 0x00, 0x80, 0xb5, 0xb6, 0x14, 0xff, 0xff, 0x80,
+    0x7b, 0xcf, 0x01, 0x00, 0x00, 0x84, 0x08, 0x20, 0x21, 0xca, 0x13, 0x56, 0x23, 0x34, 0x18, 0xc3,
+    0x01, 0x00, 0x00, 0x82, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0xff, 0xdf,
+    0x4a, 0x49, 0x01, 0x00, 0x00, 0x82, 0x21, 0xc9, 0x03, 0x36, 0x02, 0xd4, 0x1a, 0x02, 0xf5, 0x85,
+    0x03, 0x16, 0x1a, 0xd1, 0x08, 0x41, 0x00, 0x00, 0x00, 0x20, 0xbd, 0xf7, 0x04, 0xff, 0xff, 0x85,
+    0xa5, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x29, 0x65, 0xd6, 0xba, 0x13, 0xff, 0xff, 0x8e,
+    0xf7, 0x9e, 0x31, 0x86, 0x00, 0x00, 0x08, 0x20, 0x1a, 0x6e, 0x03, 0x16, 0x02, 0xf4, 0x02, 0xf5,
+    0x13, 0x35, 0x19, 0x04, 0x00, 0x00, 0x08, 0x41, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff,
+    0xff, 0x83, 0xde, 0xfb, 0x9c, 0xd3, 0x84, 0x10, 0xbd, 0xf7, 0x04, 0xff, 0xff, 0x86, 0xef, 0x5d,
+    0x6b, 0x6d, 0x00, 0x00, 0x18, 0xc3, 0xb5, 0x96, 0xb5, 0xb6, 0x29, 0x65, 0x3d, 0x00, 0x00, 0x86,
+    0x31, 0xa6, 0xbd, 0xf7, 0x5a, 0xcb, 0x00, 0x00, 0x94, 0xb2, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x14, 0x10, 0xa2, 0x94, 0x92, 0x29, 0x45, 0xde, 0xdb,
+    0x02, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xc6, 0x18, 0x08, 0x41, 0x00, 0x00, 0x21, 0x46,
+    0x13, 0x35, 0x01, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x22, 0x0b, 0x01, 0x00, 0x00, 0x80, 0x5a, 0xeb,
+    0x13, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x62, 0xeb, 0x01, 0x00, 0x00, 0x85, 0x10, 0x61, 0x22, 0x8e,
+    0x03, 0x36, 0x02, 0xd4, 0x03, 0x16, 0x1a, 0x8f, 0x01, 0x00, 0x00, 0x81, 0x10, 0xa2, 0xd6, 0x9a,
+    0x04, 0xff, 0xff, 0x85, 0xe7, 0x1c, 0x18, 0xc3, 0x00, 0x00, 0x08, 0x20, 0x32, 0x8e, 0x03, 0x36,
+    0x1a, 0x02, 0xf5, 0x81, 0x13, 0x35, 0x19, 0x04, 0x01, 0x00, 0x00, 0x82, 0x8c, 0x51, 0xff, 0xff,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x03, 0x00, 0x00, 0x83,
+    0x18, 0xe3, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x8b, 0xc6, 0x18, 0x08, 0x41,
+    0x00, 0x00, 0x18, 0xe3, 0x1b, 0x34, 0x02, 0xf5, 0x02, 0xf4, 0x03, 0x16, 0x1a, 0x6e, 0x08, 0x20,
+    0x00, 0x00, 0x5a, 0xeb, 0x04, 0xff, 0xff, 0x87, 0xef, 0x7d, 0x63, 0x2c, 0x08, 0x41, 0x31, 0x86,
+    0x42, 0x08, 0x21, 0x04, 0x4a, 0x69, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x85, 0xb5, 0xb6, 0x21, 0x04,
+    0x10, 0x82, 0x84, 0x10, 0xd6, 0x9a, 0x52, 0xaa, 0x40, 0x00, 0x00, 0x83, 0x00, 0x20, 0x4a, 0x69,
+    0x08, 0x61, 0xd6, 0x9a, 0x04, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00,
+    0x6b, 0x4d, 0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x8b, 0x52, 0x8a, 0x00, 0x00, 0x08, 0x20,
+    0x2a, 0xd0, 0x03, 0x16, 0x02, 0xf4, 0x02, 0xf5, 0x1a, 0xf2, 0x08, 0x41, 0x00, 0x00, 0x18, 0xc3,
+    0xe7, 0x1c, 0x13, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x82, 0x18, 0xa2, 0x2a, 0xd0,
+    0x03, 0x16, 0x02, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x2a, 0x0a, 0x01, 0x00, 0x00, 0x81, 0x31, 0x86,
+    0xf7, 0xbe, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x81,
+    0x10, 0x61, 0x1a, 0xf2, 0x19, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x29, 0xc9, 0x01, 0x00, 0x00, 0x80,
+    0x4a, 0x69, 0x03, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xa4, 0xf3, 0x01, 0x00, 0x00, 0x81,
+    0x10, 0x82, 0x21, 0x46, 0x01, 0x00, 0x00, 0x83, 0x18, 0xc3, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf,
+    0x0f, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x2c, 0x01, 0x00, 0x00, 0x8a, 0x2a, 0x2c,
+    0x03, 0x36, 0x02, 0xf4, 0x02, 0xd5, 0x13, 0x55, 0x10, 0xe4, 0x00, 0x00, 0x00, 0x20, 0xce, 0x59,
+    0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x87, 0x4a, 0x49, 0x18, 0xc3, 0xbd, 0xd7, 0xf7, 0xbe,
+    0xff, 0xff, 0xe7, 0x1b, 0x29, 0x45, 0x6b, 0x4d, 0x01, 0xff, 0xff, 0x84, 0xad, 0x55, 0x00, 0x00,
+    0x94, 0xb2, 0x84, 0x30, 0x08, 0x61, 0x43, 0x00, 0x00, 0x81, 0x4a, 0x69, 0xff, 0xdf, 0x05, 0xff,
+    0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x71, 0x10, 0x82, 0xbd, 0xf7, 0x03, 0xff, 0xff, 0x84,
+    0xc6, 0x38, 0x00, 0x20, 0x00, 0x00, 0x29, 0x66, 0x0b, 0x35, 0x01, 0x02, 0xf5, 0x81, 0x0b, 0x56,
+    0x29, 0xc9, 0x01, 0x00, 0x00, 0x82, 0x94, 0x92, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x80,
+    0x7b, 0xce, 0x01, 0x00, 0x00, 0x83, 0x18, 0xa2, 0x2b, 0x11, 0x03, 0x16, 0x02, 0xf4, 0x03, 0x02,
+    0xf5, 0x81, 0x0b, 0x35, 0x19, 0x45, 0x01, 0x00, 0x00, 0x82, 0x73, 0xae, 0xff, 0xff, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xef, 0x01, 0x00, 0x00, 0x81, 0x21, 0x45,
+    0x1b, 0x55, 0x16, 0x02, 0xf5, 0x82, 0x02, 0xf4, 0x03, 0x16, 0x22, 0x6e, 0x01, 0x00, 0x00, 0x81,
+    0x18, 0xc3, 0xe7, 0x1c, 0x04, 0xff, 0xff, 0x86, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x00, 0x08, 0x40,
+    0x2a, 0xb0, 0x1b, 0x76, 0x21, 0x67, 0x01, 0x00, 0x00, 0x81, 0x29, 0x45, 0xe7, 0x1c, 0x12, 0xff,
+    0xff, 0x88, 0xe7, 0x3c, 0x18, 0xc3, 0x00, 0x00, 0x10, 0x82, 0x1a, 0xf2, 0x02, 0xf5, 0x02, 0xf4,
+    0x03, 0x16, 0x22, 0x8f, 0x01, 0x00, 0x00, 0x86, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
+    0xbd, 0xd7, 0x10, 0xa2, 0xe7, 0x3c, 0x01, 0xff, 0xff, 0x88, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xf7,
+    0x21, 0x04, 0xef, 0x5d, 0xff, 0xff, 0xf7, 0x9e, 0x31, 0x86, 0x10, 0xc2, 0x43, 0x00, 0x00, 0x84,
+    0x10, 0x82, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x93, 0xff, 0xdf,
+    0xff, 0xff, 0x84, 0x10, 0x08, 0x61, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x52, 0x8a,
+    0x00, 0x00, 0x08, 0x40, 0x22, 0xb0, 0x03, 0x16, 0x02, 0xf4, 0x02, 0xf5, 0x2a, 0xf1, 0x10, 0x41,
+    0x00, 0x00, 0x31, 0xa6, 0xf7, 0xbe, 0x10, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30,
+    0x01, 0x00, 0x00, 0x83, 0x18, 0xa2, 0x2b, 0x11, 0x03, 0x16, 0x02, 0xf4, 0x05, 0x02, 0xf5, 0x81,
+    0x23, 0x13, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x01, 0xff, 0xdf, 0x80, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x81, 0x29, 0xc9, 0x0b, 0x36, 0x16,
+    0x02, 0xf5, 0x86, 0x23, 0x12, 0x18, 0xa2, 0x00, 0x00, 0x08, 0x40, 0xbd, 0xd7, 0xff, 0xff, 0xff,
+    0xdf, 0x02, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0x39, 0xc7, 0x01, 0x00, 0x00, 0x84, 0x19, 0xca, 0x03,
+    0x36, 0x02, 0xd5, 0x1b, 0x56, 0x21, 0x67, 0x01, 0x00, 0x00, 0x81, 0x31, 0x86, 0xef, 0x5d, 0x12,
+    0xff, 0xff, 0x80, 0x8c, 0x71, 0x01, 0x00, 0x00, 0x81, 0x29, 0xea, 0x03, 0x36, 0x01, 0x02, 0xf5,
+    0x84, 0x0b, 0x35, 0x19, 0x05, 0x00, 0x00, 0x08, 0x20, 0xd6, 0x9a, 0x01, 0xff, 0xff, 0x83, 0x73,
+    0x8e, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xe7, 0x1c, 0x21,
+    0x04, 0xde, 0xfb, 0x01, 0xff, 0xff, 0x82, 0x84, 0x10, 0x00, 0x00, 0x08, 0x61, 0x43, 0x00, 0x00,
+    0x81, 0x10, 0xa2, 0xef, 0x5d, 0x09, 0xff, 0xff, 0x82, 0xff, 0xdf, 0x94, 0x92, 0xef, 0x5d, 0x01,
+    0xff, 0xff, 0x84, 0xd6, 0x9a, 0x08, 0x61, 0x00, 0x00, 0x21, 0x66, 0x13, 0x56, 0x01, 0x02, 0xf5,
+    0x81, 0x13, 0x56, 0x21, 0x67, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x0e,
+    0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x75, 0x01, 0x00, 0x00, 0x82, 0x10, 0x81, 0x2a,
+    0xf1, 0x03, 0x16, 0x06, 0x02, 0xf5, 0x86, 0x02, 0xf4, 0x03, 0x16, 0x2a, 0xcf, 0x08, 0x40, 0x00,
+    0x00, 0x18, 0xc3, 0xde, 0xfb, 0x04, 0xff, 0xff, 0x81, 0xde, 0xdb, 0x18, 0xa2, 0x01, 0x00, 0x00,
+    0x82, 0x22, 0xaf, 0x03, 0x16, 0x02, 0xf4, 0x13, 0x02, 0xf5, 0x81, 0x1b, 0x35, 0x21, 0x05, 0x01,
+    0x00, 0x00, 0x80, 0x84, 0x0f, 0x03, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x6d, 0x01,
+    0x00, 0x00, 0x81, 0x21, 0x25, 0x13, 0x35, 0x02, 0x02, 0xf5, 0x81, 0x1b, 0x54, 0x29, 0x45, 0x01,
+    0x00, 0x00, 0x81, 0x4a, 0x49, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x8b, 0xf7, 0xbe, 0x29, 0x45, 0x00,
+    0x00, 0x10, 0x61, 0x1b, 0x13, 0x02, 0xf5, 0x02, 0xf4, 0x03, 0x16, 0x1a, 0x6e, 0x08, 0x20, 0x00,
+    0x00, 0x6b, 0x2c, 0x01, 0xff, 0xff, 0x82, 0x8c, 0x51, 0x52, 0xaa, 0xff, 0xff, 0x02, 0xff, 0xdf,
+    0x83, 0xff, 0xff, 0xad, 0x75, 0x18, 0xc3, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x82, 0xd6, 0xba, 0x00,
+    0x20, 0x10, 0xa2, 0x41, 0x00, 0x00, 0x84, 0x00, 0x20, 0x00, 0x00, 0x6b, 0x2c, 0xff, 0xff, 0xff,
+    0xdf, 0x0d, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x87, 0x2a, 0xaf, 0x03, 0x16, 0x02,
+    0xf4, 0x03, 0x16, 0x22, 0xd0, 0x10, 0x40, 0x00, 0x00, 0x42, 0x08, 0x10, 0xff, 0xff, 0x88, 0xff,
+    0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0xa2, 0x00, 0x00, 0x08, 0x40, 0x22, 0xaf, 0x03, 0x16, 0x02,
+    0xf4, 0x08, 0x02, 0xf5, 0x81, 0x03, 0x36, 0x21, 0xea, 0x01, 0x00, 0x00, 0x81, 0x41, 0xe7, 0xf7,
+    0xbe, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x55, 0x01, 0x00, 0x00, 0x81, 0x18,
+    0xa2, 0x23, 0x13, 0x12, 0x02, 0xf5, 0x82, 0x02, 0xd5, 0x0b, 0x36, 0x2a, 0x0a, 0x01, 0x00, 0x00,
+    0x81, 0x4a, 0x49, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x75, 0x01,
+    0x00, 0x00, 0x81, 0x10, 0xa2, 0x23, 0x33, 0x04, 0x02, 0xf5, 0x81, 0x1b, 0x34, 0x21, 0x04, 0x01,
+    0x00, 0x00, 0x82, 0x73, 0xae, 0xff, 0xff, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0x9c, 0xf3, 0x01, 0x00, 0x00, 0x8c, 0x21, 0xc9, 0x0b, 0x36, 0x02, 0xf4, 0x02, 0xf5, 0x1b,
+    0x55, 0x18, 0xe4, 0x00, 0x00, 0x18, 0xc3, 0xde, 0xfb, 0xff, 0xff, 0xd6, 0xba, 0x08, 0x61, 0xc6,
+    0x18, 0x02, 0xff, 0xff, 0x84, 0xbd, 0xf7, 0x08, 0x41, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0x01,
+    0xff, 0xff, 0x80, 0x4a, 0x69, 0x42, 0x00, 0x00, 0x86, 0x08, 0x41, 0x00, 0x00, 0xad, 0x75, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0xf7, 0x9e, 0x02,
+    0xff, 0xff, 0x84, 0xef, 0x5d, 0x18, 0xc3, 0x00, 0x00, 0x21, 0x04, 0x0b, 0x14, 0x01, 0x02, 0xf5,
+    0x81, 0x03, 0x35, 0x29, 0xa8, 0x01, 0x00, 0x00, 0x80, 0xbd, 0xd7, 0x11, 0xff, 0xff, 0x81, 0xf7,
+    0x9e, 0x31, 0x86, 0x01, 0x00, 0x00, 0x81, 0x19, 0xca, 0x03, 0x36, 0x0b, 0x02, 0xf5, 0x81, 0x1b,
+    0x55, 0x21, 0x25, 0x01, 0x00, 0x00, 0x82, 0x7b, 0xce, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x82, 0x18, 0xe5, 0x0b, 0x35, 0x02,
+    0xd5, 0x0f, 0x02, 0xf5, 0x86, 0x02, 0xf4, 0x03, 0x16, 0x32, 0x8e, 0x08, 0x20, 0x00, 0x00, 0x21,
+    0x03, 0xe7, 0x1c, 0x04, 0xff, 0xff, 0x81, 0xde, 0xdb, 0x10, 0xa2, 0x01, 0x00, 0x00, 0x81, 0x1a,
+    0x6e, 0x03, 0x16, 0x04, 0x02, 0xf5, 0x87, 0x02, 0xf6, 0x23, 0x12, 0x10, 0x61, 0x00, 0x00, 0x00,
+    0x20, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x88, 0xf7, 0xbe, 0x29, 0x45, 0x00,
+    0x00, 0x10, 0x81, 0x1a, 0xf2, 0x02, 0xf5, 0x02, 0xf4, 0x03, 0x16, 0x32, 0x6d, 0x01, 0x00, 0x00,
+    0x80, 0x94, 0x92, 0x01, 0xff, 0xff, 0x87, 0x9c, 0xb2, 0x10, 0xa2, 0x63, 0x0c, 0x7b, 0xef, 0x4a,
+    0x49, 0x00, 0x00, 0x4a, 0x69, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x9c,
+    0xf3, 0x00, 0x00, 0x08, 0x41, 0x40, 0x00, 0x00, 0x82, 0x10, 0x82, 0x18, 0xc3, 0xe7, 0x1c, 0x03,
+    0xff, 0xff, 0x81, 0xd6, 0xba, 0x8c, 0x30, 0x01, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0x94,
+    0x92, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x14, 0x01, 0x00, 0x00, 0x88, 0x19,
+    0xeb, 0x0b, 0x36, 0x02, 0xf4, 0x02, 0xf5, 0x2b, 0x12, 0x08, 0x40, 0x00, 0x00, 0x31, 0xa6, 0xf7,
+    0xbe, 0x0f, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x4d, 0x01, 0x00, 0x00, 0x81, 0x29,
+    0x87, 0x13, 0x56, 0x0d, 0x02, 0xf5, 0x86, 0x23, 0x12, 0x18, 0xa2, 0x00, 0x00, 0x00, 0x20, 0xb5,
+    0xb6, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x39, 0xe7, 0x01, 0x00, 0x00,
+    0x81, 0x2a, 0x2b, 0x0b, 0x36, 0x10, 0x02, 0xf5, 0x81, 0x23, 0x12, 0x10, 0x81, 0x01, 0x00, 0x00,
+    0x82, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x85, 0xff, 0xdf, 0x39, 0xc7, 0x00,
+    0x00, 0x08, 0x00, 0x32, 0x0a, 0x0b, 0x36, 0x05, 0x02, 0xf5, 0x86, 0x02, 0xf4, 0x03, 0x36, 0x2a,
+    0x8e, 0x08, 0x20, 0x00, 0x00, 0x10, 0xa2, 0xde, 0xfb, 0x0f, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0x9c, 0xd3, 0x01, 0x00, 0x00, 0x87, 0x2a, 0x2b, 0x03, 0x36, 0x02, 0xf4, 0x02, 0xf5, 0x12,
+    0xd2, 0x18, 0x81, 0x00, 0x00, 0x31, 0xa6, 0x02, 0xff, 0xff, 0x84, 0xb5, 0xb6, 0x39, 0xe7, 0x39,
+    0xc7, 0x52, 0x8a, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x86, 0xe7, 0x3c, 0xd6, 0xba, 0xff, 0xdf, 0xff,
+    0xff, 0xde, 0xdb, 0x08, 0x61, 0x18, 0xc3, 0x41, 0x00, 0x00, 0x80, 0x52, 0x8a, 0x01, 0xff, 0xdf,
+    0x95, 0xff, 0xff, 0x9c, 0xf3, 0x94, 0x92, 0xef, 0x7d, 0x4a, 0x69, 0xce, 0x79, 0xff, 0xff, 0xff,
+    0xdf, 0xff, 0xff, 0x31, 0x86, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x4a, 0x49, 0x00,
+    0x00, 0x10, 0x61, 0x2b, 0x33, 0x02, 0xf5, 0x02, 0xf4, 0x03, 0x36, 0x19, 0xc9, 0x01, 0x00, 0x00,
+    0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x84, 0xb5, 0xb6, 0x00, 0x20, 0x00,
+    0x00, 0x18, 0xe3, 0x1b, 0x34, 0x0e, 0x02, 0xf5, 0x81, 0x03, 0x16, 0x2a, 0x8e, 0x01, 0x00, 0x00,
+    0x81, 0x18, 0xe3, 0xe7, 0x1c, 0x04, 0xff, 0xff, 0x85, 0xd6, 0xba, 0x10, 0x82, 0x00, 0x00, 0x08,
+    0x20, 0x22, 0x6e, 0x03, 0x16, 0x0e, 0x02, 0xf5, 0x81, 0x1b, 0x55, 0x21, 0x66, 0x01, 0x00, 0x00,
+    0x82, 0x7b, 0xcf, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x73,
+    0xae, 0x01, 0x00, 0x00, 0x81, 0x19, 0x05, 0x0b, 0x35, 0x08, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x29,
+    0xe9, 0x01, 0x00, 0x00, 0x80, 0x52, 0xaa, 0x11, 0xff, 0xff, 0x88, 0xf7, 0x9e, 0x29, 0x45, 0x00,
+    0x00, 0x18, 0xc3, 0x23, 0x34, 0x02, 0xf5, 0x02, 0xf4, 0x0b, 0x56, 0x11, 0x68, 0x01, 0x00, 0x00,
+    0x82, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x89, 0xef, 0x5d, 0x9c, 0xd3, 0x39,
+    0xe7, 0x21, 0x24, 0x10, 0xa2, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xdf, 0x42, 0x28, 0x08, 0x41, 0x3f,
+    0x00, 0x00, 0x8f, 0x10, 0x82, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x8c,
+    0x51, 0x21, 0x24, 0x10, 0xa2, 0x10, 0x82, 0x6b, 0x4d, 0xef, 0x7d, 0xff, 0xff, 0xd6, 0x9a, 0x18,
+    0xe3, 0xde, 0xfb, 0x01, 0xff, 0xff, 0x84, 0xd6, 0x9a, 0x08, 0x61, 0x00, 0x00, 0x19, 0x46, 0x03,
+    0x36, 0x01, 0x02, 0xf5, 0x84, 0x13, 0x13, 0x18, 0xa2, 0x00, 0x00, 0x21, 0x04, 0xf7, 0x9e, 0x10,
+    0xff, 0xff, 0x85, 0xf7, 0x9e, 0x21, 0x24, 0x00, 0x00, 0x08, 0x40, 0x2a, 0xaf, 0x03, 0x16, 0x0f,
+    0x02, 0xf5, 0x81, 0x0b, 0x36, 0x2a, 0x0a, 0x01, 0x00, 0x00, 0x81, 0x4a, 0x69, 0xff, 0xdf, 0x04,
+    0xff, 0xff, 0x80, 0xa5, 0x34, 0x01, 0x00, 0x00, 0x81, 0x10, 0x61, 0x1b, 0x13, 0x0d, 0x02, 0xf5,
+    0x81, 0x03, 0x36, 0x29, 0xea, 0x01, 0x00, 0x00, 0x81, 0x39, 0xc7, 0xff, 0xdf, 0x02, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x01, 0x00, 0x00, 0x81, 0x10, 0x82, 0x1a, 0xf2, 0x0a,
+    0x02, 0xf5, 0x81, 0x0b, 0x34, 0x19, 0x04, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff,
+    0xdf, 0x0d, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x00, 0x00, 0x08, 0x00, 0x22,
+    0x4d, 0x03, 0x16, 0x02, 0xf4, 0x02, 0xf6, 0x2a, 0xd0, 0x08, 0x40, 0x00, 0x00, 0x73, 0x8e, 0x01,
+    0xff, 0xff, 0x89, 0xf7, 0xbe, 0xb5, 0xb6, 0x73, 0xae, 0x29, 0x65, 0x00, 0x00, 0x10, 0x82, 0x52,
+    0xaa, 0xb5, 0xb6, 0x39, 0xe7, 0x9c, 0xf3, 0x01, 0xff, 0xff, 0x82, 0x8c, 0x71, 0x00, 0x00, 0x10,
+    0x82, 0x3e, 0x00, 0x00, 0x82, 0x08, 0x61, 0x00, 0x00, 0xde, 0xdb, 0x03, 0xff, 0xff, 0x85, 0xef,
+    0x7d, 0xad, 0x75, 0x63, 0x0c, 0x08, 0x61, 0x21, 0x24, 0x63, 0x0c, 0x01, 0x4a, 0x69, 0x83, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x71, 0x01, 0x00, 0x00, 0x84, 0x32, 0xaf, 0x03, 0x16, 0x02,
+    0xd4, 0x03, 0x36, 0x2a, 0x6e, 0x01, 0x00, 0x00, 0x80, 0x84, 0x30, 0x0f, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xff, 0xff, 0x73, 0xae, 0x01, 0x00, 0x00, 0x82, 0x29, 0xea, 0x0b, 0x56, 0x02, 0xd5, 0x10,
+    0x02, 0xf5, 0x81, 0x13, 0x35, 0x21, 0x25, 0x01, 0x00, 0x00, 0x82, 0x84, 0x10, 0xff, 0xff, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x4d, 0x01, 0x00, 0x00, 0x86, 0x29,
+    0x67, 0x13, 0x35, 0x02, 0xf5, 0x02, 0xf4, 0x02, 0xf5, 0x0b, 0x35, 0x03, 0x14, 0x06, 0x02, 0xf5,
+    0x85, 0x03, 0x16, 0x22, 0xaf, 0x08, 0x20, 0x00, 0x00, 0x18, 0xc3, 0xde, 0xdb, 0x04, 0xff, 0xff,
+    0x85, 0xde, 0xfb, 0x10, 0xa2, 0x00, 0x00, 0x08, 0x20, 0x2a, 0xae, 0x03, 0x36, 0x09, 0x02, 0xf5,
+    0x86, 0x02, 0xf4, 0x03, 0x16, 0x2a, 0xf0, 0x08, 0x40, 0x00, 0x00, 0x21, 0x03, 0xe7, 0x3c, 0x10,
+    0xff, 0xff, 0x84, 0xe7, 0x1c, 0x08, 0x61, 0x00, 0x00, 0x19, 0x25, 0x13, 0x55, 0x01, 0x02, 0xf5,
+    0x8b, 0x0b, 0x14, 0x08, 0x82, 0x00, 0x00, 0x21, 0x25, 0xef, 0x7d, 0xff, 0xff, 0xef, 0x5d, 0x21,
+    0x24, 0x31, 0x86, 0x94, 0x92, 0x8c, 0x71, 0x31, 0xa6, 0x01, 0xff, 0xff, 0x81, 0x84, 0x30, 0x52,
+    0xaa, 0x01, 0xff, 0xff, 0x82, 0xce, 0x79, 0x00, 0x00, 0x08, 0x41, 0x3f, 0x00, 0x00, 0x81, 0x29,
+    0x65, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x84, 0x73, 0xae, 0x5a,
+    0xeb, 0x73, 0x8e, 0x18, 0xc3, 0xad, 0x55, 0x02, 0xff, 0xff, 0x83, 0x42, 0x08, 0x00, 0x00, 0x20,
+    0xc2, 0x12, 0xf3, 0x01, 0x02, 0xf5, 0x84, 0x03, 0x15, 0x21, 0x66, 0x00, 0x00, 0x08, 0x61, 0xd6,
+    0xba, 0x10, 0xff, 0xff, 0x84, 0xde, 0xba, 0x10, 0x82, 0x00, 0x00, 0x18, 0xa2, 0x1b, 0x14, 0x12,
+    0x02, 0xf5, 0x87, 0x02, 0xf6, 0x2b, 0x12, 0x10, 0x81, 0x00, 0x00, 0x00, 0x20, 0xbd, 0xd7, 0xff,
+    0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0x31, 0x86, 0x01, 0x00, 0x00, 0x85, 0x22,
+    0x0b, 0x03, 0x36, 0x03, 0x16, 0x12, 0xd2, 0x42, 0x29, 0x2b, 0x33, 0x06, 0x02, 0xf5, 0x81, 0x23,
+    0x13, 0x18, 0xa2, 0x01, 0x00, 0x00, 0x80, 0xad, 0x75, 0x04, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x42,
+    0x08, 0x01, 0x00, 0x00, 0x82, 0x21, 0xc9, 0x03, 0x36, 0x02, 0xd5, 0x0a, 0x02, 0xf5, 0x82, 0x02,
+    0xd5, 0x03, 0x36, 0x21, 0xa8, 0x01, 0x00, 0x00, 0x80, 0x7b, 0xcf, 0x11, 0xff, 0xff, 0x87, 0x63,
+    0x2c, 0x00, 0x00, 0x08, 0x40, 0x1a, 0xb1, 0x03, 0x16, 0x02, 0xf4, 0x03, 0x36, 0x3a, 0x2b, 0x01,
+    0x00, 0x00, 0x83, 0xb5, 0xb6, 0xff, 0xff, 0xf7, 0xbe, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x8a, 0xf7,
+    0x9e, 0x29, 0x45, 0xc6, 0x38, 0xff, 0xdf, 0xc6, 0x38, 0x31, 0xa6, 0xf7, 0x9e, 0xff, 0xff, 0xf7,
+    0xbe, 0x18, 0xe3, 0x00, 0x20, 0x3f, 0x00, 0x00, 0x82, 0x6b, 0x6d, 0xff, 0xff, 0xff, 0xdf, 0x05,
+    0xff, 0xff, 0x80, 0xf7, 0x9e, 0x01, 0xe7, 0x1c, 0x81, 0xad, 0x54, 0xf7, 0x9e, 0x01, 0xff, 0xff,
+    0x8a, 0xd6, 0xba, 0x00, 0x41, 0x00, 0x00, 0x21, 0x67, 0x13, 0x56, 0x02, 0xd4, 0x02, 0xf5, 0x2b,
+    0x33, 0x08, 0x20, 0x00, 0x00, 0x4a, 0x69, 0x11, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x00, 0x00,
+    0x82, 0x1a, 0x2c, 0x03, 0x36, 0x02, 0xf4, 0x12, 0x02, 0xf5, 0x81, 0x03, 0x16, 0x22, 0x8d, 0x01,
+    0x00, 0x00, 0x81, 0x29, 0x45, 0xe7, 0x3c, 0x02, 0xff, 0xff, 0x8a, 0xff, 0xdf, 0xff, 0xff, 0xd6,
+    0x9a, 0x10, 0x82, 0x00, 0x00, 0x10, 0x60, 0x2a, 0xd0, 0x22, 0xb0, 0x08, 0x62, 0x18, 0x60, 0x2b,
+    0x32, 0x05, 0x02, 0xf5, 0x81, 0x0b, 0x35, 0x19, 0x25, 0x01, 0x00, 0x00, 0x82, 0x73, 0x8e, 0xff,
+    0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x01, 0x00, 0x00,
+    0x81, 0x21, 0x45, 0x1b, 0x55, 0x0e, 0x02, 0xf5, 0x84, 0x1b, 0x34, 0x18, 0xc3, 0x00, 0x00, 0x08,
+    0x41, 0xde, 0xfb, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96, 0x01, 0x00, 0x00,
+    0x87, 0x32, 0x2b, 0x03, 0x16, 0x02, 0xf4, 0x03, 0x36, 0x0a, 0x6f, 0x08, 0x20, 0x00, 0x00, 0x73,
+    0xae, 0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x86, 0xe7, 0x3c, 0x08, 0x41, 0x6b, 0x6d, 0xff, 0xff,
+    0xce, 0x79, 0x18, 0xe3, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x81, 0x6b, 0x2c, 0x08, 0x41, 0x3d, 0x00,
+    0x00, 0x9e, 0x08, 0x41, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xdb,
+    0xb5, 0x96, 0x7b, 0xef, 0x63, 0x2c, 0x52, 0x8a, 0x42, 0x08, 0x18, 0xc3, 0x00, 0x00, 0x6b, 0x4c,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x08, 0x20, 0x22, 0x6e, 0x03, 0x16,
+    0x02, 0xf4, 0x03, 0x36, 0x19, 0xeb, 0x08, 0x20, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf,
+    0x0c, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x08, 0x41, 0x00, 0x00, 0x19, 0x05,
+    0x13, 0x55, 0x15, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x21, 0x88, 0x01, 0x00, 0x00, 0x80, 0x52, 0x8a,
+    0x03, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x13, 0x01, 0x00, 0x00, 0x86, 0x10, 0x61,
+    0x08, 0x40, 0x00, 0x00, 0x08, 0x40, 0x0a, 0x4e, 0x03, 0x16, 0x02, 0xf4, 0x02, 0x02, 0xf5, 0x81,
+    0x0b, 0x56, 0x2a, 0x2b, 0x01, 0x00, 0x00, 0x81, 0x42, 0x08, 0xf7, 0xbe, 0x02, 0xff, 0xff, 0x86,
+    0xff, 0xdf, 0xff, 0xff, 0xb5, 0xb6, 0x08, 0x20, 0x00, 0x00, 0x10, 0x61, 0x1a, 0xf2, 0x0e, 0x02,
+    0xf5, 0x82, 0x02, 0xf4, 0x03, 0x36, 0x2a, 0x2c, 0x01, 0x00, 0x00, 0x80, 0x6b, 0x2c, 0x10, 0xff,
+    0xff, 0x8b, 0xf7, 0xbe, 0x29, 0x65, 0x00, 0x00, 0x08, 0x82, 0x1b, 0x55, 0x02, 0xf5, 0x02, 0xd5,
+    0x1b, 0x55, 0x21, 0x24, 0x00, 0x00, 0x29, 0x45, 0xf7, 0xbe, 0x03, 0xff, 0xff, 0x8b, 0x4a, 0x69,
+    0x29, 0x65, 0x18, 0xc3, 0x6b, 0x6d, 0x29, 0x65, 0x31, 0x86, 0xf7, 0xbe, 0xff, 0xdf, 0xff, 0xff,
+    0x9c, 0xd3, 0x00, 0x00, 0x08, 0x41, 0x3c, 0x00, 0x00, 0x82, 0x18, 0xc3, 0x08, 0x40, 0xd6, 0xba,
+    0x01, 0xff, 0xff, 0x90, 0xd6, 0x9a, 0x10, 0x82, 0x31, 0x86, 0x39, 0xe7, 0x63, 0x0c, 0x62, 0xeb,
+    0x18, 0xe3, 0xb5, 0xb6, 0xde, 0xdb, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x52, 0x8a,
+    0x00, 0x00, 0x08, 0x41, 0x2b, 0x53, 0x01, 0x02, 0xf5, 0x84, 0x1b, 0x55, 0x21, 0x46, 0x00, 0x00,
+    0x10, 0x82, 0xef, 0x7d, 0x10, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x81, 0x2a, 0x8f,
+    0x03, 0x16, 0x16, 0x02, 0xf5, 0x81, 0x1b, 0x55, 0x21, 0x25, 0x01, 0x00, 0x00, 0x82, 0x8c, 0x71,
+    0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x80, 0x63, 0x2c, 0x04, 0x00, 0x00, 0x82, 0x01, 0xab,
+    0x03, 0x37, 0x02, 0xf4, 0x01, 0x02, 0xf5, 0x85, 0x03, 0x16, 0x2a, 0xaf, 0x08, 0x20, 0x00, 0x00,
+    0x08, 0x61, 0xde, 0xdb, 0x04, 0xff, 0xff, 0x86, 0xe7, 0x1c, 0x10, 0xa2, 0x00, 0x00, 0x08, 0x20,
+    0x2a, 0x8e, 0x03, 0x16, 0x02, 0xf4, 0x0f, 0x02, 0xf5, 0x84, 0x13, 0x34, 0x18, 0xc3, 0x00, 0x00,
+    0x10, 0x82, 0xd6, 0xba, 0x0e, 0xff, 0xff, 0x9c, 0xff, 0xdf, 0xff, 0xff, 0x73, 0x8e, 0x00, 0x00,
+    0x10, 0x61, 0x22, 0xd0, 0x02, 0xf6, 0x02, 0xf4, 0x03, 0x36, 0x09, 0x47, 0x00, 0x00, 0x00, 0x21,
+    0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xcf, 0x00, 0x20, 0xde, 0xfb, 0xb5, 0x96,
+    0x42, 0x28, 0x4a, 0x69, 0xe6, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79, 0x08, 0x41,
+    0x21, 0x04, 0x3c, 0x00, 0x00, 0x82, 0x08, 0x41, 0x29, 0x45, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x86,
+    0xe7, 0x3c, 0x52, 0x8a, 0x31, 0xa6, 0xce, 0x59, 0xff, 0xff, 0xa5, 0x14, 0x52, 0xaa, 0x04, 0xff,
+    0xff, 0x8a, 0xef, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x19, 0x25, 0x03, 0x15, 0x02, 0xf5, 0x03, 0x16,
+    0x0a, 0xb1, 0x10, 0x61, 0x00, 0x00, 0x63, 0x0b, 0x10, 0xff, 0xff, 0x84, 0xd6, 0x9a, 0x08, 0x41,
+    0x00, 0x00, 0x21, 0x25, 0x0b, 0x35, 0x17, 0x02, 0xf5, 0x87, 0x02, 0xf6, 0x1a, 0xd1, 0x08, 0x20,
+    0x00, 0x00, 0x08, 0x41, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xef, 0x7d,
+    0x31, 0x85, 0x00, 0x00, 0x08, 0x41, 0x01, 0x00, 0x00, 0x81, 0x21, 0xeb, 0x0b, 0x36, 0x02, 0x02,
+    0xf5, 0x81, 0x1b, 0x13, 0x10, 0xa2, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf,
+    0x02, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x4a, 0x69, 0x01, 0x00, 0x00, 0x82, 0x29, 0xea, 0x0b, 0x56,
+    0x02, 0xd5, 0x10, 0x02, 0xf5, 0x81, 0x03, 0x16, 0x32, 0x6d, 0x01, 0x00, 0x00, 0x80, 0x73, 0x6d,
+    0x10, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x01, 0x00, 0x00, 0x87, 0x11, 0x89, 0x0b, 0x56, 0x02, 0xd4,
+    0x02, 0xf6, 0x3a, 0xef, 0x08, 0x20, 0x00, 0x00, 0x8c, 0x51, 0x01, 0xff, 0xff, 0x82, 0xa5, 0x34,
+    0x00, 0x00, 0xad, 0x55, 0x07, 0xff, 0xff, 0x82, 0xf7, 0x9e, 0x29, 0x45, 0x08, 0x61, 0x3d, 0x00,
+    0x00, 0x80, 0x4a, 0x69, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x84, 0x84, 0x30, 0x10, 0x82, 0x73,
+    0xae, 0x4a, 0x49, 0x94, 0x92, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x01, 0x00,
+    0x00, 0x84, 0x3a, 0x6c, 0x03, 0x36, 0x02, 0xd4, 0x03, 0x36, 0x32, 0x8e, 0x01, 0x00, 0x00, 0x82,
+    0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x85, 0x73, 0x8e, 0x00, 0x00, 0x08, 0x20,
+    0x22, 0x6e, 0x03, 0x16, 0x02, 0xf4, 0x17, 0x02, 0xf5, 0x85, 0x03, 0x36, 0x2a, 0x4d, 0x08, 0x20,
+    0x00, 0x00, 0x21, 0x04, 0xef, 0x5d, 0x04, 0xff, 0xff, 0x8a, 0xc6, 0x18, 0x4a, 0x69, 0xb5, 0xb6,
+    0x08, 0x61, 0x00, 0x00, 0x32, 0x0a, 0x0b, 0x56, 0x02, 0xd4, 0x02, 0xf5, 0x13, 0x55, 0x21, 0x66,
+    0x01, 0x00, 0x00, 0x82, 0x63, 0x2c, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0xff, 0xff, 0x7b, 0xef, 0x01, 0x00, 0x00, 0x81, 0x19, 0x04, 0x0b, 0x35, 0x13, 0x02, 0xf5, 0x84,
+    0x13, 0x14, 0x18, 0xe3, 0x00, 0x00, 0x18, 0xc2, 0xef, 0x5d, 0x0f, 0xff, 0xff, 0x84, 0xf7, 0xbe,
+    0x29, 0x65, 0x00, 0x00, 0x31, 0xa6, 0x13, 0x35, 0x01, 0x02, 0xf5, 0x80, 0x1a, 0xf3, 0x01, 0x00,
+    0x00, 0x80, 0x52, 0x8a, 0x01, 0xff, 0xff, 0x81, 0xad, 0x55, 0x8c, 0x71, 0x01, 0xff, 0xff, 0x88,
+    0xf7, 0x9e, 0xd6, 0xba, 0xad, 0x75, 0x94, 0xb2, 0x73, 0x8d, 0xce, 0x79, 0xff, 0xff, 0xff, 0xdf,
+    0x4a, 0x69, 0x3c, 0x00, 0x00, 0x82, 0x08, 0x61, 0x00, 0x00, 0x84, 0x30, 0x01, 0xff, 0xdf, 0x81,
+    0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x83, 0xd6, 0x7a, 0x31, 0x86, 0x00, 0x00, 0x9c, 0xf3,
+    0x04, 0xff, 0xff, 0x80, 0x8c, 0x71, 0x01, 0x00, 0x00, 0x87, 0x0a, 0x2f, 0x03, 0x16, 0x02, 0xf4,
+    0x03, 0x16, 0x21, 0x87, 0x00, 0x00, 0x10, 0xa2, 0xde, 0xdb, 0x0f, 0xff, 0xff, 0x84, 0xef, 0x3c,
+    0x18, 0xe3, 0x00, 0x00, 0x08, 0xa3, 0x13, 0x35, 0x19, 0x02, 0xf5, 0x82, 0x02, 0xd5, 0x0b, 0x36,
+    0x19, 0x67, 0x01, 0x00, 0x00, 0x80, 0x5a, 0xcb, 0x06, 0xff, 0xff, 0x87, 0xff, 0xdf, 0x31, 0x86,
+    0x00, 0x00, 0x39, 0xe8, 0x13, 0x35, 0x02, 0xd4, 0x03, 0x36, 0x19, 0xca, 0x01, 0x00, 0x00, 0x81,
+    0x31, 0xa6, 0xf7, 0xbe, 0x02, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xd7, 0x01, 0x00,
+    0x00, 0x82, 0x10, 0x82, 0x2b, 0x12, 0x02, 0xf6, 0x12, 0x02, 0xf5, 0x82, 0x02, 0xd4, 0x0b, 0x36,
+    0x21, 0xca, 0x01, 0x00, 0x00, 0x82, 0x94, 0x92, 0xff, 0xff, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x92,
+    0x63, 0x2c, 0x00, 0x00, 0x08, 0x41, 0x12, 0xd2, 0x03, 0x16, 0x02, 0xf5, 0x03, 0x15, 0x21, 0x45,
+    0x00, 0x00, 0x29, 0x65, 0xef, 0x7d, 0xff, 0xff, 0xff, 0xdf, 0xad, 0x55, 0x63, 0x0c, 0x39, 0xe7,
+    0x31, 0x86, 0x21, 0x24, 0x18, 0xe3, 0x01, 0x00, 0x00, 0x80, 0x94, 0x92, 0x01, 0xff, 0xff, 0x82,
+    0x84, 0x10, 0x00, 0x00, 0x08, 0x61, 0x3a, 0x00, 0x00, 0x82, 0x10, 0x82, 0x00, 0x00, 0xb5, 0x96,
+    0x06, 0xff, 0xff, 0x84, 0xff, 0xdf, 0x84, 0x10, 0x00, 0x00, 0x6b, 0x6d, 0xef, 0x7d, 0x02, 0xff,
+    0xff, 0x83, 0x5a, 0xcb, 0x00, 0x00, 0x29, 0x03, 0x1b, 0x33, 0x01, 0x02, 0xf5, 0x84, 0x1b, 0x55,
+    0x08, 0x82, 0x00, 0x00, 0x31, 0xa6, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff,
+    0xa5, 0x34, 0x01, 0x00, 0x00, 0x81, 0x32, 0x4b, 0x03, 0x16, 0x1b, 0x02, 0xf5, 0x81, 0x1b, 0x13,
+    0x10, 0xa3, 0x01, 0x00, 0x00, 0x80, 0x94, 0x92, 0x05, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0x42, 0x28,
+    0x00, 0x00, 0x29, 0x45, 0x0b, 0x14, 0x03, 0x16, 0x2a, 0xd0, 0x10, 0x40, 0x00, 0x00, 0x08, 0x61,
+    0xd6, 0xba, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x85, 0xef, 0x3c, 0x21, 0x24, 0x00, 0x00,
+    0x08, 0x00, 0x2a, 0x8e, 0x03, 0x16, 0x15, 0x02, 0xf5, 0x84, 0x23, 0x12, 0x08, 0x41, 0x00, 0x00,
+    0x39, 0xe7, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xf3, 0x01, 0x00,
+    0x00, 0x84, 0x3a, 0xcf, 0x03, 0x16, 0x02, 0xd4, 0x0b, 0x56, 0x3a, 0x4b, 0x01, 0x00, 0x00, 0x8b,
+    0xce, 0x79, 0xff, 0xff, 0xf7, 0xbe, 0x63, 0x2c, 0x42, 0x08, 0x84, 0x10, 0xbd, 0xf7, 0xb5, 0xb6,
+    0x63, 0x0c, 0x21, 0x04, 0x7b, 0xcf, 0xef, 0x3c, 0x01, 0xff, 0xff, 0x82, 0xb5, 0x96, 0x00, 0x00,
+    0x10, 0x82, 0x3a, 0x00, 0x00, 0x82, 0x08, 0x61, 0x00, 0x00, 0xd6, 0xba, 0x01, 0xff, 0xff, 0x83,
+    0xe7, 0x1c, 0xad, 0x55, 0xde, 0xfb, 0xf7, 0x9e, 0x02, 0xff, 0xff, 0x82, 0xc6, 0x59, 0x21, 0x04,
+    0xbd, 0xf7, 0x01, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0x21, 0x04, 0x00, 0x00, 0x19, 0x26, 0x1b, 0x76,
+    0x02, 0xd4, 0x02, 0xf5, 0x33, 0x11, 0x18, 0x81, 0x00, 0x00, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xdf,
+    0x0e, 0xff, 0xff, 0x84, 0x52, 0x8a, 0x00, 0x00, 0x10, 0x61, 0x1a, 0xd1, 0x03, 0x16, 0x1a, 0x02,
+    0xf5, 0x88, 0x02, 0xd4, 0x03, 0x37, 0x32, 0xf0, 0x08, 0x40, 0x00, 0x00, 0x00, 0x20, 0xbd, 0xd7,
+    0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x85, 0x5a, 0xcb, 0x00, 0x00, 0x00, 0x20, 0x02, 0xb3,
+    0x1b, 0x13, 0x10, 0x82, 0x01, 0x00, 0x00, 0x80, 0x9c, 0xf3, 0x03, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0xff, 0xff, 0x52, 0x8a, 0x01, 0x00, 0x00, 0x81, 0x29, 0xc8, 0x0b, 0x36, 0x16, 0x02, 0xf5, 0x86,
+    0x03, 0x15, 0x21, 0x87, 0x00, 0x00, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff,
+    0xff, 0x87, 0xde, 0xfb, 0x10, 0xa3, 0x00, 0x00, 0x19, 0x88, 0x03, 0x16, 0x02, 0xf4, 0x03, 0x36,
+    0x09, 0xed, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83,
+    0x84, 0x30, 0x21, 0x24, 0x52, 0xaa, 0xde, 0xdb, 0x03, 0xff, 0xff, 0x80, 0xd6, 0xba, 0x3c, 0x00,
+    0x00, 0x82, 0x00, 0x20, 0x10, 0x82, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x89, 0xbd, 0xd7, 0x21, 0x24,
+    0x00, 0x00, 0x10, 0xa2, 0x42, 0x28, 0x63, 0x0c, 0x84, 0x30, 0xc6, 0x38, 0xde, 0xdb, 0xf7, 0x9e,
+    0x01, 0xff, 0xff, 0x87, 0xde, 0xdb, 0x08, 0x61, 0x00, 0x00, 0x01, 0x27, 0x03, 0x36, 0x02, 0xd4,
+    0x03, 0x36, 0x01, 0xcb, 0x01, 0x00, 0x00, 0x80, 0xb5, 0x96, 0x0f, 0xff, 0xff, 0x85, 0xe7, 0x3c,
+    0x00, 0x20, 0x00, 0x00, 0x29, 0x66, 0x13, 0x55, 0x02, 0xd5, 0x1a, 0x02, 0xf5, 0x82, 0x03, 0x36,
+    0x23, 0x12, 0x21, 0x25, 0x01, 0x00, 0x00, 0x81, 0x00, 0x20, 0x94, 0x92, 0x01, 0xff, 0xdf, 0x01,
+    0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x4d, 0x01, 0x00, 0x00, 0x81, 0x2b, 0x33, 0x19,
+    0x47, 0x01, 0x00, 0x00, 0x82, 0x6b, 0x4d, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xff, 0xff, 0x8c, 0x71, 0x01, 0x00, 0x00, 0x81, 0x21, 0x45, 0x1b, 0x55, 0x16, 0x02, 0xf5,
+    0x82, 0x02, 0xf4, 0x03, 0x36, 0x1a, 0x4e, 0x01, 0x00, 0x00, 0x82, 0x84, 0x10, 0xff, 0xff, 0xff,
+    0xdf, 0x0d, 0xff, 0xff, 0x8a, 0xff, 0xdf, 0x29, 0x45, 0x00, 0x00, 0x10, 0xa4, 0x1b, 0x55, 0x02,
+    0xd5, 0x02, 0xf5, 0x1a, 0xf1, 0x18, 0xa1, 0x00, 0x00, 0x7b, 0xef, 0x01, 0xff, 0xff, 0x84, 0xf7,
+    0x9e, 0x9c, 0xd3, 0x29, 0x65, 0x52, 0x8a, 0xce, 0x79, 0x01, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x01,
+    0xff, 0xff, 0x80, 0xef, 0x5d, 0x01, 0x10, 0xa2, 0x31, 0x00, 0x00, 0x80, 0x00, 0x20, 0x01, 0x08,
+    0x61, 0x05, 0x00, 0x20, 0x82, 0x00, 0x00, 0x31, 0x86, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x88, 0xff,
+    0xdf, 0xd6, 0xba, 0xb5, 0xb6, 0x84, 0x10, 0x5a, 0xcb, 0x18, 0xc3, 0x18, 0xe3, 0x52, 0xaa, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x80, 0xb5, 0xb6, 0x01, 0x00, 0x00, 0x87, 0x32, 0x8d, 0x03, 0x16, 0x02,
+    0xd4, 0x13, 0x56, 0x21, 0xa9, 0x00, 0x00, 0x00, 0x20, 0xde, 0xdb, 0x0d, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xff, 0xff, 0xa5, 0x34, 0x01, 0x00, 0x00, 0x82, 0x19, 0xeb, 0x03, 0x36, 0x02, 0xf4, 0x19,
+    0x02, 0xf5, 0x82, 0x0b, 0x15, 0x22, 0x2c, 0x08, 0x40, 0x02, 0x00, 0x00, 0x80, 0x63, 0x2c, 0x04,
+    0xff, 0xff, 0x89, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x00, 0x00, 0x00, 0x21, 0x29, 0x66, 0x00,
+    0x20, 0x00, 0x00, 0x29, 0x65, 0xf7, 0xbe, 0x02, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xc5,
+    0xf7, 0x00, 0x20, 0x00, 0x00, 0x10, 0x61, 0x22, 0xf1, 0x02, 0xf6, 0x18, 0x02, 0xf5, 0x83, 0x1b,
+    0x13, 0x20, 0xe3, 0x00, 0x00, 0x42, 0x08, 0x10, 0xff, 0xff, 0x83, 0x63, 0x2c, 0x00, 0x00, 0x20,
+    0xc2, 0x33, 0x53, 0x01, 0x02, 0xf5, 0x83, 0x2b, 0x74, 0x21, 0x04, 0x00, 0x00, 0x31, 0xa6, 0x01,
+    0xff, 0xff, 0x86, 0xc6, 0x18, 0x00, 0x00, 0x29, 0x45, 0x9c, 0xf3, 0xc6, 0x38, 0xd6, 0x9a, 0xf7,
+    0x9e, 0x03, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x42, 0x28, 0x04, 0x08, 0x41, 0x02, 0x08, 0x61, 0x80,
+    0x08, 0x41, 0x29, 0x00, 0x00, 0x84, 0x08, 0x41, 0x00, 0x00, 0x29, 0x65, 0x6b, 0x4d, 0x63, 0x0c,
+    0x03, 0x63, 0x2c, 0x81, 0x6b, 0x4d, 0x9c, 0xd3, 0x02, 0xff, 0xff, 0x81, 0x9c, 0xd3, 0xd6, 0xba,
+    0x04, 0xff, 0xff, 0x88, 0xef, 0x5d, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x30,
+    0x00, 0x00, 0x08, 0x20, 0x3b, 0x31, 0x01, 0x02, 0xf5, 0x84, 0x13, 0x55, 0x31, 0xa6, 0x00, 0x00,
+    0x31, 0xa6, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0x5a, 0xcb, 0x00, 0x00,
+    0x10, 0x61, 0x33, 0x52, 0x1b, 0x02, 0xf5, 0x82, 0x12, 0xf4, 0x19, 0xca, 0x18, 0xc3, 0x02, 0x00,
+    0x00, 0x83, 0x00, 0x20, 0x41, 0xe7, 0x9c, 0xd2, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0xff, 0xff, 0xad, 0x55, 0x03, 0x00, 0x00, 0x81, 0x10, 0x81, 0xce, 0x59, 0x04, 0xff, 0xff, 0x85,
+    0xef, 0x5d, 0x29, 0x45, 0x00, 0x00, 0x08, 0x20, 0x32, 0x6d, 0x0b, 0x36, 0x18, 0x02, 0xf5, 0x85,
+    0x02, 0xd4, 0x13, 0x76, 0x11, 0x26, 0x00, 0x00, 0x08, 0x61, 0xde, 0xfb, 0x0d, 0xff, 0xff, 0x97,
+    0xff, 0xdf, 0xff, 0xff, 0x9c, 0xb2, 0x00, 0x00, 0x08, 0x20, 0x0a, 0x4e, 0x03, 0x16, 0x02, 0xd4,
+    0x0b, 0x56, 0x08, 0xc4, 0x00, 0x00, 0x19, 0x04, 0xf7, 0xbe, 0xff, 0xff, 0xef, 0x7d, 0xbd, 0xf7,
+    0x94, 0x92, 0x6b, 0x2c, 0x52, 0x8a, 0x52, 0xaa, 0x4a, 0x49, 0x5a, 0xeb, 0x73, 0x8e, 0xce, 0x59,
+    0x01, 0xff, 0xff, 0x81, 0x7b, 0xef, 0x21, 0x24, 0x02, 0x29, 0x45, 0x03, 0x00, 0x00, 0x81, 0x08,
+    0x41, 0x00, 0x20, 0x28, 0x00, 0x00, 0x83, 0x10, 0x82, 0x00, 0x00, 0x9c, 0xd3, 0xff, 0xdf, 0x09,
+    0xff, 0xff, 0x83, 0x18, 0xe3, 0x00, 0x20, 0xce, 0x79, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x89, 0xff,
+    0xff, 0x73, 0xae, 0xad, 0x55, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5b, 0x0c, 0x00, 0x00, 0x08,
+    0x20, 0x1a, 0xf2, 0x01, 0x02, 0xf5, 0x83, 0x02, 0xb2, 0x10, 0x81, 0x00, 0x00, 0x5a, 0xeb, 0x0f,
+    0xff, 0xff, 0x85, 0xf7, 0xbe, 0x31, 0xa6, 0x00, 0x00, 0x08, 0xa3, 0x02, 0xf4, 0x02, 0xd5, 0x1b,
+    0x02, 0xf5, 0x84, 0x03, 0x36, 0x0a, 0xf4, 0x32, 0x8e, 0x19, 0x05, 0x08, 0x20, 0x02, 0x00, 0x00,
+    0x82, 0x18, 0xc3, 0x7b, 0xef, 0xd6, 0xba, 0x01, 0xff, 0xff, 0x81, 0xbd, 0xf7, 0x00, 0x20, 0x02,
+    0x00, 0x00, 0x82, 0x94, 0xb2, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0x52, 0xaa, 0x01, 0x00, 0x00, 0x82, 0x21, 0x87, 0x03, 0x36, 0x02, 0xd4, 0x18, 0x02, 0xf5,
+    0x87, 0x02, 0xf4, 0x02, 0xf6, 0x22, 0x2c, 0x08, 0x00, 0x00, 0x00, 0x9c, 0xf3, 0xff, 0xff, 0xff,
+    0xdf, 0x0d, 0xff, 0xff, 0x80, 0xbd, 0xf7, 0x01, 0x00, 0x00, 0x87, 0x11, 0xab, 0x03, 0x36, 0x02,
+    0xd4, 0x03, 0x16, 0x09, 0x26, 0x00, 0x00, 0x10, 0xa2, 0xde, 0xdb, 0x03, 0xff, 0xff, 0x83, 0xff,
+    0xdf, 0xce, 0x59, 0x94, 0x92, 0x4a, 0x69, 0x01, 0x00, 0x00, 0x83, 0x84, 0x30, 0xff, 0xff, 0xff,
+    0xdf, 0xf7, 0xbe, 0x03, 0xf7, 0x9e, 0x80, 0xe7, 0x1c, 0x01, 0xde, 0xdb, 0x82, 0x94, 0x92, 0x00,
+    0x20, 0x08, 0x41, 0x28, 0x00, 0x00, 0x82, 0x10, 0xa2, 0x00, 0x00, 0xa5, 0x14, 0x01, 0xff, 0xdf,
+    0x07, 0xff, 0xff, 0x93, 0xe7, 0x3c, 0x39, 0xc7, 0x52, 0x8a, 0x18, 0xc3, 0xce, 0x59, 0xff, 0xff,
+    0xf7, 0xbe, 0xff, 0xff, 0x39, 0xe7, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x4a, 0x69,
+    0x00, 0x00, 0x00, 0x41, 0x03, 0x15, 0x0b, 0x36, 0x0b, 0x57, 0x1a, 0xd1, 0x01, 0x00, 0x00, 0x82,
+    0x7b, 0xcf, 0xff, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79,
+    0x08, 0x41, 0x00, 0x00, 0x42, 0x6b, 0x0b, 0x77, 0x1c, 0x0b, 0x36, 0x01, 0x03, 0x36, 0x84, 0x03,
+    0x57, 0x23, 0x97, 0x22, 0xd1, 0x32, 0x0a, 0x10, 0x61, 0x02, 0x00, 0x00, 0x84, 0x08, 0x61, 0x52,
+    0x8a, 0xbd, 0xf7, 0xd6, 0xba, 0x08, 0x61, 0x01, 0x00, 0x00, 0x80, 0x63, 0x2c, 0x05, 0xff, 0xff,
+    0x80, 0x8c, 0x71, 0x01, 0x00, 0x00, 0x82, 0x18, 0xe4, 0x23, 0x55, 0x03, 0x36, 0x0b, 0x0b, 0x36,
+    0x0e, 0x03, 0x36, 0x86, 0x03, 0x37, 0x3b, 0x73, 0x08, 0x40, 0x00, 0x00, 0x5a, 0xeb, 0xff, 0xff,
+    0xff, 0xdf, 0x0d, 0xff, 0xff, 0x8a, 0xe7, 0x1c, 0x08, 0x61, 0x00, 0x00, 0x3a, 0x2a, 0x13, 0x97,
+    0x03, 0x16, 0x03, 0x37, 0x42, 0xef, 0x00, 0x00, 0x00, 0x20, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x88,
+    0x8c, 0x51, 0x31, 0x85, 0x21, 0x04, 0x00, 0x00, 0x39, 0xc7, 0x63, 0x0b, 0x8c, 0x71, 0xad, 0x75,
+    0xe7, 0x1c, 0x09, 0xff, 0xff, 0x82, 0xc6, 0x38, 0x00, 0x00, 0x08, 0x41, 0x28, 0x00, 0x00, 0x84,
+    0x18, 0xe3, 0x00, 0x00, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x89, 0xd6, 0xba,
+    0x29, 0x65, 0xf7, 0x9e, 0x7b, 0xef, 0x10, 0x82, 0xce, 0x79, 0xff, 0xff, 0xff, 0xdf, 0x3a, 0x08,
+    0xad, 0x75, 0x01, 0xff, 0xff, 0x83, 0xf7, 0x9e, 0x29, 0x65, 0x00, 0x00, 0x18, 0xe3, 0x01, 0x42,
+    0x8c, 0x81, 0x42, 0xad, 0x31, 0xe8, 0x01, 0x00, 0x00, 0x82, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf,
+    0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x01, 0x00, 0x00, 0x81, 0x31, 0xa7,
+    0x4a, 0xad, 0x1f, 0x42, 0x8c, 0x83, 0x3a, 0x6c, 0x3a, 0xad, 0x52, 0xed, 0x31, 0xc7, 0x02, 0x00,
+    0x20, 0x01, 0x00, 0x00, 0x90, 0x00, 0x20, 0x31, 0x86, 0x10, 0x82, 0x00, 0x00, 0x08, 0x41, 0x63,
+    0x2c, 0x7b, 0xcf, 0x73, 0xae, 0x7b, 0xce, 0x73, 0xae, 0x7b, 0xcf, 0x73, 0x8e, 0x10, 0xa2, 0x00,
+    0x20, 0x00, 0x00, 0x29, 0x87, 0x4a, 0xcd, 0x0c, 0x42, 0x8c, 0x80, 0x2a, 0x4d, 0x0e, 0x22, 0x4e,
+    0x84, 0x2a, 0x2d, 0x00, 0x20, 0x00, 0x00, 0x42, 0x08, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x87, 0xf7,
+    0x9e, 0x31, 0xa6, 0x00, 0x00, 0x21, 0x25, 0x2a, 0x6e, 0x22, 0x2d, 0x22, 0x4e, 0x32, 0x0a, 0x01,
+    0x00, 0x00, 0x80, 0xa5, 0x34, 0x01, 0xff, 0xff, 0x83, 0xad, 0x55, 0xa5, 0x34, 0xd6, 0x9a, 0xef,
+    0x7d, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xc6, 0x38, 0x2a, 0x00, 0x00, 0x84, 0x08,
+    0x61, 0x00, 0x00, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff,
+    0xff, 0xc6, 0x18, 0x21, 0x24, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x08, 0x61, 0xce, 0x79, 0xff,
+    0xff, 0x31, 0x86, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x81, 0xef, 0x3c, 0x21, 0x04, 0x06, 0x00, 0x00,
+    0x83, 0x08, 0x41, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0x84, 0x10, 0x5d, 0x00, 0x00, 0x81, 0x18, 0xe3, 0xe7, 0x3c, 0x0f, 0xff, 0xff, 0x80, 0x52,
+    0x8a, 0x05, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x7b, 0xef, 0x01, 0xff, 0xff, 0x83, 0xad,
+    0x75, 0x4a, 0x69, 0xb5, 0x96, 0xef, 0x7d, 0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x09, 0xff, 0xff,
+    0x80, 0xde, 0xdb, 0x2c, 0x00, 0x00, 0x80, 0xde, 0xdb, 0x07, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff,
+    0xff, 0x94, 0xb2, 0x29, 0x45, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x73, 0x8e, 0x10, 0xa2, 0xad,
+    0x75, 0x31, 0xa6, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x80, 0xd6, 0x9a, 0x01, 0x00, 0x00, 0x87, 0x08,
+    0x61, 0x18, 0xe3, 0x18, 0xc3, 0x18, 0xe3, 0x08, 0x21, 0x00, 0x00, 0x18, 0xc3, 0xde, 0xfb, 0x0f,
+    0xff, 0xff, 0x83, 0x52, 0x8a, 0x00, 0x00, 0x08, 0x61, 0x39, 0xe7, 0x08, 0x42, 0x08, 0x80, 0x3a,
+    0x08, 0x02, 0x31, 0xa6, 0x01, 0x39, 0xe7, 0x0f, 0x42, 0x08, 0x80, 0x31, 0xa7, 0x06, 0x31, 0xa6,
+    0x08, 0x39, 0xe7, 0x81, 0x42, 0x08, 0x39, 0xe7, 0x04, 0x31, 0xa6, 0x01, 0x31, 0x86, 0x0a, 0x31,
+    0xa6, 0x02, 0x39, 0xe7, 0x11, 0x31, 0xa6, 0x80, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0xc6, 0x38,
+    0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x82, 0x63, 0x2c, 0x00, 0x00, 0x00, 0x20, 0x03, 0x00,
+    0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x6b, 0x6d, 0x01, 0xff, 0xff, 0x86, 0xce, 0x59, 0x4a, 0x69,
+    0x29, 0x65, 0x08, 0x61, 0x52, 0x8a, 0x8c, 0x51, 0xd6, 0x9a, 0x0b, 0xff, 0xff, 0x82, 0xe7, 0x1c,
+    0x00, 0x00, 0x00, 0x20, 0x29, 0x00, 0x00, 0x81, 0x00, 0x20, 0xe7, 0x3c, 0x09, 0xff, 0xff, 0x82,
+    0xce, 0x59, 0x9c, 0xf3, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x84, 0xff, 0xff, 0x7b, 0xcf, 0x00, 0x00,
+    0x08, 0x61, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x80, 0xc6, 0x38, 0x01, 0x00, 0x00, 0x87, 0x73, 0x8e,
+    0xe7, 0x1c, 0xde, 0xdb, 0xe7, 0x1c, 0x31, 0x86, 0x00, 0x00, 0x21, 0x24, 0xef, 0x7d, 0x0f, 0xff,
+    0xff, 0x82, 0x21, 0x24, 0x00, 0x00, 0x42, 0x08, 0x02, 0xff, 0xdf, 0x06, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x01, 0xf7, 0x9e, 0x84, 0xe7, 0x3c, 0xb5, 0xb6, 0xbd, 0xd7, 0xbd, 0xf7, 0xf7, 0xbe, 0x0d,
+    0xff, 0xff, 0x80, 0xf7, 0xbe, 0x06, 0xf7, 0x9e, 0x80, 0xbd, 0xf7, 0x08, 0xbd, 0xd7, 0x80, 0xce,
+    0x59, 0x10, 0xf7, 0x9e, 0x81, 0xef, 0x7d, 0xc6, 0x18, 0x01, 0xbd, 0xd7, 0x80, 0xef, 0x7d, 0x0f,
+    0xf7, 0x9e, 0x81, 0xf7, 0xbe, 0x8c, 0x51, 0x01, 0x00, 0x00, 0x80, 0xad, 0x55, 0x0d, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x01, 0x00, 0x00, 0x80, 0x94, 0xb2, 0x01, 0xbd, 0xf7,
+    0x80, 0xad, 0x55, 0x01, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x03, 0xff, 0xff, 0x86, 0xef, 0x7d, 0x29,
+    0x65, 0x5a, 0xcb, 0x31, 0xa6, 0x31, 0x86, 0x52, 0x8a, 0x8c, 0x71, 0x09, 0xff, 0xff, 0x82, 0xf7,
+    0x9e, 0x21, 0x24, 0x29, 0x45, 0x29, 0x00, 0x00, 0x81, 0x31, 0x86, 0xf7, 0x9e, 0x10, 0xff, 0xff,
+    0x81, 0x84, 0x10, 0x52, 0xaa, 0x02, 0xff, 0xff, 0x80, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x80, 0x9c,
+    0xd3, 0x02, 0xff, 0xff, 0x83, 0x31, 0x86, 0x00, 0x00, 0x29, 0x65, 0xff, 0xdf, 0x0e, 0xff, 0xff,
+    0x85, 0xef, 0x5d, 0x10, 0xa2, 0x00, 0x00, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xdf, 0x0a, 0xff, 0xff,
+    0x80, 0x9c, 0xd3, 0x02, 0x00, 0x00, 0x80, 0xad, 0x75, 0x14, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x08,
+    0x41, 0x08, 0x00, 0x00, 0x80, 0x52, 0xab, 0x10, 0xff, 0xff, 0x81, 0xf7, 0x9e, 0x29, 0x45, 0x01,
+    0x00, 0x00, 0x80, 0xef, 0x7d, 0x10, 0xff, 0xff, 0x85, 0xb5, 0xb6, 0x00, 0x20, 0x00, 0x00, 0x8c,
+    0x71, 0xff, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x01,
+    0x00, 0x00, 0x80, 0xbd, 0xd7, 0x02, 0xff, 0xff, 0x82, 0x21, 0x04, 0x00, 0x00, 0x52, 0x8a, 0x01,
+    0xff, 0xff, 0x01, 0xff, 0xdf, 0x87, 0xff, 0xff, 0x42, 0x08, 0xd6, 0xba, 0xff, 0xff, 0xc6, 0x18,
+    0x10, 0xa2, 0x00, 0x00, 0xef, 0x7d, 0x08, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x29, 0x65, 0x29, 0x45,
+    0x29, 0x00, 0x00, 0x81, 0x31, 0xa6, 0xf7, 0xbe, 0x0b, 0xff, 0xff, 0x84, 0xb5, 0xb6, 0x5a, 0xeb,
+    0x5a, 0xcb, 0x73, 0xae, 0xb5, 0xb6, 0x04, 0xff, 0xff, 0x80, 0xad, 0x75, 0x01, 0x00, 0x00, 0x86,
+    0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x29, 0x45, 0x00, 0x00, 0x31, 0xa6, 0x0f, 0xff,
+    0xff, 0x85, 0xd6, 0x9a, 0x08, 0x61, 0x00, 0x00, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xdf, 0x0a, 0xff,
+    0xff, 0x84, 0x31, 0x86, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x4a, 0x69, 0x14, 0xff, 0xff, 0x81,
+    0xf7, 0xbe, 0x08, 0x61, 0x06, 0x00, 0x00, 0x84, 0x00, 0x20, 0x00, 0x00, 0x52, 0xaa, 0xff, 0xff,
+    0xff, 0xdf, 0x0c, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x7d, 0x29, 0x45, 0x01, 0x00,
+    0x00, 0x82, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff,
+    0xd6, 0x79, 0x10, 0x82, 0x00, 0x00, 0x73, 0x8e, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff,
+    0xb5, 0xb6, 0x01, 0x00, 0x00, 0x86, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x39, 0xc7,
+    0x00, 0x00, 0x4a, 0x69, 0x02, 0xff, 0xff, 0x88, 0xff, 0xdf, 0xff, 0xff, 0x42, 0x28, 0x84, 0x10,
+    0x63, 0x2c, 0x21, 0x04, 0x4a, 0x49, 0xc6, 0x18, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0x39, 0xe7, 0x29, 0x45, 0x29, 0x00, 0x00, 0x81, 0x4a, 0x49, 0xff, 0xdf, 0x09, 0xff, 0xff, 0x8c,
+    0xf7, 0xbe, 0x63, 0x0c, 0x08, 0x61, 0x5a, 0xcb, 0x63, 0x0c, 0x4a, 0x49, 0x00, 0x00, 0x52, 0x69,
+    0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x01, 0x00, 0x00, 0x80, 0x9c, 0xf3,
+    0x01, 0xff, 0xff, 0x85, 0xe7, 0x3c, 0x21, 0x04, 0x00, 0x00, 0x31, 0xa6, 0xff, 0xff, 0xff, 0xdf,
+    0x0d, 0xff, 0xff, 0x85, 0xc6, 0x38, 0x08, 0x41, 0x00, 0x00, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf,
+    0x09, 0xff, 0xff, 0x81, 0xce, 0x59, 0x00, 0x20, 0x02, 0x00, 0x00, 0x81, 0x08, 0x61, 0xd6, 0x9a,
+    0x13, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x08, 0x61, 0x00, 0x00, 0x10, 0xa2, 0xa5, 0x34, 0x04, 0xbd,
+    0xd7, 0x81, 0xb5, 0xb6, 0xce, 0x79, 0x10, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00,
+    0x00, 0x20, 0xef, 0x5d, 0x10, 0xff, 0xff, 0x83, 0xe7, 0x1c, 0x18, 0xe3, 0x00, 0x00, 0x6b, 0x4d,
+    0x0d, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0xb6, 0x00, 0x20, 0x00, 0x00, 0x8c, 0x71,
+    0x01, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x31, 0xa6, 0x00, 0x00, 0x31, 0x86, 0xf7, 0x9e, 0x02, 0xff,
+    0xff, 0x84, 0xc6, 0x18, 0x08, 0x61, 0x00, 0x00, 0x52, 0x8a, 0xb5, 0xb6, 0x0c, 0xff, 0xff, 0x81,
+    0x52, 0x89, 0x29, 0x65, 0x29, 0x00, 0x00, 0x80, 0x5a, 0xcb, 0x08, 0xff, 0xff, 0x84, 0xff, 0xdf,
+    0xff, 0xff, 0xa5, 0x14, 0x00, 0x20, 0xd6, 0x9a, 0x02, 0xff, 0xff, 0x89, 0xde, 0xdb, 0x10, 0xa2,
+    0x94, 0x92, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x91, 0x00, 0x00, 0x08, 0x41, 0xc6, 0x18,
+    0x01, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x18, 0xc3, 0x00, 0x00, 0x6b, 0x2c, 0x0d, 0xff, 0xff, 0x82,
+    0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x82, 0x94, 0xb2, 0xff, 0xff, 0xff, 0xdf,
+    0x09, 0xff, 0xff, 0x83, 0x6b, 0x4d, 0x00, 0x00, 0x08, 0x41, 0x31, 0xa6, 0x01, 0x00, 0x00, 0x82,
+    0x7b, 0xcf, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x08, 0x61, 0x00, 0x00,
+    0x21, 0x04, 0xf7, 0x9e, 0x17, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20,
+    0xef, 0x5d, 0x10, 0xff, 0xff, 0x83, 0xe7, 0x3c, 0x21, 0x24, 0x00, 0x00, 0x31, 0x86, 0x0f, 0xff,
+    0xff, 0x90, 0xce, 0x79, 0x08, 0x61, 0x00, 0x00, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
+    0x52, 0x8a, 0x00, 0x00, 0x31, 0xa6, 0xf7, 0x9e, 0xff, 0xff, 0xef, 0x5d, 0x42, 0x08, 0x10, 0x82,
+    0x5a, 0xeb, 0xd6, 0x9a, 0x02, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0xdf, 0x09, 0xff, 0xff, 0x81,
+    0x4a, 0x69, 0x29, 0x45, 0x29, 0x00, 0x00, 0x80, 0x52, 0xaa, 0x0a, 0xff, 0xff, 0x82, 0x73, 0x6d,
+    0x73, 0x8e, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x89, 0xff, 0xff, 0x84, 0x10, 0x5a, 0xeb, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x00, 0x00, 0x08, 0x61, 0xce, 0x79, 0x01, 0xff, 0xff, 0x83,
+    0xde, 0xfb, 0x18, 0xc3, 0x00, 0x00, 0x7b, 0xcf, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff,
+    0xa5, 0x34, 0x01, 0x00, 0x00, 0x82, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x88,
+    0xef, 0x7d, 0x21, 0x04, 0x00, 0x00, 0x29, 0x45, 0xc6, 0x38, 0x10, 0x82, 0x00, 0x00, 0x18, 0xc3,
+    0xef, 0x7d, 0x12, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x08, 0x61, 0x00, 0x00, 0x18, 0xe3, 0xe7, 0x3c,
+    0x17, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0xef, 0x5d, 0x10, 0xff,
+    0xff, 0x83, 0xf7, 0xbe, 0x31, 0x86, 0x00, 0x00, 0x29, 0x45, 0x0f, 0xff, 0xff, 0x8e, 0xd6, 0x9a,
+    0x10, 0x82, 0x00, 0x00, 0x8c, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x52, 0xcb, 0x00, 0x00,
+    0x31, 0xa6, 0xf7, 0x9e, 0xff, 0xff, 0xe7, 0x1c, 0x73, 0x8e, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x01,
+    0xff, 0xdf, 0x82, 0xff, 0xff, 0x6b, 0x4d, 0xbd, 0xd7, 0x09, 0xff, 0xff, 0x81, 0x4a, 0x69, 0x31,
+    0xa6, 0x29, 0x00, 0x00, 0x80, 0x52, 0xaa, 0x0a, 0xff, 0xff, 0x81, 0x5a, 0xcb, 0x94, 0x92, 0x04,
+    0xff, 0xff, 0x88, 0x84, 0x30, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x00,
+    0x00, 0x08, 0x61, 0xce, 0x59, 0x01, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x18, 0xc3, 0x00, 0x00, 0x73,
+    0xae, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x34, 0x01, 0x00, 0x00, 0x80, 0xbd,
+    0xd7, 0x0a, 0xff, 0xff, 0x80, 0xad, 0x55, 0x01, 0x00, 0x00, 0x82, 0x6b, 0x4d, 0xff, 0xff, 0x4a,
+    0x49, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x84, 0xf7,
+    0xbe, 0x08, 0x61, 0x00, 0x00, 0x08, 0x41, 0x4a, 0x28, 0x04, 0x52, 0x8a, 0x81, 0x5a, 0xeb, 0xe7,
+    0x3c, 0x10, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0xef, 0x5d, 0x11,
+    0xff, 0xff, 0x82, 0x31, 0xa6, 0x00, 0x00, 0x29, 0x65, 0x0f, 0xff, 0xff, 0x8a, 0xd6, 0x9a, 0x08,
+    0x61, 0x00, 0x00, 0x8c, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x52, 0xaa, 0x00, 0x00, 0x31,
+    0x86, 0xf7, 0xbe, 0x08, 0xff, 0xff, 0x83, 0x39, 0xe7, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x07,
+    0xff, 0xff, 0x81, 0x4a, 0x69, 0x39, 0xe7, 0x29, 0x00, 0x00, 0x80, 0x52, 0xaa, 0x0a, 0xff, 0xff,
+    0x8f, 0x5a, 0xcb, 0x84, 0x30, 0xf7, 0x9e, 0xef, 0x7d, 0xf7, 0x9e, 0xff, 0xdf, 0xff, 0xff, 0x84,
+    0x30, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x00, 0x00, 0x08, 0x61, 0xce,
+    0x59, 0x01, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x18, 0xc3, 0x00, 0x00, 0x73, 0xae, 0x0d, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x01, 0x00, 0x00, 0x82, 0xb5, 0xb6, 0xff, 0xff, 0xff,
+    0xdf, 0x08, 0xff, 0xff, 0x85, 0x42, 0x08, 0x00, 0x00, 0x00, 0x20, 0xb5, 0x96, 0xff, 0xdf, 0x9c,
+    0xf3, 0x01, 0x00, 0x00, 0x80, 0x42, 0x28, 0x12, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0x08, 0x61, 0x08,
+    0x00, 0x00, 0x80, 0xde, 0xdb, 0x10, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00,
+    0x20, 0xef, 0x5d, 0x10, 0xff, 0xff, 0x83, 0xff, 0xdf, 0x31, 0xa6, 0x00, 0x00, 0x29, 0x65, 0x0f,
+    0xff, 0xff, 0x90, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x00, 0x8c, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0x52, 0xaa, 0x00, 0x00, 0x31, 0xa6, 0xf7, 0x9e, 0xff, 0xff, 0xef, 0x7d, 0xad, 0x54, 0xa5,
+    0x14, 0xa5, 0x34, 0xb5, 0x96, 0x01, 0xc6, 0x38, 0x84, 0xce, 0x79, 0x39, 0xc7, 0xad, 0x55, 0xff,
+    0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x81, 0x4a, 0x69, 0x39, 0xc7, 0x29, 0x00, 0x00, 0x80, 0x52,
+    0xaa, 0x0a, 0xff, 0xff, 0x80, 0x5a, 0xeb, 0x03, 0x00, 0x00, 0x8a, 0x21, 0x24, 0x39, 0xc7, 0x08,
+    0x61, 0x63, 0x2c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x00, 0x00, 0x08, 0x41, 0xce,
+    0x59, 0x01, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x18, 0xc3, 0x00, 0x00, 0x73, 0xae, 0x0d, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x34, 0x01, 0x00, 0x00, 0x80, 0xbd, 0xd7, 0x09, 0xff, 0xff,
+    0x83, 0xd6, 0x9a, 0x08, 0x41, 0x00, 0x00, 0x31, 0x86, 0x01, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x18,
+    0xe3, 0x01, 0x00, 0x00, 0x80, 0xce, 0x79, 0x11, 0xff, 0xff, 0x86, 0xf7, 0xbe, 0x08, 0x61, 0x00,
+    0x00, 0x08, 0x41, 0x4a, 0x49, 0x52, 0x8a, 0x4a, 0x69, 0x02, 0x52, 0x8a, 0x81, 0x63, 0x0c, 0xe7,
+    0x3c, 0x10, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0xef, 0x5d, 0x11,
+    0xff, 0xff, 0x82, 0x31, 0xa6, 0x00, 0x00, 0x29, 0x65, 0x0f, 0xff, 0xff, 0x8e, 0xd6, 0x9a, 0x08,
+    0x61, 0x00, 0x00, 0x8c, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5a, 0xcb, 0x00, 0x00, 0x31,
+    0xa6, 0xf7, 0x9e, 0xff, 0xff, 0xde, 0xdb, 0x39, 0xe7, 0x31, 0x86, 0x01, 0x31, 0xa6, 0x01, 0x39,
+    0xc7, 0x82, 0x18, 0xe3, 0x00, 0x20, 0xbd, 0xf7, 0x09, 0xff, 0xff, 0x81, 0x52, 0x8a, 0x29, 0x45,
+    0x29, 0x00, 0x00, 0x80, 0x52, 0xaa, 0x0a, 0xff, 0xff, 0x82, 0xe7, 0x1c, 0xc6, 0x18, 0xbd, 0xf7,
+    0x01, 0xc6, 0x18, 0x01, 0xbd, 0xd7, 0x85, 0xad, 0x55, 0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0x94, 0x91, 0x01, 0x00, 0x00, 0x80, 0xad, 0x55, 0x01, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x18,
+    0xc3, 0x00, 0x00, 0x7b, 0xae, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x01,
+    0x00, 0x00, 0x82, 0xad, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0x7b, 0xef, 0x01, 0x00, 0x00, 0x80, 0x10, 0x82, 0x01, 0x39, 0xe7, 0x81, 0x42, 0x08, 0x18,
+    0xc3, 0x01, 0x00, 0x00, 0x80, 0x73, 0xae, 0x11, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x08, 0x61, 0x00,
+    0x00, 0x21, 0x04, 0xef, 0x5d, 0x17, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00,
+    0x20, 0xef, 0x5d, 0x10, 0xff, 0xff, 0x83, 0xf7, 0xbe, 0x31, 0x86, 0x00, 0x00, 0x29, 0x45, 0x0f,
+    0xff, 0xff, 0x83, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x00, 0x8c, 0x30, 0x01, 0xff, 0xff, 0x86, 0xff,
+    0xdf, 0x39, 0xe7, 0x00, 0x00, 0x31, 0x86, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0x03, 0xf7, 0xbe,
+    0x84, 0xf7, 0x9e, 0xf7, 0xbe, 0xd6, 0xba, 0x31, 0x86, 0xce, 0x79, 0x08, 0xff, 0xff, 0x82, 0xf7,
+    0xbe, 0x31, 0xa6, 0x31, 0x86, 0x29, 0x00, 0x00, 0x80, 0x5a, 0xca, 0x0a, 0xff, 0xff, 0x80, 0xe7,
+    0x3c, 0x0a, 0xff, 0xff, 0x80, 0xad, 0x55, 0x01, 0x00, 0x00, 0x80, 0x9c, 0xf3, 0x01, 0xff, 0xff,
+    0x83, 0xde, 0xfb, 0x18, 0xc3, 0x00, 0x00, 0x6b, 0x6d, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x82, 0x94, 0xb2, 0xff, 0xff, 0xff, 0xdf, 0x06, 0xff, 0xff,
+    0x81, 0xf7, 0x9e, 0x21, 0x24, 0x08, 0x00, 0x00, 0x81, 0x18, 0xe3, 0xf7, 0x9d, 0x10, 0xff, 0xff,
+    0x86, 0xf7, 0xbe, 0x08, 0x61, 0x00, 0x00, 0x18, 0xe3, 0xe6, 0xfb, 0xff, 0xdf, 0xf7, 0xbe, 0x04,
+    0xff, 0xdf, 0x10, 0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0xef, 0x5d,
+    0x10, 0xff, 0xff, 0x83, 0xe7, 0x3c, 0x21, 0x24, 0x00, 0x00, 0x39, 0xe7, 0x0f, 0xff, 0xff, 0x83,
+    0xce, 0x79, 0x08, 0x61, 0x00, 0x00, 0x84, 0x30, 0x01, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x31, 0xa6,
+    0x00, 0x00, 0x42, 0x28, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x29, 0x45, 0xce, 0x59,
+    0x08, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x29, 0x45, 0x4a, 0x69, 0x29, 0x00, 0x00, 0x81, 0x42, 0x28,
+    0xff, 0xdf, 0x09, 0xff, 0xff, 0x82, 0x7b, 0xef, 0x39, 0xc7, 0xce, 0x79, 0x01, 0xff, 0xff, 0x02,
+    0xff, 0xdf, 0x03, 0xff, 0xff, 0x80, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x80, 0x9c, 0xf3, 0x01, 0xff,
+    0xff, 0x83, 0xe7, 0x1c, 0x18, 0xe3, 0x00, 0x00, 0x39, 0xe7, 0x0f, 0xff, 0xff, 0x85, 0xc6, 0x38,
+    0x08, 0x41, 0x00, 0x00, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0xff, 0xff, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x81, 0x10, 0x82, 0x29, 0x65, 0x02, 0x31, 0x86, 0x81,
+    0x29, 0x65, 0x08, 0x61, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x0e, 0xff,
+    0xff, 0x84, 0xf7, 0xbe, 0x08, 0x61, 0x00, 0x00, 0x21, 0x04, 0xff, 0xdf, 0x17, 0xff, 0xff, 0x84,
+    0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0xef, 0x5d, 0x10, 0xff, 0xff, 0x83, 0xe7, 0x1c,
+    0x21, 0x04, 0x00, 0x00, 0x6b, 0x2c, 0x0d, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0xb6,
+    0x00, 0x20, 0x00, 0x00, 0x8c, 0x51, 0x01, 0xff, 0xff, 0x83, 0xf7, 0xbe, 0x31, 0x86, 0x00, 0x00,
+    0x52, 0x8a, 0x06, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x82, 0xef, 0x7d, 0x63, 0x2c, 0xde, 0xdb, 0x08,
+    0xff, 0xff, 0x82, 0xef, 0x7d, 0x18, 0xe3, 0x39, 0xc7, 0x29, 0x00, 0x00, 0x81, 0x31, 0xa6, 0xf7,
+    0xbe, 0x09, 0xff, 0xff, 0x84, 0xde, 0xfb, 0x5a, 0xeb, 0x08, 0x41, 0x6b, 0x6d, 0xe7, 0x3c, 0x06,
+    0xff, 0xff, 0x80, 0xbd, 0xf7, 0x01, 0x00, 0x00, 0x80, 0x8c, 0x51, 0x01, 0xff, 0xff, 0x85, 0xf7,
+    0xbe, 0x29, 0x45, 0x00, 0x00, 0x31, 0xa6, 0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x85, 0xd6,
+    0x9a, 0x08, 0x61, 0x00, 0x00, 0x52, 0xaa, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xff, 0xff, 0x52, 0x8a, 0x01, 0x00, 0x00, 0x80, 0x94, 0xb2, 0x04, 0xff, 0xff, 0x80, 0x8c,
+    0x71, 0x01, 0x00, 0x00, 0x80, 0x4a, 0x49, 0x10, 0xff, 0xff, 0x86, 0xf7, 0xbe, 0x08, 0x61, 0x00,
+    0x00, 0x08, 0x61, 0x6b, 0x4d, 0x73, 0xae, 0x73, 0x8e, 0x03, 0x73, 0xae, 0x80, 0x84, 0x10, 0x10,
+    0xff, 0xff, 0x84, 0xf7, 0x7d, 0x29, 0x45, 0x00, 0x00, 0x00, 0x20, 0xef, 0x5d, 0x0e, 0xff, 0xff,
+    0x85, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79, 0x08, 0x61, 0x00, 0x00, 0x7b, 0xce, 0x0d, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x80, 0xa5, 0x34, 0x01, 0xff, 0xff,
+    0x83, 0xe7, 0x3c, 0x00, 0x20, 0x00, 0x00, 0x5a, 0xcb, 0x09, 0xff, 0xff, 0x81, 0xc6, 0x18, 0xe7,
+    0x3c, 0x08, 0xff, 0xff, 0x82, 0xe7, 0x1c, 0x00, 0x00, 0x42, 0x08, 0x29, 0x00, 0x00, 0x81, 0x21,
+    0x24, 0xef, 0x7d, 0x0b, 0xff, 0xff, 0x87, 0xc6, 0x38, 0x4a, 0x69, 0x39, 0xc7, 0x7b, 0xef, 0x73,
+    0xae, 0x63, 0x0c, 0x52, 0x8a, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0xce, 0x79, 0x01, 0x00, 0x00,
+    0x86, 0x7b, 0xcf, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x29, 0x65, 0x00, 0x00, 0x29, 0x65, 0x0f,
+    0xff, 0xff, 0x85, 0xef, 0x5d, 0x10, 0xa2, 0x00, 0x00, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xdf, 0x03,
+    0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0xba, 0x08, 0x61, 0x00, 0x00, 0x10, 0x82, 0xe7,
+    0x3c, 0xff, 0xff, 0x03, 0xff, 0xdf, 0x81, 0xde, 0xdb, 0x08, 0x41, 0x01, 0x00, 0x00, 0x82, 0xd6,
+    0x99, 0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0x08, 0x41, 0x09, 0x00, 0x00,
+    0x0e, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x7d, 0x21, 0x24, 0x01, 0x00, 0x00, 0x82,
+    0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96,
+    0x01, 0x00, 0x00, 0x80, 0x94, 0x92, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x91,
+    0x01, 0x00, 0x00, 0x80, 0xad, 0x75, 0x01, 0xff, 0xff, 0x80, 0xde, 0xdb, 0x01, 0x00, 0x00, 0x82,
+    0x6b, 0x4d, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x83, 0xc6, 0x38, 0x41, 0xe7, 0x10, 0xa2,
+    0xe7, 0x3c, 0x08, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x00, 0x00, 0x21, 0x04, 0x2a, 0x00, 0x00, 0x80,
+    0xe7, 0x1c, 0x0a, 0xff, 0xff, 0x88, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xfb, 0x08, 0x40, 0x29, 0x45,
+    0x5a, 0xcb, 0x63, 0x0c, 0x7b, 0xef, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x83, 0xde, 0xfb, 0x10, 0xa2,
+    0x00, 0x00, 0x6b, 0x4c, 0x02, 0xff, 0xff, 0x83, 0x31, 0xa6, 0x00, 0x00, 0x21, 0x24, 0xf7, 0x9e,
+    0x0e, 0xff, 0xff, 0x83, 0xff, 0xdf, 0x18, 0xc3, 0x00, 0x00, 0x4a, 0x49, 0x07, 0xff, 0xff, 0x80,
+    0x8c, 0x71, 0x01, 0x08, 0x41, 0x80, 0x5a, 0xcb, 0x06, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x08,
+    0x41, 0x80, 0x73, 0xae, 0x10, 0xff, 0xff, 0x81, 0x10, 0xa2, 0x08, 0x41, 0x01, 0x08, 0x61, 0x05,
+    0x08, 0x62, 0x80, 0x29, 0x45, 0x10, 0xff, 0xff, 0x84, 0xf7, 0x9e, 0x31, 0x86, 0x08, 0x41, 0x08,
+    0x61, 0xef, 0x7d, 0x10, 0xff, 0xff, 0x80, 0x9c, 0xf3, 0x01, 0x00, 0x00, 0x82, 0xad, 0x55, 0xff,
+    0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xcf, 0x01, 0x00, 0x00,
+    0x80, 0xce, 0x79, 0x01, 0xff, 0xff, 0x80, 0xc6, 0x38, 0x01, 0x00, 0x00, 0x80, 0x73, 0xae, 0x01,
+    0xff, 0xff, 0x88, 0xde, 0xdb, 0xc6, 0x38, 0xe7, 0x1c, 0xff, 0xdf, 0xd6, 0x9a, 0x4a, 0x69, 0x00,
+    0x00, 0x52, 0x8a, 0xd6, 0x9a, 0x07, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xc6, 0x18, 0x00,
+    0x00, 0x08, 0x41, 0x2a, 0x00, 0x00, 0x80, 0xde, 0xdb, 0x0b, 0xff, 0xff, 0x82, 0xa5, 0x13, 0x00,
+    0x00, 0x6b, 0x4d, 0x06, 0xff, 0xff, 0x8a, 0xf7, 0x9d, 0x31, 0x86, 0x00, 0x00, 0x41, 0xe7, 0xd6,
+    0x9a, 0xd6, 0x79, 0xd6, 0xba, 0x31, 0xa6, 0x00, 0x00, 0x18, 0xc3, 0xde, 0xfb, 0x0f, 0xff, 0xff,
+    0x85, 0x52, 0xaa, 0x00, 0x00, 0x39, 0xc7, 0xf7, 0x9e, 0xf7, 0xbe, 0xf7, 0x9e, 0x01, 0xf7, 0xbe,
+    0x02, 0xef, 0x5d, 0x01, 0xde, 0xfb, 0x80, 0xe7, 0x1c, 0x01, 0xf7, 0x9e, 0x03, 0xf7, 0xbe, 0x01,
+    0xef, 0x5d, 0x80, 0xe7, 0x3c, 0x01, 0xde, 0xfb, 0x80, 0xe7, 0x1c, 0x0e, 0xf7, 0xbe, 0x81, 0xf7,
+    0x9e, 0xef, 0x5d, 0x0a, 0xde, 0xfb, 0x81, 0xef, 0x5d, 0xf7, 0x9e, 0x0f, 0xf7, 0xbe, 0x82, 0xe7,
+    0x1c, 0xde, 0xdb, 0xde, 0xfb, 0x01, 0xef, 0x5d, 0x80, 0xef, 0x7d, 0x0b, 0xf7, 0xbe, 0x01, 0xf7,
+    0x9e, 0x86, 0xf7, 0xbe, 0x7b, 0xef, 0x00, 0x00, 0x00, 0x20, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf,
+    0x0d, 0xff, 0xff, 0x80, 0x63, 0x2c, 0x01, 0x00, 0x00, 0x83, 0xc6, 0x38, 0xef, 0x5d, 0xef, 0x7d,
+    0xa4, 0xf3, 0x01, 0x00, 0x00, 0x80, 0x94, 0x92, 0x01, 0xff, 0xff, 0x82, 0x9c, 0xf3, 0x21, 0x04,
+    0x18, 0xe3, 0x01, 0x00, 0x00, 0x81, 0x52, 0x8a, 0xce, 0x79, 0x09, 0xff, 0xff, 0x84, 0xff, 0xdf,
+    0xff, 0xff, 0xb5, 0x96, 0x00, 0x00, 0x08, 0x41, 0x2a, 0x00, 0x00, 0x82, 0xc6, 0x18, 0xff, 0xdf,
+    0xf7, 0xbe, 0x04, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x82, 0x6b, 0x8d, 0x00, 0x00, 0x8c, 0x71, 0x03,
+    0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xff, 0xdf, 0x42, 0x08, 0x00, 0x00, 0x00,
+    0x20, 0x01, 0x10, 0x82, 0x86, 0x10, 0xa2, 0x08, 0x61, 0x00, 0x00, 0x08, 0x41, 0xc6, 0x38, 0xff,
+    0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x83, 0x7b, 0xef, 0x00, 0x00, 0x08, 0x41, 0x29, 0x65, 0x03,
+    0x31, 0x86, 0x02, 0x29, 0x45, 0x01, 0x29, 0x65, 0x81, 0x31, 0x86, 0x31, 0xa6, 0x04, 0x31, 0x86,
+    0x82, 0x29, 0x45, 0x21, 0x45, 0x29, 0x45, 0x01, 0x29, 0x65, 0x0f, 0x31, 0x86, 0x81, 0x29, 0x65,
+    0x29, 0x45, 0x0a, 0x29, 0x65, 0x81, 0x29, 0x45, 0x31, 0x65, 0x10, 0x31, 0x86, 0x84, 0x29, 0x45,
+    0x29, 0x65, 0x29, 0x45, 0x21, 0x45, 0x29, 0x65, 0x0d, 0x31, 0x86, 0x84, 0x31, 0xa6, 0x10, 0xa2,
+    0x00, 0x00, 0x21, 0x24, 0xef, 0x5d, 0x0f, 0xff, 0xff, 0x83, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x20,
+    0x21, 0x24, 0x01, 0x29, 0x45, 0x80, 0x18, 0xc3, 0x01, 0x00, 0x00, 0x8b, 0xbd, 0xb6, 0xff, 0xff,
+    0xff, 0xdf, 0xf7, 0x9e, 0xde, 0xfb, 0xce, 0x79, 0xb5, 0x96, 0x39, 0xe7, 0x52, 0x8a, 0xf7, 0xbe,
+    0xff, 0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x82, 0x9c, 0xd3, 0x10, 0xa2, 0x08,
+    0x41, 0x28, 0x00, 0x00, 0x82, 0x18, 0xe3, 0x00, 0x00, 0xce, 0x79, 0x09, 0xff, 0xff, 0x83, 0xe7,
+    0x1c, 0x39, 0xc7, 0xbd, 0xd7, 0xff, 0xff, 0x04, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x80, 0x52, 0x8a,
+    0x07, 0x00, 0x00, 0x82, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0xff, 0xff, 0xa5, 0x34, 0x5d, 0x00, 0x00, 0x81, 0x42, 0x28, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x81,
+    0xf7, 0x9e, 0x31, 0x86, 0x06, 0x00, 0x00, 0x83, 0x08, 0x61, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf,
+    0x03, 0xff, 0xff, 0x83, 0xf7, 0x9e, 0x42, 0x28, 0x18, 0xc3, 0xd6, 0x9a, 0x0a, 0xff, 0xff, 0x82,
+    0x8c, 0x30, 0x18, 0xc3, 0x08, 0x41, 0x28, 0x00, 0x00, 0x82, 0x18, 0xe3, 0x00, 0x00, 0x18, 0xc3,
+    0x04, 0x29, 0x45, 0x82, 0x29, 0x65, 0x31, 0xa6, 0x94, 0xb2, 0x01, 0xff, 0xff, 0x81, 0xef, 0x7d,
+    0xef, 0x5d, 0x08, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x6d, 0x00, 0x00, 0x00, 0x20,
+    0x42, 0x4a, 0x01, 0x42, 0xce, 0x80, 0x32, 0x2a, 0x01, 0x00, 0x00, 0x82, 0x7b, 0xef, 0xff, 0xff,
+    0xff, 0xdf, 0x0b, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x00,
+    0x21, 0x45, 0x21, 0x42, 0xce, 0x86, 0x42, 0xee, 0x08, 0x82, 0x00, 0x00, 0x10, 0xa2, 0x7b, 0xcf,
+    0x8c, 0x51, 0x84, 0x30, 0x05, 0x8c, 0x51, 0x83, 0x8c, 0x50, 0x84, 0x30, 0x8c, 0x71, 0x39, 0xe7,
+    0x01, 0x00, 0x00, 0x81, 0x3a, 0x4b, 0x42, 0xee, 0x06, 0x42, 0xce, 0x81, 0x42, 0x8c, 0x3a, 0x2a,
+    0x04, 0x3a, 0x4a, 0x80, 0x3a, 0x2a, 0x01, 0x3a, 0x4a, 0x80, 0x3a, 0x2a, 0x0c, 0x3a, 0x4a, 0x87,
+    0x3a, 0x2a, 0x3a, 0x4a, 0x39, 0xe8, 0x00, 0x20, 0x00, 0x00, 0x6b, 0x4d, 0xff, 0xff, 0xff, 0xdf,
+    0x0d, 0xff, 0xff, 0x8a, 0xde, 0xdb, 0x08, 0x41, 0x00, 0x00, 0x19, 0x04, 0x3a, 0x4a, 0x3a, 0x2a,
+    0x3a, 0x4a, 0x10, 0x82, 0x00, 0x00, 0x18, 0xc3, 0xef, 0x5d, 0x03, 0xff, 0xff, 0x81, 0xff, 0xdf,
+    0xf7, 0xbe, 0x01, 0xff, 0xff, 0x85, 0x73, 0x8e, 0x10, 0x61, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xdf,
+    0xd6, 0x9a, 0x05, 0xbd, 0xf7, 0x83, 0xc6, 0x38, 0x52, 0xaa, 0x21, 0x24, 0x00, 0x20, 0x28, 0x00,
+    0x00, 0x83, 0x08, 0x41, 0x21, 0x24, 0x4a, 0x49, 0x39, 0xe7, 0x02, 0x42, 0x07, 0x83, 0x39, 0xe7,
+    0x42, 0x28, 0x08, 0x61, 0x5a, 0xcb, 0x01, 0xff, 0xff, 0x83, 0xff, 0xdf, 0x63, 0x0c, 0x39, 0xe7,
+    0x4a, 0x49, 0x01, 0x5a, 0xeb, 0x90, 0x6b, 0x6d, 0x84, 0x10, 0x8c, 0x71, 0xc6, 0x38, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0xa5, 0x14, 0x00, 0x00, 0x08, 0x20, 0x3b, 0x30, 0x03, 0x37, 0x03, 0x36,
+    0x02, 0xd3, 0x08, 0x20, 0x00, 0x00, 0x63, 0x0c, 0x0f, 0xff, 0xff, 0x85, 0xf7, 0xbe, 0x31, 0xa6,
+    0x00, 0x00, 0x10, 0xc3, 0x0b, 0x36, 0x03, 0x16, 0x1e, 0x03, 0x36, 0x85, 0x03, 0x16, 0x03, 0x57,
+    0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xef, 0x7d, 0x0a, 0xff, 0xff, 0x80, 0x73, 0xae, 0x01, 0x00,
+    0x00, 0x82, 0x22, 0xf2, 0x03, 0x37, 0x03, 0x16, 0x06, 0x03, 0x36, 0x80, 0x03, 0x16, 0x15, 0x03,
+    0x36, 0x82, 0x03, 0x15, 0x03, 0x37, 0x2a, 0x6d, 0x01, 0x00, 0x00, 0x82, 0xad, 0x75, 0xff, 0xff,
+    0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xd7, 0x01, 0x00, 0x00, 0x86,
+    0x11, 0xcc, 0x0b, 0x77, 0x02, 0xf5, 0x23, 0x96, 0x19, 0x04, 0x00, 0x00, 0x21, 0x24, 0x01, 0xff,
+    0xff, 0x81, 0xf7, 0xbe, 0xde, 0xdb, 0x05, 0xff, 0xff, 0x84, 0x7b, 0xef, 0x9c, 0xd3, 0xff, 0xff,
+    0xf7, 0xbe, 0x39, 0xc7, 0x07, 0x00, 0x00, 0x80, 0x18, 0xe3, 0x2a, 0x00, 0x00, 0x82, 0x42, 0x08,
+    0xa5, 0x14, 0x94, 0x92, 0x04, 0x94, 0xb2, 0x82, 0x39, 0xe7, 0x39, 0xc7, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x88, 0xbd, 0xf7, 0xad, 0x55, 0x8c, 0x71, 0x84, 0x10, 0x8c, 0x71, 0x94, 0x71, 0x29, 0x65,
+    0x00, 0x00, 0x5a, 0xcb, 0x02, 0xff, 0xff, 0x8a, 0xce, 0x59, 0x00, 0x41, 0x00, 0x00, 0x01, 0x27,
+    0x03, 0x16, 0x02, 0xd4, 0x13, 0x14, 0x29, 0x65, 0x00, 0x00, 0x31, 0xa6, 0xff, 0xdf, 0x0d, 0xff,
+    0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0x5a, 0xcb, 0x00, 0x00, 0x10, 0x41, 0x33, 0x32, 0x02, 0xd5,
+    0x1e, 0x02, 0xf5, 0x87, 0x02, 0xf4, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x18, 0xe4, 0xe7, 0x1c,
+    0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x81, 0xff, 0xff, 0x73, 0x8e, 0x01,
+    0x00, 0x00, 0x82, 0x22, 0xb1, 0x02, 0xf5, 0x02, 0xf4, 0x1d, 0x02, 0xf5, 0x85, 0x02, 0xd4, 0x13,
+    0x56, 0x19, 0x26, 0x00, 0x00, 0x08, 0x41, 0xe6, 0xfb, 0x0d, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff,
+    0xff, 0x9c, 0xd3, 0x00, 0x00, 0x08, 0x20, 0x0a, 0x2e, 0x03, 0x16, 0x02, 0xd5, 0x2b, 0x33, 0x20,
+    0xc2, 0x00, 0x00, 0x63, 0x2c, 0x01, 0xff, 0xff, 0x87, 0xce, 0x79, 0x21, 0x24, 0x10, 0xa2, 0x5a,
+    0xcb, 0x94, 0xb2, 0xbd, 0xd7, 0xe7, 0x1c, 0xf7, 0xbe, 0x02, 0xff, 0xff, 0x84, 0xef, 0x5d, 0x08,
+    0x41, 0x7b, 0xef, 0xce, 0x59, 0xc6, 0x18, 0x02, 0xc6, 0x38, 0x82, 0xc6, 0x18, 0xc6, 0x38, 0x8c,
+    0x71, 0x33, 0x00, 0x00, 0x81, 0x10, 0x82, 0xef, 0x5d, 0x05, 0xff, 0xff, 0x84, 0xce, 0x79, 0x5a,
+    0xcb, 0x29, 0x44, 0x84, 0x10, 0xe7, 0x3c, 0x02, 0xff, 0xff, 0x87, 0xef, 0x7d, 0x10, 0x82, 0x00,
+    0x00, 0x09, 0x06, 0x0b, 0x56, 0x02, 0xd4, 0x13, 0x56, 0x29, 0xa9, 0x01, 0x00, 0x00, 0x80, 0xde,
+    0xfb, 0x0d, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x55, 0x01, 0x00, 0x00, 0x81, 0x11,
+    0xeb, 0x03, 0x36, 0x1f, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7,
+    0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x22, 0xd1, 0x03, 0x16, 0x1f,
+    0x02, 0xf5, 0x83, 0x1b, 0x13, 0x20, 0xe3, 0x00, 0x00, 0x42, 0x08, 0x0e, 0xff, 0xff, 0x8b, 0xff,
+    0xdf, 0xff, 0xff, 0x5a, 0xeb, 0x00, 0x00, 0x20, 0xc3, 0x33, 0x53, 0x02, 0xd5, 0x03, 0x16, 0x0a,
+    0x2e, 0x08, 0x20, 0x00, 0x00, 0x9c, 0xd3, 0x01, 0xff, 0xff, 0x8e, 0xf7, 0x9e, 0xce, 0x59, 0x94,
+    0x92, 0x39, 0xe7, 0x00, 0x00, 0x08, 0x41, 0x10, 0x82, 0x31, 0xa6, 0x63, 0x2c, 0xf7, 0x9e, 0xff,
+    0xff, 0xd6, 0x9a, 0x00, 0x00, 0x52, 0x69, 0x10, 0xa2, 0x05, 0x08, 0x61, 0x80, 0x08, 0x41, 0x32,
+    0x00, 0x00, 0x82, 0x08, 0x61, 0x00, 0x00, 0xce, 0x59, 0x03, 0xff, 0xff, 0x84, 0xd6, 0x9a, 0x52,
+    0xaa, 0x18, 0xe3, 0x63, 0x0c, 0xde, 0xfb, 0x05, 0xff, 0xff, 0x86, 0x39, 0xc7, 0x00, 0x00, 0x29,
+    0x24, 0x23, 0x54, 0x02, 0xd5, 0x03, 0x36, 0x09, 0xab, 0x01, 0x00, 0x00, 0x80, 0xb5, 0x96, 0x0f,
+    0xff, 0xff, 0x85, 0xef, 0x7d, 0x10, 0xa2, 0x00, 0x00, 0x21, 0x66, 0x13, 0x55, 0x02, 0xd5, 0x1e,
+    0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff,
+    0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x22, 0xd1, 0x03, 0x16, 0x1e, 0x02, 0xf5, 0x81, 0x03,
+    0x36, 0x22, 0x6e, 0x01, 0x00, 0x00, 0x82, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff,
+    0x87, 0xff, 0xdf, 0x29, 0x45, 0x00, 0x00, 0x08, 0xa3, 0x13, 0x55, 0x02, 0xd4, 0x0b, 0x56, 0x2a,
+    0x0b, 0x01, 0x00, 0x00, 0x80, 0xbd, 0xf7, 0x05, 0xff, 0xff, 0x89, 0x29, 0x65, 0x8c, 0x71, 0xd6,
+    0xba, 0x8c, 0x71, 0x7b, 0xcf, 0xef, 0x5d, 0xff, 0xff, 0xad, 0x55, 0x08, 0x20, 0x10, 0xa2, 0x3a,
+    0x00, 0x00, 0x82, 0x10, 0xa2, 0x00, 0x00, 0xad, 0x54, 0x01, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x63,
+    0x0c, 0x10, 0x82, 0x73, 0x8e, 0xe7, 0x1c, 0x07, 0xff, 0xff, 0x8b, 0x7b, 0xaf, 0x00, 0x00, 0x08,
+    0x40, 0x0a, 0x70, 0x03, 0x16, 0x02, 0xf5, 0x33, 0x11, 0x18, 0x81, 0x00, 0x00, 0x7b, 0xef, 0xff,
+    0xff, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x84, 0x63, 0x0c, 0x00, 0x00, 0x10, 0x41, 0x0a, 0xb1, 0x03,
+    0x16, 0x1e, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a,
+    0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x22, 0xd1, 0x03, 0x16, 0x1e, 0x02, 0xf5,
+    0x86, 0x03, 0x15, 0x21, 0x66, 0x00, 0x00, 0x10, 0x82, 0xce, 0x79, 0xff, 0xff, 0xff, 0xdf, 0x0d,
+    0xff, 0xff, 0x8a, 0xd6, 0x9a, 0x10, 0x82, 0x00, 0x00, 0x19, 0xa8, 0x03, 0x16, 0x02, 0xf5, 0x03,
+    0x35, 0x31, 0xc7, 0x00, 0x00, 0x18, 0xc3, 0xe7, 0x3c, 0x03, 0xff, 0xff, 0x84, 0xe7, 0x1c, 0x7b,
+    0xcf, 0x10, 0x82, 0x10, 0xa2, 0xef, 0x5d, 0x03, 0xff, 0xff, 0x82, 0x84, 0x10, 0x21, 0x24, 0x18,
+    0xc3, 0x3a, 0x00, 0x00, 0x92, 0x08, 0x41, 0x00, 0x00, 0x6b, 0x6d, 0xff, 0xdf, 0xff, 0xff, 0xf7,
+    0xbe, 0x31, 0xa6, 0x31, 0x86, 0x52, 0xaa, 0x39, 0xe7, 0x4a, 0x69, 0x5a, 0xca, 0x7b, 0xef, 0x8c,
+    0x71, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x01, 0x00, 0x00, 0x86, 0x2a,
+    0x4d, 0x03, 0x36, 0x02, 0xd5, 0x23, 0x54, 0x08, 0x82, 0x00, 0x00, 0x31, 0xc7, 0x0e, 0xff, 0xff,
+    0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x55, 0x01, 0x00, 0x00, 0x81, 0x2a, 0x0b, 0x03, 0x16, 0x1e,
+    0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff,
+    0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x22, 0xd1, 0x03, 0x16, 0x1e, 0x02, 0xf5, 0x83, 0x2b,
+    0x32, 0x08, 0x41, 0x00, 0x00, 0x39, 0xe7, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x9c,
+    0xd3, 0x01, 0x00, 0x00, 0x86, 0x3a, 0xef, 0x03, 0x16, 0x02, 0xf5, 0x0a, 0xf3, 0x00, 0x21, 0x00,
+    0x00, 0x4a, 0x49, 0x02, 0xff, 0xff, 0x86, 0xc6, 0x38, 0x63, 0x0c, 0x00, 0x20, 0x29, 0x65, 0x9c,
+    0xf3, 0x5a, 0xcb, 0x4a, 0x49, 0x02, 0xff, 0xdf, 0x83, 0xff, 0xff, 0x42, 0x28, 0x21, 0x24, 0x08,
+    0x61, 0x3c, 0x00, 0x00, 0x81, 0x31, 0xa6, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0xd6,
+    0xba, 0xb5, 0xb6, 0x01, 0xad, 0x55, 0x83, 0x94, 0xb2, 0x4a, 0x69, 0x00, 0x00, 0x29, 0x65, 0x02,
+    0xff, 0xff, 0x8a, 0xde, 0xdb, 0x18, 0xc3, 0x00, 0x00, 0x31, 0xe8, 0x03, 0x15, 0x02, 0xf5, 0x03,
+    0x16, 0x21, 0x67, 0x00, 0x00, 0x10, 0xa3, 0xde, 0xdb, 0x0f, 0xff, 0xff, 0x84, 0xef, 0x7d, 0x21,
+    0x04, 0x00, 0x00, 0x10, 0xa2, 0x1b, 0x34, 0x1e, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x22,
+    0xd1, 0x03, 0x16, 0x1c, 0x02, 0xf5, 0x82, 0x02, 0xd4, 0x03, 0x36, 0x19, 0xca, 0x01, 0x00, 0x00,
+    0x82, 0x94, 0x92, 0xff, 0xff, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x00, 0x00,
+    0x86, 0x0a, 0x91, 0x03, 0x16, 0x02, 0xf5, 0x3b, 0x31, 0x08, 0x20, 0x00, 0x00, 0x73, 0x8e, 0x01,
+    0xff, 0xff, 0x83, 0xc6, 0x18, 0x00, 0x20, 0x42, 0x08, 0xad, 0x75, 0x01, 0xff, 0xff, 0x82, 0xef,
+    0x5d, 0x10, 0x82, 0x9c, 0xd3, 0x01, 0xff, 0xff, 0x82, 0xf7, 0x9e, 0x18, 0xc3, 0x39, 0xe7, 0x3c,
+    0x00, 0x00, 0x82, 0x21, 0x04, 0x18, 0xc3, 0xe7, 0x1c, 0x05, 0xff, 0xff, 0x84, 0xc6, 0x38, 0x63,
+    0x0c, 0x29, 0x65, 0x84, 0x10, 0xef, 0x5d, 0x02, 0xff, 0xff, 0x87, 0xff, 0xdf, 0x42, 0x08, 0x00,
+    0x00, 0x08, 0x41, 0x13, 0x34, 0x02, 0xf5, 0x03, 0x36, 0x3a, 0xae, 0x01, 0x00, 0x00, 0x82, 0x9c,
+    0xd3, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xcf, 0x00,
+    0x00, 0x08, 0x20, 0x22, 0x4d, 0x03, 0x36, 0x02, 0xf4, 0x1c, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00,
+    0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00,
+    0x81, 0x12, 0xb2, 0x03, 0x16, 0x1d, 0x02, 0xf5, 0x84, 0x12, 0xf3, 0x18, 0xc3, 0x00, 0x00, 0x18,
+    0xc3, 0xef, 0x5d, 0x0f, 0xff, 0xff, 0x87, 0xef, 0x7d, 0x18, 0xe3, 0x00, 0x00, 0x31, 0x86, 0x13,
+    0x35, 0x02, 0xd5, 0x03, 0x16, 0x19, 0xca, 0x01, 0x00, 0x00, 0x80, 0xbd, 0xf7, 0x01, 0xff, 0xff,
+    0x81, 0xde, 0xdb, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x89, 0xff, 0xdf, 0xf7, 0xbe, 0xff, 0xff, 0x9c,
+    0xf3, 0x18, 0xc3, 0xef, 0x7d, 0xff, 0xff, 0xd6, 0xba, 0x18, 0xe3, 0x39, 0xc7, 0x3c, 0x00, 0x00,
+    0x8b, 0x10, 0xa2, 0x00, 0x00, 0xb5, 0xb6, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0x9e, 0xa5,
+    0x14, 0x31, 0x86, 0x10, 0xa2, 0x73, 0x8e, 0xe7, 0x1c, 0x03, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff,
+    0xff, 0x7b, 0xef, 0x00, 0x00, 0x10, 0x40, 0x32, 0xf0, 0x02, 0xf5, 0x03, 0x16, 0x0a, 0x70, 0x08,
+    0x20, 0x00, 0x00, 0x5a, 0xcb, 0x10, 0xff, 0xff, 0x84, 0xde, 0xdb, 0x00, 0x20, 0x00, 0x00, 0x21,
+    0x25, 0x13, 0x35, 0x1d, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7,
+    0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x1c,
+    0x02, 0xf5, 0x81, 0x03, 0x16, 0x22, 0x4d, 0x01, 0x00, 0x00, 0x80, 0x7b, 0xae, 0x10, 0xff, 0xff,
+    0x80, 0xc6, 0x18, 0x01, 0x00, 0x00, 0x8c, 0x19, 0xaa, 0x0b, 0x56, 0x02, 0xd4, 0x1b, 0x76, 0x19,
+    0x25, 0x00, 0x00, 0x18, 0xc3, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0x8c, 0x51, 0xbd, 0xd7, 0xef,
+    0x5d, 0x03, 0xff, 0xff, 0x86, 0xff, 0xdf, 0x84, 0x10, 0xe7, 0x1c, 0xff, 0xff, 0xa5, 0x34, 0x00,
+    0x00, 0x39, 0xc7, 0x3c, 0x00, 0x00, 0x82, 0x00, 0x20, 0x00, 0x00, 0x84, 0x10, 0x01, 0xff, 0xff,
+    0x84, 0xf7, 0xbe, 0x42, 0x08, 0x18, 0xe3, 0x84, 0x30, 0xe7, 0x3c, 0x01, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x04, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x01, 0x00, 0x00, 0x87, 0x19, 0x89, 0x0b, 0x56, 0x02,
+    0xd4, 0x1b, 0x55, 0x29, 0x46, 0x00, 0x00, 0x10, 0x82, 0xef, 0x5d, 0x10, 0xff, 0xff, 0x80, 0x63,
+    0x0c, 0x01, 0x00, 0x00, 0x81, 0x2a, 0x8e, 0x03, 0x16, 0x1c, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00,
+    0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00,
+    0x81, 0x02, 0x92, 0x03, 0x16, 0x1b, 0x02, 0xf5, 0x85, 0x02, 0xd5, 0x1b, 0x54, 0x18, 0xe3, 0x00,
+    0x00, 0x10, 0x82, 0xde, 0xfb, 0x0e, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x4d, 0x00,
+    0x00, 0x10, 0x61, 0x2a, 0xf0, 0x02, 0xf5, 0x03, 0x15, 0x12, 0xb1, 0x10, 0x82, 0x00, 0x00, 0x5a,
+    0xcb, 0x01, 0xff, 0xff, 0x87, 0xf7, 0xbe, 0x5a, 0xeb, 0x18, 0xc2, 0x08, 0x61, 0x4a, 0x49, 0x7b,
+    0xef, 0xc6, 0x18, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x08,
+    0x61, 0x18, 0xc3, 0x3d, 0x00, 0x00, 0x81, 0x18, 0xc3, 0x42, 0x28, 0x01, 0xff, 0xff, 0x82, 0xf7,
+    0xbe, 0xa5, 0x34, 0xef, 0x5d, 0x09, 0xff, 0xff, 0x87, 0xff, 0xdf, 0x21, 0x24, 0x00, 0x00, 0x29,
+    0x24, 0x13, 0x34, 0x02, 0xd5, 0x03, 0x36, 0x11, 0xaa, 0x01, 0x00, 0x00, 0x82, 0x9c, 0xf3, 0xff,
+    0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x08, 0x61, 0x00,
+    0x00, 0x18, 0xe4, 0x1b, 0x35, 0x1c, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21,
+    0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03,
+    0x16, 0x1a, 0x02, 0xf5, 0x82, 0x02, 0xf4, 0x03, 0x36, 0x19, 0xeb, 0x01, 0x00, 0x00, 0x82, 0x73,
+    0x8e, 0xff, 0xff, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x87, 0xf7, 0x9e, 0x21, 0x24, 0x00, 0x00, 0x10,
+    0xc3, 0x13, 0x35, 0x02, 0xd4, 0x03, 0x36, 0x2a, 0x6d, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x14, 0xff,
+    0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x8b, 0xef, 0x7d, 0xbd, 0xf7, 0x73, 0x8e, 0x29, 0x65, 0x21,
+    0x04, 0x10, 0x82, 0x5a, 0xcb, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xdf, 0x31, 0xa6, 0x39, 0xe7, 0x3e,
+    0x00, 0x00, 0x82, 0x00, 0x20, 0x08, 0x41, 0xe7, 0x3c, 0x03, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x09,
+    0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x86, 0x1a, 0xb0, 0x03, 0x16, 0x02, 0xf5, 0x2b,
+    0x32, 0x08, 0x41, 0x00, 0x00, 0x42, 0x28, 0x11, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x00, 0x00,
+    0x82, 0x2a, 0x4c, 0x03, 0x36, 0x02, 0xf4, 0x1a, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0x92, 0x03, 0x16, 0x1b, 0x02, 0xf5, 0x84, 0x1b, 0x13, 0x10, 0x82, 0x00, 0x00, 0x10, 0x82, 0xe6,
+    0xfb, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x75, 0x01, 0x00, 0x00, 0x87, 0x32,
+    0x2b, 0x03, 0x16, 0x02, 0xf5, 0x03, 0x15, 0x19, 0x25, 0x00, 0x00, 0x10, 0x82, 0xde, 0xfb, 0x07,
+    0xff, 0xff, 0x87, 0xde, 0xdb, 0x9c, 0xd3, 0x6b, 0x4d, 0xde, 0xfb, 0xff, 0xff, 0xde, 0xdb, 0x00,
+    0x00, 0x4a, 0x69, 0x3e, 0x00, 0x00, 0x84, 0x18, 0xc3, 0x00, 0x20, 0xad, 0x55, 0xff, 0xff, 0xff,
+    0xdf, 0x0a, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20, 0x00, 0x00, 0x29,
+    0xe9, 0x03, 0x16, 0x02, 0xf5, 0x03, 0x15, 0x21, 0x25, 0x00, 0x00, 0x10, 0x82, 0xd6, 0x9a, 0x10,
+    0xff, 0xff, 0x84, 0xe7, 0x1c, 0x10, 0x81, 0x00, 0x00, 0x10, 0x82, 0x1b, 0x13, 0x1b, 0x02, 0xf5,
+    0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73,
+    0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x19, 0x02, 0xf5, 0x82, 0x02, 0xf4, 0x0b,
+    0x56, 0x29, 0xe9, 0x01, 0x00, 0x00, 0x82, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff,
+    0x89, 0x5a, 0xeb, 0x00, 0x00, 0x08, 0x41, 0x12, 0xb1, 0x03, 0x16, 0x02, 0xf5, 0x2b, 0x12, 0x08,
+    0x20, 0x00, 0x00, 0x52, 0xaa, 0x0d, 0xff, 0xff, 0x82, 0xa5, 0x14, 0x08, 0x61, 0x31, 0xa6, 0x3e,
+    0x00, 0x00, 0x84, 0x08, 0x41, 0x00, 0x00, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff,
+    0x87, 0xf7, 0x9e, 0x29, 0x45, 0x00, 0x00, 0x08, 0x62, 0x1b, 0x54, 0x02, 0xd5, 0x03, 0x36, 0x22,
+    0x6d, 0x01, 0x00, 0x00, 0x80, 0x7b, 0xcf, 0x11, 0xff, 0xff, 0x80, 0x84, 0x30, 0x01, 0x00, 0x00,
+    0x81, 0x29, 0x88, 0x0b, 0x36, 0x1a, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x21,
+    0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03,
+    0x16, 0x19, 0x02, 0xf5, 0x85, 0x03, 0x16, 0x22, 0x6e, 0x08, 0x20, 0x00, 0x00, 0x18, 0xe3, 0xef,
+    0x7d, 0x10, 0xff, 0xff, 0x87, 0xde, 0xfb, 0x10, 0x82, 0x00, 0x00, 0x21, 0x46, 0x13, 0x55, 0x02,
+    0xd4, 0x0b, 0x36, 0x19, 0xca, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x07,
+    0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x4a, 0x69, 0x29, 0x45, 0x18,
+    0xc3, 0x3f, 0x00, 0x00, 0x82, 0x10, 0x82, 0x29, 0x65, 0xef, 0x5d, 0x0c, 0xff, 0xff, 0x8c, 0xff,
+    0xdf, 0xff, 0xff, 0x84, 0x0f, 0x00, 0x00, 0x08, 0x20, 0x22, 0x4d, 0x03, 0x16, 0x02, 0xf5, 0x1b,
+    0x13, 0x18, 0xc3, 0x00, 0x00, 0x21, 0x04, 0xf7, 0x9e, 0x10, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0x31,
+    0x86, 0x01, 0x00, 0x00, 0x82, 0x22, 0x6e, 0x03, 0x36, 0x02, 0xf4, 0x18, 0x02, 0xf5, 0x84, 0x03,
+    0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01,
+    0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x19, 0x02, 0xf5, 0x81, 0x1b, 0x54, 0x18, 0xc3, 0x01,
+    0x00, 0x00, 0x80, 0xa5, 0x34, 0x0f, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x00,
+    0x00, 0x08, 0x00, 0x22, 0x4d, 0x03, 0x16, 0x02, 0xf5, 0x13, 0x14, 0x21, 0x04, 0x00, 0x00, 0x18,
+    0xe3, 0xf7, 0x9e, 0x0c, 0xff, 0xff, 0x82, 0xef, 0x5d, 0x18, 0xe3, 0x39, 0xe7, 0x40, 0x00, 0x00,
+    0x84, 0x18, 0xc3, 0x00, 0x00, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x87, 0xd6,
+    0xba, 0x00, 0x20, 0x00, 0x00, 0x21, 0x66, 0x0b, 0x35, 0x02, 0xd4, 0x0b, 0x36, 0x21, 0xa9, 0x01,
+    0x00, 0x00, 0x82, 0xa5, 0x13, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x80, 0xbd, 0xf7, 0x01,
+    0x00, 0x00, 0x81, 0x18, 0xa2, 0x23, 0x12, 0x19, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x21, 0x04, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0x92, 0x03, 0x16, 0x18, 0x02, 0xf5, 0x81, 0x0b, 0x36, 0x21, 0x67, 0x01, 0x00, 0x00, 0x82, 0x52,
+    0xaa, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x87, 0xef, 0x7d, 0x21, 0x24, 0x00, 0x00, 0x08,
+    0x82, 0x13, 0x34, 0x02, 0xf5, 0x03, 0x16, 0x2a, 0x8f, 0x01, 0x00, 0x00, 0x80, 0x73, 0xae, 0x0b,
+    0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x75, 0x00, 0x00, 0x4a, 0x69, 0x40, 0x00, 0x00,
+    0x84, 0x00, 0x20, 0x10, 0x82, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x80, 0x52,
+    0x8a, 0x01, 0x00, 0x00, 0x83, 0x1a, 0xd1, 0x03, 0x16, 0x02, 0xf5, 0x1a, 0xf2, 0x01, 0x00, 0x00,
+    0x81, 0x31, 0x86, 0xf7, 0xbe, 0x0f, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xcf, 0x01,
+    0x00, 0x00, 0x81, 0x19, 0x05, 0x0b, 0x35, 0x18, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x18, 0xe4, 0xe7, 0x3c, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0x92, 0x03, 0x16, 0x16, 0x02, 0xf5, 0x82, 0x02, 0xd4, 0x03, 0x36, 0x22, 0x4c, 0x01, 0x00, 0x00,
+    0x81, 0x21, 0x04, 0xe7, 0x3c, 0x11, 0xff, 0xff, 0x80, 0x94, 0xb2, 0x01, 0x00, 0x00, 0x89, 0x2a,
+    0x2b, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x36, 0x21, 0x66, 0x00, 0x00, 0x08, 0x41, 0xce, 0x59, 0xff,
+    0xff, 0xff, 0xdf, 0x09, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x4d, 0x18, 0xa2, 0x18,
+    0xc3, 0x41, 0x00, 0x00, 0x82, 0x10, 0xa2, 0x10, 0x82, 0xef, 0x7d, 0x0c, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xff, 0xff, 0xb5, 0x96, 0x01, 0x00, 0x00, 0x84, 0x21, 0x88, 0x03, 0x36, 0x02, 0xd4, 0x03,
+    0x35, 0x21, 0x67, 0x01, 0x00, 0x00, 0x80, 0xa5, 0x34, 0x11, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0x41,
+    0xe7, 0x01, 0x00, 0x00, 0x82, 0x29, 0xe9, 0x0b, 0x36, 0x02, 0xd5, 0x16, 0x02, 0xf5, 0x84, 0x03,
+    0x16, 0x00, 0x83, 0x00, 0x00, 0x21, 0x24, 0xef, 0x7d, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01,
+    0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x16, 0x02, 0xf5, 0x82, 0x03, 0x16, 0x33, 0x11, 0x10,
+    0x61, 0x01, 0x00, 0x00, 0x80, 0xb5, 0xb6, 0x11, 0xff, 0xff, 0x84, 0xff, 0xdf, 0x31, 0x86, 0x00,
+    0x00, 0x10, 0xa2, 0x1b, 0x13, 0x01, 0x02, 0xf5, 0x83, 0x22, 0xd0, 0x08, 0x40, 0x00, 0x00, 0x42,
+    0x28, 0x0d, 0xff, 0xff, 0x82, 0xf7, 0x9e, 0x08, 0x61, 0x52, 0x8a, 0x42, 0x00, 0x00, 0x84, 0x10,
+    0x82, 0x00, 0x20, 0xad, 0x55, 0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x8b, 0xff, 0xdf, 0x31,
+    0x86, 0x00, 0x00, 0x10, 0x81, 0x23, 0x12, 0x02, 0xf5, 0x03, 0x16, 0x1a, 0xb1, 0x08, 0x41, 0x00,
+    0x00, 0x31, 0x86, 0xf7, 0xbe, 0x11, 0xff, 0xff, 0x86, 0xde, 0xdb, 0x10, 0xa2, 0x00, 0x00, 0x08,
+    0x00, 0x32, 0x6d, 0x0b, 0x57, 0x02, 0xf4, 0x15, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0x92, 0x03, 0x16, 0x15, 0x02, 0xf5, 0x82, 0x03, 0x16, 0x22, 0xf2, 0x10, 0x82, 0x01, 0x00, 0x00,
+    0x80, 0x7b, 0xef, 0x12, 0xff, 0xff, 0x80, 0xa5, 0x14, 0x01, 0x00, 0x00, 0x84, 0x29, 0xea, 0x0b,
+    0x36, 0x02, 0xd4, 0x0b, 0x56, 0x19, 0x88, 0x01, 0x00, 0x00, 0x80, 0xb5, 0xb6, 0x0b, 0xff, 0xff,
+    0x84, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0x96, 0x00, 0x00, 0x52, 0xaa, 0x42, 0x00, 0x00, 0x01, 0x08,
+    0x41, 0x81, 0x52, 0xaa, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x80, 0x9c, 0xf3, 0x01, 0x00, 0x00, 0x84,
+    0x29, 0xea, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x56, 0x19, 0x47, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x34,
+    0xff, 0xff, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x81, 0xb5, 0xb6, 0x08, 0x41, 0x01, 0x00, 0x00, 0x82,
+    0x2a, 0x6e, 0x0b, 0x36, 0x02, 0xf4, 0x14, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00,
+    0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92,
+    0x03, 0x16, 0x13, 0x02, 0xf5, 0x83, 0x02, 0xf4, 0x02, 0xf5, 0x13, 0x14, 0x10, 0xe4, 0x01, 0x00,
+    0x00, 0x82, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x8b, 0xf7, 0x9e, 0x29, 0x45,
+    0x00, 0x00, 0x10, 0x81, 0x23, 0x13, 0x02, 0xf5, 0x03, 0x15, 0x1a, 0xf2, 0x08, 0x40, 0x00, 0x00,
+    0x39, 0xc7, 0xf7, 0xbe, 0x0d, 0xff, 0xff, 0x82, 0x52, 0x8a, 0x21, 0x04, 0x21, 0x24, 0x43, 0x00,
+    0x00, 0x82, 0x29, 0x45, 0x08, 0x61, 0xce, 0x79, 0x0e, 0xff, 0xff, 0x84, 0xf7, 0xbe, 0x29, 0x65,
+    0x00, 0x00, 0x10, 0x61, 0x23, 0x13, 0x01, 0x02, 0xf5, 0x80, 0x1a, 0xf1, 0x01, 0x00, 0x00, 0x81,
+    0x29, 0x24, 0xf7, 0x9e, 0x10, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x01, 0x00,
+    0x00, 0x83, 0x08, 0x00, 0x2a, 0xb0, 0x03, 0x16, 0x02, 0xf4, 0x13, 0x02, 0xf5, 0x84, 0x03, 0x16,
+    0x00, 0x83, 0x00, 0x00, 0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00,
+    0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x12, 0x02, 0xf5, 0x83, 0x02, 0xf4, 0x03, 0x15, 0x13, 0x14,
+    0x18, 0xe4, 0x01, 0x00, 0x00, 0x81, 0x31, 0xa6, 0xf7, 0x9e, 0x12, 0xff, 0xff, 0x80, 0x8c, 0x51,
+    0x01, 0x00, 0x00, 0x84, 0x29, 0xea, 0x03, 0x36, 0x02, 0xd4, 0x03, 0x36, 0x19, 0x88, 0x01, 0x00,
+    0x00, 0x82, 0xad, 0x55, 0xff, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x82, 0xe7, 0x1c, 0x08, 0x61,
+    0x52, 0x8a, 0x43, 0x00, 0x00, 0x80, 0x10, 0x82, 0x01, 0x00, 0x00, 0x80, 0xad, 0x54, 0x0d, 0xff,
+    0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x01, 0x00, 0x00, 0x84, 0x29, 0xe9, 0x0b, 0x36,
+    0x02, 0xd4, 0x03, 0x36, 0x21, 0xa9, 0x01, 0x00, 0x00, 0x82, 0x8c, 0x50, 0xff, 0xff, 0xff, 0xdf,
+    0x0f, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x51, 0x01, 0x00, 0x00, 0x83, 0x08, 0x61,
+    0x22, 0xb0, 0x0b, 0x36, 0x02, 0xd4, 0x12, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00,
+    0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92,
+    0x03, 0x16, 0x11, 0x02, 0xf5, 0x83, 0x02, 0xf4, 0x03, 0x16, 0x13, 0x14, 0x18, 0xe4, 0x01, 0x00,
+    0x00, 0x81, 0x29, 0x45, 0xe7, 0x1c, 0x12, 0xff, 0xff, 0x84, 0xe7, 0x3c, 0x10, 0xa2, 0x00, 0x00,
+    0x08, 0x82, 0x1b, 0x13, 0x01, 0x02, 0xf5, 0x84, 0x22, 0xf1, 0x08, 0x61, 0x00, 0x00, 0x31, 0xa6,
+    0xff, 0xdf, 0x0b, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x51, 0x00, 0x00, 0x41, 0xe7,
+    0x41, 0x00, 0x00, 0x80, 0x08, 0x41, 0x01, 0x00, 0x00, 0x82, 0x31, 0x86, 0xb5, 0x96, 0xff, 0xdf,
+    0x0f, 0xff, 0xff, 0x8d, 0xf7, 0xbe, 0x29, 0x45, 0x00, 0x00, 0x10, 0x40, 0x1a, 0xf1, 0x03, 0x16,
+    0x02, 0xf5, 0x1a, 0xf2, 0x10, 0x82, 0x00, 0x00, 0x10, 0x82, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xdf,
+    0x11, 0xff, 0xff, 0x80, 0x73, 0x8d, 0x01, 0x00, 0x00, 0x83, 0x10, 0x61, 0x2a, 0x6e, 0x0b, 0x36,
+    0x02, 0xd5, 0x11, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x31, 0x86, 0xff, 0xdf,
+    0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x10, 0x02,
+    0xf5, 0x83, 0x02, 0xf4, 0x03, 0x16, 0x1b, 0x13, 0x19, 0x04, 0x01, 0x00, 0x00, 0x83, 0x18, 0xe3,
+    0xd6, 0xba, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x80, 0x63, 0x2c, 0x01, 0x00, 0x00, 0x84,
+    0x22, 0x2c, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x56, 0x29, 0x87, 0x01, 0x00, 0x00, 0x82, 0xad, 0x55,
+    0xff, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x81, 0xce, 0x59, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x80,
+    0x08, 0x61, 0x3d, 0x00, 0x00, 0x85, 0x08, 0x41, 0x10, 0x82, 0x00, 0x00, 0x10, 0xa2, 0x8c, 0x71,
+    0xff, 0xbe, 0x10, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x14, 0x01, 0x00, 0x00, 0x84,
+    0x21, 0x67, 0x0b, 0x36, 0x02, 0xd4, 0x03, 0x36, 0x2a, 0x2c, 0x01, 0x00, 0x00, 0x82, 0x52, 0xaa,
+    0xff, 0xff, 0xff, 0xdf, 0x12, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x82, 0x08, 0x00,
+    0x32, 0x6d, 0x0b, 0x56, 0x11, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x31, 0x86,
+    0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16,
+    0x0f, 0x02, 0xf5, 0x83, 0x02, 0xd4, 0x03, 0x16, 0x2b, 0x12, 0x10, 0x82, 0x01, 0x00, 0x00, 0x83,
+    0x21, 0x24, 0xce, 0x79, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x8d, 0xff, 0xdf, 0xff, 0xff,
+    0xbd, 0xf7, 0x00, 0x20, 0x00, 0x00, 0x18, 0xe4, 0x13, 0x35, 0x02, 0xf5, 0x03, 0x16, 0x2a, 0xb0,
+    0x08, 0x20, 0x00, 0x00, 0x39, 0xc7, 0xf7, 0xbe, 0x0f, 0xff, 0xff, 0x85, 0xff, 0xdf, 0x9c, 0xd3,
+    0x21, 0x24, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x39, 0x00, 0x00, 0x81, 0x00, 0x20, 0x08, 0x61,
+    0x01, 0x00, 0x00, 0x81, 0x6b, 0x4d, 0xde, 0xdb, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x11, 0xff,
+    0xff, 0x81, 0xff, 0xdf, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x84, 0x2a, 0xaf, 0x03, 0x16, 0x02, 0xd5,
+    0x1b, 0x35, 0x19, 0x04, 0x01, 0x00, 0x00, 0x82, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x12, 0xff,
+    0xff, 0x80, 0x8c, 0x30, 0x01, 0x00, 0x00, 0x84, 0x08, 0x20, 0x29, 0xe9, 0x13, 0x35, 0x02, 0xf5,
+    0x02, 0xf4, 0x0e, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x31, 0x86, 0xff, 0xdf,
+    0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x0f, 0x02,
+    0xf5, 0x82, 0x03, 0x36, 0x2a, 0xae, 0x10, 0x61, 0x01, 0x00, 0x00, 0x81, 0x31, 0xa6, 0xe7, 0x3c,
+    0x13, 0xff, 0xff, 0x8d, 0xf7, 0xbe, 0x31, 0x86, 0x00, 0x00, 0x08, 0x20, 0x2a, 0xd0, 0x03, 0x16,
+    0x02, 0xd5, 0x13, 0x35, 0x21, 0x25, 0x00, 0x00, 0x00, 0x20, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xdf,
+    0x0d, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xe7, 0x1c, 0x73, 0x8e, 0x00, 0x20,
+    0x00, 0x00, 0x08, 0x61, 0x38, 0x00, 0x00, 0x83, 0x08, 0x61, 0x00, 0x00, 0x29, 0x65, 0xc5, 0xf7,
+    0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x14, 0xff, 0xff, 0x80, 0xc5, 0xf7, 0x01, 0x00, 0x00, 0x88,
+    0x18, 0xc3, 0x13, 0x34, 0x02, 0xf5, 0x03, 0x16, 0x22, 0xb0, 0x08, 0x20, 0x00, 0x00, 0x18, 0xc3,
+    0xe7, 0x3c, 0x12, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xb2, 0x00, 0x20, 0x01, 0x00,
+    0x00, 0x82, 0x19, 0x25, 0x2b, 0x12, 0x03, 0x16, 0x0e, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83,
+    0x00, 0x00, 0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81,
+    0x02, 0x92, 0x03, 0x16, 0x0d, 0x02, 0xf5, 0x83, 0x02, 0xf6, 0x1b, 0x35, 0x21, 0xca, 0x08, 0x40,
+    0x01, 0x00, 0x00, 0x83, 0x4a, 0x49, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x82,
+    0xff, 0xdf, 0xff, 0xff, 0x7b, 0xcf, 0x01, 0x00, 0x00, 0x84, 0x21, 0x88, 0x0b, 0x36, 0x02, 0xd4,
+    0x03, 0x36, 0x22, 0x4c, 0x01, 0x00, 0x00, 0x80, 0x52, 0xaa, 0x12, 0xff, 0xff, 0x80, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x81, 0xc6, 0x38, 0x4a, 0x49, 0x01, 0x00, 0x00, 0x80, 0x08, 0x41, 0x36, 0x00,
+    0x00, 0x82, 0x00, 0x20, 0x10, 0x82, 0x31, 0x86, 0x02, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x80, 0x5a,
+    0xeb, 0x01, 0x00, 0x00, 0x84, 0x2a, 0x0b, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x56, 0x29, 0xe9, 0x01,
+    0x00, 0x00, 0x82, 0x52, 0xaa, 0xff, 0xff, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x81, 0xbd, 0xd7, 0x18,
+    0xc3, 0x01, 0x00, 0x00, 0x84, 0x18, 0xa2, 0x22, 0x6e, 0x0b, 0x35, 0x02, 0xf5, 0x02, 0xf4, 0x0b,
+    0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff,
+    0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03, 0x16, 0x0c, 0x02, 0xf5, 0x82, 0x0b,
+    0x36, 0x1a, 0xf1, 0x29, 0x45, 0x02, 0x00, 0x00, 0x81, 0x6b, 0x6d, 0xf7, 0xbe, 0x12, 0xff, 0xff,
+    0x86, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xd7, 0x00, 0x20, 0x00, 0x00, 0x18, 0xc3, 0x1b, 0x34, 0x01,
+    0x02, 0xf5, 0x86, 0x22, 0xf2, 0x10, 0x61, 0x00, 0x00, 0x08, 0x61, 0xd6, 0xbb, 0xff, 0xff, 0xff,
+    0xdf, 0x14, 0xff, 0xff, 0x83, 0xff, 0xdf, 0x29, 0x65, 0x18, 0xe3, 0x10, 0x82, 0x37, 0x00, 0x00,
+    0x84, 0x10, 0xa2, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x88, 0xe7,
+    0x3c, 0x18, 0xc3, 0x00, 0x00, 0x08, 0x20, 0x22, 0xd1, 0x03, 0x15, 0x02, 0xf5, 0x13, 0x14, 0x18,
+    0xc3, 0x01, 0x00, 0x00, 0x82, 0x8c, 0x51, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x83, 0xff,
+    0xdf, 0xff, 0xff, 0xe7, 0x1b, 0x4a, 0x49, 0x02, 0x00, 0x00, 0x84, 0x21, 0x87, 0x22, 0xf2, 0x03,
+    0x36, 0x02, 0xf5, 0x02, 0xf4, 0x09, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x31,
+    0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03,
+    0x16, 0x0a, 0x02, 0xf5, 0x83, 0x03, 0x16, 0x1b, 0x34, 0x2a, 0x2b, 0x10, 0x61, 0x01, 0x00, 0x00,
+    0x81, 0x18, 0xc3, 0xa5, 0x34, 0x15, 0xff, 0xff, 0x88, 0xef, 0x5d, 0x29, 0x45, 0x00, 0x00, 0x08,
+    0x20, 0x22, 0x8e, 0x03, 0x16, 0x02, 0xd4, 0x13, 0x56, 0x19, 0x46, 0x01, 0x00, 0x00, 0x80, 0x84,
+    0x30, 0x15, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x59, 0x00, 0x00, 0x63, 0x2c, 0x39,
+    0x00, 0x00, 0x82, 0x10, 0x82, 0x39, 0xc7, 0xf7, 0xbe, 0x16, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0x9c, 0xf3, 0x01, 0x00, 0x00, 0x8a, 0x21, 0x25, 0x1b, 0x55, 0x02, 0xf5, 0x03, 0x16, 0x2b,
+    0x11, 0x10, 0x61, 0x00, 0x00, 0x08, 0x41, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff,
+    0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x84, 0x30, 0x08, 0x61, 0x01, 0x00, 0x00, 0x83, 0x10,
+    0x61, 0x22, 0x0b, 0x13, 0x13, 0x03, 0x36, 0x09, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0x92, 0x03, 0x16, 0x08, 0x02, 0xf5, 0x83, 0x02, 0xf6, 0x13, 0x35, 0x2a, 0xaf, 0x18, 0xe3, 0x02,
+    0x00, 0x00, 0x83, 0x42, 0x08, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xdf, 0x12, 0xff, 0xff, 0x82, 0xff,
+    0xdf, 0xff, 0xff, 0x52, 0xaa, 0x01, 0x00, 0x00, 0x84, 0x29, 0xea, 0x0b, 0x56, 0x02, 0xd4, 0x03,
+    0x16, 0x2a, 0x4d, 0x01, 0x00, 0x00, 0x81, 0x31, 0xa6, 0xff, 0xdf, 0x15, 0xff, 0xff, 0x84, 0xff,
+    0xdf, 0xff, 0xff, 0x52, 0xaa, 0x18, 0xe3, 0x31, 0x86, 0x39, 0x00, 0x00, 0x84, 0x10, 0xa2, 0x00,
+    0x00, 0xbd, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0x17, 0xff, 0xff, 0x80, 0x4a, 0x49, 0x01, 0x00, 0x00,
+    0x84, 0x21, 0xc9, 0x03, 0x36, 0x02, 0xd4, 0x03, 0x36, 0x2a, 0x4c, 0x01, 0x00, 0x00, 0x81, 0x29,
+    0x45, 0xe7, 0x3c, 0x16, 0xff, 0xff, 0x81, 0xce, 0x79, 0x39, 0xe7, 0x02, 0x00, 0x00, 0x83, 0x18,
+    0xc3, 0x1a, 0x0b, 0x13, 0x34, 0x03, 0x36, 0x07, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00,
+    0x00, 0x31, 0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0x92, 0x03, 0x16, 0x06, 0x02, 0xf5, 0x84, 0x03, 0x36, 0x0b, 0x35, 0x2a, 0xb0, 0x21, 0x46, 0x08,
+    0x20, 0x01, 0x00, 0x00, 0x84, 0x08, 0x61, 0x8c, 0x71, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x12,
+    0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x01, 0x00, 0x00, 0x8a, 0x18, 0xe4, 0x13,
+    0x34, 0x02, 0xd5, 0x02, 0xf5, 0x23, 0x12, 0x10, 0x61, 0x00, 0x00, 0x08, 0x41, 0xce, 0x38, 0xff,
+    0xff, 0xff, 0xdf, 0x15, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x00, 0x00, 0x6b, 0x2c, 0x3a, 0x00, 0x00,
+    0x83, 0x08, 0x41, 0x10, 0x82, 0x42, 0x28, 0xff, 0xdf, 0x18, 0xff, 0xff, 0x88, 0xde, 0xfb, 0x18,
+    0xc3, 0x00, 0x00, 0x08, 0x40, 0x2a, 0xcf, 0x03, 0x16, 0x02, 0xd4, 0x13, 0x56, 0x29, 0x87, 0x01,
+    0x00, 0x00, 0x81, 0x42, 0x28, 0xff, 0xdf, 0x14, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xff,
+    0xdf, 0x94, 0xb2, 0x21, 0x04, 0x01, 0x00, 0x00, 0x85, 0x08, 0x00, 0x10, 0x82, 0x2a, 0x2c, 0x1a,
+    0xf2, 0x0b, 0x56, 0x02, 0xf6, 0x04, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x00, 0x83, 0x00, 0x00, 0x31,
+    0x86, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x80, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02, 0x92, 0x03,
+    0x15, 0x04, 0x02, 0xf5, 0x84, 0x03, 0x16, 0x1b, 0x34, 0x1a, 0x6e, 0x21, 0x66, 0x08, 0x40, 0x01,
+    0x00, 0x00, 0x82, 0x00, 0x20, 0x5a, 0xeb, 0xde, 0xdb, 0x15, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff,
+    0xff, 0xad, 0x55, 0x01, 0x00, 0x00, 0x81, 0x18, 0xa2, 0x2b, 0x12, 0x01, 0x02, 0xf5, 0x81, 0x1b,
+    0x35, 0x21, 0x25, 0x01, 0x00, 0x00, 0x82, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x16, 0xff, 0xff,
+    0x82, 0x52, 0xaa, 0x20, 0xe4, 0x39, 0xe7, 0x3b, 0x00, 0x00, 0x84, 0x29, 0x45, 0x00, 0x00, 0xc6,
+    0x18, 0xff, 0xff, 0xff, 0xdf, 0x15, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x14, 0x01,
+    0x00, 0x00, 0x81, 0x10, 0x62, 0x1a, 0xf2, 0x01, 0x02, 0xf5, 0x81, 0x1b, 0x34, 0x21, 0x04, 0x01,
+    0x00, 0x00, 0x80, 0x63, 0x2c, 0x15, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xe7,
+    0x3c, 0x7b, 0xcf, 0x10, 0x82, 0x02, 0x00, 0x00, 0x8c, 0x18, 0xc2, 0x19, 0x67, 0x32, 0xd0, 0x0b,
+    0x14, 0x0b, 0x36, 0x03, 0x36, 0x02, 0xf5, 0x02, 0xd4, 0x03, 0x15, 0x00, 0x83, 0x00, 0x00, 0x31,
+    0x86, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0x8e, 0x01, 0x00, 0x00,
+    0x88, 0x02, 0x92, 0x02, 0xf5, 0x02, 0xd5, 0x02, 0xf6, 0x0b, 0x56, 0x0b, 0x15, 0x23, 0x12, 0x2a,
+    0x2b, 0x21, 0x04, 0x03, 0x00, 0x00, 0x81, 0x42, 0x07, 0xbd, 0xf7, 0x01, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x13, 0xff, 0xff, 0x8a, 0xff, 0xdf, 0xff, 0xff, 0xc6, 0x38, 0x10, 0x82, 0x00, 0x00, 0x10,
+    0x40, 0x22, 0xaf, 0x03, 0x16, 0x02, 0xd4, 0x03, 0x36, 0x19, 0x88, 0x01, 0x00, 0x00, 0x81, 0x42,
+    0x08, 0xff, 0xdf, 0x15, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x00, 0x63,
+    0x0c, 0x00, 0x20, 0x3b, 0x00, 0x00, 0x01, 0x08, 0x61, 0x82, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xdf,
+    0x18, 0xff, 0xff, 0x80, 0x6b, 0x6d, 0x01, 0x00, 0x00, 0x85, 0x19, 0x05, 0x0b, 0x35, 0x02, 0xd5,
+    0x02, 0xf5, 0x1a, 0xf2, 0x18, 0x82, 0x01, 0x00, 0x00, 0x82, 0x84, 0x10, 0xff, 0xff, 0xff, 0xdf,
+    0x17, 0xff, 0xff, 0x82, 0xde, 0xfb, 0x73, 0xae, 0x21, 0x04, 0x02, 0x00, 0x00, 0x89, 0x08, 0x20,
+    0x18, 0xe3, 0x32, 0x0a, 0x12, 0x2e, 0x2b, 0x53, 0x13, 0x55, 0x03, 0x37, 0x00, 0x84, 0x00, 0x00,
+    0x31, 0x86, 0x09, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x86,
+    0x02, 0xb3, 0x03, 0x37, 0x23, 0x75, 0x1a, 0xd1, 0x22, 0x2c, 0x29, 0x86, 0x08, 0x20, 0x03, 0x00,
+    0x00, 0x81, 0x4a, 0x49, 0xad, 0x75, 0x17, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a,
+    0x21, 0x04, 0x01, 0x00, 0x00, 0x88, 0x22, 0x0b, 0x03, 0x36, 0x02, 0xd4, 0x03, 0x36, 0x32, 0xae,
+    0x08, 0x20, 0x00, 0x00, 0x18, 0xa2, 0xde, 0xfb, 0x18, 0xff, 0xff, 0x82, 0x6b, 0x4d, 0x10, 0x82,
+    0x42, 0x08, 0x3d, 0x00, 0x00, 0x84, 0x29, 0x45, 0x00, 0x20, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf,
+    0x17, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0x31, 0xa6, 0x01, 0x00, 0x00, 0x84, 0x29, 0xe9, 0x13, 0x56,
+    0x02, 0xd4, 0x03, 0x16, 0x22, 0x8f, 0x02, 0x00, 0x00, 0x82, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf,
+    0x18, 0xff, 0xff, 0x83, 0xe7, 0x3c, 0x94, 0xb2, 0x31, 0x86, 0x00, 0x41, 0x02, 0x00, 0x00, 0x87,
+    0x08, 0x00, 0x20, 0xe3, 0x10, 0xe5, 0x22, 0x0a, 0x08, 0x82, 0x00, 0x00, 0x29, 0x65, 0xf7, 0x9e,
+    0x09, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x6b, 0x6d, 0x01, 0x00, 0x00, 0x83, 0x32, 0x4b, 0x11, 0x47,
+    0x18, 0xe4, 0x18, 0x81, 0x03, 0x00, 0x00, 0x82, 0x10, 0xa2, 0x6b, 0x4d, 0xc6, 0x59, 0x1a, 0xff,
+    0xff, 0x81, 0xef, 0x5d, 0x29, 0x45, 0x01, 0x00, 0x00, 0x85, 0x29, 0xa9, 0x0b, 0x36, 0x02, 0xd4,
+    0x03, 0x16, 0x2a, 0xd1, 0x10, 0x41, 0x01, 0x00, 0x00, 0x80, 0xad, 0x75, 0x16, 0xff, 0xff, 0x84,
+    0xff, 0xdf, 0xff, 0xff, 0xd6, 0xda, 0x00, 0x20, 0x63, 0x0c, 0x3e, 0x00, 0x00, 0x82, 0x10, 0x82,
+    0x08, 0x41, 0x5a, 0xcb, 0x1a, 0xff, 0xff, 0x81, 0xde, 0xdb, 0x18, 0xc3, 0x01, 0x00, 0x00, 0x8a,
+    0x32, 0x2c, 0x0b, 0x36, 0x02, 0xd4, 0x0b, 0x36, 0x2a, 0x8e, 0x08, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x83,
+    0xff, 0xdf, 0xc6, 0x38, 0x73, 0x8e, 0x39, 0xc7, 0x05, 0x00, 0x00, 0x85, 0x00, 0x20, 0x08, 0x41,
+    0x31, 0x86, 0x4a, 0x69, 0x52, 0xaa, 0x6b, 0x6d, 0x02, 0x73, 0x8e, 0x87, 0x6b, 0x6d, 0x73, 0x8e,
+    0x63, 0x0c, 0x52, 0xaa, 0x42, 0x08, 0x18, 0xc3, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x83,
+    0x18, 0xc3, 0x52, 0xaa, 0xa4, 0xf3, 0xef, 0x5d, 0x19, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff,
+    0xe7, 0x3c, 0x31, 0xa6, 0x01, 0x00, 0x00, 0x85, 0x29, 0xa8, 0x1b, 0x56, 0x02, 0xd4, 0x02, 0xf5,
+    0x1a, 0xf2, 0x08, 0x61, 0x01, 0x00, 0x00, 0x82, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0x17, 0xff,
+    0xff, 0x82, 0x5a, 0xcb, 0x10, 0x81, 0x39, 0xe7, 0x3f, 0x00, 0x00, 0x84, 0x29, 0x65, 0x00, 0x20,
+    0xce, 0x59, 0xff, 0xff, 0xff, 0xdf, 0x18, 0xff, 0xff, 0x81, 0xbd, 0xd7, 0x00, 0x20, 0x01, 0x00,
+    0x00, 0x84, 0x1a, 0x4d, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x36, 0x32, 0x6c, 0x01, 0x00, 0x00, 0x83,
+    0x00, 0x20, 0xa5, 0x14, 0xff, 0xff, 0xff, 0xdf, 0x1b, 0xff, 0xff, 0x85, 0xf7, 0xbe, 0xc6, 0x18,
+    0x94, 0x91, 0x42, 0x28, 0x19, 0x04, 0x08, 0x61, 0x12, 0x00, 0x00, 0x84, 0x10, 0xa2, 0x29, 0x45,
+    0x6b, 0x4d, 0xad, 0x75, 0xe7, 0x1c, 0x1b, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x5d,
+    0x31, 0xa6, 0x01, 0x00, 0x00, 0x85, 0x29, 0xa7, 0x1b, 0x55, 0x02, 0xd5, 0x02, 0xf5, 0x13, 0x34,
+    0x21, 0x45, 0x01, 0x00, 0x00, 0x80, 0x5a, 0xeb, 0x17, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff,
+    0xce, 0x79, 0x00, 0x00, 0x6b, 0x6d, 0x00, 0x20, 0x3f, 0x00, 0x00, 0x82, 0x08, 0x61, 0x10, 0x82,
+    0x42, 0x28, 0x19, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x01, 0x00, 0x00, 0x89,
+    0x08, 0x40, 0x22, 0x8f, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x36, 0x32, 0x6c, 0x08, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x94, 0x92, 0x1b, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x87, 0xf7, 0x9e,
+    0xce, 0x59, 0x9c, 0xd3, 0x73, 0xae, 0x62, 0xeb, 0x42, 0x08, 0x31, 0xa6, 0x08, 0x41, 0x06, 0x00,
+    0x00, 0x86, 0x21, 0x24, 0x39, 0xc7, 0x52, 0x8a, 0x6b, 0x4d, 0x84, 0x30, 0xb5, 0x96, 0xde, 0xfb,
+    0x04, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x18, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a,
+    0x31, 0x86, 0x01, 0x00, 0x00, 0x81, 0x29, 0xa7, 0x1b, 0x55, 0x01, 0x02, 0xf5, 0x81, 0x13, 0x34,
+    0x21, 0x66, 0x01, 0x00, 0x00, 0x81, 0x39, 0xe7, 0xf7, 0x9e, 0x19, 0xff, 0xff, 0x82, 0x31, 0xa6,
+    0x21, 0x24, 0x39, 0xe7, 0x41, 0x00, 0x00, 0x84, 0x29, 0x45, 0x00, 0x00, 0xb5, 0x96, 0xff, 0xff,
+    0xff, 0xdf, 0x17, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xcf, 0x01, 0x00, 0x00, 0x86,
+    0x10, 0x81, 0x1a, 0xf1, 0x03, 0x16, 0x02, 0xd4, 0x0b, 0x36, 0x32, 0x4c, 0x08, 0x20, 0x01, 0x00,
+    0x00, 0x80, 0x84, 0x30, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x21, 0xff, 0xff, 0x87, 0xff, 0xdf,
+    0xf7, 0xbe, 0xe7, 0x3c, 0xe7, 0x1c, 0xde, 0xfb, 0xce, 0x59, 0xbd, 0xf7, 0xd6, 0xba, 0x01, 0xe7,
+    0x1c, 0x81, 0xef, 0x7d, 0xf7, 0xbe, 0x22, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a,
+    0x21, 0x04, 0x01, 0x00, 0x00, 0x85, 0x29, 0xa7, 0x1b, 0x55, 0x02, 0xf5, 0x02, 0xd5, 0x13, 0x55,
+    0x29, 0xa8, 0x01, 0x00, 0x00, 0x81, 0x21, 0x24, 0xe7, 0x1c, 0x17, 0xff, 0xff, 0x84, 0xff, 0xdf,
+    0xff, 0xff, 0x9c, 0xf3, 0x00, 0x00, 0x7b, 0xcf, 0x42, 0x00, 0x00, 0x83, 0x08, 0x41, 0x18, 0xe3,
+    0x21, 0x24, 0xf7, 0x9e, 0x19, 0xff, 0xff, 0x82, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x01, 0x00,
+    0x00, 0x86, 0x18, 0xc2, 0x1a, 0xf1, 0x03, 0x16, 0x02, 0xd4, 0x0b, 0x36, 0x32, 0x6c, 0x08, 0x00,
+    0x01, 0x00, 0x00, 0x81, 0x63, 0x2c, 0xf7, 0xbe, 0x1f, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x0e, 0xff,
+    0xff, 0x01, 0xff, 0xdf, 0x1d, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xb5, 0xb6, 0x18, 0xc3,
+    0x01, 0x00, 0x00, 0x85, 0x29, 0xa7, 0x1b, 0x55, 0x02, 0xf5, 0x02, 0xd5, 0x13, 0x56, 0x31, 0xe9,
+    0x01, 0x00, 0x00, 0x83, 0x21, 0x04, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0x15, 0xff, 0xff, 0x85,
+    0xff, 0xdf, 0xff, 0xff, 0xe7, 0x1c, 0x10, 0x61, 0x52, 0x8a, 0x21, 0x24, 0x43, 0x00, 0x00, 0x84,
+    0x29, 0x65, 0x00, 0x20, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xdf, 0x1a, 0xff, 0xff, 0x80, 0x52, 0xaa,
+    0x01, 0x00, 0x00, 0x86, 0x18, 0xc3, 0x22, 0xf1, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x36, 0x2a, 0x6e,
+    0x08, 0x20, 0x01, 0x00, 0x00, 0x83, 0x42, 0x28, 0xe7, 0x3c, 0xff, 0xff, 0xff, 0xdf, 0x4b, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0x8c, 0x71, 0x02, 0x00, 0x00, 0x85, 0x29, 0xa8,
+    0x1b, 0x55, 0x02, 0xd5, 0x02, 0xf5, 0x13, 0x56, 0x31, 0xe9, 0x01, 0x00, 0x00, 0x83, 0x10, 0x82,
+    0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x52, 0xaa,
+    0x08, 0x61, 0x63, 0x2c, 0x45, 0x00, 0x00, 0x84, 0x31, 0xa6, 0x00, 0x00, 0xce, 0x59, 0xff, 0xff,
+    0xff, 0xdf, 0x19, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0x52, 0xaa, 0x01, 0x00, 0x00, 0x86, 0x18, 0x82,
+    0x1a, 0x8f, 0x03, 0x36, 0x02, 0xd4, 0x0b, 0x36, 0x1a, 0x6f, 0x10, 0x81, 0x01, 0x00, 0x00, 0x81,
+    0x21, 0x24, 0xbd, 0xf7, 0x4b, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0x9e, 0x6b, 0x4d,
+    0x01, 0x00, 0x00, 0x86, 0x08, 0x20, 0x29, 0xea, 0x13, 0x56, 0x02, 0xd4, 0x02, 0xf5, 0x13, 0x34,
+    0x29, 0xa7, 0x01, 0x00, 0x00, 0x83, 0x10, 0xa2, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xdf, 0x16, 0xff,
+    0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x34, 0x00, 0x00, 0x73, 0xae, 0x00, 0x21, 0x45, 0x00,
+    0x00, 0x83, 0x10, 0xa2, 0x18, 0xc3, 0x31, 0x85, 0xf7, 0xbe, 0x1b, 0xff, 0xff, 0x81, 0xff, 0xdf,
+    0x52, 0xaa, 0x01, 0x00, 0x00, 0x86, 0x08, 0x40, 0x1a, 0x4d, 0x0b, 0x56, 0x02, 0xd4, 0x03, 0x16,
+    0x23, 0x12, 0x21, 0x25, 0x01, 0x00, 0x00, 0x81, 0x08, 0x40, 0x8c, 0x51, 0x01, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x48, 0xff, 0xff, 0x81, 0xce, 0x79, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x86, 0x10, 0x81,
+    0x22, 0x8e, 0x0b, 0x36, 0x02, 0xd4, 0x03, 0x15, 0x13, 0x34, 0x21, 0x66, 0x01, 0x00, 0x00, 0x83,
+    0x10, 0xa2, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff,
+    0xe7, 0x1c, 0x10, 0xa2, 0x4a, 0x69, 0x29, 0x45, 0x47, 0x00, 0x00, 0x84, 0x31, 0x86, 0x00, 0x00,
+    0x84, 0x10, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x83, 0xad, 0x75, 0xb5, 0x96, 0xff, 0xff,
+    0xff, 0xdf, 0x10, 0xff, 0xff, 0x81, 0xff, 0xdf, 0x73, 0x8e, 0x02, 0x00, 0x00, 0x85, 0x2a, 0x2c,
+    0x13, 0x56, 0x02, 0xd5, 0x02, 0xf5, 0x23, 0x54, 0x21, 0x87, 0x02, 0x00, 0x00, 0x81, 0x5a, 0xaa,
+    0xde, 0xfb, 0x45, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0x94, 0xb2, 0x10, 0x82,
+    0x01, 0x00, 0x00, 0x86, 0x18, 0xc3, 0x2a, 0xf1, 0x03, 0x16, 0x02, 0xd4, 0x03, 0x16, 0x22, 0xd2,
+    0x18, 0xe4, 0x01, 0x00, 0x00, 0x83, 0x21, 0x24, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0xdf, 0x0f, 0xff,
+    0xff, 0x80, 0xc6, 0x38, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x84, 0xff, 0xdf,
+    0xff, 0xff, 0x4a, 0x69, 0x10, 0x82, 0x6b, 0x4d, 0x48, 0x00, 0x00, 0x84, 0x00, 0x20, 0x39, 0xc7,
+    0x00, 0x00, 0xc6, 0x38, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0xd6, 0xba, 0x52,
+    0xaa, 0x01, 0x00, 0x00, 0x82, 0xc6, 0x18, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x80, 0x7b,
+    0xcf, 0x02, 0x00, 0x00, 0x86, 0x29, 0xe9, 0x0b, 0x35, 0x02, 0xf5, 0x02, 0xd5, 0x13, 0x35, 0x1a,
+    0x0b, 0x10, 0x61, 0x01, 0x00, 0x00, 0x81, 0x10, 0xa2, 0xa5, 0x34, 0x42, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x81, 0xd6, 0xba, 0x4a, 0x69, 0x01, 0x00, 0x00, 0x87, 0x08, 0x00, 0x19,
+    0x87, 0x23, 0x34, 0x03, 0x16, 0x02, 0xd4, 0x03, 0x36, 0x32, 0xd0, 0x10, 0x62, 0x01, 0x00, 0x00,
+    0x86, 0x31, 0x85, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0xef, 0x7d, 0x0a,
+    0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xf3, 0x00, 0x00, 0x42, 0x08, 0xce, 0x79, 0x01,
+    0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x00, 0x84,
+    0x10, 0x00, 0x20, 0x49, 0x00, 0x00, 0x83, 0x10, 0xa2, 0x21, 0x04, 0x29, 0x65, 0xf7, 0xbe, 0x01,
+    0xff, 0xff, 0x89, 0xef, 0x7d, 0x73, 0x8e, 0x00, 0x00, 0x08, 0x61, 0x94, 0xb2, 0x39, 0xe7, 0x10,
+    0xa2, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0x7b,
+    0xef, 0x73, 0xae, 0x03, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x20, 0x01,
+    0x00, 0x00, 0x86, 0x19, 0x05, 0x22, 0xf2, 0x03, 0x16, 0x02, 0xd4, 0x03, 0x36, 0x2a, 0xf1, 0x10,
+    0xc3, 0x02, 0x00, 0x00, 0x81, 0x4a, 0x69, 0xd6, 0x9a, 0x41, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x8c,
+    0x51, 0x10, 0x82, 0x01, 0x00, 0x00, 0x82, 0x10, 0x61, 0x2a, 0x4c, 0x0b, 0x36, 0x01, 0x02, 0xf5,
+    0x82, 0x0b, 0x36, 0x22, 0x2c, 0x10, 0x40, 0x01, 0x00, 0x00, 0x83, 0x42, 0x28, 0xef, 0x5d, 0xff,
+    0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x83, 0x6b, 0x4c, 0x18, 0xc2, 0x73, 0xae, 0xde, 0xfb, 0x07,
+    0xff, 0xff, 0x88, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x00, 0x39, 0xc7, 0x29, 0x65, 0x00,
+    0x00, 0x6b, 0x6d, 0xe7, 0x3c, 0x02, 0xff, 0xff, 0x83, 0xd6, 0xba, 0x00, 0x00, 0x5a, 0xcb, 0x29,
+    0x45, 0x4b, 0x00, 0x00, 0x8d, 0x31, 0x86, 0x00, 0x00, 0x6b, 0x4d, 0xff, 0xff, 0x94, 0x92, 0x18,
+    0xc3, 0x00, 0x20, 0x73, 0xae, 0xd6, 0x9a, 0x5a, 0xcb, 0x4a, 0x49, 0x18, 0xe3, 0x31, 0x86, 0xef,
+    0x7d, 0x07, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x51, 0x00, 0x00, 0x08, 0x41, 0x63,
+    0x0c, 0x05, 0xff, 0xff, 0x81, 0xbd, 0xf7, 0x18, 0xc3, 0x01, 0x00, 0x00, 0x87, 0x10, 0x82, 0x2a,
+    0xaf, 0x03, 0x36, 0x02, 0xd5, 0x02, 0xf5, 0x1b, 0x34, 0x2a, 0x0a, 0x08, 0x00, 0x01, 0x00, 0x00,
+    0x82, 0x08, 0x41, 0x84, 0x10, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x3b, 0xff, 0xff,
+    0x81, 0xb5, 0x96, 0x39, 0xc7, 0x02, 0x00, 0x00, 0x86, 0x21, 0x66, 0x23, 0x33, 0x03, 0x16, 0x02,
+    0xd4, 0x02, 0xf6, 0x23, 0x34, 0x19, 0x67, 0x02, 0x00, 0x00, 0x83, 0x6b, 0x6d, 0xf7, 0xbe, 0xff,
+    0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x85, 0x6b, 0x4d, 0x21, 0x24, 0x52, 0xaa, 0x10, 0x82, 0x5a,
+    0xcb, 0xce, 0x59, 0x06, 0xff, 0xff, 0x8d, 0xef, 0x7d, 0x21, 0x04, 0x29, 0x45, 0x8c, 0x51, 0x9c,
+    0xf3, 0x84, 0x30, 0x08, 0x40, 0x10, 0x81, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf, 0x39, 0xc7, 0x21,
+    0x04, 0x63, 0x2c, 0x4d, 0x00, 0x00, 0x87, 0x39, 0xc7, 0x00, 0x20, 0x21, 0x04, 0x00, 0x00, 0x5a,
+    0xcb, 0xd6, 0xba, 0x84, 0x10, 0x08, 0x61, 0x01, 0x00, 0x00, 0x83, 0x4a, 0x49, 0x00, 0x00, 0x5a,
+    0xaa, 0xf7, 0xbe, 0x07, 0xff, 0xff, 0x86, 0xad, 0x75, 0x00, 0x00, 0x9c, 0xf3, 0xe7, 0x1c, 0x21,
+    0x04, 0x4a, 0x69, 0xff, 0xde, 0x02, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0xd6, 0xba, 0x39,
+    0xc7, 0x01, 0x00, 0x00, 0x87, 0x08, 0x20, 0x21, 0xca, 0x1b, 0x55, 0x02, 0xf5, 0x02, 0xd5, 0x0b,
+    0x36, 0x22, 0xb0, 0x21, 0x25, 0x02, 0x00, 0x00, 0x82, 0x20, 0xe3, 0x94, 0xb2, 0xf7, 0x9e, 0x36,
+    0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0xce, 0x59, 0x4a, 0x69, 0x02, 0x00, 0x00,
+    0x87, 0x18, 0xa2, 0x2a, 0x6d, 0x13, 0x35, 0x02, 0xf5, 0x02, 0xd5, 0x0b, 0x36, 0x1a, 0xb0, 0x20,
+    0xe3, 0x01, 0x00, 0x00, 0x81, 0x08, 0x41, 0x94, 0x92, 0x03, 0xff, 0xff, 0x8b, 0xef, 0x7d, 0xf7,
+    0x9e, 0xff, 0xff, 0xce, 0x59, 0x29, 0x45, 0xef, 0x3c, 0xc6, 0x38, 0x39, 0xe7, 0x00, 0x00, 0x42,
+    0x08, 0xbd, 0xd7, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xf7, 0xbe, 0x4a, 0x49, 0x00,
+    0x00, 0x94, 0xb2, 0x01, 0x00, 0x00, 0x87, 0x4a, 0x49, 0xbd, 0xd7, 0x63, 0x0c, 0x00, 0x00, 0x31,
+    0xa6, 0x63, 0x0b, 0x00, 0x00, 0x7b, 0xef, 0x4e, 0x00, 0x00, 0x85, 0x10, 0x82, 0x21, 0x04, 0x29,
+    0x65, 0xce, 0x59, 0xa5, 0x14, 0x21, 0x04, 0x04, 0x00, 0x00, 0x82, 0x52, 0xaa, 0x00, 0x00, 0x73,
+    0x8e, 0x04, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79, 0x00, 0x00, 0x73, 0xae, 0x01,
+    0xff, 0xff, 0x84, 0xe7, 0x3c, 0x18, 0xc3, 0x84, 0x10, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x83, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0x9e, 0x6b, 0x4d, 0x02, 0x00, 0x00, 0x87, 0x21, 0x25, 0x22,
+    0xd1, 0x03, 0x36, 0x02, 0xd5, 0x03, 0x16, 0x1b, 0x35, 0x22, 0x4c, 0x10, 0x81, 0x02, 0x00, 0x00,
+    0x82, 0x31, 0x86, 0x9c, 0xd3, 0xf7, 0xbe, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x33, 0xff, 0xff,
+    0x82, 0xce, 0x59, 0x5a, 0xcb, 0x00, 0x20, 0x01, 0x00, 0x00, 0x88, 0x08, 0x20, 0x21, 0xc9, 0x1b,
+    0x13, 0x03, 0x36, 0x02, 0xd4, 0x03, 0x16, 0x13, 0x34, 0x2a, 0x0a, 0x10, 0x40, 0x01, 0x00, 0x00,
+    0x81, 0x29, 0x65, 0xc6, 0x18, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xdb, 0x4a,
+    0x49, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x8e, 0x39, 0xe7, 0x7b, 0xae, 0xff, 0xff, 0x4a, 0x49, 0x5a,
+    0xcb, 0x63, 0x0c, 0x00, 0x00, 0x42, 0x08, 0xef, 0x5d, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x00,
+    0x00, 0x9c, 0xf3, 0x10, 0x82, 0x02, 0x00, 0x00, 0x86, 0x08, 0x41, 0x63, 0x2c, 0xbd, 0xf7, 0x39,
+    0xe7, 0x00, 0x00, 0x7b, 0xcf, 0x18, 0xe3, 0x4f, 0x00, 0x00, 0x82, 0x39, 0xc7, 0xbd, 0xf7, 0x39,
+    0xc7, 0x06, 0x00, 0x00, 0x85, 0x00, 0x20, 0x63, 0x2c, 0x00, 0x00, 0x7b, 0xef, 0xff, 0xff, 0xff,
+    0xdf, 0x02, 0xff, 0xff, 0x81, 0xd6, 0xba, 0x10, 0xa2, 0x01, 0x31, 0x86, 0x80, 0xce, 0x38, 0x01,
+    0xff, 0xff, 0x82, 0x63, 0x2c, 0x31, 0xa6, 0xff, 0xdf, 0x06, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x18,
+    0xc3, 0x01, 0x00, 0x00, 0x88, 0x08, 0x20, 0x2a, 0x2b, 0x1b, 0x55, 0x03, 0x16, 0x02, 0xd5, 0x03,
+    0x36, 0x23, 0x13, 0x21, 0xc9, 0x10, 0x81, 0x02, 0x00, 0x00, 0x82, 0x21, 0x24, 0x8c, 0x51, 0xe6,
+    0xfb, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x29, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff,
+    0x82, 0xb5, 0x96, 0x52, 0x8a, 0x00, 0x20, 0x01, 0x00, 0x00, 0x83, 0x08, 0x20, 0x19, 0x46, 0x2a,
+    0xf1, 0x0b, 0x36, 0x01, 0x02, 0xf5, 0x82, 0x0b, 0x36, 0x2a, 0xd0, 0x21, 0x04, 0x02, 0x00, 0x00,
+    0x82, 0x52, 0xaa, 0xef, 0x7d, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x82, 0xff, 0xff, 0x9c, 0xf3, 0x29,
+    0x45, 0x02, 0xff, 0xff, 0x83, 0xad, 0x55, 0x18, 0xe3, 0x31, 0x86, 0x5a, 0xcb, 0x01, 0xff, 0xff,
+    0x87, 0xce, 0x59, 0xad, 0x75, 0xf7, 0xbe, 0xff, 0xff, 0x84, 0x30, 0x00, 0x00, 0x8c, 0x51, 0x21,
+    0x04, 0x05, 0x00, 0x00, 0x83, 0x10, 0xa2, 0x8c, 0x51, 0xad, 0x75, 0x4a, 0x69, 0x5b, 0x00, 0x00,
+    0x90, 0x10, 0x81, 0x5a, 0xeb, 0x00, 0x00, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd6,
+    0xba, 0x10, 0xa2, 0x52, 0x8a, 0xf7, 0xbe, 0x7b, 0xcf, 0x08, 0x61, 0x7b, 0xcf, 0x94, 0xb2, 0x00,
+    0x00, 0x8c, 0x51, 0x08, 0xff, 0xff, 0x81, 0xde, 0xfb, 0x52, 0x8a, 0x02, 0x00, 0x00, 0x82, 0x21,
+    0x04, 0x22, 0xaf, 0x0b, 0x35, 0x01, 0x02, 0xf5, 0x83, 0x0b, 0x36, 0x22, 0xf2, 0x29, 0xc8, 0x10,
+    0x61, 0x02, 0x00, 0x00, 0x83, 0x18, 0xe3, 0x63, 0x2c, 0xc6, 0x18, 0xff, 0xdf, 0x02, 0xff, 0xff,
+    0x80, 0xff, 0xdf, 0x24, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0x94,
+    0x92, 0x31, 0xa7, 0x02, 0x00, 0x00, 0x89, 0x08, 0x40, 0x21, 0x46, 0x2a, 0xaf, 0x13, 0x35, 0x02,
+    0xf5, 0x02, 0xd5, 0x03, 0x16, 0x1b, 0x13, 0x21, 0xa8, 0x10, 0x61, 0x01, 0x00, 0x00, 0x81, 0x18,
+    0xc3, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x87, 0x8c, 0x51, 0x52,
+    0x8a, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0x21, 0x04, 0x42, 0x08, 0x05, 0xff, 0xff,
+    0x83, 0x9c, 0xf3, 0x00, 0x00, 0x73, 0xae, 0x39, 0xc7, 0x08, 0x00, 0x00, 0x80, 0x18, 0xc3, 0x5d,
+    0x00, 0x00, 0x83, 0x10, 0x82, 0x63, 0x2c, 0x00, 0x00, 0x9c, 0xf3, 0x01, 0xff, 0xff, 0x81, 0x9c,
+    0xd3, 0x42, 0x08, 0x02, 0xff, 0xff, 0x89, 0xa5, 0x14, 0x29, 0x45, 0x10, 0xa2, 0x6b, 0x4d, 0xf7,
+    0x9e, 0x84, 0x10, 0x39, 0xc6, 0x29, 0x65, 0x63, 0x2c, 0xde, 0xdb, 0x02, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x81, 0x9c, 0xd3, 0x10, 0xa2, 0x02, 0x00, 0x00, 0x82, 0x21, 0x87, 0x1a,
+    0xf1, 0x0b, 0x36, 0x01, 0x02, 0xf5, 0x83, 0x03, 0x36, 0x2b, 0x12, 0x21, 0xa9, 0x18, 0x82, 0x03,
+    0x00, 0x00, 0x82, 0x39, 0xc7, 0x84, 0x30, 0xd6, 0xba, 0x04, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x1b,
+    0xff, 0xff, 0x01, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x83, 0xef, 0x7d, 0xad, 0x75, 0x63, 0x0b, 0x08,
+    0x61, 0x02, 0x00, 0x00, 0x89, 0x08, 0x40, 0x21, 0x47, 0x2a, 0xaf, 0x13, 0x35, 0x03, 0x16, 0x02,
+    0xd5, 0x03, 0x16, 0x1b, 0x34, 0x2a, 0x2c, 0x10, 0x82, 0x02, 0x00, 0x00, 0x82, 0x5a, 0xca, 0xde,
+    0xfb, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x86, 0xff, 0xff, 0xe7, 0x3c, 0x73, 0xae, 0xe7, 0x3c, 0xff,
+    0xff, 0x6b, 0x6d, 0x73, 0x8e, 0x01, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x82, 0x7b, 0xef, 0x39, 0xe7,
+    0xff, 0xdf, 0x01, 0xff, 0xff, 0x85, 0xff, 0xdf, 0xff, 0xff, 0xa5, 0x14, 0x00, 0x00, 0x6b, 0x4d,
+    0x4a, 0x49, 0x69, 0x00, 0x00, 0x83, 0x18, 0xe3, 0x63, 0x2c, 0x00, 0x00, 0x9c, 0xf3, 0x06, 0xff,
+    0xff, 0x89, 0xf7, 0x9e, 0xe7, 0x3c, 0xff, 0xff, 0x42, 0x28, 0x10, 0xa2, 0x94, 0xb2, 0xb5, 0x96,
+    0x5a, 0xcb, 0x18, 0xc3, 0xce, 0x79, 0x05, 0xff, 0xff, 0x81, 0xde, 0xfb, 0x5a, 0xcb, 0x02, 0x00,
+    0x00, 0x83, 0x10, 0x61, 0x29, 0xea, 0x23, 0x12, 0x0b, 0x36, 0x01, 0x02, 0xf5, 0x84, 0x0b, 0x36,
+    0x12, 0xd2, 0x2a, 0x4c, 0x18, 0xc3, 0x10, 0x40, 0x02, 0x00, 0x00, 0x84, 0x10, 0x82, 0x31, 0xa6,
+    0x84, 0x0f, 0xc6, 0x38, 0xef, 0x7d, 0x1f, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xde, 0xdb, 0xad, 0x55,
+    0x52, 0x8a, 0x21, 0x24, 0x02, 0x00, 0x00, 0x8a, 0x08, 0x00, 0x10, 0x82, 0x21, 0xa8, 0x22, 0xd1,
+    0x13, 0x35, 0x02, 0xf5, 0x02, 0xd5, 0x03, 0x16, 0x13, 0x34, 0x2a, 0x8e, 0x18, 0xe4, 0x02, 0x00,
+    0x00, 0x81, 0x21, 0x24, 0xa5, 0x34, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x87,
+    0xef, 0x7d, 0x18, 0xc3, 0x5a, 0xaa, 0xff, 0xff, 0x5a, 0xcb, 0x4a, 0x49, 0xd6, 0xba, 0xf7, 0xbe,
+    0x01, 0xff, 0xff, 0x89, 0xe7, 0x3c, 0x08, 0x61, 0xb5, 0x96, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff,
+    0xa5, 0x14, 0x00, 0x00, 0x52, 0xaa, 0x73, 0x8e, 0x6b, 0x00, 0x00, 0x83, 0x18, 0xe3, 0x63, 0x2c,
+    0x00, 0x00, 0x84, 0x30, 0x07, 0xff, 0xff, 0x82, 0x6b, 0x4d, 0x08, 0x61, 0xe7, 0x1c, 0x02, 0xff,
+    0xff, 0x81, 0x5a, 0xeb, 0x31, 0x86, 0x04, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81,
+    0xb5, 0x96, 0x31, 0xa6, 0x02, 0x00, 0x00, 0x83, 0x10, 0x81, 0x29, 0xea, 0x2b, 0x13, 0x03, 0x36,
+    0x01, 0x02, 0xf5, 0x84, 0x03, 0x15, 0x1b, 0x55, 0x22, 0x8e, 0x21, 0xa8, 0x18, 0xc2, 0x04, 0x00,
+    0x00, 0x84, 0x21, 0x04, 0x5a, 0xcb, 0x84, 0x30, 0xbd, 0xf7, 0xe7, 0x3c, 0x17, 0xff, 0xff, 0x85,
+    0xf7, 0xbe, 0xd6, 0xba, 0xa5, 0x34, 0x73, 0x8e, 0x4a, 0x28, 0x08, 0x61, 0x03, 0x00, 0x00, 0x8a,
+    0x08, 0x20, 0x29, 0x66, 0x1a, 0x0c, 0x2b, 0x33, 0x03, 0x16, 0x02, 0xf5, 0x02, 0xd5, 0x03, 0x16,
+    0x1b, 0x55, 0x2a, 0x6e, 0x21, 0x25, 0x02, 0x00, 0x00, 0x82, 0x08, 0x41, 0x7b, 0xcf, 0xef, 0x5d,
+    0x03, 0xff, 0xff, 0x8f, 0xef, 0x7d, 0xad, 0x55, 0xb5, 0x96, 0xff, 0xdf, 0xde, 0xdb, 0x00, 0x20,
+    0x8c, 0x51, 0x4a, 0x28, 0x29, 0x45, 0x10, 0xa2, 0x29, 0x65, 0x5a, 0xeb, 0x9c, 0xf3, 0xde, 0xdb,
+    0x73, 0xae, 0xbd, 0xd7, 0x01, 0xff, 0xff, 0x83, 0xa5, 0x14, 0x00, 0x00, 0x4a, 0x69, 0x7b, 0xcf,
+    0x6d, 0x00, 0x00, 0x83, 0x18, 0xe3, 0x6b, 0x4d, 0x00, 0x00, 0x84, 0x10, 0x01, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xe7, 0x1c, 0x10, 0xa2, 0xad, 0x55, 0xff, 0xff, 0x01, 0xff,
+    0xdf, 0x85, 0xff, 0xff, 0xde, 0xdb, 0x10, 0x82, 0xd6, 0xba, 0xff, 0xff, 0xf7, 0xbe, 0x05, 0xff,
+    0xff, 0x82, 0xf7, 0xbe, 0x9c, 0xf3, 0x29, 0x44, 0x02, 0x00, 0x00, 0x8c, 0x10, 0x82, 0x32, 0x09,
+    0x1a, 0xd1, 0x13, 0x55, 0x03, 0x16, 0x02, 0xd5, 0x02, 0xf6, 0x13, 0x56, 0x12, 0xf3, 0x32, 0xcf,
+    0x21, 0x87, 0x18, 0xc3, 0x08, 0x20, 0x03, 0x00, 0x00, 0x89, 0x00, 0x20, 0x18, 0xc3, 0x29, 0x45,
+    0x63, 0x0c, 0x8c, 0x51, 0xa5, 0x34, 0xbd, 0xf7, 0xd6, 0x9a, 0xe7, 0x3c, 0xef, 0x7d, 0x02, 0xff,
+    0xdf, 0x02, 0xff, 0xff, 0x8b, 0xf7, 0xbe, 0xff, 0xdf, 0xf7, 0xbe, 0xef, 0x5d, 0xde, 0xfb, 0xce,
+    0x59, 0xb5, 0xb6, 0x9c, 0xf3, 0x73, 0xae, 0x42, 0x28, 0x21, 0x04, 0x10, 0x82, 0x04, 0x00, 0x00,
+    0x8c, 0x18, 0xa2, 0x10, 0xc4, 0x32, 0x6c, 0x1a, 0xd1, 0x13, 0x35, 0x03, 0x36, 0x02, 0xd5, 0x02,
+    0xf5, 0x0b, 0x36, 0x1b, 0x14, 0x32, 0x6d, 0x18, 0xe4, 0x08, 0x20, 0x01, 0x00, 0x00, 0x82, 0x08,
+    0x41, 0x5a, 0xeb, 0xd6, 0xba, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x8f, 0xad,
+    0x55, 0x21, 0x04, 0x29, 0x65, 0x10, 0xa2, 0x5a, 0xeb, 0xff, 0xff, 0xad, 0x34, 0x00, 0x00, 0x10,
+    0x82, 0xd6, 0x9a, 0xe7, 0x1c, 0x9c, 0xf3, 0x42, 0x08, 0x18, 0xc3, 0x52, 0x8a, 0xf7, 0x9e, 0x01,
+    0xff, 0xff, 0x83, 0x94, 0x92, 0x00, 0x00, 0x6b, 0x2c, 0x7b, 0xcf, 0x6f, 0x00, 0x00, 0x83, 0x18,
+    0xe3, 0x6b, 0x6d, 0x00, 0x00, 0x63, 0x2c, 0x01, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x83, 0xff, 0xff,
+    0xb5, 0xb6, 0x08, 0x61, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79,
+    0x08, 0x41, 0xde, 0xdb, 0xff, 0xdf, 0x39, 0xc7, 0xbd, 0xd7, 0x03, 0xff, 0xff, 0x80, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x82, 0xef, 0x7d, 0x84, 0x30, 0x18, 0xe3, 0x02, 0x00, 0x00, 0x8e, 0x10, 0x40,
+    0x21, 0x67, 0x2a, 0x8e, 0x1b, 0x54, 0x03, 0x15, 0x02, 0xf6, 0x02, 0xf5, 0x03, 0x15, 0x03, 0x16,
+    0x2b, 0x54, 0x12, 0x4e, 0x29, 0xea, 0x31, 0x86, 0x00, 0x20, 0x08, 0x20, 0x07, 0x00, 0x00, 0x8c,
+    0x21, 0x04, 0x29, 0x65, 0x42, 0x28, 0x42, 0x08, 0x39, 0xe7, 0x52, 0x89, 0x5a, 0xcb, 0x42, 0x28,
+    0x39, 0xe7, 0x42, 0x08, 0x39, 0xe7, 0x29, 0x45, 0x10, 0xa2, 0x07, 0x00, 0x00, 0x86, 0x00, 0x20,
+    0x18, 0xc2, 0x31, 0xe9, 0x09, 0xec, 0x2b, 0x32, 0x13, 0x35, 0x03, 0x16, 0x01, 0x02, 0xf5, 0x84,
+    0x03, 0x16, 0x0b, 0x35, 0x33, 0x32, 0x11, 0x89, 0x21, 0x03, 0x03, 0x00, 0x00, 0x81, 0x5a, 0xcb,
+    0xc6, 0x38, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x85, 0xce, 0x79, 0x08, 0x41,
+    0x94, 0xb2, 0xff, 0xff, 0xde, 0xdb, 0xd6, 0xba, 0x01, 0xff, 0xff, 0x82, 0x7b, 0xef, 0x00, 0x00,
+    0xd6, 0xba, 0x02, 0xff, 0xff, 0x01, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x83, 0x84, 0x30, 0x00, 0x00,
+    0x6b, 0x6d, 0x73, 0x8e, 0x71, 0x00, 0x00, 0x8b, 0x10, 0x82, 0x7b, 0xcf, 0x00, 0x00, 0x52, 0xaa,
+    0xf7, 0x9e, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xc6, 0x18, 0x10, 0xa2, 0xff, 0xdf, 0xff, 0xff,
+    0x01, 0xff, 0xdf, 0x86, 0xff, 0xff, 0x73, 0x8e, 0x10, 0xa2, 0xff, 0xff, 0x7b, 0xcf, 0x10, 0x82,
+    0xe7, 0x1c, 0x08, 0xff, 0xff, 0x82, 0xef, 0x5d, 0x8c, 0x71, 0x29, 0x65, 0x02, 0x00, 0x00, 0x85,
+    0x08, 0x40, 0x10, 0xa3, 0x32, 0x2b, 0x1a, 0xb0, 0x1b, 0x55, 0x03, 0x36, 0x01, 0x02, 0xf5, 0x89,
+    0x03, 0x16, 0x0b, 0x36, 0x13, 0x15, 0x0a, 0xd2, 0x3b, 0x10, 0x2a, 0x0a, 0x08, 0xe5, 0x19, 0x04,
+    0x21, 0x03, 0x10, 0x40, 0x12, 0x00, 0x00, 0x88, 0x18, 0xa2, 0x21, 0x04, 0x10, 0xe5, 0x11, 0x47,
+    0x42, 0xef, 0x22, 0xf1, 0x0a, 0xf3, 0x13, 0x35, 0x03, 0x36, 0x01, 0x02, 0xf5, 0x85, 0x03, 0x16,
+    0x13, 0x56, 0x1a, 0xf3, 0x22, 0x6e, 0x29, 0x66, 0x10, 0x61, 0x02, 0x00, 0x00, 0x82, 0x08, 0x62,
+    0x5a, 0xeb, 0xce, 0x59, 0x05, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x6d, 0x5a, 0xcb,
+    0x01, 0xff, 0xff, 0x87, 0xef, 0x7d, 0xb5, 0x96, 0xa5, 0x14, 0xe7, 0x3c, 0xff, 0xff, 0x39, 0xe7,
+    0x31, 0xa6, 0xf7, 0xbe, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0x63, 0x0c, 0x00, 0x00, 0x84,
+    0x30, 0x4a, 0x49, 0x73, 0x00, 0x00, 0x89, 0x08, 0x61, 0x63, 0x0c, 0x00, 0x00, 0x29, 0x45, 0xd6,
+    0xba, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x29, 0x65, 0x73, 0x8e, 0x02, 0xff, 0xff, 0x87, 0xbd,
+    0xd7, 0x00, 0x00, 0xa5, 0x13, 0xe7, 0x1c, 0x00, 0x00, 0xa5, 0x34, 0xff, 0xff, 0xff, 0xdf, 0x06,
+    0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x83, 0xf7, 0x9e, 0xa5, 0x14, 0x42, 0x28, 0x00,
+    0x20, 0x02, 0x00, 0x00, 0x87, 0x10, 0x40, 0x21, 0x45, 0x19, 0xea, 0x3b, 0x31, 0x0a, 0xf4, 0x0b,
+    0x35, 0x03, 0x36, 0x02, 0xf6, 0x01, 0x02, 0xf5, 0x8b, 0x03, 0x16, 0x0b, 0x36, 0x23, 0x55, 0x2b,
+    0x53, 0x12, 0x90, 0x00, 0x42, 0x00, 0x00, 0x10, 0xa2, 0x63, 0x0c, 0x42, 0x28, 0x4a, 0x49, 0x29,
+    0x65, 0x03, 0x08, 0x61, 0x84, 0x10, 0xa2, 0x42, 0x08, 0x42, 0x28, 0x52, 0xaa, 0x31, 0x86, 0x01,
+    0x00, 0x00, 0x84, 0x01, 0xcc, 0x23, 0x12, 0x2b, 0x74, 0x1b, 0x55, 0x03, 0x16, 0x01, 0x02, 0xf5,
+    0x87, 0x02, 0xf6, 0x03, 0x16, 0x0b, 0x36, 0x0b, 0x15, 0x23, 0x13, 0x32, 0x8d, 0x11, 0x47, 0x20,
+    0xc2, 0x03, 0x00, 0x00, 0x82, 0x21, 0x04, 0x7b, 0xef, 0xd6, 0x9a, 0x02, 0xff, 0xff, 0x9a, 0xff,
+    0xdf, 0xff, 0xff, 0xf7, 0xbe, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9c, 0xd3, 0x10,
+    0x82, 0x7b, 0xcf, 0x52, 0x89, 0x18, 0xe3, 0x10, 0x82, 0x21, 0x04, 0x21, 0x24, 0xde, 0xfb, 0xef,
+    0x5d, 0x18, 0xc3, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x7d, 0x42, 0x28, 0x00,
+    0x00, 0x94, 0x71, 0x42, 0x28, 0x76, 0x00, 0x00, 0x83, 0x6b, 0x4d, 0x18, 0xe3, 0x10, 0x82, 0xb5,
+    0x96, 0x01, 0xff, 0xff, 0x89, 0xc6, 0x38, 0x18, 0xc3, 0x52, 0x8a, 0x9c, 0xd3, 0x6b, 0x6d, 0x00,
+    0x00, 0x73, 0x8e, 0xff, 0xff, 0x4a, 0x49, 0x42, 0x28, 0x02, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff,
+    0xff, 0xc6, 0x18, 0x5a, 0xeb, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff,
+    0x82, 0xce, 0x59, 0x6b, 0x6d, 0x29, 0x45, 0x03, 0x00, 0x00, 0x87, 0x10, 0x41, 0x08, 0x41, 0x3a,
+    0x09, 0x1a, 0x2d, 0x1a, 0xd1, 0x2b, 0x75, 0x0b, 0x36, 0x03, 0x16, 0x02, 0x02, 0xf5, 0x83, 0x03,
+    0x37, 0x00, 0x84, 0x00, 0x00, 0x31, 0x86, 0x02, 0xff, 0xdf, 0x80, 0xf7, 0xbe, 0x03, 0xef, 0x7d,
+    0x84, 0xf7, 0x9e, 0xff, 0xdf, 0xf7, 0xbe, 0xff, 0xff, 0x73, 0x8e, 0x01, 0x00, 0x00, 0x81, 0x02,
+    0xb3, 0x03, 0x16, 0x02, 0x02, 0xf5, 0x87, 0x03, 0x36, 0x1b, 0x55, 0x2b, 0x53, 0x0a, 0x4e, 0x32,
+    0x4c, 0x21, 0x45, 0x08, 0x41, 0x08, 0x20, 0x02, 0x00, 0x00, 0x83, 0x10, 0x82, 0x4a, 0x49, 0xa5,
+    0x14, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x8e, 0x5a, 0xcb, 0x21,
+    0x24, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xef, 0x39, 0xe7, 0x4a, 0x69, 0xad,
+    0x75, 0xf7, 0xbe, 0xff, 0xff, 0x31, 0x86, 0x84, 0x30, 0xff, 0xff, 0x01, 0xce, 0x59, 0x01, 0xff,
+    0xff, 0x84, 0xd6, 0xba, 0x29, 0x45, 0x08, 0x41, 0xa5, 0x14, 0x31, 0xa6, 0x78, 0x00, 0x00, 0x83,
+    0x5a, 0xeb, 0x4a, 0x48, 0x00, 0x00, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x8a, 0xe7, 0x1c, 0x73, 0xae,
+    0x39, 0xc7, 0x52, 0x8a, 0xad, 0x75, 0xff, 0xff, 0xb5, 0xb6, 0x00, 0x00, 0xd6, 0x9a, 0xff, 0xff,
+    0xff, 0xdf, 0x02, 0xff, 0xff, 0x84, 0x4a, 0x49, 0x4a, 0x69, 0xce, 0x59, 0x52, 0xaa, 0xc6, 0x38,
+    0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x83, 0xef, 0x7d, 0xb5, 0x96, 0x6b, 0x4d,
+    0x10, 0xa2, 0x04, 0x00, 0x00, 0x8a, 0x18, 0x81, 0x21, 0x24, 0x08, 0xe5, 0x32, 0x6c, 0x43, 0x10,
+    0x1a, 0xd2, 0x02, 0xb3, 0x13, 0x56, 0x00, 0x83, 0x00, 0x00, 0x31, 0xa6, 0x0b, 0xff, 0xff, 0x80,
+    0x7b, 0xcf, 0x01, 0x00, 0x00, 0x88, 0x0a, 0xd2, 0x0b, 0x15, 0x0a, 0xd2, 0x33, 0x11, 0x42, 0xef,
+    0x09, 0x27, 0x19, 0x05, 0x29, 0x03, 0x08, 0x00, 0x03, 0x00, 0x00, 0x83, 0x08, 0x61, 0x39, 0xc6,
+    0x94, 0x91, 0xd6, 0xba, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x85, 0x42, 0x28,
+    0x31, 0x86, 0x18, 0xe3, 0xb5, 0x96, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x81, 0x29, 0x65,
+    0x9c, 0xf3, 0x03, 0xff, 0xff, 0x84, 0xb5, 0x96, 0x10, 0xa2, 0x29, 0x45, 0xad, 0x75, 0x18, 0xc3,
+    0x7a, 0x00, 0x00, 0x84, 0x39, 0xe7, 0x08, 0x41, 0xc5, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xff,
+    0xff, 0x84, 0xf7, 0xbe, 0x21, 0x24, 0x6b, 0x4d, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x87,
+    0xce, 0x59, 0x08, 0x40, 0xd6, 0x9a, 0xe7, 0x3c, 0x5a, 0xcb, 0x21, 0x04, 0x52, 0x8a, 0xa5, 0x34,
+    0x03, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x84, 0xf7, 0x9e, 0xb5, 0x96, 0x63, 0x0c,
+    0x39, 0xc7, 0x00, 0x20, 0x04, 0x00, 0x00, 0x8a, 0x08, 0x20, 0x00, 0x20, 0x08, 0x41, 0x31, 0xc7,
+    0x08, 0x41, 0x00, 0x00, 0x18, 0xa2, 0x8c, 0x71, 0x94, 0xb2, 0xb5, 0x96, 0xc6, 0x38, 0x05, 0xc6,
+    0x18, 0x82, 0x9c, 0xf3, 0x94, 0xb2, 0x39, 0xe7, 0x01, 0x00, 0x00, 0x83, 0x31, 0xa7, 0x21, 0x04,
+    0x00, 0x20, 0x08, 0x20, 0x05, 0x00, 0x00, 0x83, 0x21, 0x24, 0x52, 0x8a, 0x8c, 0x71, 0xde, 0xfb,
+    0x03, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x84, 0x5a, 0xeb, 0x8c, 0x51, 0x9c, 0xd3,
+    0x00, 0x00, 0x9c, 0xd3, 0x01, 0xff, 0xff, 0x87, 0xb5, 0xb6, 0x6b, 0x6d, 0xd6, 0xba, 0xc6, 0x18,
+    0x39, 0xe7, 0x42, 0x08, 0xf7, 0xbe, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x84, 0xff, 0xff, 0x52, 0xaa,
+    0x00, 0x00, 0x7b, 0xef, 0x08, 0x61, 0x7a, 0x00, 0x00, 0x84, 0x00, 0x20, 0x00, 0x00, 0x73, 0xae,
+    0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x00, 0x00,
+    0xef, 0x7d, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x81, 0x42, 0x28, 0x52, 0x89, 0x02, 0xff,
+    0xff, 0x85, 0xbd, 0xf7, 0x00, 0x00, 0x10, 0xa2, 0x29, 0x65, 0x94, 0x92, 0xff, 0xdf, 0x02, 0xff,
+    0xff, 0x02, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x86, 0xf7, 0xbe, 0xd6, 0x9a, 0xa5, 0x14, 0x73, 0x8e,
+    0x29, 0x45, 0x10, 0xa2, 0x00, 0x21, 0x09, 0x00, 0x00, 0x06, 0x08, 0x41, 0x09, 0x00, 0x00, 0x85,
+    0x08, 0x62, 0x19, 0x04, 0x52, 0xaa, 0x8c, 0x71, 0xbd, 0xf7, 0xef, 0x5d, 0x02, 0xff, 0xff, 0x81,
+    0x7b, 0xef, 0x84, 0x10, 0x01, 0xff, 0xdf, 0x82, 0xff, 0xff, 0xd6, 0xba, 0xc6, 0x18, 0x05, 0xff,
+    0xff, 0x8c, 0x73, 0x8e, 0x63, 0x2c, 0xff, 0xff, 0xa5, 0x14, 0x00, 0x00, 0x6b, 0x6d, 0xff, 0xff,
+    0xce, 0x79, 0x21, 0x24, 0x29, 0x45, 0x21, 0x04, 0x6b, 0x6d, 0xf7, 0xbe, 0x02, 0xff, 0xff, 0x84,
+    0xff, 0xdf, 0xff, 0xff, 0xce, 0x79, 0x10, 0x82, 0x08, 0x61, 0x7b, 0x00, 0x00, 0x84, 0x00, 0x20,
+    0x18, 0xe3, 0xe7, 0x1c, 0xff, 0xff, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x80, 0xbd, 0xd7, 0x01, 0x39,
+    0xc7, 0x80, 0xbd, 0xd7, 0x02, 0xff, 0xff, 0x8e, 0xbd, 0xf7, 0x00, 0x00, 0xce, 0x79, 0xff, 0xff,
+    0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x31, 0x86, 0xf7, 0x9e, 0x94, 0x92, 0x73, 0xae, 0xad, 0x55,
+    0x52, 0xaa, 0xa5, 0x34, 0xef, 0x7d, 0x04, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x86,
+    0xde, 0xfb, 0xc6, 0x18, 0x8c, 0x71, 0x6b, 0x6d, 0x52, 0xaa, 0x39, 0xe7, 0x10, 0xa2, 0x10, 0x00,
+    0x00, 0x86, 0x29, 0x65, 0x4a, 0x49, 0x63, 0x2c, 0x7b, 0xcf, 0xad, 0x75, 0xce, 0x79, 0xf7, 0xbe,
+    0x04, 0xff, 0xff, 0x83, 0xff, 0xdf, 0xff, 0xff, 0x31, 0xa6, 0xbd, 0xd7, 0x02, 0xff, 0xff, 0x82,
+    0x94, 0xb2, 0x18, 0xc3, 0xef, 0x7d, 0x02, 0xff, 0xff, 0x8c, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x71,
+    0x42, 0x08, 0x9c, 0xf3, 0x39, 0xe7, 0x4a, 0x49, 0x18, 0xc3, 0x42, 0x28, 0xef, 0x7d, 0xff, 0xff,
+    0xd6, 0x9a, 0xe7, 0x3c, 0x05, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0x73, 0xae, 0x00, 0x00,
+    0x08, 0x61, 0x79, 0x00, 0x00, 0x84, 0x08, 0x61, 0x00, 0x00, 0x94, 0x92, 0xff, 0xff, 0xff, 0xdf,
+    0x07, 0xff, 0xff, 0x8d, 0xf7, 0xbe, 0x7b, 0xef, 0x18, 0xe3, 0x52, 0x89, 0xf7, 0x9e, 0xff, 0xff,
+    0x39, 0xc7, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x7d, 0x10, 0xa2, 0xa5, 0x14,
+    0x02, 0xff, 0xff, 0x88, 0x4a, 0x28, 0x21, 0x24, 0x31, 0xa6, 0x21, 0x24, 0x52, 0x8a, 0xad, 0x55,
+    0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x06, 0xff, 0xff, 0x87,
+    0xff, 0xbe, 0xe7, 0x3c, 0xde, 0xdb, 0xc6, 0x18, 0xbd, 0xf7, 0xb5, 0x95, 0x94, 0xb2, 0x9c, 0xf3,
+    0x05, 0x9c, 0xd3, 0x80, 0xa5, 0x14, 0x01, 0xbd, 0xd7, 0x82, 0xd6, 0x9a, 0xde, 0xfb, 0xf7, 0x9e,
+    0x0b, 0xff, 0xff, 0x96, 0xff, 0xdf, 0x73, 0xae, 0x31, 0x86, 0x29, 0x65, 0x4a, 0x69, 0xde, 0xdb,
+    0xf7, 0xbe, 0x10, 0x82, 0x9c, 0xf3, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
+    0xb5, 0x96, 0x08, 0x41, 0x31, 0xa6, 0xa5, 0x13, 0xff, 0xff, 0xde, 0xdb, 0x18, 0xe3, 0x39, 0xe7,
+    0xff, 0xdf, 0x09, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0x18, 0xe3, 0x08, 0x61, 0x78, 0x00, 0x00, 0x83,
+    0x00, 0x20, 0x00, 0x00, 0x31, 0x86, 0xf7, 0x9e, 0x0b, 0xff, 0xff, 0x8b, 0xd6, 0xba, 0x6b, 0x4d,
+    0xef, 0x7d, 0xb5, 0x96, 0x08, 0x41, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x8c, 0x51,
+    0x21, 0x04, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x87, 0xde, 0xfb, 0x08, 0x61, 0xce, 0x59, 0xff, 0xff,
+    0xbd, 0xd7, 0x73, 0x8e, 0x21, 0x24, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 0xff, 0xdf, 0xef, 0x5d,
+    0x04, 0xff, 0xff, 0x02, 0xff, 0xdf, 0x16, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x88,
+    0x7b, 0xef, 0x10, 0xa2, 0x94, 0x92, 0xbd, 0xd7, 0x31, 0x86, 0x4a, 0x49, 0xff, 0xff, 0x73, 0x8e,
+    0x21, 0x24, 0x02, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79, 0x18, 0xc3, 0xe7, 0x3c,
+    0x02, 0xff, 0xff, 0x83, 0xc6, 0x18, 0x52, 0xaa, 0xff, 0xff, 0xf7, 0xbe, 0x07, 0xff, 0xff, 0x84,
+    0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x08, 0x41, 0x77, 0x00, 0x00, 0x84, 0x10, 0x82,
+    0x08, 0x41, 0xb5, 0x75, 0xff, 0xff, 0xff, 0xdf, 0x0d, 0xff, 0xff, 0x8d, 0x73, 0xae, 0x73, 0x8d,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x21, 0x04, 0x73, 0x8e, 0xff, 0xff, 0xff, 0xbe,
+    0xff, 0xff, 0x8c, 0x51, 0x18, 0xe3, 0xe7, 0x3c, 0x02, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xf7, 0xbe,
+    0xf7, 0x9e, 0x73, 0x8e, 0x10, 0xa2, 0x21, 0x04, 0x29, 0x44, 0x9c, 0xf3, 0x18, 0xff, 0xff, 0x80,
+    0xff, 0xdf, 0x04, 0xff, 0xff, 0x81, 0xde, 0xfb, 0xe7, 0x3c, 0x04, 0xff, 0xff, 0x82, 0xff, 0xdf,
+    0x21, 0x04, 0xb5, 0xb6, 0x02, 0xff, 0xff, 0x86, 0xef, 0x9d, 0xff, 0xff, 0xde, 0xdb, 0x08, 0x61,
+    0xbd, 0xd7, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x89, 0xe7, 0x1c, 0x21, 0x24, 0xce, 0x59,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xe7, 0x1c, 0x21, 0x24, 0x39, 0xe7, 0xe7, 0x3c, 0x09, 0xff,
+    0xff, 0x81, 0xf7, 0x9e, 0x29, 0x65, 0x77, 0x00, 0x00, 0x82, 0x08, 0x41, 0x00, 0x00, 0x39, 0xe7,
+    0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf,
+    0xff, 0xff, 0xa5, 0x34, 0x08, 0x41, 0xef, 0x5d, 0x02, 0xff, 0xff, 0x85, 0x42, 0x08, 0x00, 0x00,
+    0x31, 0xa6, 0x52, 0xaa, 0xad, 0x75, 0xef, 0x5d, 0x01, 0xff, 0xff, 0x8f, 0x52, 0xaa, 0x10, 0xa2,
+    0xad, 0x75, 0xce, 0x79, 0x94, 0x92, 0x00, 0x00, 0x94, 0xb2, 0xff, 0xff, 0x84, 0x10, 0x73, 0x8e,
+    0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xf7, 0xbe, 0xf7, 0x9e, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x87,
+    0xde, 0xfb, 0xa5, 0x34, 0xef, 0x7d, 0xff, 0xff, 0xef, 0x7d, 0x21, 0x24, 0x39, 0xc7, 0xff, 0xdf,
+    0x04, 0xff, 0xff, 0x01, 0x42, 0x08, 0x87, 0xad, 0x75, 0x84, 0x30, 0x84, 0x10, 0xa5, 0x14, 0xef,
+    0x5d, 0xff, 0xff, 0x42, 0x28, 0x52, 0x8a, 0x02, 0xff, 0xff, 0x83, 0xd6, 0x9a, 0xd6, 0xba, 0x39,
+    0xe7, 0xbd, 0xf7, 0x03, 0xff, 0xff, 0x81, 0xbd, 0xf7, 0xbd, 0xd7, 0x09, 0xff, 0xff, 0x84, 0xff,
+    0xdf, 0xff, 0xff, 0xbd, 0xf7, 0x00, 0x20, 0x08, 0x61, 0x75, 0x00, 0x00, 0x86, 0x10, 0x82, 0x42,
+    0x28, 0x00, 0x00, 0x5a, 0xcb, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xdf, 0x11, 0xff, 0xff, 0x8f, 0x42,
+    0x28, 0x5a, 0xcb, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xdb, 0x08, 0x61, 0xb5, 0xb6, 0xc6,
+    0x38, 0x63, 0x2c, 0x31, 0x86, 0x31, 0xa6, 0xff, 0xdf, 0xc6, 0x18, 0x00, 0x20, 0xce, 0x59, 0x02,
+    0xff, 0xff, 0x8d, 0x73, 0xae, 0x18, 0xc3, 0xff, 0xff, 0x42, 0x28, 0x39, 0xe7, 0xff, 0xff, 0xf7,
+    0xbe, 0xff, 0xff, 0xc6, 0x18, 0x29, 0x65, 0xef, 0x7d, 0x9c, 0xf3, 0x5a, 0xcb, 0xff, 0xdf, 0x01,
+    0xff, 0xff, 0x87, 0xe7, 0x3c, 0x7b, 0xcf, 0xff, 0xff, 0xd6, 0xba, 0x7b, 0xef, 0xff, 0xdf, 0x9c,
+    0xf3, 0x73, 0xae, 0x01, 0xff, 0xff, 0x82, 0xe7, 0x3c, 0x10, 0xa2, 0x73, 0x8e, 0x01, 0xff, 0xff,
+    0x85, 0xc6, 0x18, 0x21, 0x04, 0x29, 0x65, 0x84, 0x10, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff, 0xff,
+    0x90, 0xd6, 0x9a, 0x42, 0x08, 0x31, 0xa6, 0x39, 0xe7, 0x42, 0x08, 0x29, 0x24, 0x29, 0x65, 0xef,
+    0x7d, 0xc6, 0x18, 0x10, 0x82, 0xd6, 0xba, 0xb5, 0xb6, 0x42, 0x28, 0x18, 0xc3, 0xb5, 0xb6, 0xef,
+    0x5d, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x7b, 0xef, 0x00,
+    0x00, 0x29, 0x45, 0x00, 0x20, 0x75, 0x00, 0x00, 0x84, 0x31, 0x86, 0x73, 0x8e, 0x00, 0x00, 0x18,
+    0xc3, 0xbd, 0xd6, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x86, 0xce, 0x59, 0xe7,
+    0x1c, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x92, 0x21, 0x24, 0x02, 0xff, 0xff, 0x85, 0xf7,
+    0x9e, 0xd6, 0x9a, 0xff, 0xff, 0x63, 0x0c, 0x29, 0x65, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x85, 0xff,
+    0xff, 0xef, 0x5d, 0xc6, 0x18, 0xff, 0xff, 0x42, 0x08, 0x94, 0xb2, 0x02, 0xff, 0xff, 0x85, 0x9c,
+    0xf3, 0x18, 0xc3, 0xff, 0xff, 0x7b, 0xcf, 0x00, 0x00, 0x9c, 0xd3, 0x01, 0xff, 0xff, 0x93, 0xd6,
+    0x9a, 0x18, 0xa2, 0xff, 0xff, 0xbd, 0xf7, 0x18, 0xc3, 0xff, 0xdf, 0x8c, 0x71, 0x18, 0xc3, 0xff,
+    0xff, 0xff, 0xdf, 0x31, 0x86, 0x52, 0x8a, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x42,
+    0x08, 0xbd, 0xd7, 0x08, 0x20, 0xd6, 0x9a, 0x05, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff,
+    0x88, 0xf7, 0x9e, 0x29, 0x65, 0xad, 0x75, 0xff, 0xff, 0x29, 0x45, 0x10, 0xa2, 0x29, 0x45, 0x7b,
+    0xef, 0xde, 0xdb, 0x06, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x0a, 0xff, 0xff, 0x84, 0xd6, 0xba, 0x39,
+    0xe7, 0x00, 0x00, 0x6b, 0x4d, 0x84, 0x10, 0x77, 0x00, 0x00, 0x87, 0x00, 0x20, 0x73, 0xae, 0x39,
+    0xe7, 0x00, 0x00, 0x73, 0x8e, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x83, 0x39,
+    0xc7, 0x21, 0x24, 0xa5, 0x34, 0xef, 0x9e, 0x03, 0xff, 0xff, 0x83, 0x4a, 0x49, 0x73, 0x8e, 0xff,
+    0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0xa1, 0xf7, 0xbe, 0x31, 0x86, 0x73, 0x8e, 0xd6, 0x9a, 0xe7,
+    0x1c, 0xff, 0xff, 0x7b, 0xcf, 0x21, 0x24, 0xff, 0xff, 0x5a, 0xcb, 0x21, 0x24, 0x18, 0xc3, 0xde,
+    0xdb, 0xff, 0xff, 0xbd, 0xf7, 0x21, 0x24, 0xff, 0xff, 0xc6, 0x18, 0x21, 0x24, 0xff, 0xdf, 0xad,
+    0x75, 0x08, 0x41, 0xff, 0xff, 0x63, 0x0c, 0x31, 0x86, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xdf, 0xff,
+    0xff, 0x6b, 0x6d, 0x63, 0x2c, 0xff, 0xff, 0x63, 0x2c, 0x39, 0xc6, 0x01, 0xff, 0xdf, 0x01, 0xff,
+    0xff, 0x82, 0xf7, 0x9e, 0x84, 0x30, 0xe7, 0x1c, 0x01, 0xff, 0xff, 0x86, 0xde, 0xdb, 0x18, 0xe3,
+    0xc6, 0x18, 0xff, 0xff, 0xad, 0x75, 0x8c, 0x71, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x80, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x84, 0x9c, 0xd3, 0x00, 0x00, 0x18, 0xe3, 0xa5, 0x14, 0x4a, 0x69, 0x7a, 0x00,
+    0x00, 0x84, 0x39, 0xc7, 0x7b, 0xcf, 0x00, 0x00, 0x29, 0x45, 0xce, 0x59, 0x14, 0xff, 0xff, 0x8b,
+    0xc6, 0x38, 0x73, 0xae, 0x18, 0xe3, 0x29, 0x65, 0x5a, 0xcb, 0xb5, 0x96, 0xef, 0x7d, 0xff, 0xff,
+    0x4a, 0x69, 0x5a, 0xcb, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff,
+    0xe7, 0x3c, 0x21, 0x03, 0x21, 0x04, 0x01, 0x31, 0x86, 0x95, 0x39, 0xa6, 0x10, 0xa2, 0x6b, 0x4d,
+    0xff, 0xff, 0x42, 0x08, 0x84, 0x0f, 0x52, 0xaa, 0x4a, 0x69, 0xff, 0xff, 0xad, 0x75, 0x21, 0x04,
+    0xff, 0xff, 0xc6, 0x18, 0x29, 0x44, 0xf7, 0xbe, 0xc6, 0x38, 0x21, 0x24, 0x73, 0x8e, 0x00, 0x00,
+    0xa4, 0xf3, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x91, 0x52, 0x8a, 0x6b, 0x4d, 0xad, 0x75,
+    0x63, 0x0c, 0x00, 0x00, 0x94, 0x92, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0x42, 0x28,
+    0x10, 0xa2, 0x84, 0x10, 0x63, 0x2c, 0x18, 0xc3, 0x63, 0x0c, 0xff, 0xff, 0xff, 0xdf, 0x02, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x0e, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xde, 0xfb, 0x42, 0x08,
+    0x00, 0x00, 0x6b, 0x6d, 0x94, 0x92, 0x10, 0x82, 0x7c, 0x00, 0x00, 0x84, 0x10, 0x82, 0x6b, 0x6d,
+    0x31, 0xa6, 0x08, 0x41, 0x84, 0x30, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x81,
+    0xf7, 0xbe, 0xd6, 0x9a, 0x03, 0xff, 0xff, 0x88, 0xff, 0xdf, 0xb5, 0xb6, 0x63, 0x2c, 0x31, 0xa6,
+    0xc6, 0x38, 0xff, 0xff, 0x9c, 0xd3, 0x00, 0x20, 0xd6, 0x9a, 0x01, 0xff, 0xff, 0x8f, 0xbd, 0xf7,
+    0x39, 0xe7, 0xef, 0x3c, 0xd6, 0x9a, 0x00, 0x20, 0xe7, 0x3c, 0xef, 0x5d, 0xce, 0x79, 0xb5, 0x96,
+    0x29, 0x44, 0x84, 0x10, 0xff, 0xff, 0x42, 0x08, 0x8c, 0x51, 0xe7, 0x3c, 0x00, 0x00, 0x01, 0xc6,
+    0x18, 0x83, 0x18, 0xe3, 0xff, 0xdf, 0xde, 0xfb, 0x21, 0x24, 0x01, 0xe7, 0x1c, 0x84, 0x08, 0x61,
+    0x10, 0xa2, 0x6b, 0x4d, 0x00, 0x20, 0xbd, 0xf7, 0x01, 0xff, 0xff, 0x8f, 0xff, 0xdf, 0x29, 0x65,
+    0x18, 0xe3, 0x4a, 0x69, 0x7b, 0xcf, 0x6b, 0x4d, 0x08, 0x41, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xdf,
+    0xff, 0xff, 0xf7, 0xbe, 0x84, 0x30, 0x4a, 0x49, 0x5a, 0xeb, 0xb5, 0xb6, 0x03, 0xff, 0xff, 0x81,
+    0xef, 0x7d, 0xe7, 0x1c, 0x0d, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x84, 0x94, 0x92,
+    0x08, 0x61, 0x18, 0xc3, 0x9c, 0xf3, 0x4a, 0x69, 0x7f, 0x00, 0x00, 0x85, 0x00, 0x00, 0x4a, 0x69,
+    0x63, 0x2c, 0x00, 0x00, 0x39, 0xe7, 0xc6, 0x38, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x08, 0xff,
+    0xff, 0x86, 0xff, 0xdf, 0xff, 0xff, 0x94, 0xb2, 0x00, 0x00, 0x39, 0xe7, 0xa5, 0x14, 0xe7, 0x1c,
+    0x03, 0xff, 0xff, 0x81, 0xf7, 0xbe, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0x5a, 0xeb, 0x08, 0x61,
+    0x01, 0x6b, 0x4d, 0x85, 0x00, 0x00, 0x42, 0x07, 0xf7, 0xbe, 0xb5, 0x96, 0x18, 0xc3, 0xff, 0xdf,
+    0x02, 0xff, 0xff, 0x98, 0x39, 0xa6, 0x9c, 0xf3, 0xff, 0xff, 0x42, 0x08, 0x94, 0x92, 0xff, 0xff,
+    0x7b, 0xef, 0x29, 0x45, 0xa5, 0x14, 0x42, 0x08, 0xff, 0xff, 0xdf, 0x1c, 0x18, 0xc3, 0xd6, 0x9a,
+    0xf7, 0xbe, 0x18, 0xe3, 0x9c, 0xf3, 0xff, 0xff, 0x73, 0xae, 0x00, 0x20, 0xce, 0x59, 0xff, 0xff,
+    0xe7, 0x1c, 0x10, 0xa2, 0xce, 0x79, 0x02, 0xff, 0xff, 0x82, 0x39, 0xc7, 0x31, 0xa6, 0xf7, 0x9e,
+    0x08, 0xff, 0xff, 0x84, 0xd6, 0x9a, 0x7b, 0xef, 0x08, 0x41, 0x39, 0xa6, 0xf7, 0xbe, 0x0a, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x85, 0xce, 0x59, 0x4a, 0x49, 0x00, 0x00, 0x5a, 0xeb,
+    0x94, 0xb2, 0x18, 0xc3, 0x7f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x85, 0x10, 0xa2, 0x7b, 0xef, 0x29,
+    0x65, 0x00, 0x00, 0x6b, 0x6d, 0xef, 0x7d, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x07, 0xff, 0xff,
+    0x88, 0xef, 0x5d, 0x08, 0x61, 0x31, 0xa6, 0x4a, 0x69, 0x00, 0x00, 0x08, 0x61, 0x4a, 0x69, 0xad,
+    0x75, 0xf7, 0x9e, 0x02, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x9d, 0xff, 0xff, 0xad, 0x75, 0x63, 0x0c,
+    0x52, 0xaa, 0x9c, 0xd3, 0xff, 0xdf, 0xff, 0xff, 0x84, 0x10, 0x39, 0xa6, 0xff, 0xff, 0xff, 0xdf,
+    0xff, 0xff, 0xef, 0x5d, 0x08, 0x61, 0xc6, 0x18, 0xff, 0xff, 0x31, 0xa6, 0x94, 0xb2, 0xff, 0xff,
+    0xf7, 0x9e, 0x29, 0x65, 0x21, 0x04, 0x52, 0x8a, 0xff, 0xff, 0xde, 0xfb, 0x18, 0xe3, 0xce, 0x79,
+    0xff, 0xff, 0x31, 0x85, 0xb5, 0x96, 0x01, 0xff, 0xff, 0x8d, 0x52, 0xaa, 0x10, 0x82, 0xde, 0xfb,
+    0xb5, 0xb6, 0x18, 0xc3, 0xef, 0x7d, 0xff, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xde, 0xdb, 0x7b, 0xef,
+    0xef, 0x7d, 0xff, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x89, 0xef, 0x5d, 0x9c, 0xd3, 0x39, 0xe7,
+    0x00, 0x00, 0x08, 0x61, 0x5a, 0xeb, 0x00, 0x00, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0x06, 0xff,
+    0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x85, 0xef, 0x5d, 0x63, 0x0c, 0x00, 0x00, 0x21, 0x24,
+    0xa5, 0x14, 0x5a, 0xeb, 0x7f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x85, 0x42, 0x28, 0x73, 0xae, 0x08,
+    0x41, 0x10, 0xa2, 0x94, 0x92, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x03, 0xff, 0xff,
+    0x88, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x4d, 0x08, 0x41, 0xad, 0x55, 0x52, 0xaa, 0x8c, 0x51, 0x7b,
+    0xcf, 0x21, 0x24, 0x01, 0x00, 0x00, 0x82, 0x5a, 0xcb, 0x9c, 0xf3, 0xde, 0xdb, 0x06, 0xff, 0xff,
+    0x8c, 0xff, 0xdf, 0xff, 0xff, 0xad, 0x75, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xce,
+    0x79, 0x00, 0x00, 0xde, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x94, 0xb2, 0x01, 0xff, 0xff, 0x92, 0xc6,
+    0x38, 0x00, 0x00, 0x42, 0x08, 0xff, 0xff, 0xde, 0xfb, 0x10, 0x61, 0xce, 0x59, 0xff, 0xff, 0x21,
+    0x04, 0x84, 0x30, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xbe, 0x42, 0x08, 0x5a, 0xcb, 0xa5, 0x34, 0x73,
+    0x8e, 0xff, 0xdf, 0xff, 0xff, 0x01, 0xff, 0xdf, 0x05, 0xff, 0xff, 0x8b, 0xd6, 0xba, 0x9c, 0xd3,
+    0x4a, 0x49, 0x00, 0x00, 0x00, 0x20, 0x31, 0xa6, 0x94, 0xb2, 0x9c, 0xd3, 0x63, 0x2c, 0x5a, 0xaa,
+    0x08, 0x61, 0xde, 0xfb, 0x05, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x86, 0xe7, 0x1c,
+    0x7b, 0xcf, 0x00, 0x20, 0x08, 0x41, 0x7b, 0xef, 0x94, 0xb2, 0x10, 0x82, 0x7f, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x86, 0x10, 0x82, 0x73, 0x8e, 0x5a, 0xeb, 0x00, 0x00, 0x21, 0x24, 0xa5, 0x14, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xce, 0x79, 0x00,
+    0x00, 0x84, 0x10, 0x39, 0xc7, 0x01, 0x00, 0x00, 0x8a, 0x18, 0xe3, 0x5a, 0xcb, 0x94, 0x91, 0x7b,
+    0xcf, 0x31, 0x86, 0x00, 0x00, 0x10, 0x82, 0x31, 0x86, 0x6b, 0x6d, 0xbd, 0xd7, 0xe7, 0x3c, 0x09,
+    0xff, 0xff, 0x93, 0xe7, 0x3c, 0xb5, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0x6b, 0x6d, 0xc6, 0x38, 0xff,
+    0xff, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xce, 0x73, 0x8e, 0xff, 0xff, 0xf7, 0x9e, 0x7b, 0xcf, 0xde,
+    0xfb, 0xff, 0xff, 0x94, 0x92, 0xbd, 0xd7, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x81, 0xe7,
+    0x1c, 0xf7, 0x9e, 0x06, 0xff, 0xff, 0x8a, 0xef, 0x5d, 0xbd, 0xf7, 0x6b, 0x4d, 0x29, 0x45, 0x08,
+    0x41, 0x00, 0x00, 0x42, 0x08, 0x8c, 0x51, 0xa5, 0x34, 0x63, 0x2c, 0x21, 0x04, 0x01, 0x00, 0x00,
+    0x84, 0x52, 0x8a, 0x08, 0x41, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x80, 0xff,
+    0xdf, 0x01, 0xff, 0xff, 0x86, 0xef, 0x5d, 0x73, 0xae, 0x08, 0x41, 0x00, 0x00, 0x7b, 0xcf, 0x9c,
+    0xf3, 0x31, 0xa6, 0x7f, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x86, 0x29, 0x65, 0x84, 0x30, 0x4a, 0x69,
+    0x00, 0x00, 0x29, 0x45, 0x9c, 0xf3, 0xf7, 0x9e, 0x01, 0xff, 0xff, 0x84, 0xff, 0xdf, 0xff, 0xff,
+    0x39, 0xe7, 0x18, 0xe3, 0x94, 0x92, 0x05, 0x00, 0x00, 0x85, 0x10, 0xa2, 0x5a, 0xcb, 0x8c, 0x71,
+    0x84, 0x30, 0x4a, 0x49, 0x20, 0xe3, 0x01, 0x00, 0x00, 0x84, 0x39, 0xc7, 0x6b, 0x6d, 0x94, 0xb2,
+    0xc6, 0x38, 0xef, 0x7d, 0x1e, 0xff, 0xff, 0x84, 0xf7, 0x9e, 0xce, 0x79, 0xa5, 0x14, 0x73, 0x8e,
+    0x39, 0xe7, 0x01, 0x00, 0x00, 0x85, 0x21, 0x04, 0x4a, 0x49, 0x9c, 0xd2, 0xa4, 0xf3, 0x63, 0x2c,
+    0x29, 0x65, 0x05, 0x00, 0x00, 0x84, 0x6b, 0x6d, 0x00, 0x00, 0xc6, 0x38, 0xff, 0xff, 0xff, 0xdf,
+    0x01, 0xff, 0xff, 0x81, 0xd6, 0xba, 0x73, 0x8e, 0x01, 0x08, 0x41, 0x82, 0x6b, 0x4d, 0x9c, 0xd3,
+    0x39, 0xe7, 0x7f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x8b, 0x39, 0xc7, 0x8c, 0x71, 0x4a, 0x69, 0x00,
+    0x00, 0x18, 0xa2, 0x8c, 0x71, 0xef, 0x7d, 0xff, 0xff, 0xa5, 0x14, 0x00, 0x00, 0xad, 0x54, 0x18,
+    0xc3, 0x08, 0x00, 0x00, 0x8d, 0x10, 0x82, 0x31, 0x86, 0x7b, 0xae, 0x8c, 0x71, 0x84, 0x30, 0x63,
+    0x0c, 0x18, 0xc3, 0x00, 0x00, 0x08, 0x61, 0x10, 0xa2, 0x21, 0x04, 0x42, 0x07, 0x7b, 0xcf, 0xce,
+    0x79, 0x01, 0xff, 0xff, 0x80, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x8d, 0xbd, 0xf7, 0x94, 0xb2, 0x63,
+    0x0c, 0x29, 0x65, 0x10, 0xa2, 0x08, 0x61, 0x00, 0x00, 0x10, 0x82, 0x5a, 0xcb, 0x94, 0x92, 0xa5,
+    0x14, 0x8c, 0x51, 0x52, 0x8a, 0x18, 0xe3, 0x08, 0x00, 0x00, 0x01, 0x29, 0x45, 0x80, 0x39, 0xc7,
+    0x01, 0xff, 0xff, 0x86, 0xce, 0x79, 0x5a, 0xeb, 0x00, 0x20, 0x00, 0x00, 0x7b, 0xcf, 0x9c, 0xf3,
+    0x39, 0xe7, 0x7f, 0x00, 0x00, 0x14, 0x00, 0x00, 0x88, 0x31, 0x86, 0x84, 0x10, 0x52, 0xaa, 0x00,
+    0x00, 0x18, 0xc3, 0x8c, 0x51, 0x21, 0x04, 0x42, 0x08, 0x73, 0x8e, 0x0d, 0x00, 0x00, 0x8b, 0x08,
+    0x61, 0x42, 0x08, 0x63, 0x2c, 0x94, 0xb2, 0x9c, 0xd3, 0x7b, 0xef, 0x5a, 0xeb, 0x42, 0x28, 0x00,
+    0x00, 0x8c, 0x71, 0xff, 0xff, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x8a, 0xff, 0xdf, 0x08, 0x41, 0x08,
+    0x61, 0x31, 0xa6, 0x4a, 0x69, 0x73, 0x8e, 0x9c, 0xd3, 0xa5, 0x14, 0x8c, 0x51, 0x52, 0x8a, 0x29,
+    0x45, 0x0d, 0x00, 0x00, 0x88, 0x63, 0x2c, 0x00, 0x00, 0x84, 0x10, 0x5a, 0xcb, 0x00, 0x00, 0x18,
+    0xc3, 0x84, 0x10, 0xa5, 0x14, 0x39, 0xe7, 0x7f, 0x00, 0x00, 0x18, 0x00, 0x00, 0x82, 0x29, 0x65,
+    0x8c, 0x51, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x80, 0xb5, 0x96, 0x12, 0x00, 0x00, 0x85, 0x08, 0x41,
+    0x10, 0xa2, 0x21, 0x24, 0x5a, 0xcb, 0x00, 0x00, 0x8c, 0x71, 0x15, 0xff, 0xff, 0x86, 0xff, 0xdf,
+    0x00, 0x00, 0x73, 0x8e, 0x7b, 0xcf, 0x52, 0xaa, 0x29, 0x45, 0x10, 0x82, 0x11, 0x00, 0x00, 0x86,
+    0x18, 0xc3, 0x4a, 0x49, 0x00, 0x00, 0x21, 0x24, 0x94, 0x92, 0x8c, 0x71, 0x31, 0x86, 0x7f, 0x00,
+    0x00, 0x1c, 0x00, 0x00, 0x83, 0x29, 0x65, 0x63, 0x2c, 0xa5, 0x34, 0x42, 0x08, 0x17, 0x00, 0x00,
+    0x80, 0x8c, 0x71, 0x15, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x00, 0x00, 0x4a, 0x69, 0x16, 0x00, 0x00,
+    0x83, 0x63, 0x0c, 0x9c, 0xd3, 0x84, 0x10, 0x21, 0x04, 0x7f, 0x00, 0x00, 0x20, 0x00, 0x00, 0x80,
+    0x21, 0x04, 0x18, 0x00, 0x00, 0x80, 0x8c, 0x71, 0x15, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x00, 0x20,
+    0x52, 0x69, 0x16, 0x00, 0x00, 0x81, 0x00, 0x20, 0x18, 0xc3, 0x7f, 0x00, 0x00, 0x3c, 0x00, 0x00,
+    0x80, 0x8c, 0x71, 0x15, 0xff, 0xff, 0x82, 0xff, 0xdf, 0x00, 0x20, 0x52, 0x8a, 0x7f, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x80, 0x8c, 0x71, 0x01, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x82, 0xf7, 0xbe, 0x00,
+    0x00, 0x52, 0x8a, 0x7f, 0x00, 0x00, 0x55, 0x00, 0x00, 0x80, 0x94, 0xb2, 0x04, 0xff, 0xff, 0x03,
+    0xff, 0xdf, 0x06, 0xff, 0xff, 0x03, 0xff, 0xdf, 0x01, 0xff, 0xff, 0x82, 0xff, 0xdf, 0x00, 0x20,
+    0x52, 0x69, 0x7f, 0x00, 0x00, 0x55, 0x00, 0x00, 0x83, 0x6b, 0x4d, 0xd6, 0x9a, 0xde, 0xfb, 0xf7,
+    0x9e, 0x12, 0xff, 0xff, 0x82, 0xef, 0x5d, 0x00, 0x00, 0x52, 0x8a, 0x7f, 0x00, 0x00, 0x54, 0x00,
+    0x00, 0x01, 0x08, 0x61, 0x88, 0x10, 0x82, 0x18, 0xc2, 0x10, 0x82, 0x18, 0xc3, 0x21, 0x24, 0x29,
+    0x65, 0x5a, 0xcb, 0x73, 0x8e, 0x73, 0xae, 0x05, 0x9c, 0xd3, 0x89, 0x8c, 0x71, 0x73, 0x8e, 0x6b,
+    0x4d, 0x39, 0xc7, 0x29, 0x65, 0x18, 0xe3, 0x18, 0xc3, 0x10, 0x82, 0x00, 0x00, 0x52, 0x8a, 0x7f,
+    0x00, 0x00, 0x54, 0x00, 0x00, 0x8a, 0x6b, 0x6d, 0xa5, 0x14, 0x94, 0x92, 0x9c, 0xd2, 0x73, 0xae,
+    0x6b, 0x6d, 0x52, 0x8a, 0x42, 0x28, 0x31, 0x86, 0x31, 0xa6, 0x18, 0xe3, 0x05, 0x18, 0xc3, 0x85,
+    0x18, 0xa2, 0x29, 0x45, 0x31, 0xa6, 0x39, 0xc7, 0x4a, 0x69, 0x5a, 0xcb, 0x01, 0x73, 0x8e, 0x81,
+    0xa5, 0x34, 0x7b, 0xef, 0x7f, 0x00, 0x00, 0x57, 0x00, 0x00, 0x89, 0x00, 0x20, 0x08, 0x41, 0x08,
+    0x61, 0x18, 0xc3, 0x4a, 0x49, 0x52, 0x8a, 0x8c, 0x51, 0x84, 0x30, 0xa5, 0x14, 0xce, 0x59, 0x02,
+    0xc6, 0x18, 0x81, 0xce, 0x59, 0x9c, 0xf3, 0x01, 0x84, 0x30, 0x85, 0x52, 0x8a, 0x4a, 0x49, 0x10,
+    0xa2, 0x08, 0x61, 0x08, 0x41, 0x00, 0x20, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x6b, 0x00, 0x00,
 };
+
+constexpr size_t ST7789::logo_rle_size = sizeof(ST7789::logo_rle);
+
+static_assert(RLE565::decodedLength(ST7789::logo_rle, ST7789::logo_rle_size) == ST7789::WIDTH * ST7789::HEIGHT,
+              "logo does not cover the panel");
@@ -4,19 +4,39 @@
 #include <fcntl.h> // for open()
 #include <sys/ioctl.h> // for ioctl()
 #include <unistd.h> // for close()
-#include <cmath> // for rounding functions
+#include <thread> // for sleep_for
+#include <algorithm> // for std::max
 #include <linux/i2c-dev.h> // for I2C constants
 
 
-MCP9808::MCP9808(const std::string &i2cBusDevice, int address) : i2cBus_(i2cBusDevice, address) {
+MCP9808::MCP9808(const std::string &i2cBusDevice, int address, bool identified)
+    : i2cBus_(i2cBusDevice, address)
+    , resolution_(Resolution::C0_0625) {
+    // everything but the temperature only changes when written; in CONFIG
+    // the alert status (bit 4) and interrupt clear (bit 5, reads 0) are not
+    i2cBus_.cacheRegister(CONFIG_REG, 0x0030, 0x0000);
+    i2cBus_.cacheRegister(TUPPER_REG);
+    i2cBus_.cacheRegister(TLOWER_REG);
+    i2cBus_.cacheRegister(TCRIT_REG);
+    i2cBus_.cacheRegister(MANUFACTURER_ID_REG);
+    i2cBus_.cacheRegister(DEVICE_ID_REG);
+    i2cBus_.cacheRegister(RESOLUTION_REG);
 
-    if (getManufacturerID() != EXPECTED_MANUFACTURER_ID) {
-        throw std::runtime_error("MCP9808: Invalid manufacturer ID");
+    if (!identified && !probe(i2cBus_)) {
+        throw std::runtime_error("MCP9808: Invalid manufacturer or device ID");
     }
+}
 
-    if (getDeviceID() != EXPECTED_DEVICE_ID) {
-        throw std::runtime_error("MCP9808: Invalid device ID");
-    }
+bool MCP9808::probe(I2CBus &i2cBus) {
+    // both ID registers in one transaction; the MCP9808 pointer does not
+    // auto-increment, so they are two segments
+    std::array<uint8_t, 2> manufacturer;
+    std::array<uint8_t, 2> device;
+    const I2CBus::Segment segments[] = {{MANUFACTURER_ID_REG, manufacturer}, {DEVICE_ID_REG, device}};
+    i2cBus.readRegions(segments);
+
+    return ((manufacturer[0] << 8) | manufacturer[1]) == EXPECTED_MANUFACTURER_ID &&
+           ((device[0] << 8) & 0xFF00) == EXPECTED_DEVICE_ID;
 }
 
 MCP9808::~MCP9808() {
@@ -32,30 +52,93 @@ uint16_t MCP9808::getDeviceID() {
 }
 
 
-float MCP9808::convertRawTemperature(uint16_t rawTemp) {
-    rawTemp &= 0x1FFF; // Mask to get only temperature bits
-    float temperature = rawTemp * 0.0625f;
-    if (rawTemp & 0x1000) { // Check if negative
-        temperature -= 256.0f;
-    }
-    return temperature;
+Temperature MCP9808::getTemperature() {
+    uint16_t rawTemp = i2cBus_.read16(TEMP_REG);
+    return Temperature::fromMCP9808(rawTemp);
 }
 
-float MCP9808::getTemperature() {
+MCP9808::Reading MCP9808::getReading() {
     uint16_t rawTemp = i2cBus_.read16(TEMP_REG);
-    return convertRawTemperature(rawTemp);
+    return {Temperature::fromMCP9808(rawTemp), (rawTemp & 0x8000) != 0, (rawTemp & 0x4000) != 0, (rawTemp & 0x2000) != 0};
 }
 
-void MCP9808::setUpperAlarmTemperature(float temperature) {
-    if (temperature < -40.0 || temperature > 125.0) {
+// Limit registers: the temperature format without the two lowest bits, 0.25 C per step
+uint16_t MCP9808::encodeLimit(Temperature temperature) {
+    if (temperature < Temperature::fromCelsius(-40) || temperature > Temperature::fromCelsius(125)) {
         throw std::out_of_range("Temperature out of range");
     }
-    uint16_t rawTemp = static_cast<uint16_t>(std::round(temperature / 0.0625));
-    i2cBus_.write16(TUPPER_REG, rawTemp);
+    // to the nearest quarter, two's complement keeps the sign in bit 12
+    return static_cast<uint16_t>((temperature.raw() + 2) & ~3) & 0x1FFC;
+}
+
+void MCP9808::setUpperAlarmTemperature(Temperature temperature) {
+    i2cBus_.write16(TUPPER_REG, encodeLimit(temperature));
+}
+
+void MCP9808::setAlertLimits(const Alert_Limits& limits) {
+    const uint16_t upper = encodeLimit(limits.upper);
+    const uint16_t lower = encodeLimit(limits.lower);
+    const uint16_t critical = encodeLimit(limits.critical);
+    // the limit registers are cached, unchanged ones are not written again
+    i2cBus_.update16(TUPPER_REG, 0xFFFF, upper);
+    i2cBus_.update16(TLOWER_REG, 0xFFFF, lower);
+    i2cBus_.update16(TCRIT_REG, 0xFFFF, critical);
+}
+
+void MCP9808::enableAlert(Hysteresis hysteresis) {
+    // hysteresis (bits 10..9), alert output control (bit 3) set, alert
+    // select (bit 2), polarity (bit 1) and mode (bit 0) cleared
+    const uint16_t bits = static_cast<uint16_t>(static_cast<uint16_t>(hysteresis) << 9) | 0x0008;
+    i2cBus_.update16(CONFIG_REG, 0x060F, bits);
+}
+
+void MCP9808::setResolution(Resolution resolution) {
+    i2cBus_.update8(RESOLUTION_REG, 0x03, static_cast<uint8_t>(resolution));
+    resolution_ = resolution;
+}
+
+void MCP9808::shutdown(bool enable) {
+    i2cBus_.update16(CONFIG_REG, 0x0100, enable ? 0x0100 : 0x0000);
+}
+
+Temperature MCP9808::getTemperatureOneShot() {
+    // the first conversion after wake-up takes the full conversion time;
+    // the bus is free meanwhile
+    shutdown(false);
+    std::this_thread::sleep_for(conversionWait(resolution_));
+    const Temperature temperature = getTemperature();
+    shutdown(true);
+    return temperature;
+}
+
+void MCP9808::restartConversion() {
+    // the free-running conversions have no known phase; the one started by
+    // the wake-up has
+    shutdown(true);
+    shutdown(false);
+}
+
+std::chrono::milliseconds MCP9808::samplePeriod(const Config& config) {
+    const auto conversion = conversionTime(config.resolution);
+    if (config.oneShot) {
+        // every sample runs its own conversion
+        return std::max(config.samplePeriod, conversionWait(config.resolution));
+    }
+    auto conversions = (config.samplePeriod + conversion / 2) / conversion;
+    if (conversions < 1) {
+        conversions = 1; // faster reads only return the same conversion again
+    }
+    return conversions * conversion;
+}
+
+size_t MCP9808::resyncInterval(const Config& config) {
+    // the phase moves by the tolerance of every period; it may move up to
+    // the margin before a conversion ends after the read it was meant for
+    const auto margin = std::chrono::duration_cast<std::chrono::microseconds>(conversionMargin(config.resolution));
+    const auto drift = std::chrono::duration_cast<std::chrono::microseconds>(samplePeriod(config)) * clockTolerancePercent / 100;
+    return std::max<size_t>(margin / drift, 1);
 }
 
 void MCP9808::enableComparatorMode() {
-    uint16_t config = i2cBus_.read16(CONFIG_REG);
-    config &= ~(1 << 9); // Clear interrupt mode bit (set comparator mode)
-    i2cBus_.write16(CONFIG_REG, config);
+    i2cBus_.update16(CONFIG_REG, 0x0001, 0x0000); // Clear the Alert Mode bit (set comparator mode)
 }
@@ -0,0 +1,55 @@
+#include "app.hpp"
+
+#include <iostream>
+#include <climits>
+
+// Temperature alarm driven by the ALERT output of the MCP9808 instead of
+// polling: TUPPER follows the threshold set with the rotary encoder, and each
+// edge of ALERT is answered with one temperature read, whose flags give the
+// new alarm state.
+void mcp9808_alert_thread(Application_state_t  & appState, const MCP9808::Config & mcp9808Config, Edge_Source & alert) {
+    static const Temperature lowestLimit = Temperature::fromCelsius(-40);  // bottom of the sensor range, no under-temperature alarm
+    static const Temperature criticalMargin = Temperature::fromCelsius(10); // TCRIT above TUPPER
+    static const auto thresholdCheck = std::chrono::milliseconds(100);
+    try {
+        MCP9808 mcp9808(mcp9808Config.i2cBusDevice, mcp9808Config.i2cAddress, mcp9808Config.identified);
+        mcp9808.enableAlert();
+        std::cout << __func__ << " started." << std::endl;
+        int threshold = INT_MIN;
+        int alarmState = -1;
+        bool check = true;
+        while (appState.keepRunning.load()) {
+            try {
+                const int newThreshold = appState.tempThreshold.load();
+                if (newThreshold != threshold) {
+                    const Temperature upper = Temperature::fromCelsius(newThreshold);
+                    mcp9808.setAlertLimits({upper, lowestLimit, upper + criticalMargin});
+                    threshold = newThreshold;
+                    check = true; // ALERT may be asserted already, no edge would come
+                }
+                if (check) {
+                    const MCP9808::Reading reading = mcp9808.getReading();
+                    appState.mcpTemperatureRaw.store(reading.temperature);
+                    const int tripped = (reading.aboveUpper || reading.aboveCritical) ? 1 : 0;
+                    if (tripped != alarmState) {
+                        alarmState = tripped;
+                        appState.setAlarm.store(tripped == 1);
+                        if (tripped) {
+                            std::cout << "ALARM! Temperature " << reading.temperature << "C above threshold" << std::endl;
+                        } else {
+                            std::cout << "Temperature " << reading.temperature << "C below threshold. Normal operation" << std::endl;
+                        }
+                    }
+                }
+            } catch (const I2C_Error &e) {
+                std::cerr << __func__ << ": " << e.what() << std::endl;
+                threshold = INT_MIN; // program the limits and read the state again
+            }
+            // between edges, look at the threshold and keepRunning
+            check = alert.wait(thresholdCheck);
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "An error occurred in MCP9808 alert thread: " << e.what() << std::endl;
+    }
+    std::cout << __func__ << " thread finished." << std::endl;
+}
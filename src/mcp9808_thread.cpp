@@ -1,17 +1,84 @@
 #include "app.hpp"
+#include "Filter_Pipeline.hpp"
 
+#include <algorithm>
+#include <array>
 #include <thread>
 #include <iostream>
 #include <iomanip>
 
-void mcp9808_thread(Application_state_t  & appState, const MCP9808::Config & mcp9808Config) {
+void mcp9808_thread(Application_state_t  & appState, const MCP9808::Config & mcp9808Config, I2C_Scheduler & scheduler, I2C_Scheduler::Slot slot) {
+    // filtered values are published about as often as the display refreshes;
+    // faster sampling is filtered in batches
+    static const auto publishPeriod = std::chrono::milliseconds(250);
+    static constexpr size_t maxBatch = 8;
     try {
-        MCP9808 mcp9808(mcp9808Config.i2cBusDevice, mcp9808Config.i2cAddress);
+        // median against single-sample spikes, then an average against the
+        // 0.0625 C quantisation noise
+        // runs on the raw Q12.4 values, integer only
+        Filter_Pipeline<int16_t> filter;
+        filter.add(std::make_unique<Median<int16_t, 5>>())
+              .add(std::make_unique<Moving_Average<int16_t, 4>>());
+        const size_t batchSize = std::clamp<size_t>(publishPeriod / MCP9808::samplePeriod(mcp9808Config), 1, maxBatch);
+        std::array<int16_t, maxBatch> batch;
+        size_t batched = 0;
+
+        MCP9808 mcp9808(mcp9808Config.i2cBusDevice, mcp9808Config.i2cAddress, mcp9808Config.identified);
+        mcp9808.setResolution(mcp9808Config.resolution);
+        mcp9808.shutdown(mcp9808Config.oneShot);
+        // continuous mode: conversions restarted conversionTime - margin
+        // after a slot end the margin before each following slot, see
+        // MCP9808::samplePeriod; the first restart follows the first slot
+        const auto resyncDelay = MCP9808::conversionTime(mcp9808Config.resolution) -
+                                 MCP9808::conversionMargin(mcp9808Config.resolution);
+        const size_t resyncInterval = MCP9808::resyncInterval(mcp9808Config);
+        size_t untilResync = 0;
+        auto slotTime = scheduler.waitForSlot(slot);
+        auto resync = [&] {
+            // a late slot only delays the restart, the time is the slot's
+            std::this_thread::sleep_until(slotTime + resyncDelay);
+            mcp9808.restartConversion();
+            untilResync = resyncInterval;
+        };
+        if (!mcp9808Config.oneShot) {
+            resync();
+            slotTime = scheduler.waitForSlot(slot);
+        }
         std::cout << __func__ << " started." << std::endl;
+        unsigned int failures = 0;
         while (appState.keepRunning.load()) {
-            float temperature = mcp9808.getTemperature();
-            appState.mcpTemperature.store(temperature);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            try {
+                Temperature temperature;
+                if (mcp9808Config.oneShot) {
+                    temperature = mcp9808.getTemperatureOneShot();
+                } else {
+                    temperature = mcp9808.getTemperature();
+                }
+                appState.mcpTemperatureRaw.store(temperature);
+                batch[batched++] = temperature.raw();
+                if (batched == batchSize) {
+                    const int16_t filtered = filter.process(std::span<int16_t>(batch.data(), batched));
+                    appState.mcpTemperature.store(Temperature::fromRaw(filtered));
+                    batched = 0;
+                }
+                if (failures > 0) {
+                    std::cerr << __func__ << ": sensor back after " << failures << " failed samples" << std::endl;
+                    failures = 0;
+                }
+                if (!mcp9808Config.oneShot) {
+                    if (untilResync > 1) {
+                        --untilResync;
+                    } else {
+                        resync(); // the drift may have used up the margin
+                    }
+                }
+            } catch (const I2C_Error &e) {
+                // the adapter gave up retrying; keep the last value and try again next period
+                if (failures++ == 0) {
+                    std::cerr << __func__ << ": " << e.what() << std::endl;
+                }
+            }
+            slotTime = scheduler.waitForSlot(slot); // every samplePeriod, staggered against the other devices on the bus
         }
     } catch (const std::exception &e) {
         std::cerr << "An error occurred in detection thread: " << e.what() << std::endl;
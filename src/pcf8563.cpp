@@ -6,6 +6,14 @@
 
 PCF8563::PCF8563(const std::string &i2cBusDevice, uint8_t address)
     : i2cBus_(i2cBusDevice, address) {
+    // control and alarm registers only change when written; AF and TF in
+    // control2 are set by the chip and cleared by writing 0, so writes which
+    // do not mean to clear them send 1
+    i2cBus_.cacheRegister(0x00);
+    i2cBus_.cacheRegister(0x01, 0x0C, 0x0C);
+    for (uint8_t reg = 0x09; reg <= 0x0E; ++reg) {
+        i2cBus_.cacheRegister(reg);
+    }
     uint8_t control1 = 0x00;
     uint8_t control2 = 0x02;
     i2cBus_.write8(0x00, control1);
@@ -15,6 +23,14 @@ PCF8563::PCF8563(const std::string &i2cBusDevice, uint8_t address)
 PCF8563::~PCF8563() {
 }
 
+bool PCF8563::probe(I2CBus &i2cBus) {
+    // the chip has no ID register; check the bits of the control registers
+    // which always read 0 (control1: 6, 4, 2..0; control2: 7..5)
+    std::array<uint8_t, 2> control;
+    i2cBus.readBlock(0x00, control);
+    return (control[0] & 0x57) == 0 && (control[1] & 0xE0) == 0;
+}
+
 void PCF8563::setTime(uint8_t hours, uint8_t minutes, uint8_t seconds) {
     //TODO: This function not quite correctly uses separate I2C transactions to write the time data.
     //      It should use a single I2C transaction to write all three bytes at once.
@@ -45,20 +61,15 @@ void PCF8563::setDate(uint8_t day,uint8_t month, uint8_t year) {
 }
 
 std::array<uint8_t, 3> PCF8563::getTime() {
-    //TODO: This function not quite correctly uses separate I2C transactions to read the time data.
-    //      It should use a single I2C transaction to read all three bytes at once.
-    //      Implement this feature. Please use the readBlock() method of the I2CBus class.
-    //      Represent data as a std::array<uint8_t, 3>.
-    return {fromBCD(i2cBus_.read8(0x02) & 0x7F),
-            fromBCD(i2cBus_.read8(0x03) & 0x7F),
-            fromBCD(i2cBus_.read8(0x04) & 0x3F)};
+    std::array<uint8_t, 3> time;
+    i2cBus_.readBlock(0x02, time); // seconds, minutes, hours in one transaction
+    return decodeTime(time);
 }
 
 std::array<uint8_t, 4> PCF8563::getDate() {
-    return {fromBCD(i2cBus_.read8(0x05) & 0x3F),
-            fromBCD(i2cBus_.read8(0x06) & 0x07),
-            fromBCD(i2cBus_.read8(0x07) & 0x1F),
-            fromBCD(i2cBus_.read8(0x08) )};
+    std::array<uint8_t, 4> date;
+    i2cBus_.readBlock(0x05, date); // days, weekdays, months, years
+    return decodeDate(date);
 }
 
 void PCF8563::setAlarm(uint8_t hour, uint8_t minute, uint8_t day, uint8_t weekday) {
@@ -69,8 +80,20 @@ void PCF8563::setAlarm(uint8_t hour, uint8_t minute, uint8_t day, uint8_t weekda
 }
 
 void PCF8563::clearAlarm() {
-    uint8_t control2 = i2cBus_.read8(0x01);
-    i2cBus_.write8(0x01, control2 & ~0x02);
+    i2cBus_.update8(0x01, 0x02, 0x00); // AIE off, a single write once control2 is known
+}
+
+std::array<uint8_t, 3> PCF8563::decodeTime(const std::array<uint8_t, 3> &raw) {
+    return {fromBCD(raw[0] & 0x7F),
+            fromBCD(raw[1] & 0x7F),
+            fromBCD(raw[2] & 0x3F)};
+}
+
+std::array<uint8_t, 4> PCF8563::decodeDate(const std::array<uint8_t, 4> &raw) {
+    return {fromBCD(raw[0] & 0x3F),
+            fromBCD(raw[1] & 0x07),
+            fromBCD(raw[2] & 0x1F),
+            fromBCD(raw[3])};
 }
 
 uint8_t PCF8563::toBCD(uint8_t value) {
@@ -105,15 +128,27 @@ void PCF8563::setTimeAndDate(const struct tm & wall) {
 }
 
 struct tm PCF8563::getTimeAndDate() {
-    std::array<uint8_t, 3> pcfTime = getTime();
-    std::array<uint8_t, 4> pcfDate = getDate();
-    struct tm wall = {};
+    return getSnapshot().wall;
+}
+
+PCF8563::Snapshot PCF8563::getSnapshot() {
+    // One burst from seconds to years. The chip freezes its counters for the
+    // whole read access, so the registers cannot roll over between each other
+    // (e.g. 23:59:59 with the next day's date), as they could across calls.
+    std::array<uint8_t, 7> raw;
+    i2cBus_.readBlock(0x02, raw);
+    std::array<uint8_t, 3> pcfTime = decodeTime({raw[0], raw[1], raw[2]});
+    std::array<uint8_t, 4> pcfDate = decodeDate({raw[3], raw[4], raw[5], raw[6]});
+    Snapshot snapshot = {};
+    struct tm &wall = snapshot.wall;
     wall.tm_sec = pcfTime[0];
     wall.tm_min = pcfTime[1];
     wall.tm_hour = pcfTime[2];
     wall.tm_mday = pcfDate[0];
+    wall.tm_wday = pcfDate[1];
     wall.tm_mon = pcfDate[2] - 1;
     wall.tm_year = pcfDate[3] + 100;
+    snapshot.voltageLow = (raw[0] & 0x80) != 0; // cleared by setTime()
     // std::cout << "PCF8563: " ;
     // std::cout << std::dec << static_cast<int>(pcfDate[0]) << "-" ;
     // std::cout << static_cast<int>(pcfDate[2]) << "-" ;
@@ -121,6 +156,6 @@ struct tm PCF8563::getTimeAndDate() {
     // std::cout << std::dec << std::setw(2) << std::setfill(' ') << static_cast<int>(pcfTime[2]) << ":" ;
     // std::cout << std::dec << std::setw(2) << std::setfill('0') << static_cast<int>(pcfTime[1]) << ":" ;
     // std::cout << std::dec << std::setw(2) << std::setfill('0') << static_cast<int>(pcfTime[0]) << std::endl;
-    return wall;
+    return snapshot;
 }
 
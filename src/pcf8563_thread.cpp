@@ -4,15 +4,34 @@
 #include <iostream>
 #include <iomanip>
 
-void pcf8563_thread(Application_state_t  & appState, const PCF8563::Config & pcf8563Config) {
+void pcf8563_thread(Application_state_t  & appState, const PCF8563::Config & pcf8563Config, I2C_Scheduler & scheduler, I2C_Scheduler::Slot slot) {
     try {
         PCF8563 pcf8563(pcf8563Config.i2cBusDevice, pcf8563Config.i2cAddress);
 
         std::cout << __func__ << " started." << std::endl;
+        unsigned int failures = 0;
+        bool voltageLow = false;
         while (appState.keepRunning.load()) {
-            struct tm pcf8563_time = pcf8563.getTimeAndDate();
-            appState.pcfTime.store(pcf8563_time);
-            std::this_thread::sleep_for(std::chrono::seconds(1));
+            try {
+                PCF8563::Snapshot snapshot = pcf8563.getSnapshot();
+                appState.pcfTime.store(snapshot.wall);
+                if (snapshot.voltageLow != voltageLow) {
+                    voltageLow = snapshot.voltageLow;
+                    if (voltageLow) {
+                        std::cerr << __func__ << ": RTC lost power, the time is not reliable until it is set" << std::endl;
+                    }
+                }
+                if (failures > 0) {
+                    std::cerr << __func__ << ": RTC back after " << failures << " failed samples" << std::endl;
+                    failures = 0;
+                }
+            } catch (const I2C_Error &e) {
+                // the adapter gave up retrying; keep the last time and try again next period
+                if (failures++ == 0) {
+                    std::cerr << __func__ << ": " << e.what() << std::endl;
+                }
+            }
+            scheduler.waitForSlot(slot); // every samplePeriod, staggered against the other devices on the bus
         }
     } catch (const std::exception &e) {
         std::cerr << "An error occurred in detection thread: " << e.what() << std::endl;
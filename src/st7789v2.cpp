@@ -1,269 +1,242 @@
 // st7789.cpp
 #include "st7789v2.hpp"
+#include "SPI_Transaction.hpp"
+#include "RLE565.hpp"
 #include <stdexcept>
-#include <fcntl.h>
-#include <unistd.h>
-#include <sys/ioctl.h>
-#include <linux/spi/spidev.h>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <cstring>
+#include <iostream>
 #include <thread>
 #include <chrono>
 
 ST7789::ST7789(const Config& cfg)
+    : ST7789(cfg, std::make_unique<SPI_Bus>(SPI_Bus::Config{cfg.spiDevice, cfg.speedHz, SPI_MODE_3, 8}))
+{
+}
+
+ST7789::ST7789(const Config& cfg, std::unique_ptr<SPI_Bus> spiBus, std::unique_ptr<Edge_Source> te)
     : config(cfg)
-    , chip(cfg.gpioChip)
-    , dcLine(chip.get_line(cfg.dcPin))
-    , resetLine(chip.get_line(cfg.resetPin))
-    , spifd(-1)
+    , bus(std::move(spiBus))
+    , teSource(std::move(te))
+    , framebuffer(ST7789::WIDTH, ST7789::HEIGHT)
+    , frontbuffer(ST7789::WIDTH, ST7789::HEIGHT)
+    , transmitting(false)
+    , pipeline{}
+    , glyphs(font_bitmap, 32, 127, ST7789::font_height)
+    , dcState(-1)
+    , dcWrites(0)
+    , frames(0)
+    , teTimeouts(0)
+    , lastFrameStats{}
+    , initDuration{}
 {
     // Configure GPIO lines
-    dcLine.request({"st7789", gpiod::line_request::DIRECTION_OUTPUT, 0});
-    resetLine.request({"st7789", gpiod::line_request::DIRECTION_OUTPUT, 0});
-
-    // Open SPI device
-    spifd = open(config.spiDevice.c_str(), O_RDWR);
-    if (spifd < 0) {
-        throw std::runtime_error("Failed to open SPI device");
-    }
-
-    // Configure SPI
-    int mode = SPI_MODE_3;
-    if (ioctl(spifd, SPI_IOC_WR_MODE, &mode) < 0) {
-        close(spifd);
-        throw std::runtime_error("Failed to set SPI mode");
+    if (!config.gpioChip.empty()) {
+        chip.open(config.gpioChip);
+        dcLine = chip.get_line(config.dcPin);
+        resetLine = chip.get_line(config.resetPin);
+        dcLine.request({"st7789", gpiod::line_request::DIRECTION_OUTPUT, 0});
+        resetLine.request({"st7789", gpiod::line_request::DIRECTION_OUTPUT, 0});
     }
-
-    if (ioctl(spifd, SPI_IOC_WR_MAX_SPEED_HZ, &config.speedHz) < 0) {
-        close(spifd);
-        throw std::runtime_error("Failed to set SPI speed");
-    }
-
-    // Configure SPI bit order
-    uint8_t bitOrder = 0; // 0 for MSB first
-    if (ioctl(spifd, SPI_IOC_WR_LSB_FIRST, &bitOrder) < 0) {
-        close(spifd);
-        throw std::runtime_error("Failed to set SPI bit order");
+    if (config.tearingEffect && !teSource) {
+        if (!config.gpioChip.empty()) {
+            teSource = std::make_unique<GPIO_Edge_Source>(config.gpioChip, config.tePin, "st7789-te");
+        } else {
+            teSource = std::make_unique<Simulated_Edge_Source>(refreshPeriod);
+        }
     }
     display_init() ;
+    if (config.tearingEffect) {
+        command(0x35, {0x00});  // TEON: TE output on, V-blanking only
+    }
+    // the panel RAM holds garbage after reset, the first flush must cover it all
+    damage.add({0, 0, ST7789::WIDTH, ST7789::HEIGHT});
 }
 
 ST7789::~ST7789() {
-    if (spifd >= 0) {
-        writeReg(0x28);  // Display off
+    try {
+        command(0x28);  // Display off
         std::this_thread::sleep_for(std::chrono::milliseconds(120));
-        writeReg(0x10);  // Sleep in
+        command(0x10);  // Sleep in
         std::this_thread::sleep_for(std::chrono::milliseconds(120));
-        close(spifd);
+    } catch (const std::exception &e) {
+        std::cerr << "Exception in destructor: " << e.what() << std::endl;
     }
-    resetLine.release();
-    dcLine.release();
-}
-
-void ST7789::spiTransfer(uint8_t *tx, uint8_t *rx, size_t length) {
-    struct spi_ioc_transfer spi = {};
-    spi.tx_buf = reinterpret_cast<unsigned long>(tx);
-    spi.rx_buf = reinterpret_cast<unsigned long>(rx);
-    spi.len = length;
-    spi.speed_hz = config.speedHz ;
-    spi.bits_per_word = 8;
-    spi.cs_change = 0;
-    if (ioctl(spifd, SPI_IOC_MESSAGE(1), &spi) < 0) {
-        throw std::runtime_error("SPI write failed at " __FILE__ ":" + std::to_string(__LINE__));
+    if (resetLine) {
+        resetLine.release();
+    }
+    if (dcLine) {
+        dcLine.release();
     }
 }
 
-void ST7789::spiWrite8(uint8_t data) { // write 8 bits
-    uint8_t tx[] = { data };
-    uint8_t rx[sizeof(tx)] = { 0 };
-    spiTransfer(tx, rx, sizeof(tx));
-}
-
-void ST7789::spiWrite16(uint16_t data) {
-    uint8_t tx[2] = { // Most significant byte first, big-endian
-        static_cast<uint8_t>((data >> 8) & 0xFF),
-        static_cast<uint8_t>(data & 0xFF)
-    };
-    uint8_t rx[sizeof(tx)] = { 0 };
-    spiTransfer(tx, rx, sizeof(tx));
+void ST7789::setDC(int value) {
+    if (value == dcState) {
+        return; // the line already holds the requested level
+    }
+    if (dcLine) {
+        dcLine.set_value(value);
+    }
+    dcState = value;
+    dcWrites++;
 }
 
-void ST7789::writeReg(uint8_t cmd) {
-    dcLine.set_value(0);  // Command mode
-    spiWrite8(cmd);
+void ST7789::command(uint8_t cmd, std::initializer_list<uint8_t> params) {
+    command(cmd, params.begin(), params.size());
 }
 
-void ST7789::writeDataByte(uint8_t data) {
-    dcLine.set_value(1);  // Data mode
-    spiWrite8(data);
+void ST7789::command(uint8_t cmd, const uint8_t *params, size_t length) {
+    // D/C is a GPIO, so the command byte and its parameters cannot share one
+    // SPI message; the parameters go out together in a single transfer
+    setDC(0);  // Command mode
+    bus->transfer(&cmd, nullptr, 1);
+    if (length > 0) {
+        setDC(1);  // Data mode
+        bus->transfer(params, nullptr, length);
+    }
 }
 
-void ST7789::writeDataWord(uint16_t data) {
-    dcLine.set_value(1);  // Data mode
-    spiWrite16(data);
+void ST7789::writeData(const uint8_t *data, size_t length) {
+    setDC(1);  // Data mode, kept for the whole stream
+    const size_t chunk = bus->maxTransferSize();
+    for (size_t offset = 0; offset < length; offset += chunk) {
+        bus->transfer(data + offset, nullptr, std::min(chunk, length - offset));
+    }
 }
 
 void ST7789::reset() {
-    resetLine.set_value(1);
-    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    if (!resetLine) {
+        return;
+    }
+    // the line is requested low, so the reset pulse is already running;
+    // the datasheet asks for at least 10 us
     resetLine.set_value(0);
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::this_thread::sleep_for(std::chrono::microseconds(10));
     resetLine.set_value(1);
-    std::this_thread::sleep_for(std::chrono::milliseconds(150));
 }
 
-void ST7789::display_init() {
-    reset();
-    std::this_thread::sleep_for(std::chrono::milliseconds(120));
-
-    // Software Reset
-    writeReg(0x01);
-    std::this_thread::sleep_for(std::chrono::milliseconds(120));
-
-    // Sleep Out
-    writeReg(0x11);
-    std::this_thread::sleep_for(std::chrono::milliseconds(120));
-
-    // Color Mode
-    writeReg(0x3A);
-    writeDataByte(0x55);  // 16 bit color
-
-    // Memory Data Access Control
-    writeReg(0x36);
-    // writeDataByte(0x00);  // Normal orientation
-    writeDataByte(0xC0);  // Flip vertically (MY=1, MX=1)
-
-    // Column Address Set
-    writeReg(0x2A);
-    writeDataByte(0x00);
-    writeDataByte(0x00);
-    writeDataByte(0x00);
-    writeDataByte(0xEF);  // 239
-
-    // Row Address Set
-    writeReg(0x2B);
-    writeDataByte(0x00);
-    writeDataByte(0x00);
-    writeDataByte(0x00);
-    writeDataByte(0xEF);  // 239
-
-    // PORCH Setting
-    writeReg(0xB2);
-    writeDataByte(0x0C);
-    writeDataByte(0x0C);
-    writeDataByte(0x00);
-    writeDataByte(0x33);
-    writeDataByte(0x33);
-
-    // Gate Control
-    writeReg(0xB7);
-    writeDataByte(0x35);
-
-    // VCOMS Setting
-    writeReg(0xBB);
-    writeDataByte(0x2B);
-
-    // LCM Control
-    writeReg(0xC0);
-    writeDataByte(0x2C);
-
-    // VDV and VRH Command Enable
-    writeReg(0xC2);
-    writeDataByte(0x01);
-
-    // VRH Set
-    writeReg(0xC3);
-    writeDataByte(0x0B);
-
-    // VDV Set
-    writeReg(0xC4);
-    writeDataByte(0x20);
-
-    // Frame Rate Control
-    writeReg(0xC6);
-    writeDataByte(0x0F);    // 60 Hz
-
-    // Power Control 1
-    writeReg(0xD0);
-    writeDataByte(0xA4);
-    writeDataByte(0xA1);
+// Panel initialisation table, executed by display_init().
+// Commands are accepted 5 ms after a reset only if the panel was in Sleep
+// In; after a reset from Sleep Out (e.g. the application was killed before the
+// destructor sent Sleep In) commands are ignored for 120 ms. The first
+// command therefore waits for the 120 ms mark, and the rest follows without
+// delays; Sleep Out would have to wait for that mark anyway. Hardware reset
+// loads the same defaults as Software Reset, so the latter (and another
+// 120 ms) is not used.
+struct Init_Command {
+    uint8_t cmd;
+    uint8_t length;                  // number of parameters
+    std::array<uint8_t, 14> params;
+    uint16_t notBeforeMs;            // earliest send time, counted from reset release
+    uint16_t delayMs;                // wait before the next command
+};
 
-    // Positive Voltage Gamma Control
-    writeReg(0xE0);
-    writeDataByte(0xD0);
-    writeDataByte(0x00);
-    writeDataByte(0x02);
-    writeDataByte(0x07);
-    writeDataByte(0x0A);
-    writeDataByte(0x28);
-    writeDataByte(0x32);
-    writeDataByte(0x44);
-    writeDataByte(0x42);
-    writeDataByte(0x06);
-    writeDataByte(0x0E);
-    writeDataByte(0x12);
-    writeDataByte(0x14);
-    writeDataByte(0x17);
+static constexpr Init_Command init_sequence[] = {
+    {0x3A, 1, {0x55}, 120, 0},                           // Color Mode: 16 bit color
+    // {0x36, 1, {0x00}, 0, 0},                          // Normal orientation
+    {0x36, 1, {0xC0}, 0, 0},                             // Memory Data Access Control: flip vertically (MY=1, MX=1)
+    {0x2A, 4, {0x00, 0x00, 0x00, 0xEF}, 0, 0},           // Column Address Set: 0..239
+    {0x2B, 4, {0x00, 0x00, 0x00, 0xEF}, 0, 0},           // Row Address Set: 0..239
+    {0xB2, 5, {0x0C, 0x0C, 0x00, 0x33, 0x33}, 0, 0},     // PORCH Setting
+    {0xB7, 1, {0x35}, 0, 0},                             // Gate Control
+    {0xBB, 1, {0x2B}, 0, 0},                             // VCOMS Setting
+    {0xC0, 1, {0x2C}, 0, 0},                             // LCM Control
+    {0xC2, 1, {0x01}, 0, 0},                             // VDV and VRH Command Enable
+    {0xC3, 1, {0x0B}, 0, 0},                             // VRH Set
+    {0xC4, 1, {0x20}, 0, 0},                             // VDV Set
+    {0xC6, 1, {0x0F}, 0, 0},                             // Frame Rate Control: 60 Hz
+    {0xD0, 2, {0xA4, 0xA1}, 0, 0},                       // Power Control 1
+    {0xE0, 14, {0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x32, 0x44, 0x42, 0x06, 0x0E, 0x12, 0x14, 0x17}, 0, 0}, // Positive Voltage Gamma Control
+    {0xE1, 14, {0xD0, 0x00, 0x02, 0x07, 0x0A, 0x28, 0x31, 0x54, 0x47, 0x0E, 0x1C, 0x17, 0x1B, 0x1E}, 0, 0}, // Negative Voltage Gamma Control
+    {0x11, 0, {}, 0, 5},                                 // Sleep Out, then 5 ms for the supply to settle
+    {0x21, 0, {}, 0, 0},                                 // Display Inversion On
+    {0x29, 0, {}, 0, 0},                                 // Display On
+};
 
-    // Negative Voltage Gamma Control
-    writeReg(0xE1);
-    writeDataByte(0xD0);
-    writeDataByte(0x00);
-    writeDataByte(0x02);
-    writeDataByte(0x07);
-    writeDataByte(0x0A);
-    writeDataByte(0x28);
-    writeDataByte(0x31);
-    writeDataByte(0x54);
-    writeDataByte(0x47);
-    writeDataByte(0x0E);
-    writeDataByte(0x1C);
-    writeDataByte(0x17);
-    writeDataByte(0x1B);
-    writeDataByte(0x1E);
+static_assert([] {
+    for (const auto& entry : init_sequence) {
+        if (entry.length > entry.params.size()) {
+            return false;
+        }
+    }
+    return true;
+}(), "ST7789 init table entry has more parameters than it stores");
 
-    // Display Inversion On
-    writeReg(0x21);
+void ST7789::display_init() {
+    using std::chrono::milliseconds;
+    const auto start = std::chrono::steady_clock::now();
+    reset();
+    const auto resetReleased = std::chrono::steady_clock::now();
 
-    // Display On
-    writeReg(0x29);
-    std::this_thread::sleep_for(std::chrono::milliseconds(120));
+    constexpr size_t count = std::size(init_sequence);
+    for (size_t i = 0; i < count; ) {
+        const Init_Command& entry = init_sequence[i];
+        std::this_thread::sleep_until(resetReleased + milliseconds(entry.notBeforeMs));
+        size_t n = 1;
+        if (entry.length == 0) {
+            // a run of parameterless commands goes out as one command-mode transfer
+            while (i + n < count && init_sequence[i + n - 1].delayMs == 0 &&
+                   init_sequence[i + n].length == 0 && init_sequence[i + n].notBeforeMs == 0) {
+                n++;
+            }
+            uint8_t cmds[count];
+            for (size_t k = 0; k < n; ++k) {
+                cmds[k] = init_sequence[i + k].cmd;
+            }
+            setDC(0);  // Command mode
+            bus->transfer(cmds, nullptr, n);
+        } else {
+            command(entry.cmd, entry.params.data(), entry.length);
+        }
+        i += n;
+        std::this_thread::sleep_for(milliseconds(init_sequence[i - 1].delayMs));
+    }
+    initDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
 }
 
 void ST7789::selectArea(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-    writeReg(0x2A);        // CASET (Column Address Set)
-    writeDataWord(x0);     // XSTART
-    writeDataWord(x1);     // XEND
-    writeReg(0x2B);        // RASET (Row Address Set)
-    writeDataWord(y0+20);  // YSTART
-    writeDataWord(y1+20);  // YEND
-    writeReg(0X2C);        // RAMWR (Memory Write)
+    y0 += 20;  // the 240x280 glass starts at row 20 of the 240x320 controller RAM
+    y1 += 20;
+    command(0x2A, {  // CASET (Column Address Set)
+        static_cast<uint8_t>(x0 >> 8), static_cast<uint8_t>(x0 & 0xFF),  // XSTART
+        static_cast<uint8_t>(x1 >> 8), static_cast<uint8_t>(x1 & 0xFF)   // XEND
+    });
+    command(0x2B, {  // RASET (Row Address Set)
+        static_cast<uint8_t>(y0 >> 8), static_cast<uint8_t>(y0 & 0xFF),  // YSTART
+        static_cast<uint8_t>(y1 >> 8), static_cast<uint8_t>(y1 & 0xFF)   // YEND
+    });
+    command(0x2C);  // RAMWR (Memory Write)
 }
 
 void ST7789::drawPixel(int16_t x, int16_t y, uint16_t color) {
     if (x < 0 || x >= ST7789::WIDTH || y < 0 || y >= ST7789::HEIGHT) {
         return;
     }
-    selectArea(x, y, x, y);
-    writeDataWord(color);
+    if (framebuffer.setPixel(x, y, color)) {
+        damage.add({x, y, 1, 1});
+    }
 }
 
 void ST7789::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
     // example of defensive programming
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
     if (x >= ST7789::WIDTH || y >= ST7789::HEIGHT) return;
     w = (x + w > ST7789::WIDTH) ? ST7789::WIDTH - x : w;
     h = (y + h > ST7789::HEIGHT) ? ST7789::HEIGHT - y : h; 
     if (w <= 0 || h <= 0) return;
 
-    selectArea(x, y, x + w - 1, y + h - 1);
-    for (int32_t i = 0; i < w*h; i++) { // send w*h pixels
-        writeDataWord(color);
+    if (framebuffer.fill(x, y, w, h, color)) {
+        damage.add({x, y, w, h});
     }
 }
 
 void ST7789::showLogo() {
-    selectArea(0, 0, ST7789::WIDTH - 1, ST7789::HEIGHT - 1);
-    for (uint16_t pixel : image_data) {
-        writeDataWord(pixel);
-    }
+    // decode straight into the framebuffer, the logo covers the whole panel
+    RLE565::decode(logo_rle, logo_rle_size, framebuffer.row(0), static_cast<size_t>(ST7789::WIDTH) * ST7789::HEIGHT);
+    damage.add({0, 0, ST7789::WIDTH, ST7789::HEIGHT});
 }
 
 
@@ -272,25 +245,158 @@ void ST7789::clearScreen(uint16_t color) {
 }
 
 void ST7789::drawChar(int16_t x, int16_t y, char c, uint16_t color, uint16_t bg) {
-    selectArea(x, y, x+ST7789::font_width-1, y+ST7789::font_height-1);
-    for (int8_t i = 0; i < ST7789::font_height; i++) {
-        uint8_t scan_line = ST7789::font_bitmap[(c - 32) * ST7789::font_height  + i] ;
-        for (int8_t j = 0; j < ST7789::font_width; j++) {
-            auto pixel = (scan_line & (1 << (ST7789::font_width-1-j))) ? color : bg;
-            writeDataWord(pixel);
+    const uint16_t *glyph = glyphs.get(static_cast<unsigned char>(c), color, bg);
+    if (framebuffer.blit(x, y, ST7789::font_width, ST7789::font_height, glyph)) {
+        damage.add({x, y, ST7789::font_width, ST7789::font_height});
+    }
+}
+
+void ST7789::drawString(int16_t x, int16_t y, std::string_view str, uint16_t color, uint16_t bg) {
+    // Glyphs are copied from the cache row by row; only the span between the
+    // first and the last changed cell is damaged, so the whole line goes out
+    // as one window
+    int16_t first = ST7789::WIDTH;
+    int16_t last = -1;
+    for (char c : str) {
+        const uint16_t *glyph = glyphs.get(static_cast<unsigned char>(c), color, bg);
+        if (framebuffer.blit(x, y, ST7789::font_width, ST7789::font_height, glyph)) {
+            first = std::min(first, x);
+            last = std::max(last, x);
         }
+        x += ST7789::font_width;
+    }
+    if (last >= first) {
+        damage.add({first, y, static_cast<int16_t>(last - first + ST7789::font_width), ST7789::font_height});
     }
 }
 
-void ST7789::drawString(int16_t x, int16_t y, const std::string& str, uint16_t color, uint16_t bg) {
-    for (size_t i = 0; i < str.size(); ++i, x+=ST7789::font_width) {
-        drawChar(x, y, str[i], color, bg);
+void ST7789::flush() {
+    if (damage.empty()) {
+        return; // nothing changed since the last flush
+    }
+    sendAreas(framebuffer, damage);
+    damage.clear();
+}
+
+bool ST7789::present() {
+    if (damage.empty()) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(frameMutex);
+    if (transmitting) {
+        // the front buffer is on the wire; keep the damage for the next frame
+        pipeline.dropped++;
+        return false;
+    }
+    if (!frontDamage.empty()) {
+        // the previous frame was never picked up, it is replaced by this one
+        pipeline.dropped++;
+    }
+    for (const auto& area : damage) {
+        frontDamage.add(area);
+    }
+    // merged rectangles can cover pixels outside this frame's damage, which
+    // the front buffer may not have yet (e.g. drawn and sent by flush()):
+    // copy everything that will go out, not just what changed
+    for (const auto& area : frontDamage) {
+        frontbuffer.copyArea(framebuffer, area.x, area.y, area.w, area.h);
+    }
+    damage.clear();
+    pipeline.presented++;
+    frameReady.notify_one();
+    return true;
+}
+
+bool ST7789::transmitFrame(std::chrono::milliseconds timeout) {
+    Damage_Tracker areas;
+    {
+        std::unique_lock<std::mutex> lock(frameMutex);
+        if (!frameReady.wait_for(lock, timeout, [this] { return !frontDamage.empty(); })) {
+            return false;
+        }
+        areas = frontDamage;
+        frontDamage.clear();
+        transmitting = true;
     }
-    // C++20: 
-    // for (char c : str) {
-    //     drawChar(x, y, c, color, bg);
-    //     x+=ST7789::font_width;
-    // }
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        sendAreas(frontbuffer, areas);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        transmitting = false;
+        throw;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(frameMutex);
+    transmitting = false;
+    if (pipeline.transmitted > 0) {
+        pipeline.frameTime = std::chrono::duration_cast<std::chrono::microseconds>(start - lastTransmitStart);
+    }
+    pipeline.transmitTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    pipeline.transmitted++;
+    lastTransmitStart = start;
+    return true;
+}
+
+ST7789::PipelineStats ST7789::pipelineStats() const {
+    std::lock_guard<std::mutex> lock(frameMutex);
+    return pipeline;
+}
+
+void ST7789::waitForBlanking() {
+    // TE rises when the panel stops scanning out; writing from then on keeps
+    // the write pointer ahead of the scan. Without an edge within two refresh
+    // periods (TE not wired up) the flush goes ahead unsynchronised.
+    if (!teSource->wait(2 * refreshPeriod)) {
+        teTimeouts++;
+    }
+}
+
+void ST7789::sendAreas(const Framebuffer& source, const Damage_Tracker& areas) {
+    const SPI_Bus::Stats before = bus->stats();
+    std::chrono::microseconds teWait{};
+    if (teSource) {
+        const auto start = std::chrono::steady_clock::now();
+        waitForBlanking();
+        teWait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    }
+    for (const auto& area : areas) {
+        sendArea(source, area);
+    }
+    lastFrameStats = {bus->stats().ioctls - before.ioctls, bus->stats().bytes - before.bytes, areas.size(), teWait};
+    frames++;
+}
+
+void ST7789::sendArea(const Framebuffer& source, const Damage_Tracker::Rect& area) {
+    // clip to the panel, draw calls may damage cells hanging over the edge
+    int16_t x0 = std::max<int16_t>(area.x, 0);
+    int16_t y0 = std::max<int16_t>(area.y, 0);
+    int16_t x1 = std::min<int16_t>(area.right(), ST7789::WIDTH);
+    int16_t y1 = std::min<int16_t>(area.bottom(), ST7789::HEIGHT);
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    selectArea(x0, y0, x1 - 1, y1 - 1);
+    if (x0 == 0 && x1 == ST7789::WIDTH) {
+        // full-width rows are contiguous in the framebuffer, send them in place
+        const uint8_t *rows = reinterpret_cast<const uint8_t *>(source.row(y0));
+        writeData(rows, static_cast<size_t>(y1 - y0) * ST7789::WIDTH * sizeof(uint16_t));
+        return;
+    }
+    // otherwise queue one transfer per row, pointing into the framebuffer;
+    // CS stays asserted between them, so the panel sees one RAMWR stream
+    setDC(1);
+    const size_t rowBytes = static_cast<size_t>(x1 - x0) * sizeof(uint16_t);
+    SPI_Transaction rows(*bus);
+    for (int16_t y = y0; y < y1; ++y) {
+        rows.write(reinterpret_cast<const uint8_t *>(source.row(y) + x0), rowBytes);
+    }
+    rows.submit();
+}
+
+ST7789::Stats ST7789::stats() const {
+    return {bus->stats().ioctls, bus->stats().bytes, dcWrites, frames, teTimeouts};
 }
 
 const uint8_t ST7789::font_bitmap[] = {
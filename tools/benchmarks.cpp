@@ -0,0 +1,499 @@
+// Benchmarks of the I2C layer, the drivers and the display loop on
+// simulated buses, kept out of the application. Nothing here touches the
+// hardware. Each one prints its figures and returns false if the code under
+// test misbehaved.
+//
+// usage: benchmarks [name...]     (all of them without arguments; exits
+//                                  with 1 if any of them failed)
+// (or "make bench", which builds it and runs it on the target)
+
+#include "app.hpp"
+#include "I2C_Async_Engine.hpp"
+#include "Fake_I2C_Adapter.hpp"
+#include "I2C_Bus_Manager.hpp"
+#include "Fake_SPI_Bus.hpp"
+#include "Filter_Pipeline.hpp"
+#include "Widgets.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Every heap allocation of the program is counted, see benchmark_display_allocations
+static std::atomic<uint64_t> allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    if (void *p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+void mcp9808_alert_thread( Application_state_t  & appState, const MCP9808::Config & mcp9808Config, Edge_Source & alert) ;
+
+// Compares blocking reads with the asynchronous engine on a simulated bus:
+// 100 kHz clock and 100 us per I2C_RDWR call for the syscall and driver
+static bool benchmark_i2c_async() {
+    auto adapter = std::make_shared<Fake_I2C_Adapter>(100000, std::chrono::microseconds(100));
+    adapter->addDevice(0x18, 2);    // MCP9808, 16-bit registers
+    adapter->addDevice(0x51, 1);    // PCF8563
+    constexpr int rounds = 200;
+
+    I2CBus mcp9808(adapter, 0x18);
+    I2CBus pcf8563(adapter, 0x51);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        std::array<uint8_t, 7> rtc;
+        mcp9808.read16(0x05);
+        pcf8563.readBlock(0x02, rtc);
+    }
+    auto syncTime = std::chrono::steady_clock::now() - start;
+    auto syncStats = adapter->stats();
+
+    adapter->resetStats();
+    I2C_Async_Engine engine(adapter);
+    std::vector<std::future<std::vector<uint8_t>>> results;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        results.push_back(engine.read(0x18, 0x05, 2));
+        results.push_back(engine.read(0x51, 0x02, 7));
+    }
+    for (auto& result : results) {
+        result.get();
+    }
+    auto asyncTime = std::chrono::steady_clock::now() - start;
+    auto asyncStats = adapter->stats();
+
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    std::cout << "I2C blocking: " << 2 * rounds << " reads in " << duration_cast<milliseconds>(syncTime).count()
+              << " ms, " << syncStats.ioctls << " ioctls" << std::endl;
+    std::cout << "I2C async:    " << 2 * rounds << " reads in " << duration_cast<milliseconds>(asyncTime).count()
+              << " ms, " << asyncStats.ioctls << " ioctls, " << engine.stats().batches << " batches" << std::endl;
+    return true;
+}
+
+// Bus cost of one sensor sample (MCP9808 temperature and PCF8563 time and
+// date) on a simulated bus: register by register, as the drivers used to
+// read them, against the drivers' scatter/gather reads. The drivers open
+// their bus by name, so the fake is registered under one; the registry is
+// this process's own.
+static bool benchmark_i2c_sample() {
+    auto adapter = std::make_shared<Fake_I2C_Adapter>();
+    adapter->addDevice(0x18, 2);
+    adapter->setRegister(0x18, 0x06, 0x0054);  // manufacturer ID
+    adapter->setRegister(0x18, 0x07, 0x0400);  // device ID
+    adapter->addDevice(0x51, 1);
+    I2C_Bus_Manager::instance().registerAdapter("fake-i2c-sample", adapter);
+    constexpr int samples = 100;
+
+    I2CBus mcp9808Bus(adapter, 0x18);
+    I2CBus pcf8563Bus(adapter, 0x51);
+    adapter->resetStats();
+    uint64_t cycles = adapter->busCycles();
+    for (int i = 0; i < samples; ++i) {
+        mcp9808Bus.read16(0x05);
+        for (uint8_t reg = 0x02; reg <= 0x08; ++reg) {
+            pcf8563Bus.read8(reg);
+        }
+    }
+    std::cout << "I2C sample, per register: " << adapter->stats().ioctls / samples << " ioctls, "
+              << (adapter->busCycles() - cycles) / samples << " bus cycles" << std::endl;
+
+    MCP9808 mcp9808("fake-i2c-sample", 0x18);
+    PCF8563 pcf8563("fake-i2c-sample", 0x51);
+    adapter->resetStats();
+    cycles = adapter->busCycles();
+    for (int i = 0; i < samples; ++i) {
+        mcp9808.getTemperature();
+        pcf8563.getTimeAndDate();
+    }
+    std::cout << "I2C sample, drivers:      " << adapter->stats().ioctls / samples << " ioctls, "
+              << (adapter->busCycles() - cycles) / samples << " bus cycles" << std::endl;
+    return true;
+}
+
+// Latency from the sensor tripping to setAlarm, through the alert thread,
+// with a simulated ALERT line and the sensor on a fake bus
+static bool benchmark_mcp9808_alert() {
+    auto adapter = std::make_shared<Fake_I2C_Adapter>();
+    adapter->addDevice(0x18, 2);
+    adapter->setRegister(0x18, 0x06, 0x0054);
+    adapter->setRegister(0x18, 0x07, 0x0400);
+    I2C_Bus_Manager::instance().registerAdapter("fake-i2c-alert", adapter);
+    const MCP9808::Config config = {
+        .i2cBusDevice = "fake-i2c-alert",
+        .i2cAddress = 0x18,
+        .samplePeriod = std::chrono::milliseconds(1000),
+        .identified = false,
+        .alertChip = "",
+        .alertPin = 0,
+        .resolution = MCP9808::Resolution::C0_0625,
+        .oneShot = false
+    };
+    Application_state_t state {
+        .keepRunning = true,
+        .setAlarm = false,
+        .alarmTime = std::chrono::steady_clock::time_point::min(),
+        .tempThreshold = 28,
+        .mcpTemperature = Temperature(),
+        .mcpTemperatureRaw = Temperature(),
+        .pcfTime = {},
+        .gpioButtonShortPress = false,
+        .rotaryButtonShortPress = false,
+        .rotaryButtonLongPress = false
+    };
+    const uint16_t normal = 20 * 16;                 // 20 C
+    const uint16_t tripped = 0x4000 | (40 * 16);     // 40 C, above TUPPER
+    adapter->setRegister(0x18, 0x05, normal);
+
+    // every wait is bounded, a broken alert thread fails the benchmark instead of hanging it
+    const auto limit = std::chrono::seconds(1);
+    auto waitFor = [&limit](const std::function<bool()>& done) {
+        const auto deadline = std::chrono::steady_clock::now() + limit;
+        while (!done()) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    };
+
+    Simulated_Edge_Source alert;
+    std::thread alert_task(mcp9808_alert_thread, std::ref(state), config, std::ref(alert));
+    constexpr int trips = 50;
+    std::chrono::nanoseconds total(0);
+    std::chrono::nanoseconds worst(0);
+    bool ok = waitFor([&] { return adapter->getRegister(0x18, 0x02) == 28 * 16; }); // limits programmed
+    for (int i = 0; ok && i < 2 * trips; ++i) {
+        const bool alarm = (i % 2) == 0;
+        adapter->setRegister(0x18, 0x05, alarm ? tripped : normal);
+        const auto start = std::chrono::steady_clock::now();
+        alert.trigger();
+        ok = waitFor([&] { return state.setAlarm.load() == alarm; });
+        const auto latency = std::chrono::steady_clock::now() - start;
+        total += latency;
+        worst = std::max(worst, std::chrono::duration_cast<std::chrono::nanoseconds>(latency));
+    }
+    state.keepRunning.store(false);
+    alert_task.join();
+    if (!ok) {
+        std::cout << "MCP9808 alert to alarm: no alarm within " << limit.count() << " s" << std::endl;
+        return false;
+    }
+    std::cout << "MCP9808 alert to alarm: mean " << total.count() / (2 * trips) / 1000 << " us, worst "
+              << worst.count() / 1000 << " us; polled: up to " << config.samplePeriod.count() + 100 << " ms" << std::endl;
+    return true;
+}
+
+// Retry and recovery of I2C_Adapter against faults injected with
+// failNext() and failReopen(): every case checks the number of attempts,
+// recoveries and reopens, so a change of the policy logic shows up here
+static bool benchmark_i2c_retry() {
+    auto adapter = std::make_shared<Fake_I2C_Adapter>(1000000);
+    adapter->addDevice(0x18, 2);
+    adapter->setRegister(0x18, 0x01, 0x0200);
+    // short backoff, a deadline no case reaches: the outcome only depends on the counts
+    adapter->setRetryPolicy({4, std::chrono::microseconds(50), std::chrono::microseconds(100), std::chrono::seconds(1), 2});
+    I2CBus bus(adapter, 0x18);
+    bus.cacheRegister(0x01);
+    bool ok = true;
+    auto check = [&](const char *what, int errorExpected, uint64_t retries, uint64_t recoveries, unsigned int reopens,
+                     const std::function<void()>& call) {
+        adapter->resetStats();
+        const unsigned int reopensBefore = adapter->reopens();
+        int error = 0;
+        try {
+            call();
+        } catch (const I2C_Error& e) {
+            error = e.error();
+        }
+        const auto stats = adapter->stats();
+        const bool passed = error == errorExpected && stats.retries == retries && stats.recoveries == recoveries &&
+                            adapter->reopens() - reopensBefore == reopens;
+        std::cout << "I2C retry, " << what << ": " << (error ? strerror(error) : "ok") << ", " << stats.retries
+                  << " retries, " << stats.recoveries << " recoveries, " << adapter->reopens() - reopensBefore
+                  << " reopens" << (passed ? "" : "  <- unexpected") << std::endl;
+        ok = ok && passed;
+    };
+    auto read = [&] { bus.read16(0x05); };
+
+    adapter->failNext(EIO);
+    check("one EIO", 0, 1, 0, 0, read);
+    adapter->failNext(EIO, 3);
+    check("three EIO", 0, 3, 2, 2, read);
+    adapter->failNext(EIO, 4);
+    check("four EIO", EIO, 3, 2, 2, read);
+    adapter->failNext(ENXIO);
+    check("ENXIO", ENXIO, 0, 0, 0, read);
+    adapter->setNackError(EREMOTEIO);
+    check("bcm2835 NACK", EREMOTEIO, 0, 0, 0, [&] { I2CBus(adapter, 0x40).read8(0x00); });
+
+    // recovery drops the register shadow: the next read goes to the bus
+    bus.read16(0x01);
+    adapter->setRegister(0x18, 0x01, 0x0201);
+    adapter->failNext(EIO, 2);
+    check("recovery", 0, 2, 1, 1, read);
+    const bool reread = bus.read16(0x01) == 0x0201;
+    std::cout << "I2C retry, cache after recovery: " << (reread ? "dropped" : "stale  <- unexpected") << std::endl;
+    ok = ok && reread;
+
+    // the device file cannot be reopened: the call fails, the next one reopens
+    adapter->failNext(EIO, 2);
+    adapter->failReopen(2);
+    check("reopen failed", EBADF, 2, 1, 2, read);
+    check("reopen later", 0, 0, 0, 1, read);
+    return ok;
+}
+
+// The drivers on an adapter without plain I2C (SMBus transactions only)
+// read what they read over I2C_RDWR; with PEC on, a mismatch is retried and
+// transfers PEC cannot cover are refused
+static bool benchmark_i2c_smbus() {
+    auto setUp = [](const char *name, unsigned long strip) {
+        auto adapter = std::make_shared<Fake_I2C_Adapter>();
+        adapter->setFunctionality(adapter->functionality() & ~strip);
+        adapter->addDevice(0x18, 2);
+        adapter->setRegister(0x18, 0x05, 0xC1A4);  // 26.25 C, TCRIT flag set
+        adapter->setRegister(0x18, 0x06, 0x0054);
+        adapter->setRegister(0x18, 0x07, 0x0400);
+        adapter->addDevice(0x51, 1);
+        const uint8_t time[] = {0x45, 0x30, 0x12, 0x17, 0x05, 0x10, 0x26};  // 2026-10-17 12:30:45
+        for (uint8_t reg = 0x02; reg <= 0x08; ++reg) {
+            adapter->setRegister(0x51, reg, time[reg - 0x02]);
+        }
+        I2C_Bus_Manager::instance().registerAdapter(name, adapter);
+        return adapter;
+    };
+    auto rdwr = setUp("fake-i2c-rdwr", 0);
+    auto smbus = setUp("fake-i2c-smbus", I2C_FUNC_I2C | I2C_FUNC_NOSTART);
+    bool ok = true;
+
+    struct Sample {
+        int16_t temperature;
+        uint16_t manufacturer, device;
+        struct tm wall;
+    };
+    auto sample = [](const char *name, const std::shared_ptr<Fake_I2C_Adapter>& adapter, Sample& out) {
+        MCP9808 mcp9808(name, 0x18);
+        PCF8563 pcf8563(name, 0x51);
+        adapter->resetStats();
+        const uint64_t cycles = adapter->busCycles();
+        out = {mcp9808.getTemperature().raw(), mcp9808.getManufacturerID(), mcp9808.getDeviceID(),
+               pcf8563.getTimeAndDate()};
+        std::cout << "I2C SMBus, " << name << ": " << adapter->stats().ioctls << " ioctls, "
+                  << adapter->busCycles() - cycles << " bus cycles" << std::endl;
+    };
+    Sample viaRdwr{}, viaSmbus{};
+    sample("fake-i2c-rdwr", rdwr, viaRdwr);
+    sample("fake-i2c-smbus", smbus, viaSmbus);
+    const bool same = viaRdwr.temperature == viaSmbus.temperature && viaRdwr.manufacturer == viaSmbus.manufacturer &&
+                      viaRdwr.device == viaSmbus.device && viaRdwr.wall.tm_sec == viaSmbus.wall.tm_sec &&
+                      viaRdwr.wall.tm_min == viaSmbus.wall.tm_min && viaRdwr.wall.tm_hour == viaSmbus.wall.tm_hour &&
+                      viaRdwr.wall.tm_mday == viaSmbus.wall.tm_mday && viaRdwr.wall.tm_mon == viaSmbus.wall.tm_mon &&
+                      viaRdwr.wall.tm_year == viaSmbus.wall.tm_year;
+    std::cout << "I2C SMBus, readings: " << (same ? "same as I2C_RDWR" : "differ  <- unexpected") << std::endl;
+    ok = ok && same;
+
+    smbus->setRetryPolicy({4, std::chrono::microseconds(50), std::chrono::microseconds(100), std::chrono::seconds(1), 2});
+    I2CBus bus(smbus, 0x18);
+    bus.setPec(true);
+    smbus->resetStats();
+    smbus->failNext(EBADMSG);
+    const bool retried = bus.read16(0x05) == 0xC1A4 && smbus->stats().retries == 1;
+    std::cout << "I2C SMBus, PEC mismatch: " << smbus->stats().retries << " retries"
+              << (retried ? "" : "  <- unexpected") << std::endl;
+    ok = ok && retried;
+
+    I2CBus pcf8563Bus(smbus, 0x51);
+    pcf8563Bus.setPec(true);
+    bool refused = false;
+    try {
+        std::array<uint8_t, 7> time;
+        pcf8563Bus.readBlock(0x02, time);
+    } catch (const std::runtime_error&) {
+        refused = true;
+    }
+    std::cout << "I2C SMBus, 7-byte read with PEC: " << (refused ? "refused" : "sent unchecked  <- unexpected")
+              << std::endl;
+    return ok && refused;
+}
+
+// Filter results against values worked out by hand: the batched pipeline
+// of mcp9808_thread against the same samples one by one, integer rounding
+// of negative averages, the fixed-point exponential average settling on
+// int16_t, and the switching points of the hysteresis comparator
+static bool benchmark_filter_pipeline() {
+    bool ok = true;
+    auto check = [&](const char *what, bool passed) {
+        std::cout << "Filter pipeline, " << what << ": " << (passed ? "ok" : "mismatch  <- unexpected") << std::endl;
+        ok = ok && passed;
+    };
+    auto mcp9808Pipeline = [] {
+        Filter_Pipeline<int16_t> filter;
+        filter.add(std::make_unique<Median<int16_t, 5>>())
+              .add(std::make_unique<Moving_Average<int16_t, 4>>());
+        return filter;
+    };
+
+    // Q12.4 readings around 22 C with quantisation noise and spikes, both signs
+    std::array<int16_t, 240> samples;
+    uint32_t noise = 12345;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        noise = noise * 1103515245 + 12345;
+        samples[i] = static_cast<int16_t>((i < 120 ? 352 : -56) + static_cast<int>((noise >> 16) % 5) - 2 +
+                                          (i % 37 == 0 ? 400 : 0));
+    }
+    auto single = mcp9808Pipeline();
+    std::array<int16_t, samples.size()> expected;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        expected[i] = single.process(samples[i]);
+    }
+    bool same = true;
+    for (size_t batchSize : {size_t(3), size_t(4), size_t(8)}) {
+        auto batched = mcp9808Pipeline();
+        std::array<int16_t, samples.size()> output = samples;
+        for (size_t i = 0; i < output.size(); i += batchSize) {
+            batched.process(std::span<int16_t>(output).subspan(i, std::min(batchSize, output.size() - i)));
+        }
+        same = same && output == expected;
+    }
+    check("batches of 3, 4 and 8 against single samples", same);
+
+    using Four = std::array<int16_t, 4>;
+    auto average = [](Four samples) {
+        Moving_Average<int16_t, 4> filter;
+        filter.process(samples);
+        return samples;
+    };
+    // -3/2 -> -2, -5/3 -> -2, -7/4 -> -2; -2/4 and -3/4 -> -1, -1/4 -> 0
+    check("moving average, negative values", average({-1, -2, -2, -2}) == Four{-1, -2, -2, -2} &&
+                                             average({0, 0, 0, -3}) == Four{0, 0, 0, -1} &&
+                                             average({0, 0, 0, -2}) == Four{0, 0, 0, -1} &&
+                                             average({0, 0, 0, -1}) == Four{0, 0, 0, 0} &&
+                                             average({0, 0, 0, 2}) == Four{0, 0, 0, 1});
+
+    // from 0 towards a step, alpha 0.1: within 2% after 40 samples, the step
+    // itself after 200, also for a step of less than 1 / alpha
+    auto settle = [](int16_t step, int16_t& after40, int16_t& after200) {
+        Exponential_Average<int16_t> filter(0.1f);
+        int16_t sample = 0;
+        filter.process(std::span<int16_t>(&sample, 1));
+        for (int i = 1; i <= 200; ++i) {
+            sample = step;
+            filter.process(std::span<int16_t>(&sample, 1));
+            if (i == 40) {
+                after40 = sample;
+            }
+        }
+        after200 = sample;
+    };
+    int16_t up40, up200, down40, down200, small40, small200;
+    settle(100, up40, up200);
+    settle(-100, down40, down200);
+    settle(3, small40, small200);
+    check("exponential average, int16_t steps", up40 >= 98 && up200 == 100 && down40 == -up40 &&
+                                                down200 == -100 && small200 == 3);
+
+    // threshold 100, hysteresis 5: on above 100, off at 95 and below
+    Hysteresis_Comparator<int16_t> comparator(5);
+    const std::array<std::pair<int16_t, bool>, 8> steps = {{
+        {100, false}, {101, true}, {100, true}, {96, true}, {95, false}, {100, false}, {101, true}, {-20, false}
+    }};
+    bool switched = true;
+    for (const auto& [value, on] : steps) {
+        switched = switched && comparator.update(value, 100) == on;
+    }
+    check("hysteresis comparator, on and off points", switched);
+    return ok;
+}
+
+// The display loop must not allocate once it runs: frames of the widgets
+// of display_thread (Text_Format into stack buffers, then drawString),
+// present() and transmitFrame() on Fake_SPI_Bus, with the heap counted
+static bool benchmark_display_allocations() {
+    ST7789 display({"fake", 30000000, "", 0, 0}, std::make_unique<Fake_SPI_Bus>());
+    Numeric_Field temperature(display, 0, 16, {6, 1, true, " C"});
+    Numeric_Field tempThreshold(display, 240-(3)*16, 16, {3, 0, true, " "});
+    Clock_Field sysTime(display, 0, 230, Clock_Field::Show::Time);
+    Clock_Field sysDate(display, 160, 230, Clock_Field::Show::Date, 9);
+    constexpr int frames = 1000;
+    auto frame = [&](int i) {
+        temperature.setColors(i % 7 == 0 ? ST7789::Colors::RED : ST7789::Colors::WHITE, ST7789::Colors::BLACK);
+        temperature.setScaled(Temperature::fromRaw(static_cast<int16_t>(300 + i % 50)).scaled(1));
+        tempThreshold.setScaled(i % 60);
+        const time_t now = 1700000000 + i * 3607;
+        struct tm local;
+        localtime_r(&now, &local);
+        sysTime.setTime(local);
+        sysDate.setTime(local);
+        display.present();
+        display.transmitFrame(std::chrono::milliseconds(0));
+    };
+    frame(0);   // glyphs of both colours expanded into the cache, time zone loaded
+    frame(1);
+    const uint64_t before = allocations.load();
+    for (int i = 2; i < frames; ++i) {
+        frame(i);
+    }
+    const uint64_t counted = allocations.load() - before;
+    std::cout << "Display loop: " << counted << " allocations in " << frames - 2 << " frames, "
+              << display.pipelineStats().transmitted << " transmitted" << std::endl;
+    return counted == 0;
+}
+
+int main(int argc, char *argv[]) {
+    const struct {
+        const char *name;
+        bool (*run)();
+    } benchmarks[] = {
+        {"i2c_async", benchmark_i2c_async},
+        {"i2c_sample", benchmark_i2c_sample},
+        {"mcp9808_alert", benchmark_mcp9808_alert},
+        {"i2c_retry", benchmark_i2c_retry},
+        {"i2c_smbus", benchmark_i2c_smbus},
+        {"filter_pipeline", benchmark_filter_pipeline},
+        {"display_allocations", benchmark_display_allocations},
+    };
+    int status = 0;
+    for (const auto& benchmark : benchmarks) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; ++i) {
+            selected = selected || std::strcmp(argv[i], benchmark.name) == 0;
+        }
+        if (selected) {
+            try {
+                if (!benchmark.run()) {
+                    std::cerr << benchmark.name << ": FAILED" << std::endl;
+                    status = 1;
+                }
+            } catch (const std::exception &e) {
+                std::cerr << benchmark.name << ": " << e.what() << std::endl;
+                status = 1;
+            }
+        }
+    }
+    return status;
+}
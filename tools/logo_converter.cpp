@@ -0,0 +1,117 @@
+// Host tool: converts a binary PPM (P6) image into the run-length encoded
+// RGB565 logo compiled into the application, see RLE565.hpp.
+//
+// usage: logo_converter image.ppm > src/logo.cpp
+// (or "make logo", which builds and runs it)
+
+#include "RLE565.hpp"
+#include "st7789v2.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static std::vector<uint16_t> readPPM(const std::string &path, int &width, int &height) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Failed to open image: " + path);
+    }
+    // header: magic, width, height, maxval, with optional comments
+    auto token = [&in]() {
+        std::string t;
+        while (in >> t && t[0] == '#') {
+            std::getline(in, t);
+        }
+        return t;
+    };
+    if (token() != "P6") {
+        throw std::runtime_error("Not a binary PPM (P6) image: " + path);
+    }
+    width = std::stoi(token());
+    height = std::stoi(token());
+    if (std::stoi(token()) != 255) {
+        throw std::runtime_error("Only 8-bit PPM images are supported");
+    }
+    in.get(); // single whitespace before the raster
+
+    std::vector<uint16_t> pixels(static_cast<size_t>(width) * height);
+    for (auto &pixel : pixels) {
+        uint8_t rgb[3];
+        if (!in.read(reinterpret_cast<char *>(rgb), sizeof(rgb))) {
+            throw std::runtime_error("Truncated image: " + path);
+        }
+        pixel = static_cast<uint16_t>(((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3));
+    }
+    return pixels;
+}
+
+static std::vector<uint8_t> encode(const std::vector<uint16_t> &pixels) {
+    std::vector<uint8_t> out;
+    auto put = [&out](uint16_t pixel) { // big-endian, the panel wire order
+        out.push_back(static_cast<uint8_t>(pixel >> 8));
+        out.push_back(static_cast<uint8_t>(pixel & 0xFF));
+    };
+    size_t i = 0;
+    const size_t n = pixels.size();
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < RLE565::maxPacket && pixels[i + run] == pixels[i]) {
+            run++;
+        }
+        if (run >= 2) {
+            out.push_back(static_cast<uint8_t>(run - 1));
+            put(pixels[i]);
+            i += run;
+            continue;
+        }
+        // literal packet up to the next pair of equal pixels
+        size_t count = 1;
+        while (i + count < n && count < RLE565::maxPacket &&
+               !(i + count + 1 < n && pixels[i + count] == pixels[i + count + 1])) {
+            count++;
+        }
+        out.push_back(static_cast<uint8_t>(0x7F + count));
+        for (size_t k = 0; k < count; ++k) {
+            put(pixels[i + k]);
+        }
+        i += count;
+    }
+    return out;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        std::cerr << "usage: " << argv[0] << " image.ppm > logo.cpp" << std::endl;
+        return 1;
+    }
+    try {
+        int width = 0;
+        int height = 0;
+        std::vector<uint16_t> pixels = readPPM(argv[1], width, height);
+        if (width != ST7789::WIDTH || height != ST7789::HEIGHT) {
+            throw std::runtime_error("Logo must be " + std::to_string(ST7789::WIDTH) + "x" + std::to_string(ST7789::HEIGHT));
+        }
+        std::vector<uint8_t> rle = encode(pixels);
+
+        std::cout << "// Generated by tools/logo_converter from " << argv[1] << ", do not edit.\n";
+        std::cout << "// " << width << "x" << height << " RGB565, " << rle.size() << " bytes run-length encoded (RLE565.hpp)\n";
+        std::cout << "#include \"st7789v2.hpp\"\n#include \"RLE565.hpp\"\n\n";
+        std::cout << "constexpr uint8_t ST7789::logo_rle[] = {";
+        for (size_t i = 0; i < rle.size(); ++i) {
+            std::cout << ((i % 16 == 0) ? "\n    " : " ");
+            std::cout << "0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(rle[i]) << ",";
+        }
+        std::cout << std::dec << "\n};\n\n";
+        std::cout << "constexpr size_t ST7789::logo_rle_size = sizeof(ST7789::logo_rle);\n\n";
+        std::cout << "static_assert(RLE565::decodedLength(ST7789::logo_rle, ST7789::logo_rle_size) == ST7789::WIDTH * ST7789::HEIGHT,\n";
+        std::cout << "              \"logo does not cover the panel\");\n";
+    } catch (const std::exception &e) {
+        std::cerr << "logo_converter: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}